@@ -2,8 +2,11 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <iostream>
+#include <limits>
 
 #include <babylon/core/delegates/delegate.h>
+#include <babylon/misc/observable.h>
 
 using ns  = uint64_t;
 using rep = uint32_t;
@@ -175,3 +178,160 @@ TEST(BenchmarkDelegates, delegate)
 {
   Benchmark::Run();
 }
+
+class ObservableBenchmark {
+
+public:
+  static void Run()
+  {
+    // Per frame observables have a handful of observers
+    for (size_t observer_count : {1u, 4u, 16u}) {
+      std::cout << observer_count << " observers" << std::endl;
+      // All match, half match, none match
+      for (int mask : {0x03, 0x01, 0x04}) {
+        Compare(observer_count, mask);
+      }
+    }
+    CompareAddOnce();
+  } // Run
+
+private:
+  using Observer   = BABYLON::Observer<int>;
+  using Observable = BABYLON::Observable<int>;
+
+  static constexpr rep notify_count = 100000;
+  static constexpr rep round_count  = 10;
+
+  /**
+   * @brief The observer list and notification loop used before the observer entries: the mask is
+   * read through the shared pointer of every observer.
+   */
+  struct SharedPtrObservable {
+    std::vector<Observer::Ptr> observers;
+    BABYLON::EventState state{0};
+
+    bool notifyObservers(int* eventData, int mask)
+    {
+      if (observers.empty()) {
+        return true;
+      }
+      state.mask              = mask;
+      state.target            = nullptr;
+      state.currentTarget     = nullptr;
+      state.skipNextObservers = false;
+      state.lastReturnValue   = eventData;
+      state.userInfo          = nullptr;
+      for (const auto& obs : observers) {
+        if (obs->_willBeUnregistered) {
+          continue;
+        }
+        if (obs->mask & mask) {
+          obs->callback(eventData, state);
+        }
+        if (state.skipNextObservers) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }; // SharedPtrObservable
+
+  static void Compare(size_t observer_count, int mask)
+  {
+    int counter = 0;
+    SharedPtrObservable before;
+    Observable after;
+    for (size_t i = 0; i < observer_count; ++i) {
+      // Even observers listen to 0x01, odd ones to 0x02
+      const int observer_mask = (i % 2 == 0) ? 0x01 : 0x02;
+      auto callback = [&counter](int* value, BABYLON::EventState&) {
+        counter += *value;
+      };
+      before.observers.emplace_back(
+        std::make_shared<Observer>(callback, observer_mask, nullptr));
+      after.add(callback, observer_mask);
+    }
+
+    int value                         = 1;
+    const auto [beforeTime, afterTime] = MeasureBest(
+      [&]() {
+        for (rep i = 0; i < notify_count; ++i)
+          before.notifyObservers(&value, mask);
+      },
+      [&]() {
+        for (rep i = 0; i < notify_count; ++i)
+          after.notifyObservers(&value, mask);
+      });
+    // Both lists called the same observers
+    EXPECT_EQ(counter % 2, 0);
+    Report(mask == 0x03 ? "  all match" : mask == 0x01 ? "  half match" :
+                                                         "  none match",
+           beforeTime, afterTime);
+  } // Compare
+
+  static void CompareAddOnce()
+  {
+    int counter = 0, value = 1;
+    auto callback = [&counter](int* v, BABYLON::EventState&) { counter += *v; };
+
+    // Before: erasing an observer from the vector of shared pointers
+    SharedPtrObservable before;
+    Observable after;
+    const auto [beforeTime, afterTime] = MeasureBest(
+      [&]() {
+        for (rep i = 0; i < notify_count; ++i) {
+          auto observer = std::make_shared<Observer>(callback, -1, nullptr);
+          before.observers.emplace_back(observer);
+          before.notifyObservers(&value, -1);
+          before.observers.erase(std::find(before.observers.begin(),
+                                           before.observers.end(), observer));
+        }
+      },
+      [&]() {
+        for (rep i = 0; i < notify_count; ++i) {
+          after.addOnce(callback);
+          after.notifyObservers(&value);
+        }
+      });
+    EXPECT_EQ(counter, static_cast<int>(2 * round_count * notify_count));
+    EXPECT_FALSE(after.hasObservers());
+    std::cout << "addOnce" << std::endl;
+    Report("  add, notify and remove", beforeTime, afterTime);
+  } // CompareAddOnce
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before)
+        .count());
+  } // Measure
+
+  // Alternates the two measures and keeps the fastest round of each
+  template <typename Before, typename After>
+  static std::pair<ns, ns> MeasureBest(Before&& before, After&& after)
+  {
+    ns beforeTime = std::numeric_limits<ns>::max(), afterTime = beforeTime;
+    for (rep round = 0; round < round_count; ++round) {
+      beforeTime = std::min(beforeTime, Measure(before));
+      afterTime  = std::min(afterTime, Measure(after));
+    }
+    return {beforeTime, afterTime};
+  } // MeasureBest
+
+  static void Report(const char* name, ns beforeTime, ns afterTime)
+  {
+    std::cout << name << ": " << 1.0 * beforeTime / notify_count << " ns vs. "
+              << 1.0 * afterTime / notify_count << " ns per notification, gain "
+              << 1.0 * beforeTime / afterTime << std::endl;
+  } // Report
+
+}; // end of class ObservableBenchmark
+
+TEST(BenchmarkDelegates, observable)
+{
+  ObservableBenchmark::Run();
+}
@@ -0,0 +1,115 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include <babylon/core/logging.h>
+
+using ns = uint64_t;
+
+class LoggerBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    auto& logger = LoggerInstance();
+    std::cout << frame_count << " frames, " << messages_per_frame << " messages per frame"
+              << std::endl;
+
+    Report("  no listener", MeasureFrames(1));
+
+    auto listener = SA::delegate<void(const LogMessage&)>::create<&WriteToSink>();
+    logger.registerLogMessageListener(LogLevels::LEVEL_INFO, listener);
+    for (const size_t threadCount : {1u, 4u}) {
+      std::cout << threadCount << " logging thread(s)" << std::endl;
+      Report("  synchronous", MeasureFrames(threadCount));
+
+      logger.startAsync(4096);
+      const auto duration = MeasureFrames(threadCount);
+      const auto flush    = Measure([&]() { logger.flush(); });
+      logger.stopAsync();
+      Report("  asynchronous", duration);
+      Report("  asynchronous flush", flush);
+    }
+    logger.unregisterLogMessageListener(listener);
+
+    const auto statistics = logger.statistics();
+    std::cout << "  written: " << statistics.written << ", dropped: " << statistics.dropped
+              << std::endl;
+  } // Run
+
+private:
+  static constexpr size_t frame_count        = 100;
+  static constexpr size_t messages_per_frame = 200;
+
+  /**
+   * @brief A listener formatting the message like a console or file sink.
+   */
+  static void WriteToSink(const BABYLON::LogMessage& logMessage)
+  {
+    static std::ostringstream sink;
+    sink << logMessage << '\n';
+    if (sink.tellp() > (1 << 20)) {
+      sink.str("");
+    }
+  }
+
+  /**
+   * @brief Returns the average frame time, each frame does some work and logs from the given
+   * number of threads.
+   */
+  static ns MeasureFrames(size_t threadCount)
+  {
+    return Measure([threadCount]() {
+             for (size_t frame = 0; frame < frame_count; ++frame) {
+               std::vector<std::thread> threads;
+               for (size_t thread = 1; thread < threadCount; ++thread) {
+                 threads.emplace_back([frame]() { Frame(frame); });
+               }
+               Frame(frame);
+               for (auto& thread : threads) {
+                 thread.join();
+               }
+             }
+           })
+           / frame_count;
+  }
+
+  static void Frame(size_t frame)
+  {
+    float work = 0.f;
+    for (size_t message = 0; message < messages_per_frame; ++message) {
+      for (size_t i = 0; i < 500; ++i) {
+        work += static_cast<float>(i % 7) * 0.5f;
+      }
+      BABYLON_LOGF_INFO("LoggerBenchmark", "frame %zu message %zu work %f", frame, message,
+                        static_cast<double>(work));
+    }
+    EXPECT_GT(work, 0.f);
+  }
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration)
+  {
+    std::cout << name << ": " << static_cast<double>(duration) / 1000000.0 << " ms" << std::endl;
+  }
+
+}; // end of class LoggerBenchmark
+
+TEST(BenchmarkLogger, frameTime)
+{
+  LoggerBenchmark::Run();
+}
@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "../../tests/test_utils.h"
+
+#include <babylon/babylon_common.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+using ns = uint64_t;
+
+class BabylonBinaryFileBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    for (const auto* sceneName : {"skull.babylon", "candle.babylon", "morph.babylon"}) {
+      const auto rootUrl = assets_folder() + "scenes/";
+      MemoryMappedFile file;
+      if (!file.open(rootUrl + sceneName)) {
+        std::cout << sceneName << ": not found" << std::endl;
+        continue;
+      }
+      const std::string jsonData(file.view());
+      BabylonFileData fileData;
+      BabylonFileReader::Parse(jsonData, fileData);
+      const auto binaryData = BabylonBinaryFile::Serialize(fileData);
+      std::cout << sceneName << ": " << jsonData.size() << " bytes JSON, " << binaryData.size()
+                << " bytes binary" << std::endl;
+
+      // Reading the file only
+      Report("  parse JSON", Measure([&jsonData]() {
+               BabylonFileData data;
+               BabylonFileReader::Parse(jsonData, data);
+             }));
+      Report("  parse binary", Measure([&binaryData]() {
+               BabylonFileData data;
+               BabylonBinaryFile::Parse(binaryData, data);
+             }));
+
+      // Creating the meshes
+      BabylonFileLoader jsonLoader;
+      BabylonBinaryFileLoader binaryLoader;
+      Report("  import JSON", Import(jsonLoader, jsonData, rootUrl));
+      Report("  import binary", Import(binaryLoader, binaryData, rootUrl));
+    }
+  } // Run
+
+private:
+  static ns Import(const BABYLON::BabylonFileLoader& loader, const std::string& data,
+                   const std::string& rootUrl)
+  {
+    using namespace BABYLON;
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+    std::vector<AbstractMeshPtr> meshes;
+    std::vector<IParticleSystemPtr> particleSystems;
+    std::vector<SkeletonPtr> skeletons;
+    const auto duration = Measure([&]() {
+      EXPECT_TRUE(
+        loader.importMesh({}, scene.get(), data, rootUrl, meshes, particleSystems, skeletons));
+    });
+    EXPECT_FALSE(meshes.empty());
+    return duration;
+  }
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration)
+  {
+    std::cout << name << ": " << static_cast<double>(duration) / 1000000.0 << " ms" << std::endl;
+  }
+
+}; // end of class BabylonBinaryFileBenchmark
+
+TEST(BenchmarkBabylonBinaryFile, loadSampleScenes)
+{
+  BabylonBinaryFileBenchmark::Run();
+}
@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#include "../../tests/test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/obj/obj_file_loader.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+using ns = uint64_t;
+
+class OBJFileLoaderBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+
+    const auto threshold = OBJFileLoader::PARALLEL_PARSING_THRESHOLD;
+    for (size_t size : {32u, 128u, 512u, 1024u}) {
+      const auto data      = GenerateGrid(size);
+      const auto faces     = (size - 1) * (size - 1);
+      const auto megabytes = static_cast<double>(data.size()) / (1024.0 * 1024.0);
+      std::cout << "grid " << size << "x" << size << ": " << faces << " quads, " << megabytes
+                << " MB" << std::endl;
+
+      OBJFileLoader::PARALLEL_PARSING_THRESHOLD = std::numeric_limits<size_t>::max();
+      OBJFileLoader sequentialLoader;
+      const auto sequential = Measure([&]() {
+        const auto meshes = sequentialLoader.importMesh({}, scene.get(), data);
+        const auto total  = meshes.empty() ? 0 : meshes[0]->getTotalVertices();
+        for (const auto& mesh : meshes) {
+          mesh->dispose();
+        }
+        return total;
+      });
+      Report("  tokenizer", sequential, megabytes);
+
+      OBJFileLoader::PARALLEL_PARSING_THRESHOLD = 1;
+      OBJFileLoader parallelLoader;
+      const auto parallel = Measure([&]() {
+        const auto meshes = parallelLoader.importMesh({}, scene.get(), data);
+        const auto total  = meshes.empty() ? 0 : meshes[0]->getTotalVertices();
+        for (const auto& mesh : meshes) {
+          mesh->dispose();
+        }
+        return total;
+      });
+      Report("  parallel tokenizer", parallel, megabytes);
+    }
+    OBJFileLoader::PARALLEL_PARSING_THRESHOLD = threshold;
+  } // Run
+
+private:
+  static std::string GenerateGrid(size_t size)
+  {
+    std::ostringstream obj;
+    obj << "o grid\n";
+    for (size_t y = 0; y < size; ++y) {
+      for (size_t x = 0; x < size; ++x) {
+        obj << "v " << x * 0.25f << " " << y * 0.25f << " " << ((x * y) % 7) * 0.125f << "\n";
+        obj << "vt " << static_cast<float>(x) / size << " " << static_cast<float>(y) / size
+            << "\n";
+      }
+    }
+    obj << "vn 0 0 1\n";
+    for (size_t y = 0; y + 1 < size; ++y) {
+      for (size_t x = 0; x + 1 < size; ++x) {
+        const auto a = y * size + x + 1, b = a + 1, c = a + size + 1, d = a + size;
+        obj << "f " << a << "/" << a << "/1 " << b << "/" << b << "/1 " << c << "/" << c << "/1 "
+            << d << "/" << d << "/1\n";
+      }
+    }
+    return obj.str();
+  }
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    const auto result = function();
+    const auto after  = std::chrono::high_resolution_clock::now();
+    EXPECT_GT(result, 0ull);
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration, double megabytes)
+  {
+    const auto milliseconds = static_cast<double>(duration) / 1000000.0;
+    std::cout << name << ": " << milliseconds << " ms, " << megabytes / (milliseconds / 1000.0)
+              << " MB/s" << std::endl;
+  }
+
+}; // end of class OBJFileLoaderBenchmark
+
+TEST(BenchmarkOBJFileLoader, parseGrid)
+{
+  OBJFileLoaderBenchmark::Run();
+}
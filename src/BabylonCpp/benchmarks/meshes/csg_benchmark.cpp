@@ -0,0 +1,61 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "../../tests/test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+using ns = uint64_t;
+
+class CSGBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+
+    BoxOptions boxOptions;
+    boxOptions.size   = 1.2f;
+    auto box          = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+    box->position().x = 0.5f;
+
+    std::cout << "Sphere minus box" << std::endl;
+    for (unsigned int segments : {8u, 16u, 32u, 64u, 96u}) {
+      SphereOptions sphereOptions;
+      sphereOptions.segments = segments;
+      sphereOptions.diameter = 2.f;
+      auto sphere            = MeshBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+
+      const auto before = std::chrono::high_resolution_clock::now();
+      auto sphereCSG    = CSG::CSG::FromMesh(sphere);
+      auto boxCSG       = CSG::CSG::FromMesh(box);
+      auto result       = sphereCSG->subtract(boxCSG);
+      auto mesh         = result.toMesh("result", nullptr, scene.get());
+      const auto after  = std::chrono::high_resolution_clock::now();
+      const auto duration
+        = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+
+      std::cout << "segments " << segments << ": " << sphere->getTotalIndices() / 3
+                << " triangles -> " << mesh->getTotalIndices() / 3 << " triangles in "
+                << static_cast<ns>(duration) / 1000000.0 << " ms" << std::endl;
+
+      sphere->dispose();
+      mesh->dispose();
+    }
+  } // Run
+
+}; // end of class CSGBenchmark
+
+TEST(BenchmarkCSG, sphereMinusBox)
+{
+  CSGBenchmark::Run();
+}
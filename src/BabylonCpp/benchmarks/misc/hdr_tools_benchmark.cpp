@@ -0,0 +1,125 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#include <babylon/babylon_common.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
+#include <babylon/misc/highdynamicrange/hdr_tools.h>
+#include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
+
+using ns = uint64_t;
+
+class HDRToolsBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    // The HDR files of the assets, or a generated 4K panorama if there are none
+    std::vector<std::pair<std::string, Uint8Array>> files;
+    const auto texturesFolder = assets_folder() + "textures";
+    if (std::filesystem::is_directory(texturesFolder)) {
+      for (const auto& entry : std::filesystem::recursive_directory_iterator(texturesFolder)) {
+        if (entry.path().extension() == ".hdr") {
+          MemoryMappedFile file;
+          if (file.open(entry.path().string())) {
+            const auto view = file.view();
+            files.emplace_back(entry.path().filename().string(),
+                               Uint8Array(view.begin(), view.end()));
+          }
+        }
+      }
+    }
+    if (files.empty()) {
+      files.emplace_back("generated 4096x2048", CreatePanorama(4096, 2048));
+    }
+
+    for (const auto& [name, file] : files) {
+      std::cout << name << std::endl;
+
+      Float32Array pixels;
+      HDRInfo hdrInfo;
+      Report("  RGBE decode", Measure([&]() {
+               hdrInfo = HDRTools::RGBE_ReadHeader(file);
+               pixels  = HDRTools::RGBE_ReadPixels(file, hdrInfo);
+             }));
+
+      CubeMapInfo cubeMap;
+      Report("  panorama to 512 cubemap", Measure([&]() {
+               cubeMap = PanoramaToCubeMapTools::ConvertPanoramaToCubemap(
+                 pixels, hdrInfo.width, hdrInfo.height, 512);
+             }));
+
+      SphericalPolynomialPtr polynomial;
+      Report("  spherical polynomial", Measure([&]() {
+               polynomial
+                 = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(cubeMap);
+             }));
+      EXPECT_TRUE(polynomial != nullptr);
+
+      Report("  end to end", Measure([&]() {
+               const auto data = HDRTools::GetCubeMapTextureData(file, 512);
+               CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(data);
+             }));
+    }
+    std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)"
+              << std::endl;
+  } // Run
+
+private:
+  /**
+   * @brief Generates a run length encoded RGBE panorama with smooth gradients.
+   */
+  static BABYLON::Uint8Array CreatePanorama(size_t width, size_t height)
+  {
+    const auto header = "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " + std::to_string(height)
+                        + " +X " + std::to_string(width) + "\n";
+    BABYLON::Uint8Array file(header.begin(), header.end());
+    std::vector<uint8_t> channel(width);
+    for (size_t y = 0; y < height; ++y) {
+      file.insert(file.end(), {2, 2, static_cast<uint8_t>(width >> 8),
+                               static_cast<uint8_t>(width & 0xff)});
+      for (size_t c = 0; c < 4; ++c) {
+        for (size_t x = 0; x < width; ++x) {
+          channel[x] = c == 3 ? static_cast<uint8_t>(120 + (y * 16) / height) :
+                                static_cast<uint8_t>(128 + ((x * (c + 1) + y) & 0x7f));
+        }
+        // Literal chunks of at most 127 bytes
+        for (size_t x = 0; x < width; x += 127) {
+          const auto count = std::min<size_t>(127, width - x);
+          file.emplace_back(static_cast<uint8_t>(count));
+          file.insert(file.end(), channel.begin() + static_cast<std::ptrdiff_t>(x),
+                      channel.begin() + static_cast<std::ptrdiff_t>(x + count));
+        }
+      }
+    }
+    return file;
+  }
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration)
+  {
+    std::cout << name << ": " << static_cast<double>(duration) / 1000000.0 << " ms" << std::endl;
+  }
+
+}; // end of class HDRToolsBenchmark
+
+TEST(BenchmarkHDRTools, environmentPipeline)
+{
+  HDRToolsBenchmark::Run();
+}
@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <babylon/babylon_common.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/misc/file_tools.h>
+#include <babylon/misc/image_decoder.h>
+
+using ns = uint64_t;
+
+class ImageDecoderBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    // A scene with 200 textures
+    std::vector<ArrayBuffer> buffers;
+    while (buffers.size() < 200) {
+      for (const auto* textureName : {"albedo.png", "amiga.jpg", "crate.png", "earth.jpg",
+                                      "floor.png", "grass.jpg", "co.png", "fur.jpg"}) {
+        MemoryMappedFile file;
+        if (!file.open(assets_folder() + "textures/" + textureName)) {
+          std::cout << textureName << ": not found" << std::endl;
+          return;
+        }
+        const auto view = file.view();
+        buffers.emplace_back(view.begin(), view.end());
+      }
+    }
+
+    size_t pixels         = 0;
+    const auto sequential = Measure([&buffers, &pixels]() {
+      for (const auto& buffer : buffers) {
+        const auto image = FileTools::ArrayBufferToImage(buffer, true);
+        pixels += static_cast<size_t>(image.width * image.height);
+      }
+    });
+    std::cout << buffers.size() << " images, " << pixels / 1000000 << " Mpixels" << std::endl;
+    Report("  sequential", sequential);
+
+    for (size_t workers : {2u, 4u, 8u, 16u}) {
+      const auto parallel = Measure([&buffers, workers]() {
+        const auto images = ImageDecoder::DecodeBatch(buffers, true, workers);
+        EXPECT_EQ(images.size(), buffers.size());
+      });
+      std::cout << "  " << workers << " workers";
+      Report("", parallel);
+    }
+    std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)"
+              << std::endl;
+  } // Run
+
+private:
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration)
+  {
+    std::cout << name << ": " << static_cast<double>(duration) / 1000000.0 << " ms" << std::endl;
+  }
+
+}; // end of class ImageDecoderBenchmark
+
+TEST(BenchmarkImageDecoder, decodeSceneTextures)
+{
+  ImageDecoderBenchmark::Run();
+}
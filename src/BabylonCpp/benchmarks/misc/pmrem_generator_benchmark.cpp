@@ -0,0 +1,71 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <babylon/misc/highdynamicrange/pmrem_generator.h>
+
+using ns = uint64_t;
+
+class PMREMGeneratorBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    for (size_t size : {32u, 64u, 128u}) {
+      // Smooth gradients with a few bright texels
+      std::vector<Float32Array> input(6, Float32Array(size * size * 3));
+      for (size_t face = 0; face < 6; ++face) {
+        for (size_t i = 0; i < size * size; ++i) {
+          input[face][i * 3 + 0] = static_cast<float>(face) / 6.f;
+          input[face][i * 3 + 1] = static_cast<float>(i % size) / static_cast<float>(size);
+          input[face][i * 3 + 2] = (i % 97 == 0) ? 20.f : 0.5f;
+        }
+      }
+      std::cout << size << "x" << size << " cube map, 8 mip levels" << std::endl;
+
+      for (const auto importanceSampling : {false, true}) {
+        for (const size_t workerCount : {1u, 0u}) {
+          const auto duration = Measure([&]() {
+            PMREMGenerator<Float32Array> generator(input, static_cast<int>(size),
+                                                   static_cast<int>(size), 8, 3, true, 2048.f,
+                                                   0.25f, false, true);
+            generator.importanceSampling = importanceSampling;
+            generator.workerCount        = workerCount;
+            EXPECT_FALSE(generator.filterCubeMap().empty());
+          });
+          std::cout << (importanceSampling ? "  GGX 64 samples" : "  cosine power exhaustive")
+                    << (workerCount == 1 ? ", 1 thread" : ", all threads");
+          Report("", duration);
+        }
+      }
+    }
+    std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)"
+              << std::endl;
+  } // Run
+
+private:
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static void Report(const char* name, ns duration)
+  {
+    std::cout << name << ": " << static_cast<double>(duration) / 1000000.0 << " ms" << std::endl;
+  }
+
+}; // end of class PMREMGeneratorBenchmark
+
+TEST(BenchmarkPMREMGenerator, filterCubeMap)
+{
+  PMREMGeneratorBenchmark::Run();
+}
@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "../../tests/test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+
+using ns = uint64_t;
+
+class MorphTargetManagerBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+
+    // About 30k vertices, like a face, with 50 expressions moving 5% of them and 2 dense targets
+    GroundOptions groundOptions;
+    groundOptions.subdivisions = 172;
+    auto face                  = MeshBuilder::CreateGround("face", groundOptions, scene.get());
+    const auto basePositions   = face->getVerticesData(VertexBuffer::PositionKind);
+    const auto vertexCount     = basePositions.size() / 3;
+    auto manager               = MorphTargetManager::New(scene.get());
+    std::vector<Float32Array> targetPositions;
+    for (size_t target = 0; target < 52; ++target) {
+      auto positions    = basePositions;
+      const auto dense  = target >= 50;
+      const auto first  = dense ? 0 : target * vertexCount / 50;
+      const auto length = dense ? vertexCount : vertexCount / 20;
+      for (size_t vertex = first; vertex < std::min(first + length, vertexCount); ++vertex) {
+        positions[vertex * 3 + 1] += std::sin(static_cast<float>(vertex + target));
+      }
+      auto morphTarget = MorphTarget::New("target" + std::to_string(target), 0.f, scene.get());
+      morphTarget->setPositions(positions);
+      manager->addTarget(morphTarget);
+      targetPositions.emplace_back(std::move(positions));
+    }
+    manager->enableCpuMorphing = true;
+    face->morphTargetManager   = manager;
+
+    std::cout << vertexCount << " vertices, " << manager->numTargets() << " targets" << std::endl;
+    const size_t frameCount = 100;
+    for (size_t activeCount : {52u, 26u, 10u}) {
+      // Naive blend of the full arrays, the zero weights included
+      Float32Array output(basePositions.size());
+      auto before = std::chrono::high_resolution_clock::now();
+      for (size_t frame = 0; frame < frameCount; ++frame) {
+        output = basePositions;
+        for (size_t target = 0; target < targetPositions.size(); ++target) {
+          const auto weight     = target < activeCount ? 0.5f + 0.001f * frame : 0.f;
+          const auto& positions = targetPositions[target];
+          for (size_t index = 0; index < output.size(); ++index) {
+            output[index] += weight * (positions[index] - basePositions[index]);
+          }
+        }
+      }
+      auto after = std::chrono::high_resolution_clock::now();
+      const auto full
+        = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+
+      // Sparse deltas, zero weights skipped, written in the position buffer
+      before = std::chrono::high_resolution_clock::now();
+      for (size_t frame = 0; frame < frameCount; ++frame) {
+        for (size_t target = 0; target < manager->numTargets(); ++target) {
+          manager->getTarget(target)->influence
+            = target < activeCount ? 0.5f + 0.001f * frame : 0.f;
+        }
+        manager->_updateCpuMorphing();
+      }
+      after = std::chrono::high_resolution_clock::now();
+      const auto blended
+        = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+
+      std::cout << activeCount << " active targets: full arrays "
+                << static_cast<ns>(full) / (frameCount * 1000000.0) << " ms/frame, sparse blend "
+                << static_cast<ns>(blended) / (frameCount * 1000000.0) << " ms/frame"
+                << std::endl;
+    }
+  } // Run
+
+}; // end of class MorphTargetManagerBenchmark
+
+TEST(BenchmarkMorphTargetManager, cpuMorphing)
+{
+  MorphTargetManagerBenchmark::Run();
+}
@@ -10,6 +10,7 @@
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/core/profiling/memory_tracker.h>
 
 using json = nlohmann::json;
 
@@ -638,6 +639,11 @@ private:
    */
   std::vector<IAnimationKey> _keys;
 
+  /**
+   * Accounts the key frames set with setKeys() in the animations memory
+   */
+  TrackedMemory _keysMemory{MemoryCategory::Animations};
+
   /**
    * Stores the easing function of the animation
    */
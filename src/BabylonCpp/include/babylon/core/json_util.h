@@ -1,7 +1,12 @@
 #ifndef BABYLON_CORE_JSON_UTIL_H
 #define BABYLON_CORE_JSON_UTIL_H
 
+#include <cstdint>
+#include <cstring>
 #include <nlohmann/json.hpp>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 using json = nlohmann::json;
 
@@ -57,17 +62,142 @@ inline T get_string(const json& j, const std::string& key,
   }
 }
 
+/**
+ * @brief Large numeric arrays (vertex data) kept next to a json document instead of a json value per
+ * element. The document holds an empty array in place of each of them and the elements are stored
+ * here, keyed by that json node. get_array reads them from the table made current for the thread
+ * with packed_arrays_scope.
+ */
+struct packed_arrays {
+  /**
+   * @brief Elements read in place from a buffer owned by someone else (4 bytes per element).
+   */
+  struct view {
+    bool isFloat     = true;
+    const char* data = nullptr;
+    size_t size      = 0;
+  };
+
+  std::unordered_map<const json*, std::vector<float>> floats;
+  std::unordered_map<const json*, std::vector<uint32_t>> indices;
+  std::unordered_map<const json*, view> views;
+
+  void clear()
+  {
+    floats.clear();
+    indices.clear();
+    views.clear();
+  }
+
+  void erase(const json* node)
+  {
+    floats.erase(node);
+    indices.erase(node);
+    views.erase(node);
+  }
+}; // end of struct packed_arrays
+
+inline const packed_arrays*& current_packed_arrays()
+{
+  static thread_local const packed_arrays* arrays = nullptr;
+  return arrays;
+}
+
+/**
+ * @brief Makes a packed arrays table current for the calling thread during its lifetime.
+ */
+class packed_arrays_scope {
+
+public:
+  explicit packed_arrays_scope(const packed_arrays* arrays) : _previous{current_packed_arrays()}
+  {
+    current_packed_arrays() = arrays;
+  }
+  packed_arrays_scope(const packed_arrays_scope& other) = delete;
+  packed_arrays_scope& operator=(const packed_arrays_scope& other) = delete;
+  ~packed_arrays_scope()
+  {
+    current_packed_arrays() = _previous;
+  }
+
+private:
+  const packed_arrays* _previous;
+
+}; // end of class packed_arrays_scope
+
+/**
+ * @brief Returns the packed elements stored for the given json node in the current packed arrays
+ * table, false if there are none.
+ */
+template <typename T>
+inline bool get_packed_array(const json& node, std::vector<T>& v)
+{
+  const auto* arrays = current_packed_arrays();
+  if (!arrays || !node.is_array() || !node.empty()) {
+    return false;
+  }
+  if constexpr (std::is_arithmetic<T>::value) {
+    const auto convert = [&v](const auto& elements) {
+      v.assign(elements.begin(), elements.end());
+      return true;
+    };
+    if (const auto it = arrays->floats.find(&node); it != arrays->floats.end()) {
+      return convert(it->second);
+    }
+    if (const auto it = arrays->indices.find(&node); it != arrays->indices.end()) {
+      return convert(it->second);
+    }
+    if (const auto it = arrays->views.find(&node); it != arrays->views.end()) {
+      const auto& elements = it->second;
+      v.resize(elements.size);
+      for (size_t i = 0; i < elements.size; ++i) {
+        if (elements.isFloat) {
+          float value = 0.f;
+          std::memcpy(&value, elements.data + i * 4, sizeof(value));
+          v[i] = static_cast<T>(value);
+        }
+        else {
+          uint32_t value = 0;
+          std::memcpy(&value, elements.data + i * 4, sizeof(value));
+          v[i] = static_cast<T>(value);
+        }
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
 template <typename T>
 inline std::vector<T> get_array(const json& j, const std::string& key)
 {
   std::vector<T> v;
-  if (!j.is_null() && has_key(j, key) && j[key].is_array() && !j[key].empty()) {
-    v = j[key].get<std::vector<T>>();
+  if (!j.is_null() && has_key(j, key)) {
+    const auto& value = j[key];
+    if (value.is_array() && !value.empty()) {
+      v = value.get<std::vector<T>>();
+    }
+    else {
+      get_packed_array(value, v);
+    }
   }
 
   return v;
 }
 
+/**
+ * @brief Returns the array stored under the given key without copying it, an empty array if there is
+ * none. The elements keep their identity, as needed to read their packed arrays.
+ */
+inline const json& get_array_ref(const json& j, const std::string& key)
+{
+  static const json emptyArray = json::array();
+  if (!j.is_null() && has_key(j, key) && j[key].is_array()) {
+    return j[key];
+  }
+  return emptyArray;
+}
+
 } // end of namespace json_util
 } // end of namespace BABYLON
 
@@ -0,0 +1,83 @@
+#ifndef BABYLON_CORE_LOGGING_ASYNC_LOG_WRITER_H
+#define BABYLON_CORE_LOGGING_ASYNC_LOG_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <babylon/babylon_api.h>
+#include <babylon/core/logging/log_message.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Dispatches log messages on a background thread.
+ *
+ * The messages are queued in a bounded lock-free multi-producer /
+ * single-consumer ring buffer of preallocated slots: logging threads never
+ * wait for the listeners nor for each other. When the ring buffer is full the
+ * message is dropped and counted.
+ */
+class BABYLON_SHARED_EXPORT AsyncLogWriter {
+
+public:
+  using DispatchFunc = std::function<void(const LogMessage& msg)>;
+
+public:
+  /**
+   * @brief Starts the writer thread.
+   * @param capacity Number of slots of the ring buffer, rounded up to a power
+   * of two
+   * @param dispatch Called on the writer thread for each message
+   */
+  AsyncLogWriter(size_t capacity, const DispatchFunc& dispatch);
+  AsyncLogWriter(const AsyncLogWriter&) = delete;
+  AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+  ~AsyncLogWriter(); // Dispatches the queued messages and joins the thread
+
+  /**
+   * @brief Queues a message, never blocks.
+   * @returns false if the ring buffer is full and the message was dropped
+   */
+  bool push(LogMessage&& msg);
+
+  /**
+   * @brief Blocks until the messages queued before the call are dispatched.
+   */
+  void flush();
+
+  size_t capacity() const;
+  size_t written() const;
+  size_t dropped() const;
+
+private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    LogMessage message;
+  }; // end of struct Slot
+
+  void _run();
+  size_t _dispatchQueued();
+
+private:
+  std::unique_ptr<Slot[]> _slots;
+  size_t _mask;
+  DispatchFunc _dispatch;
+  // Producers and consumer positions on their own cache lines
+  alignas(64) std::atomic<size_t> _enqueuePosition;
+  alignas(64) std::atomic<size_t> _dequeuePosition;
+  std::atomic<size_t> _dropped;
+  std::atomic<bool> _running;
+  std::mutex _mutex;
+  std::condition_variable _wakeUp;
+  std::condition_variable _dispatched;
+  std::thread _thread;
+
+}; // end of class AsyncLogWriter
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_LOGGING_ASYNC_LOG_WRITER_H
@@ -2,6 +2,9 @@
 #define BABYLON_CORE_LOGGING_LOGGER_H
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <babylon/core/delegates/delegate.h>
@@ -20,8 +23,16 @@
 #define thread_local __declspec(thread)
 #endif
 
+// Messages above this level are compiled out, e.g.
+// -DBABYLON_LOG_COMPILE_LEVEL=BABYLON::LogLevels::LEVEL_WARN
+#ifndef BABYLON_LOG_COMPILE_LEVEL
+#define BABYLON_LOG_COMPILE_LEVEL BABYLON::LogLevels::LEVEL_TRACE
+#endif
+
 namespace BABYLON {
 
+class AsyncLogWriter;
+
 struct LogMessageHandler {
   using LogMessageListener = SA::delegate<void(const LogMessage&)>;
 
@@ -30,12 +41,28 @@ struct LogMessageHandler {
   LogMessageHandler(const LogMessageHandler&) = delete;
   LogMessageHandler& operator=(const LogMessageHandler&) = delete;
 
-  bool takes(unsigned int level);
+  bool takes(unsigned int level) const;
   void handle(const LogMessage& msg);
+  // Must be called with _mutex locked
+  void updateLevelMask();
 
   std::unordered_map<unsigned int, std::vector<LogMessageListener*>>
     _logMessageListeners;
   unsigned int _minLevel, _maxLevel;
+  // Bit i is set when messages of level i have a listener
+  std::atomic<unsigned int> _levelMask;
+  // Recursive, a listener may log
+  std::recursive_mutex _mutex;
+};
+
+/**
+ * @brief Logger statistics.
+ */
+struct LogStatistics {
+  /** Messages dispatched to the listeners **/
+  size_t written = 0;
+  /** Messages dropped because the asynchronous queue was full **/
+  size_t dropped = 0;
 };
 
 /**
@@ -61,7 +88,36 @@ public:
                                   char const* file, int lineNumber,
                                   char const* func, char const* prettyFunc);
   void log(const LogMessage& msg);
-  bool takes(unsigned int level);
+  void log(LogMessage&& msg);
+  /**
+   * @brief Returns whether a message of the given level would reach a
+   * listener, the macros do not format the message otherwise.
+   */
+  bool takes(unsigned int level) const;
+  /**
+   * @brief Sets the most detailed level that is dispatched.
+   */
+  void setMaxLevel(unsigned int level);
+
+  /**
+   * @brief Dispatches the messages on a background thread. The listeners are
+   * then called on that thread. Must not be called while other threads log.
+   * @param capacity Number of messages that can be queued, the messages
+   * logged when the queue is full are dropped
+   */
+  void startAsync(size_t capacity = 1024);
+  /**
+   * @brief Dispatches the queued messages and goes back to dispatching the
+   * messages on the logging thread. Must not be called while other threads
+   * log.
+   */
+  void stopAsync();
+  bool isAsync() const;
+  /**
+   * @brief Blocks until the queued messages are dispatched.
+   */
+  void flush();
+  LogStatistics statistics() const;
 
   bool isSubscribed(unsigned int level, LogMessageListener& logMsgListener);
   void registerLogMessageListener(LogMessageListener& logMsgListener);
@@ -77,6 +133,9 @@ protected:
 
 private:
   LogMessageHandler _impl;
+  std::unique_ptr<AsyncLogWriter> _asyncWriter;
+  std::atomic<size_t> _written;
+  std::atomic<size_t> _dropped;
 
 }; // end of class Logger
 
@@ -86,7 +145,8 @@ BABYLON_SHARED_EXPORT Logger & LoggerInstance();
 
 
 #define BABYLON_LOG_MSG(level, context, ...)                                   \
-  if (BABYLON::LoggerInstance().takes(level)) {                              \
+  if ((level) <= BABYLON_LOG_COMPILE_LEVEL                                     \
+      && BABYLON::LoggerInstance().takes(level)) {                             \
     std::ostringstream _ctx;                                                   \
     _ctx << context;                                                           \
     BABYLON::LogMessage _logMessage                                            \
@@ -97,7 +157,8 @@ BABYLON_SHARED_EXPORT Logger & LoggerInstance();
   }
 
 #define BABYLON_LOGF_MSG(level, context, printf_like_message, ...)             \
-  if (BABYLON::LoggerInstance().takes(level)) {                              \
+  if ((level) <= BABYLON_LOG_COMPILE_LEVEL                                     \
+      && BABYLON::LoggerInstance().takes(level)) {                             \
     std::ostringstream _ctx;                                                   \
     _ctx << context;                                                           \
     BABYLON::LogMessage _logMessage                                            \
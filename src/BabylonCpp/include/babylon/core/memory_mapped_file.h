@@ -0,0 +1,82 @@
+#ifndef BABYLON_CORE_MEMORY_MAPPED_FILE_H
+#define BABYLON_CORE_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Read-only view of the content of a file.
+ *
+ * The file is mapped in memory when the platform supports it, otherwise it is read in a buffer
+ * owned by the object. The view stays valid until the object is closed or destroyed.
+ */
+class BABYLON_SHARED_EXPORT MemoryMappedFile {
+
+public:
+  MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile(MemoryMappedFile&& other);
+  MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile& operator=(MemoryMappedFile&& other);
+  ~MemoryMappedFile();
+
+  /**
+   * @brief Opens a file, closing the previously opened one.
+   * @param filename The path of the file to open
+   * @returns true if the file content is available
+   */
+  bool open(const std::string& filename);
+
+  /**
+   * @brief Releases the content of the file.
+   */
+  void close();
+
+  /**
+   * @brief Returns true if a file is opened.
+   */
+  [[nodiscard]] bool isOpen() const;
+
+  /**
+   * @brief Returns true if the content of the file is mapped in memory, false if it was read in a
+   * buffer.
+   */
+  [[nodiscard]] bool isMapped() const;
+
+  /**
+   * @brief Returns the first byte of the file content.
+   */
+  [[nodiscard]] const char* data() const;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns the content of the file.
+   */
+  [[nodiscard]] std::string_view view() const;
+
+private:
+  bool _map(const std::string& filename);
+  bool _read(const std::string& filename);
+
+private:
+  const char* _data;
+  size_t _size;
+  bool _isOpen;
+  bool _isMapped;
+  std::vector<char> _buffer;
+
+}; // end of class MemoryMappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MEMORY_MAPPED_FILE_H
@@ -0,0 +1,161 @@
+#ifndef BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
+#define BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Subsystems whose memory is accounted by the MemoryTracker.
+ */
+enum class MemoryCategory : unsigned int {
+  /** Index data and position caches kept by the geometries */
+  Geometry = 0,
+  /** CPU copies of the vertex buffers data */
+  VertexBuffers = 1,
+  /** Particles of the particle systems and solid particle systems */
+  Particles = 2,
+  /** Animation keys */
+  Animations = 3,
+  Count = 4
+}; // end of enum class MemoryCategory
+
+/**
+ * @brief Heap allocation counts.
+ */
+struct BABYLON_SHARED_EXPORT AllocationCounts {
+  size_t allocations = 0;
+  size_t bytes       = 0;
+}; // end of struct AllocationCounts
+
+/**
+ * @brief Accounts the memory used by the big subsystems and counts the heap allocations.
+ *
+ * The live bytes of each category are reported by the subsystems through TrackedMemory members
+ * and TrackedAllocator containers. The heap allocations are only counted when the library is
+ * built with the BABYLON_TRACK_ALLOCATIONS option, which replaces the global operator new. On
+ * Windows the replacement only applies to the allocations made by the library itself.
+ */
+class BABYLON_SHARED_EXPORT MemoryTracker {
+
+public:
+  /**
+   * @brief Returns whether the global operator new hooks are compiled in.
+   */
+  static bool HasAllocationHooks();
+
+  /**
+   * @brief Returns the heap allocations made by all threads since the start of the process.
+   */
+  static AllocationCounts Allocations();
+
+  /**
+   * @brief Returns the heap allocations made by the calling thread since it started.
+   */
+  static AllocationCounts ThreadAllocations();
+
+  /**
+   * @brief Adds (or removes when negative) bytes to the live bytes of a category.
+   */
+  static void Track(MemoryCategory category, std::ptrdiff_t bytes);
+
+  /**
+   * @brief Returns the bytes currently used by a category.
+   */
+  static size_t LiveBytes(MemoryCategory category);
+
+  /**
+   * @brief Returns the highest number of bytes used by a category.
+   */
+  static size_t PeakBytes(MemoryCategory category);
+
+  /**
+   * @brief Returns the display name of a category.
+   */
+  static const char* CategoryName(MemoryCategory category);
+
+}; // end of class MemoryTracker
+
+/**
+ * @brief Accounts a number of bytes in a category for the lifetime of the object. Meant to be a
+ * member of the object owning the memory, a copy (or a move, the moved-from owner still exists)
+ * accounts the bytes again.
+ */
+class BABYLON_SHARED_EXPORT TrackedMemory {
+
+public:
+  explicit TrackedMemory(MemoryCategory category, size_t bytes = 0);
+  TrackedMemory(const TrackedMemory& other);
+  TrackedMemory& operator=(const TrackedMemory& other);
+  ~TrackedMemory(); // Removes the accounted bytes
+
+  /**
+   * @brief Sets the number of bytes accounted by this object.
+   */
+  void set(size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes accounted by this object.
+   */
+  [[nodiscard]] size_t bytes() const
+  {
+    return _bytes;
+  }
+
+private:
+  MemoryCategory _category;
+  size_t _bytes;
+
+}; // end of class TrackedMemory
+
+/**
+ * @brief Standard allocator accounting the allocated bytes in a category.
+ */
+template <typename T, MemoryCategory Category>
+struct TrackedAllocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = TrackedAllocator<U, Category>;
+  };
+
+  TrackedAllocator() = default;
+  template <typename U>
+  TrackedAllocator(const TrackedAllocator<U, Category>& /*other*/)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    MemoryTracker::Track(Category, static_cast<std::ptrdiff_t>(n * sizeof(T)));
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* ptr, size_t n)
+  {
+    MemoryTracker::Track(Category, -static_cast<std::ptrdiff_t>(n * sizeof(T)));
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <typename U>
+  bool operator==(const TrackedAllocator<U, Category>& /*other*/) const
+  {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const TrackedAllocator<U, Category>& /*other*/) const
+  {
+    return false;
+  }
+
+}; // end of struct TrackedAllocator
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
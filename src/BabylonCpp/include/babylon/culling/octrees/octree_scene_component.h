@@ -2,6 +2,7 @@
 #define BABYLON_CULLING_OCTREES_OCTREE_SCENE_COMPONENT_H
 
 #include <memory>
+#include <memory_resource>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
@@ -44,16 +45,16 @@ public:
 
   /**
    * @brief Return the list of active meshes.
-   * @returns the list of active meshes
+   * @returns the list of active meshes, allocated from the frame arena of the scene
    */
-  std::vector<AbstractMesh*> getActiveMeshCandidates();
+  std::pmr::vector<AbstractMesh*> getActiveMeshCandidates();
 
   /**
    * @brief Return the list of active sub meshes.
    * @param mesh The mesh to get the candidates sub meshes from
-   * @returns the list of active sub meshes
+   * @returns the list of active sub meshes, allocated from the frame arena of the scene
    */
-  std::vector<SubMesh*> getActiveSubMeshCandidates(AbstractMesh* mesh);
+  std::pmr::vector<SubMesh*> getActiveSubMeshCandidates(AbstractMesh* mesh);
 
   /**
    * @brief Return the list of sub meshes intersecting with a given local ray.
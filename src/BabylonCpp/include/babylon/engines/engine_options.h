@@ -88,6 +88,13 @@ struct BABYLON_SHARED_EXPORT EngineOptions {
    * cannot be created
    */
   bool failIfMajorPerformanceCaveat = false;
+
+  /**
+   * Defines the number of worker threads reading and decoding the texture images in parallel. The
+   * decoded images are uploaded at the beginning of the next frame. 0 (default) decodes them
+   * synchronously when the texture is created
+   */
+  unsigned int imageDecodingWorkers = 0;
 }; // end of struct EngineOptions
 
 } // end of namespace BABYLON
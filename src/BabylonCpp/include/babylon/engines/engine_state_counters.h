@@ -0,0 +1,116 @@
+#ifndef BABYLON_ENGINES_ENGINE_STATE_COUNTERS_H
+#define BABYLON_ENGINES_ENGINE_STATE_COUNTERS_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Counts the state changes submitted to an engine and the redundant ones filtered out by
+ * the engine state cache, along with the vertex data uploaded.
+ */
+struct BABYLON_SHARED_EXPORT EngineStateCounters {
+
+  /**
+   * @brief Returns the total number of state changes applied.
+   */
+  [[nodiscard]] size_t stateChanges() const
+  {
+    return effectBindings + vertexBufferBindings + indexBufferBindings + textureBindings
+           + alphaModeChanges + depthCullingStateChanges;
+  }
+
+  /**
+   * @brief Returns the total number of redundant state changes skipped.
+   */
+  [[nodiscard]] size_t stateChangesAvoided() const
+  {
+    return effectBindingsAvoided + vertexBufferBindingsAvoided + indexBufferBindingsAvoided
+           + textureBindingsAvoided + alphaModeChangesAvoided + depthCullingStateChangesAvoided;
+  }
+
+  /**
+   * @brief Resets all the counters.
+   */
+  void reset()
+  {
+    *this = EngineStateCounters();
+  }
+
+  /**
+   * Number of effects activated
+   */
+  size_t effectBindings = 0;
+
+  /**
+   * Number of effect activations skipped as the effect was already active
+   */
+  size_t effectBindingsAvoided = 0;
+
+  /**
+   * Number of vertex buffer sets bound
+   */
+  size_t vertexBufferBindings = 0;
+
+  /**
+   * Number of vertex buffer bindings skipped as the buffers were already bound
+   */
+  size_t vertexBufferBindingsAvoided = 0;
+
+  /**
+   * Number of index buffers bound
+   */
+  size_t indexBufferBindings = 0;
+
+  /**
+   * Number of index buffer bindings skipped as the buffer was already bound
+   */
+  size_t indexBufferBindingsAvoided = 0;
+
+  /**
+   * Number of textures bound to a texture unit
+   */
+  size_t textureBindings = 0;
+
+  /**
+   * Number of texture bindings skipped as the texture was already bound to the unit
+   */
+  size_t textureBindingsAvoided = 0;
+
+  /**
+   * Number of alpha (blend) mode changes
+   */
+  size_t alphaModeChanges = 0;
+
+  /**
+   * Number of alpha mode changes skipped as the mode was already set
+   */
+  size_t alphaModeChangesAvoided = 0;
+
+  /**
+   * Number of depth and culling state changes (culling, cull face and front face)
+   */
+  size_t depthCullingStateChanges = 0;
+
+  /**
+   * Number of depth and culling state changes skipped as the state was already set
+   */
+  size_t depthCullingStateChangesAvoided = 0;
+
+  /**
+   * Number of updates of dynamic vertex buffers
+   */
+  size_t vertexBufferUploads = 0;
+
+  /**
+   * Number of bytes uploaded to dynamic vertex buffers
+   */
+  size_t vertexBufferUploadedBytes = 0;
+
+}; // end of struct EngineStateCounters
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_ENGINE_STATE_COUNTERS_H
@@ -1,6 +1,7 @@
 #ifndef BABYLON_ENGINES_SCENE_H
 #define BABYLON_ENGINES_SCENE_H
 
+#include <memory_resource>
 #include <nlohmann/json.hpp>
 #include <regex>
 #include <variant>
@@ -37,6 +38,7 @@ class Collider;
 class DebugLayer;
 class Engine;
 class EnvironmentHelper;
+class FrameArena;
 class GamepadManager;
 struct IActiveMeshCandidateProvider;
 struct ICollisionCoordinator;
@@ -195,12 +197,12 @@ public:
   /**
    * @brief Hidden
    */
-  std::vector<AbstractMesh*> _getDefaultMeshCandidates();
+  std::pmr::vector<AbstractMesh*> _getDefaultMeshCandidates();
 
   /**
    * @brief Hidden
    */
-  std::vector<SubMesh*> _getDefaultSubMeshCandidates(AbstractMesh* mesh);
+  std::pmr::vector<SubMesh*> _getDefaultSubMeshCandidates(AbstractMesh* mesh);
 
   /**
    * @brief Sets the default candidate providers for the scene.
@@ -255,6 +257,13 @@ public:
    */
   Engine* getEngine();
 
+  /**
+   * @brief Gets the linear allocator of the transient containers of the current frame. It is reset
+   * at the start of render(), the containers allocated from it must not be kept across frames.
+   * @returns the frame arena
+   */
+  FrameArena& getFrameArena();
+
   /**
    * @brief Gets the total number of vertices rendered per frame.
    * @returns the total number of vertices rendered per frame
@@ -1743,6 +1752,15 @@ public:
     const std::function<int(const SubMesh* a, const SubMesh* b)>& transparentSortCompareFn
     = nullptr);
 
+  /**
+   * @brief Enables or disables the state sorted rendering of the opaque and alpha test submeshes.
+   * When enabled, the rendering groups without a custom sort function render these submeshes
+   * grouped by effect, then material, then geometry to limit the state changes between draws.
+   *
+   * @param enabled Defines if the state sorted rendering is enabled
+   */
+  void setStateSortedRendering(bool enabled);
+
   /**
    * @brief Specifies whether or not the stencil and depth buffer are cleared between two rendering
    * groups.
@@ -1861,9 +1879,12 @@ private:
    */
   void _processLateAnimationBindings();
   GeometryPtr _getGeometryByUniqueID(size_t uniqueId);
-  void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh);
+  void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh,
+                        bool dispatch = true);
   void _evaluateActiveMeshes();
-  void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
+  void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh, bool dispatch = true);
+  void _clearAutoInstances();
+  bool _batchAutoInstance(AbstractMesh* mesh);
   void _renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent = nullptr);
   void _bindFrameBuffer();
   void _processSubCameras(const CameraPtr& camera);
@@ -3207,6 +3228,14 @@ public:
    */
   bool dispatchAllSubMeshesOfActiveMeshes;
 
+  /**
+   * Gets or sets a boolean indicating that the active meshes sharing their geometry, material and
+   * render state are drawn with a single instanced draw call (default is false). Only meshes
+   * without instances, skeleton, morph targets, LOD levels or render observers are batched, and
+   * the engine must support instanced arrays
+   */
+  bool autoInstancing;
+
   /** Hidden */
   std::vector<IParticleSystem*> _activeParticleSystems;
 
@@ -3505,14 +3534,14 @@ public:
   Property<Scene, bool> blockMaterialDirtyMechanism;
 
   /**
-   * Lambda returning the list of potentially active meshes.
+   * Lambda returning the list of potentially active meshes, allocated from the frame arena.
    */
-  std::function<std::vector<AbstractMesh*>()> getActiveMeshCandidates;
+  std::function<std::pmr::vector<AbstractMesh*>()> getActiveMeshCandidates;
 
   /**
-   * Lambda returning the list of potentially active sub meshes.
+   * Lambda returning the list of potentially active sub meshes, allocated from the frame arena.
    */
-  std::function<std::vector<SubMesh*>(AbstractMesh* mesh)> getActiveSubMeshCandidates;
+  std::function<std::pmr::vector<SubMesh*>(AbstractMesh* mesh)> getActiveSubMeshCandidates;
 
   /**
    * Lambda returning the list of potentially intersecting sub meshes.
@@ -3695,7 +3724,10 @@ private:
   std::vector<RenderTargetTexturePtr> _renderTargets;
   std::vector<SkeletonPtr> _activeSkeletons;
   std::vector<Mesh*> _softwareSkinnedMeshes;
+  // Meshes drawing the automatic instances, by hash of their render state
+  std::unordered_map<size_t, std::vector<Mesh*>> _autoInstanceLeaders;
   std::unique_ptr<RenderingManager> _renderingManager;
+  std::unique_ptr<FrameArena> _frameArena;
   Matrix _transformMatrix;
   std::unique_ptr<UniformBuffer> _sceneUbo;
   std::unique_ptr<UniformBuffer> _alternateSceneUbo;
@@ -3751,9 +3783,6 @@ private:
   std::unique_ptr<Ray> _tempPickingRay;
   std::unique_ptr<Ray> _cachedRayForTransform;
 
-  std::vector<AbstractMesh*> _defaultMeshCandidates;
-  std::vector<SubMesh*> _defaultSubMeshCandidates;
-
   std::optional<bool> _audioEnabled;
   std::optional<bool> _headphone;
 
@@ -0,0 +1,181 @@
+#ifndef BABYLON_ENGINES_TEXTURE_CACHE_H
+#define BABYLON_ENGINES_TEXTURE_CACHE_H
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+
+namespace BABYLON {
+
+FWD_CLASS_SPTR(InternalTexture)
+
+/**
+ * @brief Counts the lookups in a texture cache and the textures evicted from it.
+ */
+struct BABYLON_SHARED_EXPORT TextureCacheCounters {
+
+  /**
+   * @brief Resets all the counters.
+   */
+  void reset()
+  {
+    *this = TextureCacheCounters();
+  }
+
+  /**
+   * Number of lookups which returned a cached texture
+   */
+  size_t hits = 0;
+
+  /**
+   * Number of lookups which did not find a cached texture
+   */
+  size_t misses = 0;
+
+  /**
+   * Number of unreferenced textures released to stay in the memory budget
+   */
+  size_t evictions = 0;
+
+}; // end of struct TextureCacheCounters
+
+/**
+ * @brief Cache of the internal textures created by an engine.
+ *
+ * The textures are indexed by url so a lookup only compares the textures loaded from the same
+ * url. When a memory budget is set, the textures which are no longer referenced are kept in the
+ * cache and reused by later lookups, the least recently used ones are evicted when the textures
+ * in the cache exceed the budget.
+ */
+class BABYLON_SHARED_EXPORT TextureCache {
+
+public:
+  TextureCache();
+  ~TextureCache(); // = default
+
+  /**
+   * @brief Gets the cached textures, in insertion order.
+   */
+  [[nodiscard]] const std::vector<InternalTexturePtr>& textures() const;
+
+  /**
+   * @brief Gets the number of cached textures.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns whether the texture is in the cache.
+   */
+  [[nodiscard]] bool contains(const InternalTexture* texture) const;
+
+  /**
+   * @brief Adds a texture to the cache, does nothing if the texture is already cached.
+   */
+  void add(const InternalTexturePtr& texture);
+
+  /**
+   * @brief Removes a texture from the cache.
+   * @returns true if the texture was cached
+   */
+  bool remove(const InternalTexture* texture);
+
+  /**
+   * @brief Removes all the textures from the cache.
+   */
+  void clear();
+
+  /**
+   * @brief Finds a cached texture matching the creation parameters and increments its number of
+   * references.
+   * @param url defines the url the texture was loaded from
+   * @param noMipmap defines whether the texture has no mip maps
+   * @param sampling defines the sampling mode, any sampling mode matches if 0
+   * @param invertY defines whether the texture is inverted on Y, any value matches if not set
+   * @param format defines the format of the texture, any format matches if not set
+   * @returns the cached texture or nullptr if none matches
+   */
+  InternalTexturePtr find(const std::string& url, bool noMipmap, unsigned int sampling = 0,
+                          const std::optional<bool>& invertY = std::nullopt,
+                          const std::optional<unsigned int>& format = std::nullopt);
+
+  /**
+   * @brief Keeps a cached texture which is no longer referenced so that it can be reused by a
+   * later lookup. Only the textures loaded from an url are kept, and only if a memory budget is
+   * set.
+   * @returns true if the texture is kept in the cache, false if it should be released
+   */
+  bool retain(const InternalTexturePtr& texture);
+
+  /**
+   * @brief Removes the least recently used unreferenced textures until the textures in the cache
+   * fit in the memory budget, or all of them if there is no budget.
+   * @returns the evicted textures, to be released by the engine
+   */
+  std::vector<InternalTexturePtr> evict();
+
+  /**
+   * @brief Gets the number of unreferenced textures kept in the cache.
+   */
+  [[nodiscard]] size_t unreferencedCount() const;
+
+  /**
+   * @brief Gets the memory used by the cached textures, in bytes. The size of a texture is only
+   * known once it is loaded, so it is computed from the cached textures on each call.
+   */
+  [[nodiscard]] size_t memoryUsage() const;
+
+  /**
+   * @brief Gets the memory budget of the cache in bytes, 0 if the unreferenced textures are not
+   * kept.
+   */
+  [[nodiscard]] size_t memoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget of the cache in bytes. The evicted textures are returned by
+   * evict().
+   */
+  void setMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Gets the lookup and eviction counters.
+   */
+  [[nodiscard]] const TextureCacheCounters& counters() const;
+
+  /**
+   * @brief Resets the lookup and eviction counters.
+   */
+  void resetCounters();
+
+  /**
+   * @brief Computes the GPU memory used by a texture, in bytes, from its size, format and type,
+   * including its faces, layers and mip maps.
+   */
+  static size_t ByteSize(const InternalTexture& texture);
+
+private:
+  void _unlinkUnreferenced(const InternalTexture* texture);
+
+private:
+  std::vector<InternalTexturePtr> _textures;
+  // Url -> cached textures loaded from this url, in insertion order
+  std::unordered_map<std::string, std::vector<InternalTexture*>> _urlIndex;
+  // Cached texture -> url it is indexed with
+  std::unordered_map<const InternalTexture*, std::string> _urls;
+  // Unreferenced textures, the least recently used first
+  std::list<InternalTexturePtr> _unreferenced;
+  std::unordered_map<const InternalTexture*, std::list<InternalTexturePtr>::iterator>
+    _unreferencedIndex;
+  size_t _memoryBudget;
+  TextureCacheCounters _counters;
+
+}; // end of class TextureCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_TEXTURE_CACHE_H
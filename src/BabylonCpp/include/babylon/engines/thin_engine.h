@@ -13,6 +13,8 @@
 #include <babylon/engines/engine_capabilities.h>
 #include <babylon/engines/engine_features.h>
 #include <babylon/engines/engine_options.h>
+#include <babylon/engines/engine_state_counters.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/materials/textures/texture_constants.h>
 #include <babylon/maths/vector4.h>
 #include <babylon/maths/viewport.h>
@@ -31,6 +33,7 @@ class DynamicBufferExtension;
 class DynamicTextureExtension;
 class Color4;
 class ICanvasRenderingContext2D;
+class ImageDecoder;
 struct IEffectCreationOptions;
 struct IFileRequest;
 struct IMultiRenderTargetOptions;
@@ -214,10 +217,29 @@ public:
   virtual float getHardwareScalingLevel() const;
 
   /**
-   * @brief Gets the list of loaded textures.
-   * @returns an array containing all loaded textures
+   * @brief Gets the cache of the loaded textures.
+   * @returns the cache containing all loaded textures
    */
-  std::vector<InternalTexturePtr>& getLoadedTexturesCache();
+  TextureCache& getLoadedTexturesCache();
+
+  /**
+   * @brief Sets the memory budget of the loaded textures cache, in bytes. With a budget, the
+   * textures loaded from an url stay in the cache once they are no longer referenced and are
+   * reused by the next textures created from the same url, the least recently used ones are
+   * released when the cache exceeds the budget. With no budget (0, the default) the textures are
+   * released as soon as they are no longer referenced.
+   * @param bytes defines the memory budget in bytes
+   */
+  void setTexturesCacheMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Hands the images decoded by the image decoding workers (see
+   * EngineOptions::imageDecodingWorkers) to their textures. This is done at the beginning of each
+   * frame, it can be called to finish loading the textures outside of the render loop.
+   * @param wait defines whether to wait for all the images being decoded
+   * @returns the number of textures updated
+   */
+  size_t processDecodedImages(bool wait = false);
 
   /**
    * @brief Gets the object containing all engine capabilities.
@@ -671,6 +693,18 @@ public:
    */
   virtual void enableEffect(const EffectPtr& effect);
 
+  /**
+   * @brief Gets the counters of the state changes applied and of the redundant state changes
+   * skipped by the engine since the last reset.
+   * @returns the state counters
+   */
+  [[nodiscard]] const EngineStateCounters& getStateCounters() const;
+
+  /**
+   * @brief Resets the state change counters.
+   */
+  void resetStateCounters();
+
   /**
    * @brief Set the value of an uniform to a number (int)
    * @param uniform defines the webGL uniform location where to store the value
@@ -1052,6 +1086,16 @@ public:
    */
   virtual void _releaseTexture(const InternalTexturePtr& texture);
 
+  /**
+   * @brief Hidden
+   */
+  void _releaseUnreferencedTexture(const InternalTexturePtr& texture);
+
+  /**
+   * @brief Hidden
+   */
+  void _releaseEvictedTextures();
+
   /**
    * @brief Binds an effect to the webGL context.
    * @param effect defines the effect to bind
@@ -1993,7 +2037,10 @@ public:
 
   // Cache
   /** @hidden */
-  std::vector<InternalTexturePtr> _internalTexturesCache;
+  TextureCache _internalTexturesCache;
+
+  /** @hidden */
+  std::unique_ptr<ImageDecoder> _imageDecoder;
 
   /** @hidden */
   InternalTexturePtr _currentRenderTarget = nullptr;
@@ -2148,6 +2195,8 @@ protected:
 
   /** @hidden */
   std::unordered_map<int, WebGLUniformLocationPtr> _boundUniforms;
+  /** @hidden */
+  EngineStateCounters _stateCounters;
 
 private:
   float _hardwareScalingLevel = 1.f;
@@ -2202,6 +2251,7 @@ private:
   std::unique_ptr<UniformBufferExtension> _uniformBufferExtension;
 
   // Friend classes
+  friend class AlphaExtension;
   friend class DynamicBufferExtension;
   friend class ReadTextureExtension;
   friend class RenderTargetExtension;
@@ -2,6 +2,7 @@
 #define BABYLON_INSTRUMENTATION_ENGINE_INSTRUMENTATION_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/instrumentation/_time_token.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observer.h>
@@ -64,6 +65,52 @@ protected:
    */
   void set_captureShaderCompilationTime(bool value);
 
+  /**
+   * @brief Gets the perf counter used for the number of state changes applied per frame.
+   */
+  PerfCounter& get_stateChangesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the number of redundant state changes skipped per frame.
+   */
+  PerfCounter& get_stateChangesAvoidedCounter();
+
+  /**
+   * @brief Gets the state changes capture status.
+   */
+  [[nodiscard]] bool get_captureStateChanges() const;
+
+  /**
+   * @brief Enable or disable the state changes capture.
+   */
+  void set_captureStateChanges(bool value);
+
+  /**
+   * @brief Gets the perf counter used for the number of texture cache hits per frame.
+   */
+  PerfCounter& get_texturesCacheHitsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the number of texture cache misses per frame.
+   */
+  PerfCounter& get_texturesCacheMissesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the number of textures evicted from the texture cache
+   * per frame.
+   */
+  PerfCounter& get_texturesCacheEvictionsCounter();
+
+  /**
+   * @brief Gets the texture cache capture status.
+   */
+  [[nodiscard]] bool get_captureTexturesCache() const;
+
+  /**
+   * @brief Enable or disable the texture cache capture.
+   */
+  void set_captureTexturesCache(bool value);
+
 public:
   // Properties
   /**
@@ -86,6 +133,45 @@ public:
    */
   Property<EngineInstrumentation, bool> captureShaderCompilationTime;
 
+  /**
+   * Perf counter used for the number of state changes (effect, buffer, texture, blend and
+   * depth/culling state) applied per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> stateChangesCounter;
+
+  /**
+   * Perf counter used for the number of redundant state changes skipped by the engine per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> stateChangesAvoidedCounter;
+
+  /**
+   * Enable or disable the state changes capture.
+   */
+  Property<EngineInstrumentation, bool> captureStateChanges;
+
+  /**
+   * Perf counter used for the number of texture cache lookups which found a loaded texture. The
+   * lookups done between two frames are counted in the next frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> texturesCacheHitsCounter;
+
+  /**
+   * Perf counter used for the number of texture cache lookups which did not find a loaded
+   * texture.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> texturesCacheMissesCounter;
+
+  /**
+   * Perf counter used for the number of unreferenced textures evicted from the texture cache to
+   * stay in its memory budget.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> texturesCacheEvictionsCounter;
+
+  /**
+   * Enable or disable the texture cache capture.
+   */
+  Property<EngineInstrumentation, bool> captureTexturesCache;
+
 private:
   /**
    * Define the instrumented engine.
@@ -99,11 +185,26 @@ private:
   bool _captureShaderCompilationTime;
   PerfCounter _shaderCompilationTime;
 
+  bool _captureStateChanges;
+  PerfCounter _stateChanges;
+  PerfCounter _stateChangesAvoided;
+  size_t _frameStartStateChanges;
+  size_t _frameStartStateChangesAvoided;
+
+  bool _captureTexturesCache;
+  PerfCounter _texturesCacheHits;
+  PerfCounter _texturesCacheMisses;
+  PerfCounter _texturesCacheEvictions;
+  TextureCacheCounters _lastTexturesCacheCounters;
+
   // Observers
   Observer<Engine>::Ptr _onBeginFrameObserver;
   Observer<Engine>::Ptr _onEndFrameObserver;
   Observer<Engine>::Ptr _onBeforeShaderCompilationObserver;
   Observer<Engine>::Ptr _onAfterShaderCompilationObserver;
+  Observer<Engine>::Ptr _onBeginFrameStateObserver;
+  Observer<Engine>::Ptr _onEndFrameStateObserver;
+  Observer<Engine>::Ptr _onEndFrameTexturesCacheObserver;
 
 }; // end of class EngineInstrumentation
 
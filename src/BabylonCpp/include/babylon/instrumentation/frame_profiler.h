@@ -0,0 +1,166 @@
+#ifndef BABYLON_INSTRUMENTATION_FRAME_PROFILER_H
+#define BABYLON_INSTRUMENTATION_FRAME_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief An event recorded by the frame profiler.
+ */
+struct BABYLON_SHARED_EXPORT ProfilerEvent {
+  /** Zone or counter name, a literal or a name interned by the profiler */
+  const char* name = nullptr;
+  /** Nanoseconds since the profiler was first used */
+  uint64_t timestamp = 0;
+  /** Value of a counter event */
+  double value = 0.0;
+  /** 'B' for a zone begin, 'E' for a zone end and 'C' for a counter */
+  char phase = 'B';
+}; // end of struct ProfilerEvent
+
+/**
+ * @brief Hierarchical CPU profiler recording nested zones and per-frame counters.
+ *
+ * Each thread records into its own ring buffer, the oldest events are overwritten once the buffer
+ * is full. The recorded events can be written in the Chrome trace event format, which is read by
+ * chrome://tracing and https://ui.perfetto.dev. When the profiler is disabled a zone costs a
+ * relaxed atomic load.
+ */
+class BABYLON_SHARED_EXPORT FrameProfiler {
+
+public:
+  /**
+   * Number of events kept per thread, rounded up to a power of two, read when a thread records
+   * its first event
+   */
+  static inline size_t ThreadBufferCapacity = 1 << 15;
+
+  /**
+   * @brief Returns whether events are recorded.
+   */
+  static bool IsEnabled()
+  {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Starts or stops recording events, the recorded events are kept.
+   */
+  static void SetEnabled(bool enabled);
+
+  /**
+   * @brief Enables the profiler for the given number of frames, then writes the Chrome trace of
+   * the recorded events to the given file and disables the profiler.
+   * @param frameCount number of frames to record, counted by EndFrame()
+   * @param filename the trace file to write
+   */
+  static void CaptureFrames(size_t frameCount, const std::string& filename);
+
+  /**
+   * @brief Opens a zone on the calling thread.
+   * @param name the zone name, must outlive the profiler (e.g. a string literal)
+   */
+  static void BeginZone(const char* name);
+
+  /**
+   * @brief Opens a zone with a name built at runtime, the name is interned.
+   */
+  static void BeginZone(const std::string& name);
+
+  /**
+   * @brief Closes the innermost zone opened on the calling thread.
+   */
+  static void EndZone();
+
+  /**
+   * @brief Records the value of a counter.
+   * @param name the counter name, must outlive the profiler (e.g. a string literal)
+   */
+  static void Counter(const char* name, double value);
+
+  /**
+   * @brief Opens the "Frame" zone.
+   */
+  static void BeginFrame();
+
+  /**
+   * @brief Closes the "Frame" zone and writes the trace when a capture is complete.
+   */
+  static void EndFrame();
+
+  /**
+   * @brief Returns the events recorded by all threads, oldest first for each thread.
+   */
+  static std::vector<ProfilerEvent> Events();
+
+  /**
+   * @brief Discards the recorded events.
+   */
+  static void Clear();
+
+  /**
+   * @brief Writes the recorded events in the Chrome trace event format.
+   */
+  static void WriteChromeTrace(std::ostream& stream);
+
+  /**
+   * @brief Writes the recorded events to a Chrome trace file.
+   * @returns false if the file could not be written
+   */
+  static bool DumpChromeTrace(const std::string& filename);
+
+  /**
+   * @brief Zone closed when going out of scope.
+   */
+  class ScopedZone {
+
+  public:
+    explicit ScopedZone(const char* name) : _active{FrameProfiler::IsEnabled()}
+    {
+      if (_active) {
+        FrameProfiler::BeginZone(name);
+      }
+    }
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+    ~ScopedZone()
+    {
+      if (_active) {
+        FrameProfiler::EndZone();
+      }
+    }
+
+  private:
+    bool _active;
+
+  }; // end of class ScopedZone
+
+private:
+  static std::atomic<bool> _enabled;
+
+}; // end of class FrameProfiler
+
+} // end of namespace BABYLON
+
+#define BABYLON_PROFILE_CONCAT_IMPL(a, b) a##b
+#define BABYLON_PROFILE_CONCAT(a, b) BABYLON_PROFILE_CONCAT_IMPL(a, b)
+
+// Opens a profiler zone closed at the end of the enclosing scope
+#ifndef BABYLON_DISABLE_PROFILER
+#define BABYLON_PROFILE_ZONE(name)                                                                 \
+  const ::BABYLON::FrameProfiler::ScopedZone BABYLON_PROFILE_CONCAT(_profilerZone, __LINE__)       \
+  {                                                                                                \
+    name                                                                                           \
+  }
+#else
+#define BABYLON_PROFILE_ZONE(name)
+#endif
+
+#endif // end of BABYLON_INSTRUMENTATION_FRAME_PROFILER_H
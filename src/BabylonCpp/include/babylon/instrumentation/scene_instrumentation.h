@@ -2,6 +2,7 @@
 #define BABYLON_INSTRUMENTATION_SCENE_INSTRUMENTATION_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observer.h>
 #include <babylon/misc/perf_counter.h>
@@ -32,6 +33,17 @@ public:
    */
   void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
 
+  /**
+   * @brief Gets the bytes currently used by a subsystem.
+   * @param category defines the subsystem
+   */
+  [[nodiscard]] size_t getMemoryUsage(MemoryCategory category) const;
+
+  /**
+   * @brief Gets the estimated bytes used by the loaded textures.
+   */
+  [[nodiscard]] size_t getTexturesMemoryUsage() const;
+
 protected:
   // Properties
   /**
@@ -189,6 +201,27 @@ protected:
    */
   PerfCounter& get_drawCallsCounter();
 
+  /**
+   * @brief Gets the perf counter used for the heap allocations made by a frame.
+   */
+  PerfCounter& get_allocationsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the heap bytes allocated by a frame.
+   */
+  PerfCounter& get_allocatedBytesCounter();
+
+  /**
+   * @brief Gets the allocations capture status.
+   */
+  [[nodiscard]] bool get_captureAllocations() const;
+
+  /**
+   * @brief Enable or disable the allocations capture, the allocations are only counted when
+   * BabylonCpp is built with the BABYLON_TRACK_ALLOCATIONS option.
+   */
+  void set_captureAllocations(bool value);
+
 public:
   // Properties
 
@@ -302,6 +335,21 @@ public:
    */
   ReadOnlyProperty<SceneInstrumentation, PerfCounter> drawCallsCounter;
 
+  /**
+   * Perf counter used for the heap allocations made by a frame.
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> allocationsCounter;
+
+  /**
+   * Perf counter used for the heap bytes allocated by a frame.
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> allocatedBytesCounter;
+
+  /**
+   * Allocations capture status.
+   */
+  Property<SceneInstrumentation, bool> captureAllocations;
+
 private:
   bool _captureActiveMeshesEvaluationTime;
   PerfCounter _activeMeshesEvaluationTime;
@@ -333,6 +381,11 @@ private:
   bool _captureCameraRenderTime;
   PerfCounter _cameraRenderTime;
 
+  bool _captureAllocations;
+  PerfCounter _allocations;
+  PerfCounter _allocatedBytes;
+  AllocationCounts _frameStartAllocations;
+
   // Observers
   Observer<Scene>::Ptr _onBeforeActiveMeshesEvaluationObserver;
   Observer<Scene>::Ptr _onAfterActiveMeshesEvaluationObserver;
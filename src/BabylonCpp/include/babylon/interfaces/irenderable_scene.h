@@ -19,6 +19,8 @@ public:
   virtual ~IRenderableScene();                 // = default
 
   void initialize(ICanvas* canvas = nullptr);
+  // Uses the given engine instead of creating one for the canvas, e.g. a NullEngine
+  void initialize(ICanvas* canvas, std::unique_ptr<Engine>&& engine);
 
   virtual void render();
   virtual const char* getName()                               = 0;
@@ -0,0 +1,125 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <babylon/babylon_api.h>
+
+using json = nlohmann::json;
+
+namespace BABYLON {
+
+struct BabylonFileData;
+class Mesh;
+using MeshPtr = std::shared_ptr<Mesh>;
+
+/**
+ * @brief Header of a binary .babylon file.
+ */
+struct BABYLON_SHARED_EXPORT BabylonBinaryFileHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t metadataLength;
+  uint64_t blocksOffset;
+  uint64_t blocksLength;
+}; // end of struct BabylonBinaryFileHeader
+
+/**
+ * @brief Binary container for .babylon scenes.
+ *
+ * Layout of the file (little endian):
+ * - the header: magic "BJSB", format version, length of the metadata, offset and length of the
+ *   blocks section
+ * - the metadata: the .babylon JSON document, where the vertex data arrays are replaced by
+ *   {"$block": index} references, and a "$blocks" array describing each block (offset in the blocks
+ *   section, number of elements and element type)
+ * - the blocks: the raw float / uint32_t arrays, each aligned on BlockAlignment bytes, which are
+ *   read in place when loading (BabylonFileData::packedArrays views) and only copied once, into the
+ *   vertex buffers
+ */
+struct BABYLON_SHARED_EXPORT BabylonBinaryFile {
+
+  static constexpr uint32_t Version      = 1;
+  static constexpr size_t BlockAlignment = 16;
+  static constexpr const char* Magic     = "BJSB";
+  static constexpr const char* Extension = ".babylonbin";
+
+  /**
+   * @brief Returns true if the data starts with the binary .babylon file magic.
+   */
+  static bool IsBinary(std::string_view data);
+
+  /**
+   * @brief Serializes a .babylon document into the binary format.
+   * @param document The .babylon JSON document (serialized scene or content of a .babylon file),
+   * its packed arrays are read from the current json_util::packed_arrays table
+   * @returns the content of the binary file
+   */
+  static std::string Serialize(const json& document);
+
+  /**
+   * @brief Serializes a parsed .babylon file into the binary format.
+   */
+  static std::string Serialize(const BabylonFileData& fileData);
+
+  /**
+   * @brief Serializes meshes of a scene into the binary format: transform, vertex data, sub-meshes
+   * and material / parent references, the vertex buffers are written without going through json
+   * values.
+   * @param meshes The meshes to serialize
+   * @returns the content of the binary file
+   */
+  static std::string SerializeMeshes(const std::vector<MeshPtr>& meshes);
+
+  /**
+   * @brief Serializes a .babylon document into a binary file.
+   * @param document The .babylon JSON document
+   * @param filename The path of the binary file
+   * @returns true if the file was written
+   */
+  static bool Write(const json& document, const std::string& filename);
+
+  /**
+   * @brief Serializes meshes of a scene into a binary file, see SerializeMeshes.
+   * @param meshes The meshes to serialize
+   * @param filename The path of the binary file
+   * @returns true if the file was written
+   */
+  static bool WriteMeshes(const std::vector<MeshPtr>& meshes, const std::string& filename);
+
+  /**
+   * @brief Converts a .babylon file into a binary file.
+   * @param babylonFilename The path of the .babylon file
+   * @param binaryFilename The path of the binary file
+   * @returns true if the file was converted
+   */
+  static bool Convert(const std::string& babylonFilename, const std::string& binaryFilename);
+
+  /**
+   * @brief Parses the content of a binary file. The blocks are not copied, the packed arrays of
+   * fileData are views on them: data must outlive fileData.
+   * @param data The content of the binary file
+   * @param fileData The parsed document and its indices
+   * @throws std::exception if the content is not a valid binary .babylon file
+   */
+  static void Parse(std::string_view data, BabylonFileData& fileData);
+
+  /**
+   * @brief Memory maps and parses a binary file, the mapping is kept alive by fileData.
+   * @param filename The path of the binary file
+   * @param fileData The parsed document and its indices
+   * @returns true if the file was read
+   */
+  static bool Read(const std::string& filename, BabylonFileData& fileData);
+
+}; // end of struct BabylonBinaryFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
@@ -0,0 +1,52 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Scene loader plugin for binary .babylon files (see BabylonBinaryFile). The scene objects
+ * are created by the .babylon loader, only the reading of the file differs.
+ */
+struct BABYLON_SHARED_EXPORT BabylonBinaryFileLoader : public BabylonFileLoader {
+
+  BabylonBinaryFileLoader();
+  ~BabylonBinaryFileLoader() override; // = default
+
+  bool parseData(
+    const std::string& data, BabylonFileData& fileData, const std::string& operation,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError
+    = nullptr,
+    const std::function<bool(const std::string& section, const json& entry)>& onEntry
+    = nullptr) const override;
+
+  /**
+   * @brief Imports meshes from a binary .babylon file. The file is memory mapped, the vertex
+   * data is copied once from the mapping into the vertex buffers.
+   * @param meshesNames The names of the meshes to import, all the meshes are imported when empty
+   * @param scene The scene to import into
+   * @param filename The path of the binary file
+   * @param meshes The meshes array to import into
+   * @param skeletons The skeletons array to import into
+   * @returns True if successful or false otherwise
+   */
+  bool importMeshFromFile(const std::vector<std::string>& meshesNames, Scene* scene,
+                          const std::string& filename, std::vector<AbstractMeshPtr>& meshes,
+                          std::vector<SkeletonPtr>& skeletons) const;
+
+  /**
+   * @brief Loads a binary .babylon file into a scene. The file is memory mapped, the vertex
+   * data is copied once from the mapping into the vertex buffers.
+   * @param scene The scene to load into
+   * @param filename The path of the binary file
+   * @returns true if successful or false otherwise
+   */
+  bool loadFromFile(Scene* scene, const std::string& filename) const;
+
+}; // end of struct BabylonBinaryFileLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
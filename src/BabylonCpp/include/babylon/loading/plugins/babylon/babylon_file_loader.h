@@ -11,6 +11,7 @@ using json = nlohmann::json;
 
 namespace BABYLON {
 
+struct BabylonFileData;
 class Material;
 using MaterialPtr = std::shared_ptr<Material>;
 
@@ -19,32 +20,78 @@ struct BABYLON_SHARED_EXPORT BabylonFileLoader : public ISceneLoaderPlugin {
   BabylonFileLoader();
   ~BabylonFileLoader() override; // = default
 
-  MaterialPtr parseMaterialById(const std::string& id, const json& parsedData, Scene* scene,
-                                const std::string& rootUrl) const;
+  MaterialPtr parseMaterialById(const std::string& id, const BabylonFileData& fileData,
+                                Scene* scene, const std::string& rootUrl) const;
   bool isDescendantOf(const json& mesh, const std::vector<std::string>& names,
                       std::vector<std::string>& hierarchyIds) const;
   [[nodiscard]] std::string logOperation(const std::string& operation) const;
   [[nodiscard]] std::string logOperation(const std::string& operation, const json& producer) const;
   void loadDetailLevels(Scene* scene, const AbstractMeshPtr& mesh) const;
 
+  /**
+   * @brief Parses the content of a file, reports the error and returns false if it is invalid.
+   * @param onEntry Optional callback consuming the section entries while the file is read (see
+   * BabylonFileReader::Parse), readers which cannot stream the file may ignore it
+   */
+  virtual bool parseData(
+    const std::string& data, BabylonFileData& fileData, const std::string& operation,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError
+    = nullptr,
+    const std::function<bool(const std::string& section, const json& entry)>& onEntry
+    = nullptr) const;
+
   bool importMesh(
     const std::vector<std::string>& meshesNames, Scene* scene, const std::string& data,
     const std::string& rootUrl, std::vector<AbstractMeshPtr>& meshes,
     std::vector<IParticleSystemPtr>& particleSystems, std::vector<SkeletonPtr>& skeletons,
     const std::function<void(const std::string& message, const std::string& exception)>& onError
     = nullptr) const override;
+  bool importMesh(
+    const std::vector<std::string>& meshesNames, Scene* scene, const BabylonFileData& fileData,
+    const std::string& rootUrl, std::vector<AbstractMeshPtr>& meshes,
+    std::vector<IParticleSystemPtr>& particleSystems, std::vector<SkeletonPtr>& skeletons,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError
+    = nullptr) const;
   bool
   load(Scene* scene, const std::string& data, const std::string& rootUrl,
        const std::function<void(const std::string& message, const std::string& exception)>& onError
        = nullptr) const override;
+  bool
+  load(Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+       const std::function<void(const std::string& message, const std::string& exception)>& onError
+       = nullptr) const;
   AssetContainerPtr loadAssetContainer(
     Scene* scene, const std::string& data, const std::string& rootUrl,
     const std::function<void(const std::string& message, const std::string& exception)>& onError
     = nullptr,
     bool addToScene = false) const override;
+  AssetContainerPtr loadAssetContainer(
+    Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError
+    = nullptr,
+    bool addToScene = false) const;
   void finally(const std::string& producer, const std::ostringstream& log,
                const json& parsedData) const;
 
+private:
+  /**
+   * @brief Parses the content of a file and creates the materials, skeletons, morph target
+   * managers, geometries and meshes while it is read, see loadAssetContainer.
+   */
+  bool _parseAndCreateEntries(
+    Scene* scene, const std::string& data, BabylonFileData& fileData, const std::string& rootUrl,
+    const std::string& operation,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError,
+    const AssetContainerPtr& container, std::ostringstream& log) const;
+  bool
+  _load(Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+        const std::function<void(const std::string& message, const std::string& exception)>& onError,
+        const AssetContainerPtr& container, std::ostringstream& assetsLog) const;
+  AssetContainerPtr _loadAssetContainer(
+    Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError,
+    bool addToScene, const AssetContainerPtr& container, std::ostringstream& log) const;
+
 }; // end of struct BabylonFileLoader
 
 } // end of namespace BABYLON
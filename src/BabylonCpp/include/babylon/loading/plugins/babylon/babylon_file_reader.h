@@ -0,0 +1,111 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_FILE_READER_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_FILE_READER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/core/json_util.h>
+
+namespace BABYLON {
+
+class MemoryMappedFile;
+
+/**
+ * @brief Content of a parsed .babylon file with its entries indexed by id.
+ */
+struct BABYLON_SHARED_EXPORT BabylonFileData {
+  BabylonFileData();
+  BabylonFileData(const BabylonFileData& other) = delete;
+  BabylonFileData& operator=(const BabylonFileData& other) = delete;
+  ~BabylonFileData(); // = default
+
+  /**
+   * @brief Returns the material with the given id, nullptr if not found.
+   */
+  [[nodiscard]] const json* getMaterialById(const std::string& id) const;
+
+  /**
+   * @brief Returns the multi-material with the given id, nullptr if not found.
+   */
+  [[nodiscard]] const json* getMultiMaterialById(const std::string& id) const;
+
+  /**
+   * @brief Returns the skeleton with the given id, nullptr if not found.
+   */
+  [[nodiscard]] const json* getSkeletonById(int id) const;
+
+  /**
+   * @brief Returns the vertex data geometry with the given id, nullptr if not found.
+   */
+  [[nodiscard]] const json* getGeometryById(const std::string& id) const;
+
+  /**
+   * The parsed document
+   */
+  json root;
+
+  /**
+   * The vertex data arrays of the document, get_array reads them while a
+   * json_util::packed_arrays_scope on this table is alive
+   */
+  json_util::packed_arrays packedArrays;
+
+  /**
+   * The memory mapped binary file the packed arrays views point into, if any
+   */
+  std::shared_ptr<MemoryMappedFile> mappedFile;
+
+  /**
+   * Entries of the document indexed by id, the first entry wins for duplicated ids
+   */
+  std::unordered_map<std::string, const json*> materials;
+  std::unordered_map<std::string, const json*> multiMaterials;
+  std::unordered_map<int, const json*> skeletons;
+  std::unordered_map<std::string, const json*> geometries;
+
+}; // end of struct BabylonFileData
+
+/**
+ * @brief Called when an entry of a section of the document ("materials", "multiMaterials",
+ * "morphTargetManagers", "skeletons", "vertexData" for the geometries or "meshes") has been read.
+ * Returns true if the entry has been consumed, it is then removed from the document.
+ */
+using BabylonFileEntryCallback
+  = std::function<bool(const std::string& section, const json& entry)>;
+
+/**
+ * @brief Streaming parser for .babylon files.
+ *
+ * The file is read with a SAX parser: the vertex data arrays (positions, normals, uvs, colors,
+ * indices, matrices indices and weights) of the meshes, geometries and morph targets are parsed
+ * straight into float / uint32_t buffers of BabylonFileData::packedArrays instead of a json value per
+ * number, which is where most of the memory of a large scene goes. The section entries can be
+ * consumed while the file is read, the remaining entries are indexed by id once it is read.
+ */
+struct BABYLON_SHARED_EXPORT BabylonFileReader {
+
+  /**
+   * @brief Parses the content of a .babylon file.
+   * @param data The content of the file
+   * @param fileData The parsed document and its indices
+   * @param onEntry Optional callback consuming the section entries as soon as they are read, the
+   * packed arrays of fileData are current while it runs
+   * @throws std::exception if the content is not valid JSON
+   */
+  static void Parse(std::string_view data, BabylonFileData& fileData,
+                    const BabylonFileEntryCallback& onEntry = nullptr);
+
+  /**
+   * @brief Returns true if the values of the given key are parsed into a packed buffer.
+   */
+  static bool IsVertexDataKey(const std::string& key);
+
+}; // end of struct BabylonFileReader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_FILE_READER_H
@@ -112,7 +112,8 @@ public:
    * @brief Hidden
    */
   InternalTexturePtr _getFromCache(const std::string& url, bool noMipmap, unsigned int sampling = 0,
-                                   const std::optional<bool>& invertY = std::nullopt);
+                                   const std::optional<bool>& invertY = std::nullopt,
+                                   const std::optional<unsigned int>& format = std::nullopt);
   /**
    * @brief Hidden
    */
@@ -10,6 +10,7 @@
 
 namespace BABYLON {
 
+class AbstractMesh;
 struct _InstancesBatch;
 struct _VisibleInstances;
 class Buffer;
@@ -35,6 +36,8 @@ struct BABYLON_SHARED_EXPORT _InstanceDataStorage {
   std::optional<unsigned int> sideOrientation  = std::nullopt;
   bool manualUpdate                            = false;
   std::optional<unsigned int> previousRenderId = std::nullopt;
+  // meshes drawn as instances of this mesh by the scene automatic instancing
+  std::vector<AbstractMesh*> autoInstances;
 }; // end of struct _InstanceDataStorage
 
 } // end of namespace BABYLON
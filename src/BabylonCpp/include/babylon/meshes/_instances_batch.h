@@ -18,6 +18,9 @@ struct BABYLON_SHARED_EXPORT _InstancesBatch {
   std::unordered_map<size_t, std::vector<InstancedMesh*>> visibleInstances;
   std::unordered_map<size_t, bool> renderSelf;
   std::vector<bool> hardwareInstancedRendering;
+  // true when the current rendering pass draws the meshes batched with the mesh by the scene
+  // automatic instancing
+  bool renderAutoInstances = false;
 }; // end of struct InstancesBatch
 
 } // end of namespace BABYLON
@@ -43,6 +43,8 @@ struct BABYLON_SHARED_EXPORT _InternalMeshDataInfo {
 
   // Morph
   MorphTargetManagerPtr _morphTargetManager = nullptr;
+  // Whether the buffers hold the shape blended by the morph target manager on the CPU
+  bool _cpuMorphed = false;
 }; // end of struct _InternalMeshDataInfo
 
 } // end of namespace BABYLON
@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
 #define BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -24,6 +26,25 @@ struct BABYLON_SHARED_EXPORT _ThinInstanceDataStorage {
   Float32Array matrixData              = {};
   std::vector<Vector3> boundingVectors = {};
   std::optional<std::vector<Matrix>> worldMatrices = std::nullopt;
+  // Per instance culling (see Mesh::thinInstanceEnableCulling)
+  // World space bounding spheres of the instances, as structure of arrays
+  Float32Array sphereCentersX = {};
+  Float32Array sphereCentersY = {};
+  Float32Array sphereCentersZ = {};
+  Float32Array sphereRadii    = {};
+  // World space bounding spheres of the clusters of consecutive instances (x, y, z, radius)
+  Float32Array clusterSpheres = {};
+  bool cullingDataDirty       = true;
+  int cullingWorldMatrixFlag  = -1;
+  // Frustum planes (a, b, c, d) the visible instances were selected with
+  std::array<float, 24> cullingPlanes            = {};
+  bool cullingPlanesSet                          = false;
+  std::vector<uint8_t> cullingMask               = {};
+  std::vector<uint32_t> visibleInstances         = {};
+  std::vector<uint32_t> previousVisibleInstances = {};
+  // Visible matrices packed at the start of the buffer, uploaded instead of matrixData
+  Float32Array compactedMatrixData = {};
+  bool gpuDataCompacted            = false;
 }; // end of struct _ThinInstanceDataStorage
 
 } // end of namespace BABYLON
@@ -2,10 +2,13 @@
 #define BABYLON_MESHES_BUFFER_H
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/core/profiling/memory_tracker.h>
 
 namespace BABYLON {
 
@@ -19,6 +22,12 @@ FWD_CLASS_SPTR(WebGLDataBuffer)
  */
 class BABYLON_SHARED_EXPORT Buffer : public std::enable_shared_from_this<Buffer> {
 
+public:
+  /**
+   * Maximum number of dirty ranges kept, the closest ones being merged beyond
+   */
+  static constexpr size_t MaxDirtyRanges = 16;
+
 public:
   /**
    * @brief Constructor
@@ -133,6 +142,31 @@ public:
                                     const std::optional<size_t>& vertexCount = std::nullopt,
                                     bool useBytes                            = false);
 
+  /**
+   * @brief Marks a range of the data as modified in place, to be uploaded by the next call to
+   * uploadDirtyRanges(). Overlapping and adjacent ranges are coalesced. The buffer must be
+   * updatable.
+   * @param start defines the index of the first modified float
+   * @param count defines the number of modified floats
+   */
+  void markRange(size_t start, size_t count);
+
+  /**
+   * @brief Gets a boolean indicating if ranges of the data were marked as modified and not
+   * uploaded yet.
+   * @returns true if some ranges must be uploaded
+   */
+  [[nodiscard]] bool hasDirtyRanges() const
+  {
+    return !_dirtyRanges.empty();
+  }
+
+  /**
+   * @brief Uploads the modified ranges of the data to the underlying buffer, one update per
+   * coalesced range.
+   */
+  void uploadDirtyRanges();
+
   /**
    * @brief Hidden
    */
@@ -154,6 +188,9 @@ public:
    */
   size_t byteStride;
 
+private:
+  void _trackDataMemory();
+
 private:
   ThinEngine* _engine;
   WebGLDataBufferPtr _buffer;
@@ -161,6 +198,12 @@ private:
   bool _instanced;
   unsigned int _divisor;
   bool _isAlreadyOwned;
+  // Sorted and disjoint [start, end) float ranges modified since the last upload
+  std::vector<std::pair<size_t, size_t>> _dirtyRanges;
+  // Copy of the range being uploaded
+  Float32Array _rangeData;
+  // CPU copy of the data accounted in the vertex buffers memory
+  TrackedMemory _dataMemory{MemoryCategory::VertexBuffers};
 
 }; // end of class Buffer
 
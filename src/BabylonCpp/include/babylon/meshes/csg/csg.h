@@ -6,7 +6,7 @@
 #include <babylon/maths/matrix.h>
 #include <babylon/maths/quaternion.h>
 #include <babylon/maths/vector3.h>
-#include <babylon/meshes/csg/polygon.h>
+#include <babylon/meshes/csg/polygon_arena.h>
 
 namespace BABYLON {
 
@@ -126,10 +126,10 @@ public:
 
 private:
   /**
-   * @brief Construct a CSG solid from a list of `CSG.Polygon` instances.
+   * @brief Construct a CSG solid from a polygon arena.
    * @param polygons Polygons used to construct a CSG solid
    */
-  static CSGPtr FromPolygons(const std::vector<Polygon>& polygons);
+  static CSGPtr FromPolygons(PolygonArena&& polygons);
 
 public:
   /**
@@ -159,7 +159,7 @@ public:
 
 private:
   static unsigned int currentCSGMeshId;
-  std::vector<Polygon> _polygons;
+  PolygonArena _polygons;
 
 }; // end of class CSG
 
@@ -1,39 +1,59 @@
 #ifndef BABYLON_MESHES_CSG_NODE_H
 #define BABYLON_MESHES_CSG_NODE_H
 
+#include <cstdint>
+#include <vector>
+
 #include <babylon/babylon_api.h>
-#include <babylon/meshes/csg/csg.h>
-#include <babylon/meshes/csg/polygon.h>
+#include <babylon/meshes/csg/plane.h>
 
 namespace BABYLON {
 namespace CSG {
 
+class PolygonArena;
+
 /**
  * @brief class Node
  *
- * Holds a node in a BSP tree. A BSP tree is built from a collection of polygons
+ * Holds a BSP tree. A BSP tree is built from a collection of polygons
  * by picking a polygon to split along. That polygon (and all other coplanar
  * polygons) are added directly to that node and the other polygons are added to
  * the front and/or back subtrees. This is not a leafy BSP tree since there is
- * no distinction between internal and leaf nodes
+ * no distinction between internal and leaf nodes.
+ *
+ * The tree nodes are stored in a flat list and reference the polygons of a
+ * polygon arena by index. All traversals are iterative.
  */
 class BABYLON_SHARED_EXPORT Node {
 
+private:
+  struct _BspNode {
+    Plane plane;
+    int32_t front = -1;
+    int32_t back  = -1;
+    std::vector<uint32_t> polygons;
+  }; // end of struct _BspNode
+
 public:
-  Node();
+  /**
+   * Minimum number of polygons in the tree before `clipTo` is run in parallel
+   */
+  static constexpr size_t ParallelClipThreshold = 2048;
 
+public:
   /**
    * @brief Initializes the node.
-   * @param polygons A collection of polygons held in the node
+   * @param arena The arena holding the polygons of the tree
    */
-  Node(const std::vector<Polygon>& polygons);
-  ~Node(); // = default
+  Node(PolygonArena& arena);
 
   /**
-   * @brief Clones, or makes a deep copy, of the node.
-   * @returns The cloned node
+   * @brief Initializes the node.
+   * @param arena The arena holding the polygons of the tree
+   * @param polygons A collection of polygons held in the node
    */
-  std::unique_ptr<Node> clone();
+  Node(PolygonArena& arena, const std::vector<uint32_t>& polygons);
+  ~Node(); // = default
 
   /**
    * @brief Convert solid space to empty space and empty space to solid space.
@@ -41,25 +61,26 @@ public:
   void invert();
 
   /**
-   * @brief Recursively remove all polygons in `polygons` that are inside this
-   * BSP tree.
+   * @brief Remove all polygons in `polygons` that are inside this BSP tree.
    * @param polygons Polygons to remove from the BSP
+   * @param arena The arena in which the polygon fragments are created
    * @returns Polygons clipped from the BSP
    */
-  std::vector<Polygon> clipPolygons(const std::vector<Polygon>& polygons);
+  [[nodiscard]] std::vector<uint32_t> clipPolygons(const std::vector<uint32_t>& polygons,
+                                                   PolygonArena& arena) const;
 
   /**
    * @brief Remove all polygons in this BSP tree that are inside the other BSP
-   * tree `bsp`.
+   * tree `bsp`. Both trees must share the same arena.
    * @param bsp BSP containing polygons to remove from this BSP
    */
-  void clipTo(Node& bsp);
+  void clipTo(const Node& bsp);
 
   /**
-   * Return a list of all polygons in this BSP tree
-   * @brief @returns List of all polygons in this BSP tree
+   * @brief Return a list of all polygons in this BSP tree
+   * @returns List of all polygons in this BSP tree
    */
-  std::vector<Polygon> allPolygons();
+  [[nodiscard]] std::vector<uint32_t> allPolygons() const;
 
   /**
    * @brief Build a BSP tree out of `polygons`. When called on an existing tree,
@@ -68,13 +89,14 @@ public:
    * (no heuristic is used to pick a good split)
    * @param polygons Polygons used to construct the BSP tree
    */
-  void build(const std::vector<Polygon>& polygons);
+  void build(const std::vector<uint32_t>& polygons);
+
+private:
+  void _clipNodes(const Node& bsp, size_t begin, size_t end, PolygonArena& arena);
 
 private:
-  std::unique_ptr<Plane> _plane;
-  std::unique_ptr<Node> _front;
-  std::unique_ptr<Node> _back;
-  std::vector<Polygon> _polygons;
+  PolygonArena* _arena;
+  std::vector<_BspNode> _nodes;
 
 }; // end of class Node
 
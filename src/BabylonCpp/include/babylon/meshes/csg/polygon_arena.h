@@ -0,0 +1,148 @@
+#ifndef BABYLON_MESHES_CSG_POLYGON_ARENA_H
+#define BABYLON_MESHES_CSG_POLYGON_ARENA_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/meshes/csg/plane.h>
+#include <babylon/meshes/csg/polygon.h>
+#include <babylon/meshes/csg/vertex.h>
+
+namespace BABYLON {
+namespace CSG {
+
+/**
+ * @brief Convex polygon stored in a polygon arena. The vertices of the polygon are the
+ * `vertexCount` consecutive vertices starting at `firstVertex` in the arena owning the polygon.
+ */
+struct BABYLON_SHARED_EXPORT ArenaPolygon {
+  uint32_t firstVertex;
+  uint32_t vertexCount;
+  PolygonOptions shared;
+  Plane plane;
+}; // end of struct ArenaPolygon
+
+/**
+ * @brief Flat storage for the polygons and vertices of a CSG solid.
+ *
+ * Polygons are referenced by index. An arena can be created on top of a read-only parent arena:
+ * polygons read from the parent are addressed with their parent index and polygons created in
+ * the child arena are tagged with `LocalFlag`. This allows several threads to split polygons of a
+ * shared arena concurrently and merge their results afterwards.
+ */
+class BABYLON_SHARED_EXPORT PolygonArena {
+
+public:
+  /**
+   * Flag set on the indices of the polygons owned by an arena created with a parent arena
+   */
+  static constexpr uint32_t LocalFlag = 0x80000000u;
+
+public:
+  /**
+   * @brief Creates a new arena.
+   * @param parent The read-only arena holding the polygons not tagged with `LocalFlag`
+   */
+  PolygonArena(const PolygonArena* parent = nullptr);
+  PolygonArena(const PolygonArena& other);
+  PolygonArena(PolygonArena&& other);
+  PolygonArena& operator=(const PolygonArena& other);
+  PolygonArena& operator=(PolygonArena&& other);
+  ~PolygonArena(); // = default
+
+  /**
+   * @brief Returns the number of polygons owned by the arena.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Reserves storage for the given number of polygons and vertices.
+   */
+  void reserve(size_t polygonCount, size_t vertexCount);
+
+  /**
+   * @brief Adds a polygon to the arena.
+   * @param vertices The vertices of the polygon, must be coplanar and form a convex loop
+   * @param count The number of vertices
+   * @param shared The properties shared across all polygons
+   * @param index Receives the index of the new polygon
+   * @returns false if the polygon is degenerated and was not added
+   */
+  bool addPolygon(const Vertex* vertices, size_t count, const PolygonOptions& shared,
+                  uint32_t& index);
+
+  /**
+   * @brief Appends all polygons of another arena to this arena.
+   * @param other The arena to append (its parent is ignored)
+   * @returns the index of the first appended polygon
+   */
+  uint32_t append(const PolygonArena& other);
+
+  /**
+   * @brief Copies the given polygons into a new compact arena.
+   * @param indices The indices of the polygons to extract
+   * @returns the new arena
+   */
+  [[nodiscard]] PolygonArena extract(const std::vector<uint32_t>& indices) const;
+
+  /**
+   * @brief Returns the polygon referenced by the given index.
+   */
+  [[nodiscard]] const ArenaPolygon& polygon(uint32_t index) const;
+
+  /**
+   * @brief Returns the first vertex of the polygon referenced by the given index.
+   */
+  [[nodiscard]] const Vertex* vertices(uint32_t index) const;
+
+  /**
+   * @brief Flips the face of the given polygon (owned by this arena).
+   */
+  void flip(uint32_t index);
+
+  /**
+   * @brief Flips the faces of all polygons owned by the arena.
+   */
+  void flipAll();
+
+  /**
+   * @brief Split a polygon by a plane if needed, the polygon fragments are created in this arena.
+   * Same semantic as `Plane::splitPolygon`.
+   * @param plane The splitting plane
+   * @param index The index of the polygon to be split
+   * @param coplanarFront Will contain polygons coplanar with the plane that are oriented to the
+   *                      front of the plane
+   * @param coplanarBack Will contain polygons coplanar with the plane that are oriented to the back
+   *                     of the plane
+   * @param front Will contain the polygons in front of the plane
+   * @param back Will contain the polygons begind the plane
+   */
+  void splitPolygon(const Plane& plane, uint32_t index, std::vector<uint32_t>& coplanarFront,
+                    std::vector<uint32_t>& coplanarBack, std::vector<uint32_t>& front,
+                    std::vector<uint32_t>& back);
+
+  /**
+   * @brief Converts a polygon of the arena to a standalone polygon.
+   */
+  [[nodiscard]] Polygon toPolygon(uint32_t index) const;
+
+private:
+  [[nodiscard]] bool _isLocal(uint32_t index) const;
+
+private:
+  const PolygonArena* _parent;
+  uint32_t _flag;
+  std::vector<ArenaPolygon> _polygons;
+  std::vector<Vertex> _vertices;
+  // Scratch buffers reused by splitPolygon
+  std::vector<Vertex> _front;
+  std::vector<Vertex> _back;
+  std::vector<int> _types;
+
+}; // end of class PolygonArena
+
+} // end of namespace CSG
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_CSG_POLYGON_ARENA_H
@@ -7,6 +7,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/core/structs.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 
@@ -148,6 +149,18 @@ public:
   AbstractMesh* updateVerticesData(const std::string& kind, const Float32Array& data,
                                    bool updateExtends = false, bool makeItUnique = false) override;
 
+  /**
+   * @brief Marks a range of vertices whose data was modified in place in the vertex buffer
+   * (through getVertexBuffer(kind)->getData()). The ranges marked before the next bind are
+   * coalesced and only they are uploaded. The vertex buffer must be updatable.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param start defines the index of the first modified vertex
+   * @param count defines the number of modified vertices
+   * @param updateExtends defines if the extends must be grown to include the modified positions.
+   * They are not shrunk, which needs a full scan (see updateVerticesData or refreshBoundingInfo)
+   */
+  void markRange(const std::string& kind, size_t start, size_t count, bool updateExtends = false);
+
   /**
    * @brief Hidden
    */
@@ -402,11 +415,13 @@ protected:
 
 private:
   void _updateBoundingInfo(bool updateExtends, const Float32Array& data);
-  void _updateExtend(Float32Array data);
+  void _updateExtend(const Float32Array& data);
+  void _updateMeshesBoundingInfo();
   void _applyToMesh(Mesh* mesh);
   void notifyUpdate(const std::string& kind = "");
   void _queueLoad(Scene* scene, const std::function<void()>& onLoaded);
   void _disposeVertexArrayObjects();
+  void _trackMemory();
 
 public:
   // Members
@@ -502,6 +517,8 @@ private:
   WebGLDataBufferPtr _indexBuffer;
   bool _indexBufferIsUpdatable;
   std::vector<Vector3> _positionsCache;
+  // Indices and positions caches accounted in the geometry memory
+  TrackedMemory _trackedMemory{MemoryCategory::Geometry};
 
 }; // end of class Geometry
 
@@ -13,6 +13,7 @@ namespace BABYLON {
 
 struct _InstanceDataStorage;
 struct _InternalMeshDataInfo;
+struct ISimplificationSettings;
 struct _ThinInstanceDataStorage;
 struct _VisibleInstances;
 class Geometry;
@@ -43,6 +44,8 @@ struct _UserThinInstanceBuffersStorage {
   std::unordered_map<std::string, size_t> sizes;
   std::unordered_map<std::string, VertexBufferPtr> vertexBuffers;
   std::unordered_map<std::string, size_t> strides;
+  // Values of the visible thin instances, see Mesh::thinInstanceEnableCulling
+  std::unordered_map<std::string, Float32Array> compactedData;
 }; // end of struct UserThinInstanceBuffersStorage
 
 struct SkinningValidationResult {
@@ -262,6 +265,23 @@ public:
    */
   Mesh& removeLODLevel(const MeshPtr& mesh);
 
+  /**
+   * @brief Simplify the mesh according to the given array of settings.
+   * The decimation runs on background threads, the simplified meshes are added as LOD levels of
+   * this mesh once ready.
+   * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the simplification
+   * finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing                 = true,
+                 SimplificationType simplificationType   = SimplificationType::QUADRATIC,
+                 const std::function<void()>& successCallback = nullptr);
+
   /**
    * @brief Returns the registered LOD mesh distant from the parameter `camera`
    * position if any, else returns the current mesh.
@@ -686,6 +706,13 @@ public:
    */
   _InstancesBatchPtr _getInstancesRenderList(size_t subMeshId, bool isReplacementMode = false);
 
+  /**
+   * @brief Hidden
+   * Returns true if the mesh can be drawn as an instance of a mesh sharing its geometry and
+   * material when the scene automatic instancing is enabled.
+   */
+  bool _canBeAutoInstanced();
+
   /**
    * @brief Hidden
    */
@@ -764,9 +791,17 @@ public:
 
   /**
    * @brief Gets the list of world matrices.
-   * @return an array containing all the world matrices from the thin instances
+   * @return an array containing all the world matrices from the thin instances, cached until the
+   * buffer of matrices is replaced
+   */
+  std::vector<Matrix>& thinInstanceGetWorldMatrices();
+
+  /**
+   * @brief Gets the number of thin instances drawn by the last camera pass. This is the number of
+   * thin instances when thinInstanceEnableCulling is false.
+   * @return the number of visible thin instances
    */
-  std::vector<Matrix> thinInstanceGetWorldMatrices();
+  size_t thinInstanceGetVisibleCount() const;
 
   /**
    * @brief Synchronize the gpu buffers with a thin instance buffer. Call this method if you update
@@ -809,6 +844,21 @@ public:
   void _renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode, const EffectPtr& effect,
                                 Engine* engine);
 
+  /**
+   * @brief Hidden
+   */
+  size_t _thinInstanceCull();
+
+  /**
+   * @brief Hidden
+   */
+  void _thinInstanceUpdateCullingData();
+
+  /**
+   * @brief Hidden
+   */
+  void _thinInstanceRestoreBuffers();
+
   /**
    * @brief Register a custom buffer that will be instanced.
    * @see https://doc.babylonjs.com/how_to/how_to_use_instances#custom-buffers
@@ -2198,6 +2248,15 @@ public:
    */
   bool thinInstanceEnablePicking;
 
+  /**
+   * Gets or sets a boolean defining if the thin instances outside of the camera frustum are culled.
+   * The instances are tested against the frustum in clusters of consecutive instances, so buffers
+   * sorted by location cull best. The visible matrices (and the custom attributes) are packed at
+   * the start of the gpu buffers before drawing, which requires updatable buffers. Render target
+   * and shadow passes still draw all the thin instances.
+   */
+  bool thinInstanceEnableCulling;
+
   /**
    * Gets / sets the number of thin instances to display. Note that you can't set a number higher
    * than what the underlying buffer can handle.
@@ -1,27 +1,35 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 #define BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
-#include <babylon/meshes/simplification/decimation_vertex.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Triangle of the mesh being decimated.
+ */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  /**
+   * @brief Creates a new decimation triangle.
+   * @param vertices indices of the triangle corners in the vertex list of the simplifier
+   */
+  DecimationTriangle(const std::array<size_t, 3>& vertices);
   ~DecimationTriangle(); // = default
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  std::array<float, 4> error;
   bool deleted;
   bool isDirty;
   float borderFactor;
   bool deletePending;
   float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  std::array<size_t, 3> vertices;
 
 }; // end of class DecimationTriangle
 
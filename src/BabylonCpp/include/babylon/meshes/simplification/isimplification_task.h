@@ -2,15 +2,17 @@
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFICATION_TASK_H
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_enums.h>
+#include <babylon/babylon_fwd.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
 
-class Mesh;
+FWD_CLASS_SPTR(Mesh)
 
 /**
  * @brief Interface used to define a simplification task.
@@ -27,7 +29,7 @@ struct BABYLON_SHARED_EXPORT ISimplificationTask {
   /**
    * Mesh to simplify
    */
-  Mesh* mesh = nullptr;
+  MeshPtr mesh = nullptr;
   /**
    * Callback called on success
    */
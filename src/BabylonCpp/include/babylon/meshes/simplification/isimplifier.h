@@ -1,10 +1,18 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 
+#include <functional>
+#include <memory>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
+#include <babylon/meshes/simplification/simplified_mesh_data.h>
 
 namespace BABYLON {
 
+FWD_CLASS_SPTR(Mesh)
+
 /**
  * @brief A simplifier interface for future simplification implementations
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
@@ -12,14 +20,33 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
   /**
    * @brief Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs async.
+   * The decimation and the mesh reconstruction both run on the calling thread.
    * @param settings The settings of the simplification, including quality and distance
    * @param successCallback A callback that will be called after the mesh was simplified.
-   * @param errorCallback in case of an error, this callback will be called. optional.
    */
-  virtual void simplify() = 0;
+  virtual void simplify(const ISimplificationSettings& settings,
+                        const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+    = 0;
+
+  /**
+   * @brief Runs the decimation part of the simplification.
+   * Only data owned by the simplifier is accessed, hence this can run on a background thread.
+   * @param settings The settings of the simplification, including quality and distance
+   * @returns the simplified geometry
+   */
+  virtual SimplifiedMeshData decimate(const ISimplificationSettings& settings) const = 0;
+
+  /**
+   * @brief Creates the simplified mesh in the scene of the source mesh.
+   * Must be called on the thread owning the scene.
+   * @param data The simplified geometry returned by `decimate`
+   * @returns the simplified mesh
+   */
+  virtual MeshPtr reconstructMesh(const SimplifiedMeshData& data) const = 0;
 
 }; // end of class ISimplifier
 
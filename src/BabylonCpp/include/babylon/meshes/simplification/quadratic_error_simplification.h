@@ -2,23 +2,94 @@
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
 #include <babylon/meshes/simplification/isimplifier.h>
 
 namespace BABYLON {
 
+class Mesh;
+
 /**
  * @brief An implementation of the Quadratic Error simplification algorithm.
  * Original paper : http://www1.cs.columbia.edu/~cs4162/html05s/garland97.pdf
  * Ported mostly from QSlim and
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html to babylon JS
+ *
+ * Edges are collapsed in order of increasing quadric error using a priority queue. Normals,
+ * tangents, UVs, colors and skinning weights are interpolated along the collapsed edge. Open
+ * borders and attribute seams are preserved.
  * @author RaananW
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
+private:
+  struct _AttributeStream {
+    std::string kind;
+    size_t stride;
+    bool isDirection;
+    Float32Array data;
+  }; // end of struct _AttributeStream
+
+  struct _SubMeshRange {
+    unsigned int materialIndex;
+    size_t indexStart;
+    size_t indexCount;
+  }; // end of struct _SubMeshRange
+
+public:
+  /**
+   * @brief Creates a new simplifier.
+   * The vertex data of the mesh is copied so that the decimation can run without accessing the
+   * mesh.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplification of a given mesh according to the given settings.
+   * @param settings The settings of the simplification, including quality and distance
+   * @param successCallback A callback that will be called after the mesh was simplified.
+   */
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback) override;
+
+  /**
+   * @brief Runs the decimation of all submeshes (thread safe).
+   * @param settings The settings of the simplification, including quality and distance
+   * @returns the simplified geometry
+   */
+  SimplifiedMeshData decimate(const ISimplificationSettings& settings) const override;
+
+  /**
+   * @brief Creates the simplified mesh in the scene of the source mesh.
+   * @param data The simplified geometry returned by `decimate`
+   * @returns the simplified mesh
+   */
+  MeshPtr reconstructMesh(const SimplifiedMeshData& data) const override;
+
+private:
+  void _decimateSubMesh(const _SubMeshRange& subMesh, const ISimplificationSettings& settings,
+                        SimplifiedMeshData& result) const;
+
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * Maximum quadric error (in normalized mesh space) of a collapse, the decimation stops before
+   * reaching the expected quality when this error is exceeded
+   */
+  float maximumError;
+
+private:
+  Mesh* _mesh;
+  Float32Array _positions;
+  std::vector<_AttributeStream> _attributes;
+  Float32Array _matricesIndices;
+  Float32Array _matricesWeights;
+  Float32Array _matricesIndicesExtra;
+  Float32Array _matricesWeightsExtra;
+  IndicesArray _indices;
+  std::vector<_SubMeshRange> _subMeshes;
 
 }; // end of class QuadraticErrorSimplification
 
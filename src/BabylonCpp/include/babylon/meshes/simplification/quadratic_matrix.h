@@ -18,14 +18,25 @@ public:
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
+  float operator[](unsigned int index) const;
+
   float det(unsigned int a11, unsigned int a12, unsigned int a13, //
             unsigned int a21, unsigned int a22, int unsigned a23, //
             int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
   void addArrayInPlace(const std::array<float, 10>& data);
   QuadraticMatrix add(const QuadraticMatrix& matrix);
 
+  /**
+   * @brief Evaluates the quadric error for the given point.
+   * @param x defines the x coordinate of the point
+   * @param y defines the y coordinate of the point
+   * @param z defines the z coordinate of the point
+   * @returns the squared distance error of the point
+   */
+  float vertexError(float x, float y, float z) const;
+
   static QuadraticMatrix FromData(float a, float b, float c, float d);
   static std::array<float, 10> DataFromNumbers(float a, float b, float c, float d);
 
@@ -1,21 +1,32 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <future>
 #include <queue>
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
 #include <babylon/meshes/simplification/isimplification_task.h>
+#include <babylon/meshes/simplification/simplified_mesh_data.h>
 
 namespace BABYLON {
 
-class ISimplifier;
+FWD_CLASS_SPTR(ISimplifier)
 
 /**
  * @brief Queue used to order the simplification tasks.
+ * The decimations run on background threads, the simplified meshes are created and added as LOD
+ * levels on the thread owning the scene.
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
+private:
+  struct _PendingDecimation {
+    std::vector<size_t> settingIndices;
+    std::future<std::vector<SimplifiedMeshData>> result;
+  }; // end of struct _PendingDecimation
+
 public:
   /**
    * @brief Creates a new queue.
@@ -36,12 +47,27 @@ public:
 
   /**
    * @brief Execute a simplification task.
+   * The decimation of every setting is started in the background, in parallel when the task
+   * allows parallel processing and sequentially otherwise.
    * @param task defines the task to run
    */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Creates the meshes of the decimations completed in the background and adds them as LOD
+   * levels of the simplified mesh. Moves to the next task once the running one is complete.
+   * Must be called on the thread owning the scene.
+   */
+  void processCompletedTasks();
+
+  /**
+   * @brief Blocks until all the queued tasks are simplified and their LOD levels added.
+   * Useful to generate the LOD levels at load time.
+   */
+  void flush();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  ISimplifierPtr getSimplifier(const ISimplificationTask& task);
 
 public:
   /**
@@ -51,6 +77,9 @@ public:
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  ISimplificationTask _runningTask;
+  ISimplifierPtr _runningSimplifier;
+  std::vector<_PendingDecimation> _pendingDecimations;
 
 }; // end of class SimplificationQueue
 
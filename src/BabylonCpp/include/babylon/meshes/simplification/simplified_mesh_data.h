@@ -0,0 +1,47 @@
+#ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFIED_MESH_DATA_H
+#define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFIED_MESH_DATA_H
+
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Range of a decimated submesh in the simplified geometry.
+ */
+struct BABYLON_SHARED_EXPORT SimplifiedSubMesh {
+  unsigned int materialIndex = 0;
+  unsigned int verticesStart = 0;
+  size_t verticesCount       = 0;
+  unsigned int indexStart    = 0;
+  size_t indexCount          = 0;
+}; // end of struct SimplifiedSubMesh
+
+/**
+ * @brief Geometry produced by a simplifier before it is turned into a mesh.
+ * This only holds plain data so it can safely be created on a background thread.
+ */
+struct BABYLON_SHARED_EXPORT SimplifiedMeshData {
+  /**
+   * Vertex data of the simplified geometry indexed by vertex buffer kind
+   */
+  std::unordered_map<std::string, Float32Array> vertexData;
+  /**
+   * Strides of the vertex data indexed by vertex buffer kind
+   */
+  std::unordered_map<std::string, size_t> strides;
+  /**
+   * Indices of the simplified geometry
+   */
+  IndicesArray indices;
+  /**
+   * Ranges of the simplified submeshes
+   */
+  std::vector<SimplifiedSubMesh> subMeshes;
+}; // end of struct SimplifiedMeshData
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_SIMPLIFICATION_SIMPLIFIED_MESH_DATA_H
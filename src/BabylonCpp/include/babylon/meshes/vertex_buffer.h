@@ -274,6 +274,20 @@ public:
    */
   WebGLDataBufferPtr updateDirectly(const Float32Array& data, size_t offset, bool useBytes = false);
 
+  /**
+   * @brief Marks vertices whose data was modified in place (through getData()), only these
+   * vertices being uploaded on the next bind. The vertex buffer must be updatable.
+   * @param start defines the index of the first modified vertex
+   * @param count defines the number of modified vertices
+   */
+  void markRange(size_t start, size_t count);
+
+  /**
+   * @brief Hidden
+   * Uploads the ranges marked as modified since the last upload.
+   */
+  void _uploadDirtyRanges();
+
   /**
    * @brief Disposes the VertexBuffer and the underlying WebGLBuffer.
    */
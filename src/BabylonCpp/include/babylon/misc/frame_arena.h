@@ -0,0 +1,83 @@
+#ifndef BABYLON_MISC_FRAME_ARENA_H
+#define BABYLON_MISC_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Linear allocator for the transient containers of a frame, used through the std::pmr
+ * containers.
+ *
+ * Allocations bump a pointer in the current block and deallocations are ignored, the memory is
+ * reclaimed all at once by reset(). When a frame needed more than one block, reset() replaces them
+ * by a single block large enough for the whole frame, so that a steady frame does not reach the
+ * heap anymore. The containers allocated from the arena must not outlive the next reset().
+ */
+class BABYLON_SHARED_EXPORT FrameArena : public std::pmr::memory_resource {
+
+public:
+  static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+public:
+  explicit FrameArena(size_t initialBlockSize = DefaultBlockSize);
+  FrameArena(const FrameArena& other) = delete;
+  FrameArena& operator=(const FrameArena& other) = delete;
+  ~FrameArena() override; // = default
+
+  /**
+   * @brief Releases all the allocations at once, keeping the memory for the next frame.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of bytes allocated since the last reset.
+   */
+  [[nodiscard]] size_t bytesUsed() const
+  {
+    return _bytesUsed;
+  }
+
+  /**
+   * @brief Returns the number of bytes reserved by the arena.
+   */
+  [[nodiscard]] size_t capacity() const;
+
+  /**
+   * @brief Returns the number of blocks reserved by the arena.
+   */
+  [[nodiscard]] size_t blockCount() const
+  {
+    return _blocks.size();
+  }
+
+protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+  }; // end of struct Block
+
+  void _addBlock(size_t size);
+
+private:
+  std::vector<Block> _blocks;
+  // Block being filled and the offset of its first free byte
+  size_t _currentBlock;
+  size_t _offset;
+  size_t _bytesUsed;
+
+}; // end of class FrameArena
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_FRAME_ARENA_H
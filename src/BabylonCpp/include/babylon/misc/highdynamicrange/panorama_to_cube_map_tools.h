@@ -40,8 +40,6 @@ private:
   static Float32Array CreateCubemapTexture(size_t texSize, const std::array<Vector3, 4>& faceData,
                                            const Float32Array& float32Array, size_t inputWidth,
                                            size_t inputHeight);
-  static Color3 CalcProjectionSpherical(const Vector3& vDir, const Float32Array& float32Array,
-                                        size_t inputWidth, size_t inputHeight);
 
 }; // end of struct PanoramaToCubeMapTools
 
@@ -9,7 +9,10 @@
 #ifndef BABYLON_MISC_HIGH_DYNAMIC_RANGE_PMREM_GENERATOR_H
 #define BABYLON_MISC_HIGH_DYNAMIC_RANGE_PMREM_GENERATOR_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
 #include <babylon/maths/vector4.h>
 #include <babylon/misc/highdynamicrange/cmg_bounding_box.h>
 
@@ -145,6 +148,31 @@ public:
   std::vector<std::vector<ArrayBufferView>>& filterCubeMap();
 
 private:
+  // Face and integer texel coordinates (u, v in range from 0 to size - 1)
+  struct _TexelCoord {
+    unsigned int faceIdx;
+    size_t u;
+    size_t v;
+  }; // end of struct _TexelCoord
+
+  // Rows [vBegin, vEnd) of a face of a mip level, the unit of work of the filter
+  struct _FilterTile {
+    size_t levelIndex;
+    unsigned int faceIdx;
+    size_t vBegin;
+    size_t vEnd;
+    float filterConeAngle;
+    float specularPower;
+  }; // end of struct _FilterTile
+
+  // Normalizer cube map face stored as structure of arrays: the texel directions and solid angles
+  struct _NormalizerFace {
+    Float32Array x;
+    Float32Array y;
+    Float32Array z;
+    Float32Array solidAngle;
+  }; // end of struct _NormalizerFace
+
   void init();
 
   //----------------------------------------------------------------------------
@@ -266,7 +294,7 @@ private:
   // Note this method return U and V in range from 0 to size-1
   // SL END
   // Store the information in vector3 for convenience (faceindex, u, v)
-  [[nodiscard]] Vector4 vectToTexelCoord(float x, float y, float z, size_t size) const;
+  [[nodiscard]] _TexelCoord vectToTexelCoord(float x, float y, float z, size_t size) const;
 
   //----------------------------------------------------------------------------
   // Original code from Ignacio CastaÒo
@@ -280,14 +308,31 @@ private:
   [[nodiscard]] float texelCoordSolidAngle(unsigned int faceIdx, float u, float v,
                                            size_t size) const;
 
-  void filterCubeSurfaces(const std::vector<ArrayBufferView>& srcCubeMap, float srcSize,
+  //----------------------------------------------------------------------------
+  // Filters the rows of a tile of the destination cube map with the exhaustive
+  // cosine power filter
+  //----------------------------------------------------------------------------
+  void filterCubeSurfaces(const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
                           std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize,
-                          float filterConeAngle, float specularPower);
+                          const _FilterTile& tile) const;
+
+  //----------------------------------------------------------------------------
+  // Filters the rows of a tile of the destination cube map by importance
+  // sampling the GGX distribution matching the specular power. The samples are
+  // read from the box filtered input mip chain according to their solid angle.
+  //----------------------------------------------------------------------------
+  void filterCubeSurfacesGGX(std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize,
+                             const _FilterTile& tile) const;
+
+  //----------------------------------------------------------------------------
+  // Builds the box filtered mip chain of the input used by the GGX filter
+  //----------------------------------------------------------------------------
+  void buildInputMipChain();
 
   //----------------------------------------------------------------------------
   // Clear filter extents for the 6 cube map faces
   //----------------------------------------------------------------------------
-  void clearFilterExtents(std::array<CMGBoundinBox, 6>& filterExtents);
+  void clearFilterExtents(std::array<CMGBoundinBox, 6>& filterExtents) const;
 
   //----------------------------------------------------------------------------
   // Define per-face bounding box filter extents
@@ -299,18 +344,18 @@ private:
   // cone.
   //
   //----------------------------------------------------------------------------
-  void determineFilterExtents(const Vector4& centerTapDir, size_t srcSize, size_t bboxSize,
+  void determineFilterExtents(const Vector4& centerTapDir, size_t srcSize, float bboxSize,
                               std::array<CMGBoundinBox, 6>& filterExtents) const;
 
   //----------------------------------------------------------------------------
   // ProcessFilterExtents
   //  Process bounding box in each cube face
-  //
+  //  tapDotProducts is a scratch row of srcSize floats
   //----------------------------------------------------------------------------
   Vector4 processFilterExtents(const Vector4& centerTapDir, float dotProdThresh,
                                const std::array<CMGBoundinBox, 6>& filterExtents,
                                const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
-                               size_t specularPower) const;
+                               float specularPower, Float32Array& tapDotProducts) const;
 
   //----------------------------------------------------------------------------
   // Fixup cube edges
@@ -331,12 +376,26 @@ public:
   float cosinePowerDropPerMip;
   bool excludeBase;
   bool fixup;
+  /**
+   * Specifies whether the GGX importance sampling filter is used instead of the
+   * exhaustive cosine power filter (much faster on large cube maps)
+   */
+  bool importanceSampling;
+  /**
+   * The number of samples per texel of the GGX importance sampling filter
+   */
+  size_t sampleCount;
+  /**
+   * The number of threads filtering the cube map (0 means the number of
+   * hardware threads)
+   */
+  size_t workerCount;
 
 private:
   std::vector<std::vector<ArrayBufferView>> _outputSurface;
-  std::vector<ArrayBufferView> _normCubeMap;
-  std::vector<std::vector<ArrayBufferView>> _filterLUT;
-  int _numMipLevels;
+  std::array<_NormalizerFace, 6> _normCubeMap;
+  std::vector<std::vector<ArrayBufferView>> _inputMips;
+  size_t _numMipLevels;
 
 }; // end of class PMREMGenerator
 
@@ -0,0 +1,125 @@
+#ifndef BABYLON_MISC_IMAGE_DECODER_H
+#define BABYLON_MISC_IMAGE_DECODER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Decodes images on a pool of worker threads.
+ *
+ * The files are read and the images decoded on the workers, the callbacks are called with the
+ * decoded images on the thread calling processDecodedImages(), typically the engine thread which
+ * uploads them to the GPU.
+ */
+class BABYLON_SHARED_EXPORT ImageDecoder {
+
+public:
+  using OnDecodedFunction = std::function<void(const Image& image)>;
+  using OnErrorFunction
+    = std::function<void(const std::string& message, const std::string& exception)>;
+
+public:
+  /**
+   * @brief Creates an image decoder.
+   * @param workerCount defines the number of worker threads, the number of hardware threads if 0
+   */
+  explicit ImageDecoder(size_t workerCount = 0);
+  ~ImageDecoder(); // Waits for the decodes in progress
+
+  ImageDecoder(const ImageDecoder& other) = delete;
+  ImageDecoder& operator=(const ImageDecoder& other) = delete;
+
+  /**
+   * @brief Gets the number of worker threads.
+   */
+  [[nodiscard]] size_t workerCount() const;
+
+  /**
+   * @brief Gets the number of images queued or decoded but not yet handed back.
+   */
+  [[nodiscard]] size_t pendingCount() const;
+
+  /**
+   * @brief Queues the decoding of an image from an encoded buffer or a data uri string.
+   * @param input defines the encoded image
+   * @param flipVertically defines whether the image rows are flipped
+   * @param onDecoded defines the callback called with the decoded image
+   * @param onError defines the callback called if the image cannot be read
+   */
+  void decode(const std::variant<std::string, ArrayBuffer, ArrayBufferView>& input,
+              bool flipVertically, const OnDecodedFunction& onDecoded,
+              const OnErrorFunction& onError = nullptr);
+
+  /**
+   * @brief Queues the loading and the decoding of an image file.
+   * @param url defines the url of the image file
+   * @param flipVertically defines whether the image rows are flipped
+   * @param onDecoded defines the callback called with the decoded image
+   * @param onError defines the callback called if the file cannot be read
+   */
+  void decodeUrl(const std::string& url, bool flipVertically, const OnDecodedFunction& onDecoded,
+                 const OnErrorFunction& onError = nullptr);
+
+  /**
+   * @brief Calls the callbacks of the images decoded so far, on the calling thread.
+   * @returns the number of images handed back
+   */
+  size_t processDecodedImages();
+
+  /**
+   * @brief Waits for all the queued images and calls their callbacks, on the calling thread.
+   * @returns the number of images handed back
+   */
+  size_t waitForDecodedImages();
+
+  /**
+   * @brief Decodes encoded images in parallel.
+   * @param buffers defines the encoded images
+   * @param flipVertically defines whether the image rows are flipped
+   * @param workerCount defines the number of worker threads, the number of hardware threads if 0
+   * @returns the decoded images, in the order of the buffers
+   */
+  static std::vector<Image> DecodeBatch(const std::vector<ArrayBuffer>& buffers,
+                                        bool flipVertically, size_t workerCount = 0);
+
+private:
+  struct _DecodeResult {
+    Image image;
+    std::string errorMessage;
+    std::string exception;
+    bool failed = false;
+    OnDecodedFunction onDecoded;
+    OnErrorFunction onError;
+  }; // end of struct _DecodeResult
+
+  void _enqueue(const std::function<void(_DecodeResult& result)>& job,
+                const OnDecodedFunction& onDecoded, const OnErrorFunction& onError);
+  void _workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+  mutable std::mutex _mutex;
+  std::condition_variable _jobAvailable;
+  std::condition_variable _jobDone;
+  std::deque<std::function<void()>> _jobs;
+  std::vector<_DecodeResult> _decoded;
+  size_t _pendingCount;
+  bool _stopping;
+
+}; // end of class ImageDecoder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_IMAGE_DECODER_H
@@ -1,6 +1,9 @@
 #ifndef BABYLON_MISC_OBSERVABLE_H
 #define BABYLON_MISC_OBSERVABLE_H
 
+#include <algorithm>
+#include <vector>
+
 #include <babylon/misc/event_state.h>
 #include <babylon/misc/observer.h>
 
@@ -16,6 +19,11 @@ namespace BABYLON {
  * notifications: Move (mask = 0x01), Stop (mask = 0x02), Turn Right (mask = 0X04), Turn Left (mask
  * = 0X08). A given observer can register itself with only Move and Stop (mask = 0x03), then it will
  * only be notified when one of these two occurs and will never be for Turn Left/Right.
+ *
+ * The observers are stored contiguously next to their mask, a notification only dereferences the
+ * observers it calls and returns immediately when no observer mask matches. The list is not
+ * modified while it is notified: observers removed during a notification keep their slot and
+ * observers added during a notification are inserted when the outermost notification returns.
  */
 template <class T>
 class Observable {
@@ -48,9 +56,21 @@ public:
   /**
    * @brief Gets the list of observers.
    */
-  std::vector<typename Observer<T>::Ptr>& observers()
+  std::vector<typename Observer<T>::Ptr> observers() const
   {
-    return _observers;
+    std::vector<typename Observer<T>::Ptr> observers;
+    observers.reserve(_observers.size() + _addedObservers.size() - _removedCount);
+    for (const auto& entry : _observers) {
+      if (!entry.observer->_willBeUnregistered) {
+        observers.emplace_back(entry.observer);
+      }
+    }
+    for (const auto& [insertFirst, entry] : _addedObservers) {
+      if (!entry.observer->_willBeUnregistered) {
+        observers.emplace(insertFirst ? observers.begin() : observers.end(), entry.observer);
+      }
+    }
+    return observers;
   }
 
   /**
@@ -58,7 +78,7 @@ public:
    */
   operator bool() const
   {
-    return !_observers.empty();
+    return hasObservers();
   }
 
   /**
@@ -81,21 +101,8 @@ public:
       return nullptr;
     }
 
-    const auto observer            = std::make_shared<Observer<T>>(callback, mask, scope);
-    observer->unregisterOnNextCall = unregisterOnFirstCall;
-
-    if (insertFirst) {
-      _observers.insert(_observers.begin(), observer);
-    }
-    else {
-      _observers.emplace_back(observer);
-    }
-
-    if (_onObserverAdded) {
-      _onObserverAdded(observer);
-    }
-
-    return observer;
+    return _add(std::make_shared<Observer<T>>(callback, mask, scope), insertFirst,
+                unregisterOnFirstCall);
   }
 
   /**
@@ -117,21 +124,8 @@ public:
       return nullptr;
     }
 
-    const auto observer = std::make_shared<Observer<T>>(std::move(callback), mask, scope);
-    observer->unregisterOnNextCall = unregisterOnFirstCall;
-
-    if (insertFirst) {
-      _observers.insert(_observers.begin(), observer);
-    }
-    else {
-      _observers.emplace_back(observer);
-    }
-
-    if (_onObserverAdded) {
-      _onObserverAdded(observer);
-    }
-
-    return observer;
+    return _add(std::make_shared<Observer<T>>(std::move(callback), mask, scope), insertFirst,
+                unregisterOnFirstCall);
   }
 
   /**
@@ -142,7 +136,7 @@ public:
    */
   typename Observer<T>::Ptr addOnce(CallbackFunc&& callback)
   {
-    return add(callback, -1, false, nullptr, true);
+    return add(std::move(callback), -1, false, nullptr, true);
   }
 
   /**
@@ -152,16 +146,8 @@ public:
    */
   bool remove(const typename Observer<T>::Ptr& observer)
   {
-    if (!observer) {
-      return false;
-    }
-
-    const auto it
-      = std::find_if(_observers.begin(), _observers.end(),
-                     [observer](const typename Observer<T>::Ptr& obs) { return obs == observer; });
-
-    if (it != _observers.end()) {
-      _deferUnregister(*it);
+    if (auto entry = _find(observer)) {
+      _deferUnregister(*entry);
       return true;
     }
     return false;
@@ -175,44 +161,130 @@ public:
    */
   bool removeCallback(const CallbackFunc& callback)
   {
-    const auto it = std::find_if(_observers.begin(), _observers.end(),
-                                 [callback](const typename Observer<T>::Ptr& obs) {
-                                   const auto ptr1 = obs->callback.template target<CallbackFunc>();
-                                   const auto ptr2 = callback.template target<CallbackFunc>();
-                                   return ptr1 < ptr2;
-                                 });
-
-    if (it != _observers.end()) {
-      _deferUnregister(*it);
+    const auto entry = _findIf([&callback](const _ObserverEntry& entry) {
+      const auto ptr1 = entry.observer->callback.template target<CallbackFunc>();
+      const auto ptr2 = callback.template target<CallbackFunc>();
+      return ptr1 < ptr2;
+    });
+
+    if (entry) {
+      _deferUnregister(*entry);
       return true;
     }
     return false;
   }
 
 private:
-  void _deferUnregister(const typename Observer<T>::Ptr& observer)
+  /**
+   * An observer next to its mask. The mask of an unregistered observer is cleared so that
+   * notifications skip it without dereferencing the observer.
+   */
+  struct _ObserverEntry {
+    int mask;
+    typename Observer<T>::Ptr observer;
+  }; // end of struct _ObserverEntry
+
+  typename Observer<T>::Ptr _add(typename Observer<T>::Ptr&& observer, bool insertFirst,
+                                 bool unregisterOnFirstCall)
   {
-    observer->unregisterOnNextCall = false;
-    observer->_willBeUnregistered  = true;
-    _remove(observer);
+    observer->unregisterOnNextCall = unregisterOnFirstCall;
+    _maskUnion |= observer->mask;
+
+    _ObserverEntry entry{observer->mask, observer};
+    if (_notifyDepth > 0) {
+      _addedObservers.emplace_back(insertFirst, std::move(entry));
+    }
+    else if (insertFirst) {
+      _observers.insert(_observers.begin(), std::move(entry));
+    }
+    else {
+      _observers.emplace_back(std::move(entry));
+    }
+
+    if (_onObserverAdded) {
+      _onObserverAdded(observer);
+    }
+
+    return std::move(observer);
   }
 
-  // This should only be called when not iterating over _observers to avoid
-  // callback skipping. Removes an observer from the _observer Array.
-  bool _remove(const typename Observer<T>::Ptr& observer)
+  // Returns the first registered observer matching the predicate, or nullptr
+  template <typename Predicate>
+  _ObserverEntry* _findIf(Predicate&& predicate)
+  {
+    for (auto& entry : _observers) {
+      if (!entry.observer->_willBeUnregistered && predicate(entry)) {
+        return &entry;
+      }
+    }
+    for (auto& added : _addedObservers) {
+      if (!added.second.observer->_willBeUnregistered && predicate(added.second)) {
+        return &added.second;
+      }
+    }
+    return nullptr;
+  }
+
+  _ObserverEntry* _find(const typename Observer<T>::Ptr& observer)
   {
     if (!observer) {
-      return false;
+      return nullptr;
     }
+    return _findIf([&observer](const _ObserverEntry& entry) { return entry.observer == observer; });
+  }
 
-    const auto index = std::find(_observers.begin(), _observers.end(), observer);
+  void _deferUnregister(_ObserverEntry& entry)
+  {
+    entry.observer->unregisterOnNextCall = false;
+    entry.observer->_willBeUnregistered  = true;
+    entry.mask                           = 0;
+    ++_removedCount;
+    if (_notifyDepth == 0) {
+      _compact();
+    }
+  }
 
-    if (index != _observers.end()) {
-      _observers.erase(index);
-      return true;
+  // This should only be called when not iterating over _observers. Inserts the observers added
+  // during the notification, erases the unregistered ones and recomputes the union of the masks.
+  void _compact()
+  {
+    for (auto& [insertFirst, entry] : _addedObservers) {
+      _observers.emplace(insertFirst ? _observers.begin() : _observers.end(), std::move(entry));
+    }
+    _addedObservers.clear();
+    _observers.erase(std::remove_if(_observers.begin(), _observers.end(),
+                                    [](const _ObserverEntry& entry) {
+                                      return entry.observer->_willBeUnregistered;
+                                    }),
+                     _observers.end());
+    _removedCount = 0;
+    _maskUnion    = 0;
+    for (const auto& entry : _observers) {
+      _maskUnion |= entry.mask;
     }
+  }
 
-    return false;
+  // Moves the entry of a registered observer to the front or the back of the list.
+  void _move(const typename Observer<T>::Ptr& observer, bool toFront)
+  {
+    const auto entry = _find(observer);
+    if (!entry) {
+      return;
+    }
+    // The order of an observer added during the notification is applied when it is inserted
+    for (auto& added : _addedObservers) {
+      if (&added.second == entry) {
+        added.first = toFront;
+        return;
+      }
+    }
+    const auto it = _observers.begin() + (entry - _observers.data());
+    if (toFront) {
+      std::rotate(_observers.begin(), it, it + 1);
+    }
+    else {
+      std::rotate(it, it + 1, _observers.end());
+    }
   }
 
 public:
@@ -223,8 +295,7 @@ public:
    */
   void makeObserverTopPriority(const typename Observer<T>::Ptr& observer)
   {
-    _remove(observer);
-    _observers.insert(_observers.begin(), observer);
+    _move(observer, true);
   }
 
   /**
@@ -234,8 +305,7 @@ public:
    */
   void makeObserverBottomPriority(const typename Observer<T>::Ptr& observer)
   {
-    _remove(observer);
-    _observers.emplace_back(observer);
+    _move(observer, false);
   }
 
   /**
@@ -254,7 +324,7 @@ public:
   bool notifyObservers(T* eventData = nullptr, int mask = -1, any* target = nullptr,
                        any* currentTarget = nullptr, any userInfo = nullptr)
   {
-    if (_observers.empty()) {
+    if ((mask & _maskUnion) == 0) {
       return true;
     }
 
@@ -266,23 +336,36 @@ public:
     state.lastReturnValue   = eventData;
     state.userInfo          = userInfo;
 
-    for (const auto& obs : _observers) {
-      if (obs->_willBeUnregistered) {
+    // The entries are neither reallocated nor erased until the outermost notification returns
+    ++_notifyDepth;
+    auto notifiedAll = true;
+    auto* entries    = _observers.data();
+    const auto count = _observers.size();
+    for (size_t index = 0; index < count; ++index) {
+      auto& entry = entries[index];
+      if ((entry.mask & mask) == 0) {
         continue;
       }
 
-      if (obs->mask & mask) {
-        obs->callback(eventData, state);
+      auto& obs = *entry.observer;
+      if (obs._willBeUnregistered) {
+        continue;
+      }
 
-        if (obs->unregisterOnNextCall) {
-          _deferUnregister(obs);
-        }
+      obs.callback(eventData, state);
+
+      if (obs.unregisterOnNextCall) {
+        _deferUnregister(entry);
       }
       if (state.skipNextObservers) {
-        return false;
+        notifiedAll = false;
+        break;
       }
     }
-    return true;
+    if (--_notifyDepth == 0 && (_removedCount > 0 || !_addedObservers.empty())) {
+      _compact();
+    }
+    return notifiedAll;
   }
 
   /**
@@ -294,7 +377,7 @@ public:
   void notifyObserver(const typename Observer<T>::Ptr& observer, T* eventData = nullptr,
                       int mask = -1)
   {
-    if (observer._willBeUnregistered) {
+    if (observer->_willBeUnregistered) {
       return;
     }
 
@@ -302,10 +385,10 @@ public:
     state.mask              = mask;
     state.skipNextObservers = false;
 
-    observer.callback(eventData, state);
+    observer->callback(eventData, state);
 
-    if (observer.unregisterOnNextCall) {
-      _deferUnregister(observer);
+    if (observer->unregisterOnNextCall) {
+      remove(observer);
     }
   }
 
@@ -315,7 +398,7 @@ public:
    */
   bool hasObservers() const
   {
-    return !_observers.empty();
+    return _observers.size() + _addedObservers.size() > _removedCount;
   }
 
   /**
@@ -323,7 +406,23 @@ public:
    */
   void clear()
   {
-    _observers.clear();
+    if (_notifyDepth > 0) {
+      for (auto& entry : _observers) {
+        if (!entry.observer->_willBeUnregistered) {
+          _deferUnregister(entry);
+        }
+      }
+      for (auto& added : _addedObservers) {
+        if (!added.second.observer->_willBeUnregistered) {
+          _deferUnregister(added.second);
+        }
+      }
+    }
+    else {
+      _observers.clear();
+      _removedCount = 0;
+      _maskUnion    = 0;
+    }
     _onObserverAdded = nullptr;
   }
 
@@ -335,7 +434,10 @@ public:
   {
     const Observable<T>::SPtr result = std::make_shared<Observable<T>>();
 
-    result->_observers = _observers;
+    for (const auto& observer : observers()) {
+      result->_observers.emplace_back(_ObserverEntry{observer->mask, observer});
+      result->_maskUnion |= observer->mask;
+    }
 
     return result;
   }
@@ -347,16 +449,21 @@ public:
    **/
   bool hasSpecificMask(int mask = -1)
   {
-    for (const auto& obs : _observers) {
-      if (obs->mask & mask || obs->mask == mask) {
-        return true;
-      }
-    }
-    return false;
+    const auto entry = _findIf(
+      [mask](const _ObserverEntry& entry) { return entry.mask & mask || entry.mask == mask; });
+    return entry != nullptr;
   }
 
 private:
-  std::vector<typename Observer<T>::Ptr> _observers;
+  std::vector<_ObserverEntry> _observers;
+  // Observers added during the notification and whether they are inserted first
+  std::vector<std::pair<bool, _ObserverEntry>> _addedObservers;
+  // Number of unregistered observers waiting for the end of the notification to be erased
+  size_t _removedCount = 0;
+  // Union of the masks of the observers, a notification matching none of them returns early
+  int _maskUnion = 0;
+  // Depth of the nested notifications
+  unsigned int _notifyDepth = 0;
   EventState _eventState;
   std::function<void(const typename Observer<T>::Ptr& observer)> _onObserverAdded;
 
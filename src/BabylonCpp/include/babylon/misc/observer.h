@@ -45,6 +45,21 @@ public:
   {
   }
 
+  /**
+   * @brief Creates a new observer.
+   * @param callback defines the callback to call when the observer is notified
+   * @param mask defines the mask of the observer (used to filter notifications)
+   * @param scope defines the current scope used to restore the JS context
+   */
+  Observer(CallbackFunc&& iCallback, int iMask, any* iScope)
+      : _willBeUnregistered{false}
+      , unregisterOnNextCall{false}
+      , callback{std::move(iCallback)}
+      , mask{iMask}
+      , scope{iScope}
+  {
+  }
+
   ~Observer() = default;
 
   operator bool() const
@@ -65,7 +80,8 @@ public:
    */
   CallbackFunc callback;
   /**
-   * Defines the mask of the observer (used to filter notifications)
+   * Defines the mask of the observer (used to filter notifications), it is read when the observer
+   * is added to an Observable
    */
   int mask;
   /**
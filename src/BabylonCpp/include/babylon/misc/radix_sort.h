@@ -0,0 +1,57 @@
+#ifndef BABYLON_MISC_RADIX_SORT_H
+#define BABYLON_MISC_RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Stable sort of indices by 64-bit keys.
+ *
+ * The sorter keeps its working buffers between calls so that sorting the same amount of elements
+ * every frame does not allocate. Keys sharing a byte are detected and the corresponding radix
+ * pass is skipped.
+ */
+class BABYLON_SHARED_EXPORT RadixSort {
+
+public:
+  RadixSort();
+  ~RadixSort(); // = default
+
+  /**
+   * @brief Sorts the indices of the keys by increasing key value. Indices of equal keys keep
+   * their relative order.
+   * @param keys The sort keys
+   * @param order Receives the sorted indices
+   */
+  void sort(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order);
+
+  /**
+   * @brief Sorts a permutation of the indices of the keys, typically the sorted order of the
+   * previous frame. The result is the same as `sort`. A permutation which is already sorted is
+   * only checked, a nearly sorted permutation is fixed with an insertion sort, otherwise the
+   * indices are radix sorted.
+   * @param keys The sort keys
+   * @param order The permutation to sort, replaced by the sorted indices
+   * @returns true if the permutation was already sorted
+   */
+  bool sortCoherent(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order);
+
+  /**
+   * @brief Maps a float to an unsigned integer with the same ordering.
+   * @param value The float to convert
+   * @returns the order preserving bits
+   */
+  static uint32_t FloatToOrderedBits(float value);
+
+private:
+  std::vector<uint32_t> _scratch;
+
+}; // end of class RadixSort
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_RADIX_SORT_H
@@ -0,0 +1,116 @@
+#ifndef BABYLON_MISC_TEXTURE_DISK_CACHE_H
+#define BABYLON_MISC_TEXTURE_DISK_CACHE_H
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+
+namespace BABYLON {
+
+class MemoryMappedFile;
+FWD_CLASS_SPTR(SphericalPolynomial)
+
+/**
+ * @brief Statistics of the texture disk cache.
+ */
+struct BABYLON_SHARED_EXPORT TextureDiskCacheStats {
+  /**
+   * Number of textures read from the cache
+   */
+  size_t hits = 0;
+  /**
+   * Number of textures not found in the cache
+   */
+  size_t misses = 0;
+  /**
+   * Number of textures written to the cache
+   */
+  size_t stores = 0;
+  /**
+   * Number of processed bytes read from the cache instead of being computed again
+   */
+  size_t bytesSaved = 0;
+}; // end of struct TextureDiskCacheStats
+
+/**
+ * @brief Processed texture read from the texture disk cache. The levels (faces or mip levels)
+ * point into the memory mapped cache file.
+ */
+struct BABYLON_SHARED_EXPORT TextureDiskCacheEntry {
+  int width           = 0;
+  int height          = 0;
+  unsigned int format = 0;
+  unsigned int type   = 0;
+  std::vector<std::string_view> levels;
+  SphericalPolynomialPtr sphericalPolynomial = nullptr;
+  std::shared_ptr<MemoryMappedFile> mappedFile;
+}; // end of struct TextureDiskCacheEntry
+
+/**
+ * @brief Persistent cache of decoded and preprocessed textures.
+ *
+ * The entries are keyed by a hash of the source bytes and of the processing parameters and store
+ * the GPU ready pixels with the spherical polynomial of the environment maps. The cache is
+ * disabled until a directory is set, it can be used from several threads.
+ */
+struct BABYLON_SHARED_EXPORT TextureDiskCache {
+
+  /**
+   * Extension of the cache files
+   */
+  static constexpr const char* Extension = ".btex";
+
+  /**
+   * @brief Sets the directory of the cache files, the directory must exist. An empty directory
+   * disables the cache.
+   */
+  static void SetDirectory(const std::string& directory);
+
+  /**
+   * @brief Returns whether the cache is enabled.
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief Computes the key of a processed texture.
+   * @param source defines the source bytes of the texture
+   * @param parameters defines the processing parameters, they are part of the key
+   * @returns the cache key
+   */
+  static std::string Key(std::string_view source, const std::string& parameters);
+
+  /**
+   * @brief Reads a processed texture from the cache.
+   * @param key defines the cache key
+   * @returns the cached texture, or nullopt if the texture is not cached or the cache is disabled
+   */
+  static std::optional<TextureDiskCacheEntry> Load(const std::string& key);
+
+  /**
+   * @brief Writes a processed texture to the cache.
+   * @param key defines the cache key
+   * @param entry defines the texture, its levels are copied to the cache file
+   * @returns true if the texture was written
+   */
+  static bool Store(const std::string& key, const TextureDiskCacheEntry& entry);
+
+  /**
+   * @brief Gets the cache statistics since the last reset.
+   */
+  static TextureDiskCacheStats GetStats();
+
+  /**
+   * @brief Resets the cache statistics.
+   */
+  static void ResetStats();
+
+}; // end of struct TextureDiskCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_TEXTURE_DISK_CACHE_H
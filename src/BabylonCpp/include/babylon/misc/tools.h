@@ -154,24 +154,25 @@ struct BABYLON_SHARED_EXPORT Tools {
   static void DumpFramebuffer(int width, int height, Engine* engine);
 
   /**
-   * @brief Starts a performance counter.
+   * @brief Starts a performance counter, recorded as a FrameProfiler zone.
    */
-  static void StartPerformanceCounter(const std::string&);
+  static void StartPerformanceCounter(const std::string& counterName);
 
   /**
-   * @brief Starts a performance counter.
+   * @brief Starts a performance counter if the condition is true.
    */
-  static void StartPerformanceCounter(const std::string&, bool);
+  static void StartPerformanceCounter(const std::string& counterName, bool condition);
 
   /**
-   * @brief Ends a specific performance counter.
+   * @brief Ends a specific performance counter, counters must be ended in the reverse order they
+   * were started.
    */
-  static void EndPerformanceCounter(const std::string&);
+  static void EndPerformanceCounter(const std::string& counterName);
 
   /**
-   * @brief Ends a specific performance counter.
+   * @brief Ends a specific performance counter if the condition is true.
    */
-  static void EndPerformanceCounter(const std::string&, bool);
+  static void EndPerformanceCounter(const std::string& counterName, bool condition);
 
   static void ExitFullscreen();
   static void RequestFullscreen(ICanvas*);
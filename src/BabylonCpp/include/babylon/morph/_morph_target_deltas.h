@@ -0,0 +1,31 @@
+#ifndef BABYLON_MORPH_MORPH_TARGET_DELTAS_H
+#define BABYLON_MORPH_MORPH_TARGET_DELTAS_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Hidden
+ * Differences between a morph target and the base shape of a mesh, used to blend the targets on
+ * the CPU. Targets moving few vertices only store these vertices.
+ */
+struct BABYLON_SHARED_EXPORT _MorphTargetDeltas {
+  // Whether only the moving vertices are stored
+  bool sparse = false;
+  // Sorted indices of the moving vertices, when sparse
+  Uint32Array indices = {};
+  // 3 floats per vertex, or per moving vertex when sparse
+  Float32Array positions = {};
+  // Same layout as the positions, empty when the normals are not morphed
+  Float32Array normals = {};
+  // Base shape the deltas were computed against
+  const float* basePositions = nullptr;
+  const float* baseNormals   = nullptr;
+  bool isDirty               = true;
+}; // end of struct _MorphTargetDeltas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MORPH_MORPH_TARGET_DELTAS_H
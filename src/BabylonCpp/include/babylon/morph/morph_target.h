@@ -8,6 +8,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
 #include <babylon/misc/observable.h>
+#include <babylon/morph/_morph_target_deltas.h>
 
 using json = nlohmann::json;
 
@@ -24,6 +25,12 @@ FWD_CLASS_SPTR(MorphTarget)
  */
 class BABYLON_SHARED_EXPORT MorphTarget : public IAnimatable {
 
+public:
+  /**
+   * Targets moving less than this ratio of the vertices store their deltas sparsely
+   */
+  static constexpr float SparseDeltasRatio = 0.5f;
+
 public:
   template <typename... Ts>
   static MorphTargetPtr New(Ts&&... args)
@@ -134,6 +141,17 @@ public:
    */
   std::string getClassName() const;
 
+  /**
+   * @brief Hidden
+   * Returns the differences between this target and a base shape, computed the first time and
+   * kept until the data of the target or the base shape change.
+   * @param basePositions defines the positions of the base shape
+   * @param baseNormals defines the normals of the base shape, null if the normals are not morphed
+   * @returns the deltas, sparse when the target moves less than SparseDeltasRatio of the vertices
+   */
+  const _MorphTargetDeltas& _getDeltas(const Float32Array& basePositions,
+                                       const Float32Array* baseNormals);
+
   // Statics
 
   /**
@@ -272,6 +290,7 @@ private:
   float _influence;
   size_t _uniqueId;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
+  _MorphTargetDeltas _deltas;
 
 }; // end of class MorphTarget
 
@@ -8,6 +8,7 @@
 
 namespace BABYLON {
 
+class Mesh;
 FWD_CLASS_SPTR(MorphTargetManager)
 
 /**
@@ -16,6 +17,12 @@ FWD_CLASS_SPTR(MorphTargetManager)
  */
 class BABYLON_SHARED_EXPORT MorphTargetManager {
 
+public:
+  /**
+   * Vertex count above which the CPU morphing is split in chunks blended in parallel
+   */
+  static constexpr size_t ParallelBlendThreshold = 16384;
+
 public:
   template <typename... Ts>
   static MorphTargetManagerPtr New(Ts&&... args)
@@ -74,6 +81,20 @@ public:
    */
   void synchronize();
 
+  /**
+   * @brief Hidden
+   * Blends the active targets on the CPU and writes the result in the position and normal buffers
+   * of the mesh, the base shape being saved the first time as for the software skinning.
+   * @param mesh defines the mesh to morph
+   */
+  void _applyToMesh(Mesh& mesh);
+
+  /**
+   * @brief Hidden
+   * Blends the meshes again when influences changed since the last blend, once per frame.
+   */
+  void _updateCpuMorphing();
+
   // Statics
   static MorphTargetManagerPtr Parse(const json& serializationObject, Scene* scene);
 
@@ -124,6 +145,16 @@ protected:
    */
   Float32Array& get_influences();
 
+  /**
+   * @brief Gets a boolean indicating if the targets are blended on the CPU instead of the shaders.
+   */
+  bool get_enableCpuMorphing() const;
+
+  /**
+   * @brief Sets a boolean indicating if the targets are blended on the CPU instead of the shaders.
+   */
+  void set_enableCpuMorphing(bool value);
+
   void _syncActiveTargets(bool needUpdate);
 
 public:
@@ -174,7 +205,8 @@ public:
   ReadOnlyProperty<MorphTargetManager, size_t> numTargets;
 
   /**
-   * Number of influencers (ie. the number of targets with influences > 0)
+   * Number of influencers (ie. the number of targets with influences > 0), 0 when the targets are
+   * blended on the CPU as the shaders have nothing to morph then
    */
   ReadOnlyProperty<MorphTargetManager, size_t> numInfluencers;
 
@@ -183,6 +215,13 @@ public:
    */
   ReadOnlyProperty<MorphTargetManager, Float32Array> influences;
 
+  /**
+   * Gets or sets a boolean indicating if the targets are blended on the CPU and written in the
+   * position and normal buffers of the meshes, for headless or software rendering. Targets moving
+   * few vertices are then blended from sparse deltas.
+   */
+  Property<MorphTargetManager, bool> enableCpuMorphing;
+
 private:
   std::vector<MorphTargetPtr> _targets;
   std::vector<Observer<bool>::Ptr> _targetInfluenceChangedObservers;
@@ -196,6 +235,12 @@ private:
   size_t _vertexCount;
   size_t _uniqueId;
   Float32Array _tempInfluences;
+  bool _enableCpuMorphing;
+  bool _cpuMorphingDirty;
+  // Blended shape and the targets blended into it
+  Float32Array _cpuPositions;
+  Float32Array _cpuNormals;
+  std::vector<std::pair<const _MorphTargetDeltas*, float>> _cpuTargets;
 
 }; // end of class MorphTargetManager
 
@@ -3,6 +3,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/maths/color4.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
@@ -203,6 +204,7 @@ public:
 
 private:
   unsigned int _currentFrameCounter;
+  TrackedMemory _trackedMemory{MemoryCategory::Particles, sizeof(Particle)};
 
 }; // end of class Particle
 
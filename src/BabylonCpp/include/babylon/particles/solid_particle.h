@@ -7,6 +7,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/maths/color4.h>
 #include <babylon/maths/quaternion.h>
@@ -218,6 +219,9 @@ public:
 
   std::unordered_map<std::string, float> extraFields;
 
+private:
+  TrackedMemory _trackedMemory{MemoryCategory::Particles, sizeof(SolidParticle)};
+
 }; // end of class SolidParticle
 
 } // end of namespace BABYLON
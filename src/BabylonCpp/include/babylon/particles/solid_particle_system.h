@@ -1,6 +1,7 @@
 #ifndef BABYLON_PARTICLES_SOLID_PARTICLE_SYSTEM_H
 #define BABYLON_PARTICLES_SOLID_PARTICLE_SYSTEM_H
 
+#include <array>
 #include <functional>
 
 #include <babylon/babylon_api.h>
@@ -73,6 +74,12 @@ public:
   }
   ~SolidParticleSystem() override; // = default
 
+  /**
+   * Number of particles from which `setParticles()` splits the particles in chunks processed in
+   * parallel, when the particles have no parent and no vertex function is used
+   */
+  static constexpr size_t ParallelUpdateThreshold = 4096;
+
   /**
    * @brief Builds the SPS underlying mesh. Returns a standard Mesh.
    * If no model shape was added to the SPS, the returned mesh is just a single triangular plane.
@@ -297,6 +304,16 @@ public:
    */
   virtual SolidParticle* updateParticle(SolidParticle* particle);
 
+  /**
+   * @brief Updates a range of particles : it can be overwritten by the user instead of
+   * `updateParticle()`, to update all the particles in a single call. It is called once by
+   * `setParticles()` before the particles are transformed, the default implementation calls
+   * `updateParticle()` on each particle of the range.
+   * @param start the index of the first particle to update in the particle array
+   * @param stop the index of the last particle to update in the particle array
+   */
+  virtual void updateParticles(size_t start, size_t stop);
+
   /**
    * @brief Updates a vertex of a particle : it can be overwritten by the user.
    * This will be called on each vertex particle by `setParticles()` if `computeParticleVertex` is
@@ -499,6 +516,32 @@ private:
    */
   void _resetCopy();
 
+  /**
+   * @brief Transforms the particles of the range [start, end] and updates their vertex data. Only
+   * the particles of the range are written, so that disjoint ranges can be set concurrently.
+   * @param start the index of the first particle
+   * @param end the index of the last particle
+   * @param camAxes the camera axes in the mesh local system (identity when not billboarded)
+   * @param camInvertedPosition the camera position in the mesh local system
+   * @param minimum the minimum of the bounding box, extended with the particle vertices
+   * @param maximum the maximum of the bounding box, extended with the particle vertices
+   * @hidden
+   */
+  void _setParticlesRange(size_t start, size_t end, const std::array<Vector3, 3>& camAxes,
+                          const Vector3& camInvertedPosition, Vector3& minimum, Vector3& maximum);
+
+  /**
+   * @brief Uploads the vertex data of a kind, only the vertices of the updated particles when the
+   * vertex buffer can be updated in place.
+   * @param kind the vertex data kind
+   * @param data the vertex data of the whole mesh
+   * @param firstVertex the index of the first vertex of the updated particles
+   * @param vertexCount the number of vertices of the updated particles
+   * @hidden
+   */
+  void _updateVerticesData(const std::string& kind, const Float32Array& data, size_t firstVertex,
+                           size_t vertexCount);
+
   /**
    * @brief Inserts the shape model geometry in the global SPS mesh by updating the positions,
    * indices, normals, colors, uvs arrays
@@ -841,6 +884,8 @@ private:
   bool _particlesIntersect;
   bool _needs32Bits;
   bool _isNotBuilt;
+  // Whether particles were set without updating the vertex buffers since the last update
+  bool _verticesNotUploaded;
   size_t _lastParticleId;
   std::vector<size_t> _idxOfId; // array : key = particle.id / value = particle.idx
   bool _multimaterialEnabled;
@@ -8,6 +8,7 @@
 #include <babylon/babylon_common.h>
 #include <babylon/babylon_fwd.h>
 #include <babylon/maths/vector3.h>
+#include <babylon/misc/radix_sort.h>
 
 namespace BABYLON {
 
@@ -30,6 +31,21 @@ FWD_CLASS_SPTR(SubMesh)
 class BABYLON_SHARED_EXPORT RenderingGroup {
 
 public:
+  using SortKeyFn = uint64_t (*)(const SubMesh* subMesh);
+
+  /**
+   * Sort state of a submesh queue kept between frames. The built-in comparison functions are
+   * replaced by 64-bit sort keys radix sorted into persistent buffers.
+   */
+  struct _SortCache {
+    SortKeyFn sortKey = nullptr;
+    RadixSort sorter;
+    std::vector<SubMesh*> previousSubMeshes;
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> order;
+    std::vector<SubMesh*> sortedSubMeshes;
+  }; // end of struct _SortCache
+
   /**
    * @brief Creates a new rendering group.
    * @param index The rendering group index
@@ -88,7 +104,46 @@ public:
    * @param b The second submesh
    * @returns The result of the comparison
    */
-  static bool frontToBackSortCompare(SubMesh* a, SubMesh* b);
+  static bool frontToBackSortCompare(const SubMesh* a, const SubMesh* b);
+
+  /**
+   * @brief Build in function which can be applied to ensure meshes of a special queue (opaque,
+   * alpha test) are grouped by material to limit the state changes, and rendered front to back
+   * for a given material.
+   *
+   * @param a The first submesh
+   * @param b The second submesh
+   * @returns The result of the comparison
+   */
+  static bool materialSortCompare(const SubMesh* a, const SubMesh* b);
+
+  /**
+   * @brief Build in function which can be applied to ensure meshes of a special queue (opaque,
+   * alpha test) are grouped by effect, then material, then geometry to limit the effect, uniform
+   * and vertex buffer rebinds between draws.
+   *
+   * @param a The first submesh
+   * @param b The second submesh
+   * @returns The result of the comparison
+   */
+  static bool stateSortCompare(const SubMesh* a, const SubMesh* b);
+
+  /**
+   * @brief Sorts the submeshes using the sort cache.
+   * @param subMeshes The submeshes to sort
+   * @param sortCompareFn The comparison function use to sort, used when no sort key is available
+   * @param cache The sort state of the queue
+   * @returns The sorted submeshes
+   */
+  static const std::vector<SubMesh*>&
+  sortSubMeshes(const std::vector<SubMesh*>& subMeshes,
+                const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
+                _SortCache& cache);
+
+  /**
+   * @brief Returns the sort key matching a built-in comparison function, nullptr otherwise.
+   */
+  static SortKeyFn getSortKey(const std::function<bool(const SubMesh* a, const SubMesh* b)>& fn);
 
   /**
    * @brief Resets the different lists of submeshes to prepare a new frame.
@@ -141,13 +196,14 @@ private:
    * @brief Renders the submeshes in a specified order.
    * @param subMeshes The submeshes to sort before render
    * @param sortCompareFn The comparison function use to sort
+   * @param cache The sort state of the queue
    * @param camera The camera to use to preprocess the submeshes to help sorting
    * @param transparent Specifies to activate blending if true
    */
   static void
   renderSorted(const std::vector<SubMesh*>& subMeshes,
                const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
-               const CameraPtr& camera, bool transparent);
+               _SortCache& cache, const CameraPtr& camera, bool transparent);
 
   /**
    * @brief Renders the submeshes in the order they were dispatched (no sort
@@ -224,6 +280,11 @@ private:
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderAlphaTest;
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderTransparent;
 
+  _SortCache _opaqueSortCache;
+  _SortCache _alphaTestSortCache;
+  _SortCache _depthOnlySortCache;
+  _SortCache _transparentSortCache;
+
 }; // end of class RenderingGroup
 
 } // end of namespace BABYLON
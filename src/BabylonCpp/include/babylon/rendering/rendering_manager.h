@@ -123,6 +123,15 @@ public:
     const std::function<int(const SubMesh* a, const SubMesh* b)>& transparentSortCompareFn
     = nullptr);
 
+  /**
+   * @brief Enables or disables the state sorted rendering of the opaque and alpha test submeshes.
+   * When enabled, the rendering groups without a custom sort function render these submeshes
+   * grouped by effect, then material, then geometry to limit the state changes between draws.
+   *
+   * @param enabled Defines if the state sorted rendering is enabled
+   */
+  void setStateSortedRendering(bool enabled);
+
   /**
    * @brief Specifies whether or not the stencil and depth buffer are cleared between two rendering
    * groups.
@@ -146,6 +155,7 @@ public:
 private:
   void _clearDepthStencilBuffer(bool depth = true, bool stencil = true);
   void _prepareRenderingGroup(unsigned int renderingGroupId);
+  void _applyRenderingOrder(unsigned int renderingGroupId);
 
 public:
   /**
@@ -157,6 +167,7 @@ private:
   Scene* _scene;
   std::vector<std::unique_ptr<RenderingGroup>> _renderingGroups;
   bool _depthStencilBufferAlreadyCleaned;
+  bool _stateSortedRendering;
 
   std::vector<IRenderingManagerAutoClearSetup> _autoClearDepthStencil;
   std::vector<std::function<int(const SubMesh* a, const SubMesh* b)>> _customOpaqueSortCompareFn;
@@ -647,6 +647,7 @@ AnimationPtr Animation::clone() const
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
   _keys = values;
+  _keysMemory.set(_keys.capacity() * sizeof(IAnimationKey));
 }
 
 json Animation::serialize() const
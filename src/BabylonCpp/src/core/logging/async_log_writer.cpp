@@ -0,0 +1,132 @@
+#include <babylon/core/logging/async_log_writer.h>
+
+#include <chrono>
+
+namespace BABYLON {
+
+AsyncLogWriter::AsyncLogWriter(size_t capacity, const DispatchFunc& dispatch)
+    : _mask{0}
+    , _dispatch{dispatch}
+    , _enqueuePosition{0}
+    , _dequeuePosition{0}
+    , _dropped{0}
+    , _running{true}
+{
+  size_t size = 2;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  _mask  = size - 1;
+  _slots = std::make_unique<Slot[]>(size);
+  for (size_t i = 0; i < size; ++i) {
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  _thread = std::thread([this]() { _run(); });
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running = false;
+  }
+  _wakeUp.notify_one();
+  _thread.join();
+}
+
+bool AsyncLogWriter::push(LogMessage&& msg)
+{
+  // Bounded queue of D. Vyukov: a slot is free for the producer at position
+  // p when its sequence is p, and ready for the consumer when it is p + 1
+  auto position = _enqueuePosition.load(std::memory_order_relaxed);
+  Slot* slot    = nullptr;
+  for (;;) {
+    slot                = &_slots[position & _mask];
+    const auto sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff     = static_cast<std::ptrdiff_t>(sequence - position);
+    if (diff == 0) {
+      if (_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                 std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    else if (diff < 0) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else {
+      position = _enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+  slot->message = std::move(msg);
+  slot->sequence.store(position + 1, std::memory_order_release);
+  return true;
+}
+
+void AsyncLogWriter::flush()
+{
+  const auto position = _enqueuePosition.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(_mutex);
+  _wakeUp.notify_one();
+  _dispatched.wait(lock, [this, position]() {
+    return _dequeuePosition.load(std::memory_order_acquire) >= position
+           || !_running;
+  });
+}
+
+size_t AsyncLogWriter::capacity() const
+{
+  return _mask + 1;
+}
+
+size_t AsyncLogWriter::written() const
+{
+  return _dequeuePosition.load(std::memory_order_acquire);
+}
+
+size_t AsyncLogWriter::dropped() const
+{
+  return _dropped.load(std::memory_order_relaxed);
+}
+
+size_t AsyncLogWriter::_dispatchQueued()
+{
+  size_t count  = 0;
+  auto position = _dequeuePosition.load(std::memory_order_relaxed);
+  for (;;) {
+    auto& slot = _slots[position & _mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+      break;
+    }
+    _dispatch(slot.message);
+    slot.message.clear();
+    // Hands the slot back to the producers for the next lap
+    slot.sequence.store(position + _mask + 1, std::memory_order_release);
+    _dequeuePosition.store(++position, std::memory_order_release);
+    ++count;
+  }
+  return count;
+}
+
+void AsyncLogWriter::_run()
+{
+  // The producers do not signal new messages, the writer polls
+  static constexpr std::chrono::milliseconds pollInterval{2};
+  for (;;) {
+    const auto count = _dispatchQueued();
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (count > 0) {
+      _dispatched.notify_all();
+    }
+    if (!_running) {
+      break;
+    }
+    if (count == 0) {
+      _wakeUp.wait_for(lock, pollInterval);
+    }
+  }
+  _dispatchQueued();
+  _dispatched.notify_all();
+}
+
+} // end of namespace BABYLON
@@ -7,14 +7,17 @@
 namespace BABYLON {
 
 LogMessage::LogMessage(unsigned int level, const std::string& context)
-    : _level{level}, _context{context}
+    : _level{level}, _lineNumber{0}, _context{context}
 {
   // Set timestamp
   _timestamp = Time::systemTimepointNow();
-  // Set thread id
-  std::ostringstream ss;
-  ss << std::hex << std::this_thread::get_id();
-  _threadId = ss.str();
+  // Set thread id, formatted once per thread
+  static thread_local const std::string threadId = []() {
+    std::ostringstream ss;
+    ss << std::hex << std::this_thread::get_id();
+    return ss.str();
+  }();
+  _threadId = threadId;
 }
 
 LogMessage::LogMessage(const LogMessage& otherLogMessage)
@@ -39,6 +42,7 @@ LogMessage::LogMessage(LogMessage&& otherLogMessage)
     , _context{std::move(otherLogMessage._context)}
     , _function{std::move(otherLogMessage._function)}
     , _prettyFunction{std::move(otherLogMessage._prettyFunction)}
+    , _oss{std::move(otherLogMessage._oss)}
 {
 }
 
@@ -53,8 +57,9 @@ LogMessage& LogMessage::operator=(const LogMessage& otherLogMessage)
     _context        = otherLogMessage._context;
     _function       = otherLogMessage._function;
     _prettyFunction = otherLogMessage._prettyFunction;
+    _oss.str(otherLogMessage._oss.str());
     _oss.clear();
-    _oss << otherLogMessage._oss.str();
+    _oss.seekp(0, std::ios_base::end);
   }
 
   return *this;
@@ -71,9 +76,7 @@ LogMessage& LogMessage::operator=(LogMessage&& otherLogMessage)
     _context        = std::move(otherLogMessage._context);
     _function       = std::move(otherLogMessage._function);
     _prettyFunction = std::move(otherLogMessage._prettyFunction);
-    _oss.clear();
-    _oss << otherLogMessage._oss.str();
-    otherLogMessage._oss.clear();
+    _oss            = std::move(otherLogMessage._oss);
   }
 
   return *this;
@@ -1,29 +1,35 @@
 #include <babylon/core/logging/logger.h>
 
+#include <babylon/core/logging/async_log_writer.h>
 #include <babylon/core/logging/log_message.h>
 #include <iostream>
 
 namespace BABYLON {
 
 LogMessageHandler::LogMessageHandler()
-    : _minLevel{LogLevels::LEVEL_QUIET}, _maxLevel{LogLevels::LEVEL_TRACE}
+    : _minLevel{LogLevels::LEVEL_QUIET}
+    , _maxLevel{LogLevels::LEVEL_TRACE}
+    , _levelMask{0}
 {
   for (unsigned int lvl = _minLevel; lvl <= _maxLevel; ++lvl) {
     _logMessageListeners[lvl] = std::vector<LogMessageListener*>();
   }
+  updateLevelMask();
 }
 
-bool LogMessageHandler::takes(unsigned int level)
+bool LogMessageHandler::takes(unsigned int level) const
 {
-  return (level >= _minLevel) && (level <= _maxLevel);
+  return (level < 32)
+         && ((_levelMask.load(std::memory_order_relaxed) >> level) & 1u);
 }
 
 void LogMessageHandler::handle(const LogMessage& msg)
 {
-  if (_logMessageListeners.find(msg.level())
-      != _logMessageListeners.end()) {
-    for (auto& logMsgListener : _logMessageListeners[msg.level()]) {
-      (*logMsgListener)(LogMessage(msg));
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  const auto it = _logMessageListeners.find(msg.level());
+  if (it != _logMessageListeners.end()) {
+    for (auto& logMsgListener : it->second) {
+      (*logMsgListener)(msg);
     }
   }
 #ifdef __EMSCRIPTEN__
@@ -31,6 +37,24 @@ void LogMessageHandler::handle(const LogMessage& msg)
 #endif
 }
 
+void LogMessageHandler::updateLevelMask()
+{
+  unsigned int mask = 0;
+  for (const auto& [level, listeners] : _logMessageListeners) {
+    if (level < 32 && level >= _minLevel && level <= _maxLevel) {
+#ifdef __EMSCRIPTEN__
+      // Every message is printed on the console
+      mask |= 1u << level;
+#else
+      if (!listeners.empty()) {
+        mask |= 1u << level;
+      }
+#endif
+    }
+  }
+  _levelMask.store(mask, std::memory_order_relaxed);
+}
+
 //BABYLON::Logger& Logger::Instance()
 //{
 //  // Since it's a static variable, if the class has already been created,
@@ -54,11 +78,14 @@ Logger & LoggerInstance()
 }
 
 
-Logger::Logger() = default;
+Logger::Logger() : _written{0}, _dropped{0}
+{
+}
 
 Logger::~Logger()
 {
   // Cleanly shutting down log message handler
+  stopAsync();
   _impl._logMessageListeners.clear();
 }
 
@@ -76,17 +103,83 @@ LogMessage Logger::CreateMessage(unsigned int level, std::string context,
 
 void Logger::log(const LogMessage& msg)
 {
+  if (_asyncWriter) {
+    _asyncWriter->push(LogMessage(msg));
+    return;
+  }
   _impl.handle(msg);
+  _written.fetch_add(1, std::memory_order_relaxed);
 }
 
-bool Logger::takes(unsigned int level)
+void Logger::log(LogMessage&& msg)
+{
+  if (_asyncWriter) {
+    _asyncWriter->push(std::move(msg));
+    return;
+  }
+  _impl.handle(msg);
+  _written.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Logger::takes(unsigned int level) const
 {
   return _impl.takes(level);
 }
 
+void Logger::setMaxLevel(unsigned int level)
+{
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
+  _impl._maxLevel = level;
+  _impl.updateLevelMask();
+}
+
+void Logger::startAsync(size_t capacity)
+{
+  if (_asyncWriter) {
+    return;
+  }
+  _asyncWriter = std::make_unique<AsyncLogWriter>(
+    capacity, [this](const LogMessage& msg) { _impl.handle(msg); });
+}
+
+void Logger::stopAsync()
+{
+  if (_asyncWriter) {
+    _asyncWriter->flush();
+    _written.fetch_add(_asyncWriter->written(), std::memory_order_relaxed);
+    _dropped.fetch_add(_asyncWriter->dropped(), std::memory_order_relaxed);
+    _asyncWriter.reset();
+  }
+}
+
+bool Logger::isAsync() const
+{
+  return _asyncWriter != nullptr;
+}
+
+void Logger::flush()
+{
+  if (_asyncWriter) {
+    _asyncWriter->flush();
+  }
+}
+
+LogStatistics Logger::statistics() const
+{
+  LogStatistics statistics;
+  statistics.written = _written.load(std::memory_order_relaxed);
+  statistics.dropped = _dropped.load(std::memory_order_relaxed);
+  if (_asyncWriter) {
+    statistics.written += _asyncWriter->written();
+    statistics.dropped += _asyncWriter->dropped();
+  }
+  return statistics;
+}
+
 bool Logger::isSubscribed(unsigned int level,
                           LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
   bool subscribed = false;
   if (_impl._logMessageListeners.find(level)
       != _impl._logMessageListeners.end()) {
@@ -100,6 +193,7 @@ bool Logger::isSubscribed(unsigned int level,
 
 void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
   for (auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -109,11 +203,13 @@ void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
       _logMsgListenersLvl.emplace_back(l);
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::unregisterLogMessageListener(
   const LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
   for (const auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -122,40 +218,41 @@ void Logger::unregisterLogMessageListener(
       _logMsgListenersLvl.erase(it);
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::registerLogMessageListener(unsigned int level,
                                         LogMessageListener& logMsgListener)
 {
-  if (_impl.takes(level)) {
-    if (_impl._logMessageListeners.find(level)
-        != _impl._logMessageListeners.end()) {
-      auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
-      auto l                    = &logMsgListener;
-      auto it
-        = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(), l);
-      if (it == _logMsgListenersLvl.end()) {
-        _impl._logMessageListeners[level].emplace_back(l);
-      }
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
+  if (_impl._logMessageListeners.find(level)
+      != _impl._logMessageListeners.end()) {
+    auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
+    auto l                    = &logMsgListener;
+    auto it
+      = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(), l);
+    if (it == _logMsgListenersLvl.end()) {
+      _impl._logMessageListeners[level].emplace_back(l);
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::unregisterLogMessageListener(
   unsigned int level, const LogMessageListener& logMsgListener)
 {
-  if (_impl.takes(level)) {
-    if (_impl._logMessageListeners.find(level)
-        != _impl._logMessageListeners.end()) {
-      auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
-      auto it                   = std::find(_logMsgListenersLvl.begin(),
+  std::lock_guard<std::recursive_mutex> lock(_impl._mutex);
+  if (_impl._logMessageListeners.find(level)
+      != _impl._logMessageListeners.end()) {
+    auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
+    auto it                   = std::find(_logMsgListenersLvl.begin(),
                           _logMsgListenersLvl.end(), &logMsgListener);
-      if (it != _logMsgListenersLvl.end()) {
-        _logMsgListenersLvl.erase(it);
-      }
+    if (it != _logMsgListenersLvl.end()) {
+      _logMsgListenersLvl.erase(it);
     }
   }
-} // namespace BABYLON
+  _impl.updateLevelMask();
+}
 
 
 } // end of namespace BABYLON
@@ -0,0 +1,168 @@
+#ifdef _WIN32
+#include <windows.h>
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+#include <fstream>
+
+#include <babylon/core/memory_mapped_file.h>
+
+namespace BABYLON {
+
+MemoryMappedFile::MemoryMappedFile()
+    : _data{nullptr}, _size{0}, _isOpen{false}, _isMapped{false}
+{
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) : MemoryMappedFile()
+{
+  *this = std::move(other);
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other)
+{
+  if (&other != this) {
+    close();
+    _buffer   = std::move(other._buffer);
+    _data     = other._isMapped ? other._data : _buffer.data();
+    _size     = other._size;
+    _isOpen   = other._isOpen;
+    _isMapped = other._isMapped;
+    // The mapping now belongs to this object
+    other._data     = nullptr;
+    other._size     = 0;
+    other._isOpen   = false;
+    other._isMapped = false;
+    other._buffer.clear();
+  }
+  return *this;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  close();
+}
+
+bool MemoryMappedFile::open(const std::string& filename)
+{
+  close();
+  _isOpen = _map(filename) || _read(filename);
+  return _isOpen;
+}
+
+void MemoryMappedFile::close()
+{
+  if (_isMapped && _data) {
+#ifdef _WIN32
+    UnmapViewOfFile(_data);
+#else
+    munmap(const_cast<char*>(_data), _size);
+#endif
+  }
+  _buffer.clear();
+  _data     = nullptr;
+  _size     = 0;
+  _isOpen   = false;
+  _isMapped = false;
+}
+
+bool MemoryMappedFile::isOpen() const
+{
+  return _isOpen;
+}
+
+bool MemoryMappedFile::isMapped() const
+{
+  return _isMapped;
+}
+
+const char* MemoryMappedFile::data() const
+{
+  return _data;
+}
+
+size_t MemoryMappedFile::size() const
+{
+  return _size;
+}
+
+std::string_view MemoryMappedFile::view() const
+{
+  return _data ? std::string_view(_data, _size) : std::string_view();
+}
+
+bool MemoryMappedFile::_map(const std::string& filename)
+{
+#ifdef _WIN32
+  auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping) {
+    return false;
+  }
+  // The view keeps the mapping alive once the handle is closed
+  auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!view) {
+    return false;
+  }
+  _data = static_cast<const char*>(view);
+  _size = static_cast<size_t>(fileSize.QuadPart);
+#else
+  const auto fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(fileStat.st_size);
+  auto view       = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid once the file descriptor is closed
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return false;
+  }
+#ifdef MADV_SEQUENTIAL
+  madvise(view, size, MADV_SEQUENTIAL);
+#endif
+  _data = static_cast<const char*>(view);
+  _size = size;
+#endif
+  _isMapped = true;
+  return true;
+}
+
+bool MemoryMappedFile::_read(const std::string& filename)
+{
+  std::ifstream ifs(filename.c_str(), std::ios::binary | std::ios::ate);
+  if (!ifs) {
+    return false;
+  }
+  const auto size = static_cast<size_t>(ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+  _buffer.resize(size);
+  if (size > 0 && !ifs.read(_buffer.data(), static_cast<std::streamsize>(size))) {
+    _buffer.clear();
+    return false;
+  }
+  _data = _buffer.data();
+  _size = size;
+  return true;
+}
+
+} // end of namespace BABYLON
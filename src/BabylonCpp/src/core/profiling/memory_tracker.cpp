@@ -0,0 +1,166 @@
+#include <babylon/core/profiling/memory_tracker.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace BABYLON {
+
+namespace {
+
+struct CategoryBytes {
+  std::atomic<std::ptrdiff_t> live{0};
+  std::atomic<std::ptrdiff_t> peak{0};
+}; // end of struct CategoryBytes
+
+std::array<CategoryBytes, static_cast<size_t>(MemoryCategory::Count)> categoryBytes;
+
+std::atomic<size_t> allocationCount{0};
+std::atomic<size_t> allocatedBytes{0};
+
+// Constant initialized, safe to use from the operator new of any thread
+thread_local AllocationCounts threadAllocations;
+
+} // end of anonymous namespace
+
+#ifdef BABYLON_TRACK_ALLOCATIONS
+bool MemoryTracker::HasAllocationHooks()
+{
+  return true;
+}
+#else
+bool MemoryTracker::HasAllocationHooks()
+{
+  return false;
+}
+#endif
+
+AllocationCounts MemoryTracker::Allocations()
+{
+  return {allocationCount.load(std::memory_order_relaxed),
+          allocatedBytes.load(std::memory_order_relaxed)};
+}
+
+AllocationCounts MemoryTracker::ThreadAllocations()
+{
+  return threadAllocations;
+}
+
+void MemoryTracker::Track(MemoryCategory category, std::ptrdiff_t bytes)
+{
+  if (bytes == 0) {
+    return;
+  }
+  auto& counts    = categoryBytes[static_cast<size_t>(category)];
+  const auto live = counts.live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak       = counts.peak.load(std::memory_order_relaxed);
+  while (live > peak
+         && !counts.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+size_t MemoryTracker::LiveBytes(MemoryCategory category)
+{
+  const auto live
+    = categoryBytes[static_cast<size_t>(category)].live.load(std::memory_order_relaxed);
+  return live > 0 ? static_cast<size_t>(live) : 0;
+}
+
+size_t MemoryTracker::PeakBytes(MemoryCategory category)
+{
+  return static_cast<size_t>(
+    categoryBytes[static_cast<size_t>(category)].peak.load(std::memory_order_relaxed));
+}
+
+const char* MemoryTracker::CategoryName(MemoryCategory category)
+{
+  switch (category) {
+    case MemoryCategory::Geometry:
+      return "Geometry";
+    case MemoryCategory::VertexBuffers:
+      return "Vertex buffers";
+    case MemoryCategory::Particles:
+      return "Particles";
+    case MemoryCategory::Animations:
+      return "Animations";
+    default:
+      return "";
+  }
+}
+
+TrackedMemory::TrackedMemory(MemoryCategory category, size_t bytes)
+    : _category{category}, _bytes{bytes}
+{
+  MemoryTracker::Track(_category, static_cast<std::ptrdiff_t>(_bytes));
+}
+
+TrackedMemory::TrackedMemory(const TrackedMemory& other)
+    : TrackedMemory{other._category, other._bytes}
+{
+}
+
+TrackedMemory& TrackedMemory::operator=(const TrackedMemory& other)
+{
+  if (&other != this) {
+    set(0);
+    _category = other._category;
+    set(other._bytes);
+  }
+  return *this;
+}
+
+TrackedMemory::~TrackedMemory()
+{
+  set(0);
+}
+
+void TrackedMemory::set(size_t bytes)
+{
+  MemoryTracker::Track(_category,
+                       static_cast<std::ptrdiff_t>(bytes) - static_cast<std::ptrdiff_t>(_bytes));
+  _bytes = bytes;
+}
+
+} // end of namespace BABYLON
+
+#ifdef BABYLON_TRACK_ALLOCATIONS
+
+void* operator new(size_t size)
+{
+  BABYLON::allocationCount.fetch_add(1, std::memory_order_relaxed);
+  BABYLON::allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  ++BABYLON::threadAllocations.allocations;
+  BABYLON::threadAllocations.bytes += size;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+#endif // BABYLON_TRACK_ALLOCATIONS
@@ -4,6 +4,7 @@
 #include <babylon/collisions/collider.h>
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/misc/frame_arena.h>
 
 namespace BABYLON {
 
@@ -53,20 +54,20 @@ void OctreeSceneComponent::_register()
   });
 }
 
-std::vector<AbstractMesh*> OctreeSceneComponent::getActiveMeshCandidates()
+std::pmr::vector<AbstractMesh*> OctreeSceneComponent::getActiveMeshCandidates()
 {
   if (scene->selectionOctree()) {
-    auto selection = scene->selectionOctree()->select(scene->frustumPlanes());
-    return selection;
+    const auto& selection = scene->selectionOctree()->select(scene->frustumPlanes());
+    return {selection.begin(), selection.end(), &scene->getFrameArena()};
   }
   return scene->_getDefaultMeshCandidates();
 }
 
-std::vector<SubMesh*> OctreeSceneComponent::getActiveSubMeshCandidates(AbstractMesh* mesh)
+std::pmr::vector<SubMesh*> OctreeSceneComponent::getActiveSubMeshCandidates(AbstractMesh* mesh)
 {
   if (mesh->_submeshesOctree && mesh->useOctreeForRenderingSelection) {
-    auto intersections = mesh->_submeshesOctree->select(scene->frustumPlanes());
-    return intersections;
+    const auto& intersections = mesh->_submeshesOctree->select(scene->frustumPlanes());
+    return {intersections.begin(), intersections.end(), &scene->getFrameArena()};
   }
   return scene->_getDefaultSubMeshCandidates(mesh);
 }
@@ -80,7 +81,7 @@ std::vector<SubMesh*> OctreeSceneComponent::getIntersectingSubMeshCandidates(Abs
 
     return intersections;
   }
-  return scene->_getDefaultSubMeshCandidates(mesh);
+  return stl_util::to_raw_ptr_vector(mesh->subMeshes);
 }
 
 std::vector<SubMesh*> OctreeSceneComponent::getCollidingSubMeshCandidates(AbstractMesh* mesh,
@@ -93,7 +94,7 @@ std::vector<SubMesh*> OctreeSceneComponent::getCollidingSubMeshCandidates(Abstra
 
     return intersections;
   }
-  return scene->_getDefaultSubMeshCandidates(mesh);
+  return stl_util::to_raw_ptr_vector(mesh->subMeshes);
 }
 
 void OctreeSceneComponent::rebuild()
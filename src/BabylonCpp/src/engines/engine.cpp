@@ -184,9 +184,12 @@ void Engine::generateMipMapsForCubemap(const InternalTexturePtr& texture, bool u
 
 void Engine::setState(bool culling, float zOffset, bool force, bool reverseSide)
 {
+  auto changed = false;
+
   // Culling
   if (_depthCullingState->cull() != culling || force) {
     _depthCullingState->cull = culling;
+    changed                  = true;
   }
 
   // Cull face
@@ -195,6 +198,7 @@ void Engine::setState(bool culling, float zOffset, bool force, bool reverseSide)
        && *_depthCullingState->cullFace() != static_cast<int>(cullFace))
       || force) {
     _depthCullingState->cullFace = static_cast<int>(cullFace);
+    changed                      = true;
   }
 
   // Z offset
@@ -204,6 +208,14 @@ void Engine::setState(bool culling, float zOffset, bool force, bool reverseSide)
   const auto frontFace = reverseSide ? GL::CW : GL::CCW;
   if (_depthCullingState->frontFace() != frontFace || force) {
     _depthCullingState->frontFace = frontFace;
+    changed                       = true;
+  }
+
+  if (changed) {
+    ++_stateCounters.depthCullingStateChanges;
+  }
+  else {
+    ++_stateCounters.depthCullingStateChangesAvoided;
   }
 }
 
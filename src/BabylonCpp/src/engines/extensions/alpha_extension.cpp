@@ -20,8 +20,10 @@ void AlphaExtension::setAlphaConstants(float r, float g, float b, float a)
 void AlphaExtension::setAlphaMode(unsigned int mode, bool noDepthWriteChange)
 {
   if (_this->_alphaMode == mode) {
+    ++_this->_stateCounters.alphaModeChangesAvoided;
     return;
   }
+  ++_this->_stateCounters.alphaModeChanges;
 
   switch (mode) {
     case Constants::ALPHA_DISABLE:
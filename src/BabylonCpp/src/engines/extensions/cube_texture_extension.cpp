@@ -198,7 +198,7 @@ InternalTexturePtr CubeTextureExtension::createCubeTexture(
       files, onError);
   }
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
@@ -37,7 +37,7 @@ InternalTexturePtr DynamicTextureExtension::createDynamicTexture(int width, int
 
   _this->updateTextureSamplingMode(samplingMode, texture);
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
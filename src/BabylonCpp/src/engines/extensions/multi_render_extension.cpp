@@ -171,7 +171,7 @@ MultiRenderExtension::createMultipleRenderTarget(ISize size,
     texture->_attachments           = attachments;
     texture->_textureArray          = textures;
 
-    _this->_internalTexturesCache.emplace_back(texture);
+    _this->_internalTexturesCache.add(texture);
   }
 
   if (generateDepthTexture && _this->_caps.depthTextureExtension) {
@@ -215,7 +215,7 @@ MultiRenderExtension::createMultipleRenderTarget(ISize size,
     depthTexture->_generateStencilBuffer = generateStencilBuffer;
 
     textures.emplace_back(depthTexture);
-    _this->_internalTexturesCache.emplace_back(depthTexture);
+    _this->_internalTexturesCache.add(depthTexture);
   }
 
   gl.drawBuffers(attachments);
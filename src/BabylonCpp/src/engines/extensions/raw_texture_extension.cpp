@@ -51,7 +51,7 @@ InternalTexturePtr RawTextureExtension::createRawTexture(
 
   _this->_bindTextureDirectly(GL::TEXTURE_2D, nullptr);
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
@@ -275,7 +275,7 @@ InternalTexturePtr RawTextureExtension::createRawCubeTextureFromUrl(
     = _this->createRawCubeTexture({}, size, format, type, !noMipmap, invertY, samplingMode);
   scene->_addPendingData(texture);
   texture->url = url;
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   const auto onerror = [=](const std::string& message, const std::string& exception) -> void {
     scene->_removePendingData(texture);
@@ -402,7 +402,7 @@ InternalTexturePtr RawTextureExtension::_createRawTexture(const ArrayBufferView&
 
   _this->_bindTextureDirectly(target, nullptr);
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
@@ -98,7 +98,7 @@ RenderTargetCubeExtension::createRenderTargetCubeTexture(const ISize& size,
   texture->_generateDepthBuffer   = fullOptions.generateDepthBuffer.value();
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value();
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
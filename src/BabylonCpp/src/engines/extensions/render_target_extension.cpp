@@ -126,7 +126,7 @@ InternalTexturePtr RenderTargetExtension::createRenderTargetTexture(
   texture->_generateDepthBuffer   = fullOptions.generateDepthBuffer.value();
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value();
 
-  _this->_internalTexturesCache.emplace_back(texture);
+  _this->_internalTexturesCache.add(texture);
 
   return texture;
 }
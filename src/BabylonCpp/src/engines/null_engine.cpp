@@ -157,6 +157,15 @@ void NullEngine::bindSamplers(Effect& /*effect*/)
 
 void NullEngine::enableEffect(const EffectPtr& effect)
 {
+  if (!effect) {
+    return;
+  }
+  if (effect == _currentEffect) {
+    ++_stateCounters.effectBindingsAvoided;
+    return;
+  }
+  ++_stateCounters.effectBindings;
+
   _currentEffect = effect;
 
   if (effect->onBind) {
@@ -167,8 +176,10 @@ void NullEngine::enableEffect(const EffectPtr& effect)
   }
 }
 
-void NullEngine::setState(bool /*culling*/, float /*zOffset*/, bool /*force*/, bool /*reverseSide*/)
+void NullEngine::setState(bool culling, float zOffset, bool force, bool reverseSide)
 {
+  // Only updates the cached states (no GL calls)
+  Engine::setState(culling, zOffset, force, reverseSide);
 }
 
 bool NullEngine::setIntArray(const WebGLUniformLocationPtr& /*uniform*/,
@@ -290,8 +301,10 @@ bool NullEngine::setFloat4(const WebGLUniformLocationPtr& /*uniform*/, float /*x
 void NullEngine::setAlphaMode(unsigned int mode, bool noDepthWriteChange)
 {
   if (_alphaMode == mode) {
+    ++_stateCounters.alphaModeChangesAvoided;
     return;
   }
+  ++_stateCounters.alphaModeChanges;
 
   alphaState()->alphaBlend = (mode != Constants::ALPHA_DISABLE);
 
@@ -302,9 +315,29 @@ void NullEngine::setAlphaMode(unsigned int mode, bool noDepthWriteChange)
 }
 
 void NullEngine::bindBuffers(
-  const std::unordered_map<std::string, VertexBufferPtr>& /*vertexBuffers*/,
-  const WebGLDataBufferPtr& /*indexBuffer*/, const EffectPtr& /*effect*/)
-{
+  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
+  const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
+{
+  // Same cache as the WebGL engine so that the state counters are meaningful
+  if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect) {
+    ++_stateCounters.vertexBufferBindings;
+    _cachedVertexBuffersMap       = vertexBuffers;
+    _cachedEffectForVertexBuffers = effect;
+  }
+  else {
+    ++_stateCounters.vertexBufferBindingsAvoided;
+  }
+
+  if (!indexBuffer) {
+    return;
+  }
+  if (_cachedIndexBuffer != indexBuffer) {
+    ++_stateCounters.indexBufferBindings;
+    _cachedIndexBuffer = indexBuffer;
+  }
+  else {
+    ++_stateCounters.indexBufferBindingsAvoided;
+  }
 }
 
 void NullEngine::wipeCaches(bool bruteForce)
@@ -323,7 +356,8 @@ void NullEngine::wipeCaches(bool bruteForce)
     alphaState()->reset();
   }
 
-  _cachedVertexBuffers          = nullptr;
+  _cachedVertexBuffers = nullptr;
+  _cachedVertexBuffersMap.clear();
   _cachedIndexBuffer            = nullptr;
   _cachedEffectForVertexBuffers = nullptr;
 }
@@ -331,16 +365,20 @@ void NullEngine::wipeCaches(bool bruteForce)
 void NullEngine::draw(bool /*useTriangles*/, int /*indexStart*/, int /*indexCount*/,
                       int /*instancesCount*/)
 {
+  // Only counts the draw calls (no GL calls)
+  _reportDrawCall();
 }
 
 void NullEngine::drawElementsType(unsigned int /*fillMode*/, int /*indexStart*/,
                                   int /*verticesCount*/, int /*instancesCount*/)
 {
+  _reportDrawCall();
 }
 
 void NullEngine::drawArraysType(unsigned int /*fillMode*/, int /*verticesStart*/,
                                 int /*verticesCount*/, int /*instancesCount*/)
 {
+  _reportDrawCall();
 }
 
 WebGLTexturePtr NullEngine::_createTexture()
@@ -348,8 +386,9 @@ WebGLTexturePtr NullEngine::_createTexture()
   return std::make_shared<GL::IGLTexture>(0);
 }
 
-void NullEngine::_releaseTexture(const InternalTexturePtr& /*texture*/)
+void NullEngine::_releaseTexture(const InternalTexturePtr& texture)
 {
+  _internalTexturesCache.remove(texture.get());
 }
 
 InternalTexturePtr NullEngine::createTexture(
@@ -382,7 +421,7 @@ InternalTexturePtr NullEngine::createTexture(
     onLoad(texture.get(), es);
   }
 
-  _internalTexturesCache.emplace_back(texture);
+  _internalTexturesCache.add(texture);
 
   return texture;
 }
@@ -436,7 +475,7 @@ NullEngine::createRenderTargetTexture(const std::variant<int, RenderTargetSize,
   texture->_generateDepthBuffer   = *fullOptions.generateDepthBuffer;
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value_or(false);
 
-  _internalTexturesCache.emplace_back(texture);
+  _internalTexturesCache.add(texture);
 
   return texture;
 }
@@ -520,19 +559,25 @@ void NullEngine::updateDynamicIndexBuffer(const WebGLDataBufferPtr& /*indexBuffe
 }
 
 void NullEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& /*vertexBuffer*/,
-                                           const Float32Array& /*data*/, int /*byteOffset*/,
-                                           int /*byteLength*/)
+                                           const Float32Array& data, int /*byteOffset*/,
+                                           int byteLength)
 {
+  const auto dataLength = data.size() * sizeof(float);
+  ++_stateCounters.vertexBufferUploads;
+  _stateCounters.vertexBufferUploadedBytes
+    += byteLength < 0 ? dataLength : std::min(static_cast<size_t>(byteLength), dataLength);
 }
 
 bool NullEngine::_bindTextureDirectly(unsigned int /*target*/, const InternalTexturePtr& texture,
                                       bool /*forTextureDataUpdate*/, bool /*force*/)
 {
-  if (stl_util::contains(_boundTexturesCache, _activeChannel)
-      && _boundTexturesCache[_activeChannel] != texture) {
+  if (!stl_util::contains(_boundTexturesCache, _activeChannel)
+      || _boundTexturesCache[_activeChannel] != texture) {
+    ++_stateCounters.textureBindings;
     _boundTexturesCache[_activeChannel] = texture;
     return true;
   }
+  ++_stateCounters.textureBindingsAvoided;
   return false;
 }
 
@@ -542,6 +587,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture)
     return;
   }
 
+  _activeChannel = channel;
   _bindTextureDirectly(0, texture);
 }
 
@@ -36,6 +36,7 @@
 #include <babylon/gamepads/gamepad_system_scene_component.h>
 #include <babylon/helpers/environment_helper.h>
 #include <babylon/inputs/click_info.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/layers/effect_layer.h>
 #include <babylon/layers/glow_layer.h>
@@ -57,13 +58,16 @@
 #include <babylon/materials/uniform_buffer.h>
 #include <babylon/maths/frustum.h>
 #include <babylon/maths/tmp_vectors.h>
+#include <babylon/meshes/_instance_data_storage.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_simplification_scene_component.h>
 #include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/misc/frame_arena.h>
 #include <babylon/misc/guid.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -88,6 +92,49 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Returns true if the sub meshes of both meshes are drawn with the same render state.
+ */
+bool autoInstanceCompatible(Mesh* leader, Mesh* mesh)
+{
+  auto& a = *leader->subMeshes[0];
+  auto& b = *mesh->subMeshes[0];
+  return leader->geometry() == mesh->geometry() && a.getMaterial() == b.getMaterial()
+         && a.verticesStart == b.verticesStart && a.verticesCount == b.verticesCount
+         && a.indexStart == b.indexStart && a.indexCount == b.indexCount
+         && leader->renderingGroupId() == mesh->renderingGroupId()
+         && leader->receiveShadows() == mesh->receiveShadows()
+         && leader->useVertexColors() == mesh->useVertexColors()
+         && leader->hasVertexAlpha() == mesh->hasVertexAlpha()
+         && leader->applyFog() == mesh->applyFog()
+         && leader->overrideMaterialSideOrientation == mesh->overrideMaterialSideOrientation
+         && (leader->_getWorldMatrixDeterminant() < 0.f)
+              == (mesh->_getWorldMatrixDeterminant() < 0.f)
+         && leader->lightSources() == mesh->lightSources();
+}
+
+/**
+ * @brief Hash of the state compared by autoInstanceCompatible.
+ */
+size_t autoInstanceHash(Mesh* mesh)
+{
+  auto& subMesh      = *mesh->subMeshes[0];
+  size_t hash        = std::hash<Geometry*>{}(mesh->geometry().get());
+  const auto combine = [&hash](size_t value) {
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+  };
+  combine(std::hash<Material*>{}(subMesh.getMaterial().get()));
+  combine(subMesh.indexStart);
+  combine(static_cast<size_t>(mesh->renderingGroupId()));
+  combine(mesh->_getWorldMatrixDeterminant() < 0.f ? 1 : 0);
+  combine(mesh->lightSources().size());
+  return hash;
+}
+
+} // end of anonymous namespace
+
 size_t Scene::_uniqueIdCounter = 0;
 
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
@@ -174,6 +221,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _cachedEffect{nullptr}
     , _cachedVisibility{0.f}
     , dispatchAllSubMeshesOfActiveMeshes{false}
+    , autoInstancing{false}
     , _forcedViewPosition{nullptr}
     , _isAlternateRenderingEnabled{this, &Scene::get_isAlternateRenderingEnabled}
     , frustumPlanes{this, &Scene::get_frustumPlanes}
@@ -277,6 +325,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _preventFreeActiveMeshesAndRenderingGroups{false}
     , _skipEvaluateActiveMeshesCompletely{false}
     , _renderingManager{nullptr}
+    , _frameArena{std::make_unique<FrameArena>()}
     , _transformMatrix{Matrix::Zero()}
     , _sceneUbo{nullptr}
     , _alternateSceneUbo{nullptr}
@@ -881,16 +930,24 @@ std::string Scene::getClassName() const
   return "Scene";
 }
 
-std::vector<AbstractMesh*> Scene::_getDefaultMeshCandidates()
+std::pmr::vector<AbstractMesh*> Scene::_getDefaultMeshCandidates()
 {
-  _defaultMeshCandidates = stl_util::to_raw_ptr_vector(meshes);
-  return _defaultMeshCandidates;
+  std::pmr::vector<AbstractMesh*> candidates{_frameArena.get()};
+  candidates.reserve(meshes.size());
+  for (const auto& mesh : meshes) {
+    candidates.emplace_back(mesh.get());
+  }
+  return candidates;
 }
 
-std::vector<SubMesh*> Scene::_getDefaultSubMeshCandidates(AbstractMesh* mesh)
+std::pmr::vector<SubMesh*> Scene::_getDefaultSubMeshCandidates(AbstractMesh* mesh)
 {
-  _defaultSubMeshCandidates = stl_util::to_raw_ptr_vector(mesh->subMeshes);
-  return _defaultSubMeshCandidates;
+  std::pmr::vector<SubMesh*> candidates{_frameArena.get()};
+  candidates.reserve(mesh->subMeshes.size());
+  for (const auto& subMesh : mesh->subMeshes) {
+    candidates.emplace_back(subMesh.get());
+  }
+  return candidates;
 }
 
 void Scene::setDefaultCandidateProviders()
@@ -899,11 +956,12 @@ void Scene::setDefaultCandidateProviders()
 
   getActiveSubMeshCandidates
     = [this](AbstractMesh* mesh) { return _getDefaultSubMeshCandidates(mesh); };
-  getIntersectingSubMeshCandidates = [this](AbstractMesh* mesh, const Ray& /*localRay*/) {
-    return _getDefaultSubMeshCandidates(mesh);
+  // Picking and collisions may run outside of a frame, their candidates are not kept in the arena
+  getIntersectingSubMeshCandidates = [](AbstractMesh* mesh, const Ray& /*localRay*/) {
+    return stl_util::to_raw_ptr_vector(mesh->subMeshes);
   };
-  getCollidingSubMeshCandidates = [this](AbstractMesh* mesh, const Collider& /*collider*/) {
-    return _getDefaultSubMeshCandidates(mesh);
+  getCollidingSubMeshCandidates = [](AbstractMesh* mesh, const Collider& /*collider*/) {
+    return stl_util::to_raw_ptr_vector(mesh->subMeshes);
   };
 }
 
@@ -950,6 +1008,11 @@ Engine* Scene::getEngine()
   return _engine;
 }
 
+FrameArena& Scene::getFrameArena()
+{
+  return *_frameArena;
+}
+
 size_t Scene::getTotalVertices() const
 {
   return _totalVertices.current();
@@ -2471,6 +2534,9 @@ int Scene::removeMesh(AbstractMesh* toRemove, bool recursive)
     // Remove from the scene if mesh found
     meshes.erase(it);
 
+    // The automatic instance batches may reference the mesh
+    _clearAutoInstances();
+
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
@@ -3539,7 +3605,8 @@ bool Scene::_isInIntermediateRendering() const
   return _intermediateRendering;
 }
 
-void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh)
+void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh,
+                             bool dispatch)
 {
   if (initialMesh->hasInstances() || initialMesh->isAnInstance()
       || dispatchAllSubMeshesOfActiveMeshes || _skipFrustumClipping
@@ -3567,7 +3634,9 @@ void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh*
       }
 
       // Dispatch
-      _renderingManager->dispatch(subMesh, mesh, material);
+      if (dispatch) {
+        _renderingManager->dispatch(subMesh, mesh, material);
+      }
     }
   }
 }
@@ -3629,6 +3698,8 @@ Scene& Scene::unfreezeActiveMeshes()
 
 void Scene::_evaluateActiveMeshes()
 {
+  BABYLON_PROFILE_ZONE("Evaluate active meshes");
+
   if (_activeMeshesFrozen && !_activeMeshes.empty()) {
 
     if (!_skipEvaluateActiveMeshesCompletely) {
@@ -3659,6 +3730,7 @@ void Scene::_evaluateActiveMeshes()
   _activeParticleSystems.clear();
   _activeSkeletons.clear();
   _softwareSkinnedMeshes.clear();
+  _clearAutoInstances();
   for (const auto& step : _beforeEvaluateActiveMeshStage) {
     step.action();
   }
@@ -3734,7 +3806,9 @@ void Scene::_evaluateActiveMeshes()
           }
         }
         meshToRender->_internalAbstractMeshDataInfo._isActive = true;
-        _activeMesh(mesh, meshToRender);
+        // The meshes drawn as automatic instances are evaluated but not dispatched
+        _activeMesh(mesh, meshToRender,
+                    !autoInstancing || meshToRender != mesh || !_batchAutoInstance(mesh));
       }
 
       mesh->_postActivate();
@@ -3762,7 +3836,41 @@ void Scene::_evaluateActiveMeshes()
   }
 }
 
-void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
+void Scene::_clearAutoInstances()
+{
+  for (auto& [hash, leaders] : _autoInstanceLeaders) {
+    for (auto leader : leaders) {
+      leader->_instanceDataStorage->autoInstances.clear();
+    }
+  }
+  _autoInstanceLeaders.clear();
+}
+
+bool Scene::_batchAutoInstance(AbstractMesh* mesh)
+{
+  if (mesh->type() != Type::MESH) {
+    return false;
+  }
+
+  auto _mesh = static_cast<Mesh*>(mesh);
+  if (!_mesh->_canBeAutoInstanced()) {
+    return false;
+  }
+
+  // The first active mesh of each batch is dispatched, the other ones are drawn as its instances
+  auto& leaders = _autoInstanceLeaders[autoInstanceHash(_mesh)];
+  for (auto leader : leaders) {
+    if (autoInstanceCompatible(leader, _mesh)) {
+      leader->_instanceDataStorage->autoInstances.emplace_back(_mesh);
+      return true;
+    }
+  }
+  leaders.emplace_back(_mesh);
+
+  return false;
+}
+
+void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh, bool dispatch)
 {
   if (_skeletonsEnabled && mesh->skeleton()) {
     if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(), mesh->skeleton())
@@ -3784,7 +3892,7 @@ void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
   if (mesh && !mesh->subMeshes.empty()) {
     auto subMeshes = getActiveSubMeshCandidates(mesh);
     for (const auto& subMesh : subMeshes) {
-      _evaluateSubMesh(subMesh, mesh, sourceMesh);
+      _evaluateSubMesh(subMesh, mesh, sourceMesh, dispatch);
     }
   }
 }
@@ -3874,6 +3982,11 @@ void Scene::_renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent
     mesh->applySkeleton(mesh->skeleton());
   }
 
+  // Software morphing
+  for (const auto& morphTargetManager : morphTargetManagers) {
+    morphTargetManager->_updateCpuMorphing();
+  }
+
   // Render targets
   onBeforeRenderTargetsRenderObservable.notifyObservers(this);
 
@@ -4064,6 +4177,9 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   }
 
   ++_frameId;
+  FrameProfiler::BeginFrame();
+  // The transient containers of the previous frame are all released by now
+  _frameArena->reset();
 
   // Register components that have been associated lately to the scene.
   _registerTransientComponents();
@@ -4076,6 +4192,7 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   resetCachedMaterial();
 
   onBeforeAnimationsObservable.notifyObservers(this);
+  const auto drawCalls = _engine->_drawCalls.current();
 
   // Actions
   if (actionManager) {
@@ -4084,6 +4201,7 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
 
   // Animations
   if (!ignoreAnimations) {
+    BABYLON_PROFILE_ZONE("Animate");
     animate();
   }
 
@@ -4134,6 +4252,8 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
 
         if (!_activeCamera) {
           BABYLON_LOG_ERROR("Scene", "Active camera not set")
+          Tools::EndPerformanceCounter("Custom render targets");
+          FrameProfiler::EndFrame();
           return;
         }
 
@@ -4222,6 +4342,19 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   _activeBones.addCount(0, true);
   _activeIndices.addCount(0, true);
   _activeParticles.addCount(0, true);
+
+  if (FrameProfiler::IsEnabled()) {
+    const auto frameDrawCalls = _engine->_drawCalls.current();
+    FrameProfiler::Counter("Draw calls", static_cast<double>(frameDrawCalls >= drawCalls ?
+                                                               frameDrawCalls - drawCalls :
+                                                               frameDrawCalls));
+    FrameProfiler::Counter("Active meshes", static_cast<double>(_activeMeshes.size()));
+    FrameProfiler::Counter("Active indices", static_cast<double>(_activeIndices.current()));
+    FrameProfiler::Counter("Active bones", static_cast<double>(_activeBones.current()));
+    FrameProfiler::Counter("Active particles", static_cast<double>(_activeParticles.current()));
+    FrameProfiler::Counter("Total vertices", static_cast<double>(_totalVertices.current()));
+  }
+  FrameProfiler::EndFrame();
 }
 
 std::optional<bool>& Scene::get_audioEnabled()
@@ -4861,8 +4994,8 @@ Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
           // the user only asked for a bounding info check so we can return
           return pickingInfo;
         }
-        auto& tmpMatrix   = TmpVectors::MatrixArray[1];
-        auto thinMatrices = _mesh->thinInstanceGetWorldMatrices();
+        auto& tmpMatrix    = TmpVectors::MatrixArray[1];
+        auto& thinMatrices = _mesh->thinInstanceGetWorldMatrices();
         for (size_t index = 0; index < thinMatrices.size(); ++index) {
           auto& thinMatrix = thinMatrices[index];
           thinMatrix.multiplyToRef(world, tmpMatrix);
@@ -4923,8 +5056,8 @@ Scene::_internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
       auto result = _internalPickForMesh(std::nullopt, rayFunction, mesh, world, true, true,
                                          trianglePredicate);
       if (result) {
-        auto& tmpMatrix   = TmpVectors::MatrixArray[1];
-        auto thinMatrices = _mesh->thinInstanceGetWorldMatrices();
+        auto& tmpMatrix    = TmpVectors::MatrixArray[1];
+        auto& thinMatrices = _mesh->thinInstanceGetWorldMatrices();
         for (size_t index = 0; index < thinMatrices.size(); ++index) {
           auto& thinMatrix = thinMatrices[index];
           thinMatrix.multiplyToRef(world, tmpMatrix);
@@ -5498,6 +5631,11 @@ void Scene::setRenderingOrder(
                                        alphaTestSortCompareFn, transparentSortCompareFn);
 }
 
+void Scene::setStateSortedRendering(bool enabled)
+{
+  _renderingManager->setStateSortedRendering(enabled);
+}
+
 void Scene::setRenderingAutoClearDepthStencil(unsigned int renderingGroupId,
                                               bool autoClearDepthStencil, bool depth, bool stencil)
 {
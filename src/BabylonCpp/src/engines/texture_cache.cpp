@@ -0,0 +1,279 @@
+#include <babylon/engines/texture_cache.h>
+
+#include <algorithm>
+
+#include <babylon/engines/constants.h>
+#include <babylon/materials/textures/internal_texture.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Returns the size of a pixel in bytes times 2, to account for the compressed formats
+ * using half a byte per pixel.
+ */
+size_t pixelHalfBytes(unsigned int format, unsigned int type)
+{
+  switch (format) {
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT1:
+      return 1;
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT3:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+      return 2;
+    default:
+      break;
+  }
+
+  // Packed types store all the channels of a pixel together
+  switch (type) {
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_4_4_4_4:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_5_5_1:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_6_5:
+      return 2 * 2;
+    case Constants::TEXTURETYPE_UNSIGNED_INT_2_10_10_10_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_24_8:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_10F_11F_11F_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_5_9_9_9_REV:
+      return 2 * 4;
+    case Constants::TEXTURETYPE_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      return 2 * 8;
+    default:
+      break;
+  }
+
+  size_t channels = 4;
+  switch (format) {
+    case Constants::TEXTUREFORMAT_ALPHA:
+    case Constants::TEXTUREFORMAT_LUMINANCE:
+    case Constants::TEXTUREFORMAT_RED:
+    case Constants::TEXTUREFORMAT_RED_INTEGER:
+    case Constants::TEXTUREFORMAT_DEPTH24_STENCIL8:
+    case Constants::TEXTUREFORMAT_DEPTH32_FLOAT:
+      channels = 1;
+      break;
+    case Constants::TEXTUREFORMAT_LUMINANCE_ALPHA:
+    case Constants::TEXTUREFORMAT_RG:
+    case Constants::TEXTUREFORMAT_RG_INTEGER:
+      channels = 2;
+      break;
+    case Constants::TEXTUREFORMAT_RGB:
+    case Constants::TEXTUREFORMAT_RGB_INTEGER:
+      channels = 3;
+      break;
+    default:
+      break;
+  }
+
+  size_t channelBytes = 1;
+  switch (type) {
+    case Constants::TEXTURETYPE_FLOAT:
+    case Constants::TEXTURETYPE_INT:
+    case Constants::TEXTURETYPE_UNSIGNED_INTEGER:
+      channelBytes = 4;
+      break;
+    case Constants::TEXTURETYPE_HALF_FLOAT:
+    case Constants::TEXTURETYPE_SHORT:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT:
+      channelBytes = 2;
+      break;
+    default:
+      break;
+  }
+
+  return 2 * channels * channelBytes;
+}
+
+} // end of anonymous namespace
+
+TextureCache::TextureCache() : _memoryBudget{0}
+{
+}
+
+TextureCache::~TextureCache() = default;
+
+const std::vector<InternalTexturePtr>& TextureCache::textures() const
+{
+  return _textures;
+}
+
+size_t TextureCache::size() const
+{
+  return _textures.size();
+}
+
+bool TextureCache::contains(const InternalTexture* texture) const
+{
+  return _urls.find(texture) != _urls.end();
+}
+
+void TextureCache::add(const InternalTexturePtr& texture)
+{
+  if (!texture || contains(texture.get())) {
+    return;
+  }
+
+  _textures.emplace_back(texture);
+  _urls[texture.get()] = texture->url;
+  _urlIndex[texture->url].emplace_back(texture.get());
+}
+
+bool TextureCache::remove(const InternalTexture* texture)
+{
+  auto it = _urls.find(texture);
+  if (it == _urls.end()) {
+    return false;
+  }
+
+  auto bucket = _urlIndex.find(it->second);
+  if (bucket != _urlIndex.end()) {
+    auto& entries = bucket->second;
+    entries.erase(std::remove(entries.begin(), entries.end(), texture), entries.end());
+    if (entries.empty()) {
+      _urlIndex.erase(bucket);
+    }
+  }
+  _urls.erase(it);
+  _unlinkUnreferenced(texture);
+
+  _textures.erase(std::remove_if(_textures.begin(), _textures.end(),
+                                 [texture](const InternalTexturePtr& cachedTexture) {
+                                   return cachedTexture.get() == texture;
+                                 }),
+                  _textures.end());
+  return true;
+}
+
+void TextureCache::clear()
+{
+  _textures.clear();
+  _urlIndex.clear();
+  _urls.clear();
+  _unreferenced.clear();
+  _unreferencedIndex.clear();
+}
+
+InternalTexturePtr TextureCache::find(const std::string& url, bool noMipmap, unsigned int sampling,
+                                      const std::optional<bool>& invertY,
+                                      const std::optional<unsigned int>& format)
+{
+  auto bucket = _urlIndex.find(url);
+  if (bucket != _urlIndex.end()) {
+    for (auto* texturesCacheEntry : bucket->second) {
+      if ((invertY.has_value() && *invertY != texturesCacheEntry->invertY)
+          || texturesCacheEntry->url != url || texturesCacheEntry->generateMipMaps == noMipmap
+          || (sampling && sampling != texturesCacheEntry->samplingMode)
+          || (format.has_value() && *format != texturesCacheEntry->format)) {
+        continue;
+      }
+      ++_counters.hits;
+      _unlinkUnreferenced(texturesCacheEntry);
+      texturesCacheEntry->incrementReferences();
+      return texturesCacheEntry->shared_from_this();
+    }
+  }
+
+  ++_counters.misses;
+  return nullptr;
+}
+
+bool TextureCache::retain(const InternalTexturePtr& texture)
+{
+  if (_memoryBudget == 0 || !texture || texture->url.empty() || texture->_references > 0
+      || !contains(texture.get())) {
+    return false;
+  }
+
+  _unlinkUnreferenced(texture.get());
+  _unreferenced.emplace_back(texture);
+  _unreferencedIndex[texture.get()] = std::prev(_unreferenced.end());
+  return true;
+}
+
+std::vector<InternalTexturePtr> TextureCache::evict()
+{
+  std::vector<InternalTexturePtr> evicted;
+  if (_unreferenced.empty()) {
+    return evicted;
+  }
+
+  // Without budget no unreferenced texture is kept
+  auto usage = memoryUsage();
+  while ((_memoryBudget == 0 || usage > _memoryBudget) && !_unreferenced.empty()) {
+    auto texture = _unreferenced.front();
+    usage -= std::min(usage, ByteSize(*texture));
+    remove(texture.get());
+    evicted.emplace_back(texture);
+    ++_counters.evictions;
+  }
+
+  return evicted;
+}
+
+size_t TextureCache::unreferencedCount() const
+{
+  return _unreferenced.size();
+}
+
+size_t TextureCache::memoryUsage() const
+{
+  size_t usage = 0;
+  for (const auto& texture : _textures) {
+    usage += ByteSize(*texture);
+  }
+  return usage;
+}
+
+size_t TextureCache::memoryBudget() const
+{
+  return _memoryBudget;
+}
+
+void TextureCache::setMemoryBudget(size_t bytes)
+{
+  _memoryBudget = bytes;
+}
+
+const TextureCacheCounters& TextureCache::counters() const
+{
+  return _counters;
+}
+
+void TextureCache::resetCounters()
+{
+  _counters.reset();
+}
+
+size_t TextureCache::ByteSize(const InternalTexture& texture)
+{
+  const auto width  = static_cast<size_t>(std::max(texture.width, 0));
+  const auto height = static_cast<size_t>(std::max(texture.height, 0));
+  size_t layers     = 1;
+  if (texture.isCube) {
+    layers = 6;
+  }
+  else if (texture.is3D || texture.is2DArray) {
+    layers = static_cast<size_t>(std::max(texture.depth, 1));
+  }
+
+  auto bytes = width * height * layers * pixelHalfBytes(texture.format, texture.type) / 2;
+  // A full mip chain adds a third of the base level
+  if (texture.generateMipMaps) {
+    bytes += bytes / 3;
+  }
+  return bytes;
+}
+
+void TextureCache::_unlinkUnreferenced(const InternalTexture* texture)
+{
+  auto it = _unreferencedIndex.find(texture);
+  if (it != _unreferencedIndex.end()) {
+    _unreferenced.erase(it->second);
+    _unreferencedIndex.erase(it);
+  }
+}
+
+} // end of namespace BABYLON
@@ -39,6 +39,7 @@
 #include <babylon/meshes/webgl/webgl_data_buffer.h>
 #include <babylon/misc/dds.h>
 #include <babylon/misc/file_tools.h>
+#include <babylon/misc/image_decoder.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/states/alpha_state.h>
 #include <babylon/states/depth_culling_state.h>
@@ -125,6 +126,10 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
     , _renderTargetCubeExtension{std::make_unique<RenderTargetCubeExtension>(this)}
     , _uniformBufferExtension{std::make_unique<UniformBufferExtension>(this)}
 {
+  if (options.imageDecodingWorkers > 0) {
+    _imageDecoder = std::make_unique<ImageDecoder>(options.imageDecodingWorkers);
+  }
+
   if (!canvas) {
     return;
   }
@@ -291,7 +296,7 @@ void ThinEngine::_debugInsertMarker(const std::string& /*text*/,
 void ThinEngine::_rebuildInternalTextures()
 {
   const auto currentState
-    = _internalTexturesCache; // Do a copy because the rebuild will add proxies
+    = _internalTexturesCache.textures(); // Do a copy because the rebuild will add proxies
 
   for (const auto& internalTexture : currentState) {
     internalTexture->_rebuild();
@@ -630,11 +635,26 @@ float ThinEngine::getHardwareScalingLevel() const
   return _hardwareScalingLevel;
 }
 
-std::vector<InternalTexturePtr>& ThinEngine::getLoadedTexturesCache()
+TextureCache& ThinEngine::getLoadedTexturesCache()
 {
   return _internalTexturesCache;
 }
 
+size_t ThinEngine::processDecodedImages(bool wait)
+{
+  if (!_imageDecoder) {
+    return 0;
+  }
+
+  return wait ? _imageDecoder->waitForDecodedImages() : _imageDecoder->processDecodedImages();
+}
+
+void ThinEngine::setTexturesCacheMemoryBudget(size_t bytes)
+{
+  _internalTexturesCache.setMemoryBudget(bytes);
+  _releaseEvictedTextures();
+}
+
 EngineCapabilities& ThinEngine::getCaps()
 {
   return _caps;
@@ -799,6 +819,7 @@ void ThinEngine::setViewport(const Viewport& viewport, const std::optional<int>&
 
 void ThinEngine::beginFrame()
 {
+  processDecodedImages();
 }
 
 void ThinEngine::endFrame()
@@ -1170,10 +1191,14 @@ void ThinEngine::_bindIndexBufferWithCache(const WebGLDataBufferPtr& indexBuffer
     return;
   }
   if (_cachedIndexBuffer != indexBuffer) {
+    ++_stateCounters.indexBufferBindings;
     _cachedIndexBuffer = indexBuffer;
     bindIndexBuffer(indexBuffer);
     _uintIndicesCurrentlySet = indexBuffer->is32Bits;
   }
+  else {
+    ++_stateCounters.indexBufferBindingsAvoided;
+  }
 }
 
 void ThinEngine::_bindVertexBuffersAttributes(
@@ -1270,6 +1295,7 @@ void ThinEngine::bindBuffersDirectly(const WebGLDataBufferPtr& vertexBuffer,
                                      const EffectPtr& effect)
 {
   if (_cachedVertexBuffers != vertexBuffer || _cachedEffectForVertexBuffers != effect) {
+    ++_stateCounters.vertexBufferBindings;
     _cachedVertexBuffers          = vertexBuffer;
     _cachedEffectForVertexBuffers = effect;
 
@@ -1298,6 +1324,9 @@ void ThinEngine::bindBuffersDirectly(const WebGLDataBufferPtr& vertexBuffer,
       }
     }
   }
+  else {
+    ++_stateCounters.vertexBufferBindingsAvoided;
+  }
 
   _bindIndexBufferWithCache(indexBuffer);
 }
@@ -1321,11 +1350,15 @@ void ThinEngine::bindBuffers(const std::unordered_map<std::string, VertexBufferP
                              const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect)
 {
   if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect) {
+    ++_stateCounters.vertexBufferBindings;
     _cachedVertexBuffersMap       = vertexBuffers;
     _cachedEffectForVertexBuffers = effect;
 
     _bindVertexBuffersAttributes(vertexBuffers, effect);
   }
+  else {
+    ++_stateCounters.vertexBufferBindingsAvoided;
+  }
 
   _bindIndexBufferWithCache(indexBuffer);
 }
@@ -1888,9 +1921,14 @@ Int32Array ThinEngine::getAttributes(const IPipelineContextPtr& pipelineContext,
 
 void ThinEngine::enableEffect(const EffectPtr& effect)
 {
-  if (!effect || effect == _currentEffect) {
+  if (!effect) {
     return;
   }
+  if (effect == _currentEffect) {
+    ++_stateCounters.effectBindingsAvoided;
+    return;
+  }
+  ++_stateCounters.effectBindings;
 
   // Use program
   bindSamplers(*effect);
@@ -1903,6 +1941,16 @@ void ThinEngine::enableEffect(const EffectPtr& effect)
   effect->onBindObservable().notifyObservers(effect.get());
 }
 
+const EngineStateCounters& ThinEngine::getStateCounters() const
+{
+  return _stateCounters;
+}
+
+void ThinEngine::resetStateCounters()
+{
+  _stateCounters.reset();
+}
+
 bool ThinEngine::setInt(const WebGLUniformLocationPtr& uniform, int value)
 {
   if (!uniform) {
@@ -2113,7 +2161,7 @@ std::unique_ptr<StencilState>& ThinEngine::get_stencilState()
 
 void ThinEngine::clearInternalTexturesCache()
 {
-  _internalTexturesCache = {};
+  _internalTexturesCache.clear();
 }
 
 void ThinEngine::wipeCaches(bool bruteForce)
@@ -2341,7 +2389,7 @@ InternalTexturePtr ThinEngine::createTexture(
   }
 
   if (!fallback) {
-    _internalTexturesCache.emplace_back(texture);
+    _internalTexturesCache.add(texture);
   }
 
   const auto onInternalError = [=](const std::string& message, const std::string& exception) {
@@ -2475,14 +2523,26 @@ InternalTexturePtr ThinEngine::createTexture(
         samplingMode);
     };
 
+    // The image decoder reads and decodes the images on its workers, the texture is created with
+    // the decoded image at the beginning of the next frame
     if (!fromData || isBase64) {
       if (url.empty() && buffer.has_value() && std::holds_alternative<Image>(*buffer)) {
         onload(std::get<Image>(*buffer));
       }
+      else if (_imageDecoder) {
+        _imageDecoder->decodeUrl(url, invertY, onload, onInternalError);
+      }
       else {
         ThinEngine::_FileToolsLoadImageFromUrl(url, onload, onInternalError, invertY, mimeType);
       }
     }
+    else if (buffer.has_value() && _imageDecoder
+             && std::holds_alternative<std::string>(*buffer)) {
+      _imageDecoder->decode(std::get<std::string>(*buffer), invertY, onload, onInternalError);
+    }
+    else if (buffer.has_value() && _imageDecoder && std::holds_alternative<ArrayBuffer>(*buffer)) {
+      _imageDecoder->decode(std::get<ArrayBuffer>(*buffer), invertY, onload, onInternalError);
+    }
     else if (buffer.has_value()
              && (std::holds_alternative<std::string>(*buffer)
                  || std::holds_alternative<ArrayBuffer>(*buffer)
@@ -2987,7 +3047,7 @@ void ThinEngine::_releaseTexture(const InternalTexturePtr& texture)
   // Unbind channels
   unbindAllTextures();
 
-  stl_util::remove_vector_elements_equal_sharedptr(_internalTexturesCache, texture.get());
+  _internalTexturesCache.remove(texture.get());
 
   // Integrated fixed lod samplers.
   if (texture->_lodTextureHigh) {
@@ -3006,6 +3066,26 @@ void ThinEngine::_releaseTexture(const InternalTexturePtr& texture)
   }
 }
 
+void ThinEngine::_releaseUnreferencedTexture(const InternalTexturePtr& texture)
+{
+  if (!_internalTexturesCache.retain(texture)) {
+    _releaseTexture(texture);
+    texture->_webGLTexture = nullptr;
+    return;
+  }
+
+  // The texture is kept for reuse, the least recently used ones are released instead
+  _releaseEvictedTextures();
+}
+
+void ThinEngine::_releaseEvictedTextures()
+{
+  for (const auto& texture : _internalTexturesCache.evict()) {
+    _releaseTexture(texture);
+    texture->_webGLTexture = nullptr;
+  }
+}
+
 void ThinEngine::_deleteTexture(const WebGLTexturePtr& texture)
 {
   _gl->deleteTexture(texture.get());
@@ -3060,6 +3140,7 @@ bool ThinEngine::_bindTextureDirectly(unsigned int target, const InternalTexture
   }
 
   if (currentTextureBound != texture || force) {
+    ++_stateCounters.textureBindings;
     _activateCurrentTexture();
 
     if (texture && texture->isMultiview) {
@@ -3079,6 +3160,9 @@ bool ThinEngine::_bindTextureDirectly(unsigned int target, const InternalTexture
     wasPreviouslyBound = true;
     _activateCurrentTexture();
   }
+  else {
+    ++_stateCounters.textureBindingsAvoided;
+  }
 
   if (isTextureForRendering && !forTextureDataUpdate) {
     _bindSamplerUniformToChannel(texture->_associatedChannel, _activeChannel);
@@ -3371,6 +3455,9 @@ void ThinEngine::dispose()
 {
   stopRenderLoop();
 
+  // Waits for the images being decoded, they are not uploaded anymore
+  _imageDecoder = nullptr;
+
   // Clear observables
   /* if (onBeforeTextureInitObservable) */ {
     onBeforeTextureInitObservable.clear();
@@ -3386,6 +3473,9 @@ void ThinEngine::dispose()
     _emptyCubeTexture = nullptr;
   }
 
+  // Unreferenced textures kept in the cache
+  setTexturesCacheMemoryBudget(0);
+
   if (_dummyFramebuffer) {
     _gl->deleteFramebuffer(_dummyFramebuffer.get());
   }
@@ -3927,6 +4017,10 @@ void ThinEngine::updateDynamicIndexBuffer(const WebGLDataBufferPtr& indexBuffer,
 void ThinEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
                                            const Float32Array& data, int byteOffset, int byteLength)
 {
+  const auto dataLength = data.size() * sizeof(float);
+  ++_stateCounters.vertexBufferUploads;
+  _stateCounters.vertexBufferUploadedBytes
+    += byteLength < 0 ? dataLength : std::min(static_cast<size_t>(byteLength), dataLength);
   _dynamicBufferExtension->updateDynamicVertexBuffer(vertexBuffer, data, byteOffset, byteLength);
 }
 
@@ -11,14 +11,30 @@ EngineInstrumentation::EngineInstrumentation(Engine* engine)
     , shaderCompilationTimeCounter{this, &EngineInstrumentation::get_shaderCompilationTimeCounter}
     , captureShaderCompilationTime{this, &EngineInstrumentation::get_captureShaderCompilationTime,
                                    &EngineInstrumentation::set_captureShaderCompilationTime}
+    , stateChangesCounter{this, &EngineInstrumentation::get_stateChangesCounter}
+    , stateChangesAvoidedCounter{this, &EngineInstrumentation::get_stateChangesAvoidedCounter}
+    , captureStateChanges{this, &EngineInstrumentation::get_captureStateChanges,
+                          &EngineInstrumentation::set_captureStateChanges}
+    , texturesCacheHitsCounter{this, &EngineInstrumentation::get_texturesCacheHitsCounter}
+    , texturesCacheMissesCounter{this, &EngineInstrumentation::get_texturesCacheMissesCounter}
+    , texturesCacheEvictionsCounter{this, &EngineInstrumentation::get_texturesCacheEvictionsCounter}
+    , captureTexturesCache{this, &EngineInstrumentation::get_captureTexturesCache,
+                           &EngineInstrumentation::set_captureTexturesCache}
     , _engine{engine}
     , _captureGPUFrameTime{false}
     , _gpuFrameTimeToken{std::nullopt}
     , _captureShaderCompilationTime{false}
+    , _captureStateChanges{false}
+    , _frameStartStateChanges{0}
+    , _frameStartStateChangesAvoided{0}
+    , _captureTexturesCache{false}
     , _onBeginFrameObserver{nullptr}
     , _onEndFrameObserver{nullptr}
     , _onBeforeShaderCompilationObserver{nullptr}
     , _onAfterShaderCompilationObserver{nullptr}
+    , _onBeginFrameStateObserver{nullptr}
+    , _onEndFrameStateObserver{nullptr}
+    , _onEndFrameTexturesCacheObserver{nullptr}
 {
 }
 
@@ -108,6 +124,107 @@ void EngineInstrumentation::set_captureShaderCompilationTime(bool value)
   }
 }
 
+PerfCounter& EngineInstrumentation::get_stateChangesCounter()
+{
+  return _stateChanges;
+}
+
+PerfCounter& EngineInstrumentation::get_stateChangesAvoidedCounter()
+{
+  return _stateChangesAvoided;
+}
+
+bool EngineInstrumentation::get_captureStateChanges() const
+{
+  return _captureStateChanges;
+}
+
+void EngineInstrumentation::set_captureStateChanges(bool value)
+{
+  if (value == _captureStateChanges) {
+    return;
+  }
+
+  _captureStateChanges = value;
+
+  if (value) {
+    _onBeginFrameStateObserver
+      = _engine->onBeginFrameObservable.add([this](Engine* /*engine*/, EventState& /*es*/) {
+          const auto& counters           = _engine->getStateCounters();
+          _frameStartStateChanges        = counters.stateChanges();
+          _frameStartStateChangesAvoided = counters.stateChangesAvoided();
+        });
+
+    _onEndFrameStateObserver
+      = _engine->onEndFrameObservable.add([this](Engine* /*engine*/, EventState& /*es*/) {
+          const auto& counters = _engine->getStateCounters();
+          _stateChanges.fetchNewFrame();
+          _stateChanges.addCount(counters.stateChanges() - _frameStartStateChanges, true);
+          _stateChangesAvoided.fetchNewFrame();
+          _stateChangesAvoided.addCount(
+            counters.stateChangesAvoided() - _frameStartStateChangesAvoided, true);
+        });
+  }
+  else {
+    _engine->onBeginFrameObservable.remove(_onBeginFrameStateObserver);
+    _onBeginFrameStateObserver = nullptr;
+    _engine->onEndFrameObservable.remove(_onEndFrameStateObserver);
+    _onEndFrameStateObserver = nullptr;
+  }
+}
+
+PerfCounter& EngineInstrumentation::get_texturesCacheHitsCounter()
+{
+  return _texturesCacheHits;
+}
+
+PerfCounter& EngineInstrumentation::get_texturesCacheMissesCounter()
+{
+  return _texturesCacheMisses;
+}
+
+PerfCounter& EngineInstrumentation::get_texturesCacheEvictionsCounter()
+{
+  return _texturesCacheEvictions;
+}
+
+bool EngineInstrumentation::get_captureTexturesCache() const
+{
+  return _captureTexturesCache;
+}
+
+void EngineInstrumentation::set_captureTexturesCache(bool value)
+{
+  if (value == _captureTexturesCache) {
+    return;
+  }
+
+  _captureTexturesCache = value;
+
+  if (value) {
+    // Textures are mostly looked up while loading, outside of the frames, so the counters are
+    // sampled from one frame end to the next
+    _lastTexturesCacheCounters = _engine->getLoadedTexturesCache().counters();
+
+    _onEndFrameTexturesCacheObserver
+      = _engine->onEndFrameObservable.add([this](Engine* /*engine*/, EventState& /*es*/) {
+          const auto& counters = _engine->getLoadedTexturesCache().counters();
+          _texturesCacheHits.fetchNewFrame();
+          _texturesCacheHits.addCount(counters.hits - _lastTexturesCacheCounters.hits, true);
+          _texturesCacheMisses.fetchNewFrame();
+          _texturesCacheMisses.addCount(counters.misses - _lastTexturesCacheCounters.misses, true);
+          _texturesCacheEvictions.fetchNewFrame();
+          _texturesCacheEvictions.addCount(
+            counters.evictions - _lastTexturesCacheCounters.evictions, true);
+          _lastTexturesCacheCounters = counters;
+        });
+  }
+  else {
+    _engine->onEndFrameObservable.remove(_onEndFrameTexturesCacheObserver);
+    _onEndFrameTexturesCacheObserver = nullptr;
+  }
+}
+
 void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _engine->onBeginFrameObservable.remove(_onBeginFrameObserver);
@@ -122,6 +239,15 @@ void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMateria
   _engine->onAfterShaderCompilationObservable.remove(_onAfterShaderCompilationObserver);
   _onAfterShaderCompilationObserver = nullptr;
 
+  _engine->onBeginFrameObservable.remove(_onBeginFrameStateObserver);
+  _onBeginFrameStateObserver = nullptr;
+
+  _engine->onEndFrameObservable.remove(_onEndFrameStateObserver);
+  _onEndFrameStateObserver = nullptr;
+
+  _engine->onEndFrameObservable.remove(_onEndFrameTexturesCacheObserver);
+  _onEndFrameTexturesCacheObserver = nullptr;
+
   _engine = nullptr;
 }
 
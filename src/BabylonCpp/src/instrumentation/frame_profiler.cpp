@@ -0,0 +1,278 @@
+#include <babylon/instrumentation/frame_profiler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <babylon/core/logging.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Ring buffer of the events recorded by one thread.
+ */
+struct ThreadBuffer {
+  explicit ThreadBuffer(size_t iThreadId, size_t capacity) : threadId{iThreadId}
+  {
+    // Power of two capacity, the event index is a mask of the recorded count
+    size_t size = 1;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    events.resize(size);
+  }
+
+  // Only contended while the events are read
+  std::mutex mutex;
+  size_t threadId;
+  std::vector<ProfilerEvent> events;
+  size_t recordedCount = 0;
+  // Zones opened on this thread, an unmatched EndZone() is ignored
+  size_t depth = 0;
+}; // end of struct ThreadBuffer
+
+struct ProfilerState {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+  std::unordered_set<std::string> names;
+  size_t capturedFrameCount = 0;
+  std::string captureFilename;
+  const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+}; // end of struct ProfilerState
+
+ProfilerState& profilerState()
+{
+  // Never destroyed, threads may record events during the static destruction
+  static auto* state = new ProfilerState();
+  return *state;
+}
+
+// The buffers are owned by the profiler so that the events of finished threads are kept
+thread_local ThreadBuffer* currentThreadBuffer = nullptr;
+
+ThreadBuffer& threadBuffer()
+{
+  if (!currentThreadBuffer) {
+    auto& state = profilerState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    state.threadBuffers.emplace_back(std::make_unique<ThreadBuffer>(
+      state.threadBuffers.size() + 1, FrameProfiler::ThreadBufferCapacity));
+    currentThreadBuffer = state.threadBuffers.back().get();
+  }
+  return *currentThreadBuffer;
+}
+
+const char* internName(const std::string& name)
+{
+  thread_local std::unordered_map<std::string, const char*> cache;
+  auto it = cache.find(name);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> lock{state.mutex};
+  // Nodes are never moved nor erased, the pointer stays valid
+  const auto* interned = state.names.emplace(name).first->c_str();
+  cache.emplace(name, interned);
+  return interned;
+}
+
+void record(const char* name, char phase, double value = 0.0)
+{
+  const auto timestamp = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                         - profilerState().origin)
+      .count());
+  auto& buffer = threadBuffer();
+  std::lock_guard<std::mutex> lock{buffer.mutex};
+  if (phase == 'B') {
+    ++buffer.depth;
+  }
+  else if (phase == 'E') {
+    if (buffer.depth == 0) {
+      return;
+    }
+    --buffer.depth;
+  }
+  auto& event     = buffer.events[buffer.recordedCount & (buffer.events.size() - 1)];
+  event.name      = name;
+  event.timestamp = timestamp;
+  event.value     = value;
+  event.phase     = phase;
+  ++buffer.recordedCount;
+}
+
+void writeJsonString(std::ostream& stream, const char* text)
+{
+  stream << '"';
+  for (const char* c = text ? text : ""; *c; ++c) {
+    switch (*c) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(*c) >= 0x20) {
+          stream << *c;
+        }
+    }
+  }
+  stream << '"';
+}
+
+} // end of anonymous namespace
+
+std::atomic<bool> FrameProfiler::_enabled{false};
+
+void FrameProfiler::SetEnabled(bool enabled)
+{
+  _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void FrameProfiler::CaptureFrames(size_t frameCount, const std::string& filename)
+{
+  {
+    auto& state = profilerState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    state.capturedFrameCount = frameCount;
+    state.captureFilename    = filename;
+  }
+  Clear();
+  SetEnabled(frameCount > 0);
+}
+
+void FrameProfiler::BeginZone(const char* name)
+{
+  if (IsEnabled()) {
+    record(name, 'B');
+  }
+}
+
+void FrameProfiler::BeginZone(const std::string& name)
+{
+  if (IsEnabled()) {
+    record(internName(name), 'B');
+  }
+}
+
+void FrameProfiler::EndZone()
+{
+  // Recorded even when disabled meanwhile, to close the zones left open
+  if (IsEnabled() || currentThreadBuffer) {
+    record(nullptr, 'E');
+  }
+}
+
+void FrameProfiler::Counter(const char* name, double value)
+{
+  if (IsEnabled()) {
+    record(name, 'C', value);
+  }
+}
+
+void FrameProfiler::BeginFrame()
+{
+  BeginZone("Frame");
+}
+
+void FrameProfiler::EndFrame()
+{
+  EndZone();
+  if (!IsEnabled()) {
+    return;
+  }
+
+  std::string filename;
+  {
+    auto& state = profilerState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    if (state.capturedFrameCount == 0 || --state.capturedFrameCount > 0) {
+      return;
+    }
+    filename = std::move(state.captureFilename);
+  }
+  SetEnabled(false);
+  DumpChromeTrace(filename);
+}
+
+std::vector<ProfilerEvent> FrameProfiler::Events()
+{
+  std::vector<ProfilerEvent> events;
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> lock{state.mutex};
+  for (const auto& buffer : state.threadBuffers) {
+    std::lock_guard<std::mutex> bufferLock{buffer->mutex};
+    const auto capacity = buffer->events.size();
+    const auto count    = std::min(buffer->recordedCount, capacity);
+    for (size_t i = buffer->recordedCount - count; i < buffer->recordedCount; ++i) {
+      events.emplace_back(buffer->events[i % capacity]);
+    }
+  }
+  return events;
+}
+
+void FrameProfiler::Clear()
+{
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> lock{state.mutex};
+  for (const auto& buffer : state.threadBuffers) {
+    std::lock_guard<std::mutex> bufferLock{buffer->mutex};
+    buffer->recordedCount = 0;
+  }
+}
+
+void FrameProfiler::WriteChromeTrace(std::ostream& stream)
+{
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> lock{state.mutex};
+  stream << "{\"traceEvents\":[";
+  auto first = true;
+  for (const auto& buffer : state.threadBuffers) {
+    std::lock_guard<std::mutex> bufferLock{buffer->mutex};
+    const auto capacity = buffer->events.size();
+    const auto count    = std::min(buffer->recordedCount, capacity);
+    for (size_t i = buffer->recordedCount - count; i < buffer->recordedCount; ++i) {
+      const auto& event = buffer->events[i % capacity];
+      stream << (first ? "\n" : ",\n") << "{\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":"
+             << buffer->threadId << ",\"ts\":" << event.timestamp / 1000 << '.'
+             << (event.timestamp % 1000) / 100 << (event.timestamp % 100) / 10
+             << event.timestamp % 10;
+      if (event.phase != 'E') {
+        stream << ",\"name\":";
+        writeJsonString(stream, event.name);
+      }
+      if (event.phase == 'C') {
+        stream << ",\"args\":{\"value\":" << event.value << '}';
+      }
+      stream << '}';
+      first = false;
+    }
+  }
+  stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool FrameProfiler::DumpChromeTrace(const std::string& filename)
+{
+  std::ofstream stream{filename, std::ios::out | std::ios::trunc};
+  if (!stream) {
+    BABYLON_LOGF_ERROR("FrameProfiler", "Could not write the trace file %s", filename.c_str())
+    return false;
+  }
+  WriteChromeTrace(stream);
+  BABYLON_LOGF_INFO("FrameProfiler", "Trace written to %s", filename.c_str())
+  return stream.good();
+}
+
+} // end of namespace BABYLON
@@ -3,6 +3,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/misc/tools.h>
 
 namespace BABYLON {
@@ -46,6 +47,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , captureCameraRenderTime{this, &SceneInstrumentation::get_captureCameraRenderTime,
                               &SceneInstrumentation::set_captureCameraRenderTime}
     , drawCallsCounter{this, &SceneInstrumentation::get_drawCallsCounter}
+    , allocationsCounter{this, &SceneInstrumentation::get_allocationsCounter}
+    , allocatedBytesCounter{this, &SceneInstrumentation::get_allocatedBytesCounter}
+    , captureAllocations{this, &SceneInstrumentation::get_captureAllocations,
+                         &SceneInstrumentation::set_captureAllocations}
     , _captureActiveMeshesEvaluationTime{false}
     , _captureRenderTargetsRenderTime{false}
     , _captureFrameTime{false}
@@ -56,6 +61,7 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , _capturePhysicsTime{false}
     , _captureAnimationsTime{false}
     , _captureCameraRenderTime{false}
+    , _captureAllocations{false}
     , _onBeforeActiveMeshesEvaluationObserver{nullptr}
     , _onAfterActiveMeshesEvaluationObserver{nullptr}
     , _onBeforeRenderTargetsRenderObserver{nullptr}
@@ -106,6 +112,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
           _animationsTime.beginMonitoring();
         }
 
+        if (_captureAllocations) {
+          _frameStartAllocations = MemoryTracker::ThreadAllocations();
+        }
+
         scene->getEngine()->_drawCalls.fetchNewFrame();
       });
 
@@ -124,6 +134,14 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
         if (_captureInterFrameTime) {
           _interFrameTime.beginMonitoring();
         }
+
+        if (_captureAllocations) {
+          const auto allocations = MemoryTracker::ThreadAllocations();
+          _allocations.fetchNewFrame();
+          _allocations.addCount(allocations.allocations - _frameStartAllocations.allocations, true);
+          _allocatedBytes.fetchNewFrame();
+          _allocatedBytes.addCount(allocations.bytes - _frameStartAllocations.bytes, true);
+        }
       });
 }
 
@@ -474,6 +492,36 @@ PerfCounter& SceneInstrumentation::get_drawCallsCounter()
   return scene->getEngine()->_drawCalls;
 }
 
+PerfCounter& SceneInstrumentation::get_allocationsCounter()
+{
+  return _allocations;
+}
+
+PerfCounter& SceneInstrumentation::get_allocatedBytesCounter()
+{
+  return _allocatedBytes;
+}
+
+bool SceneInstrumentation::get_captureAllocations() const
+{
+  return _captureAllocations;
+}
+
+void SceneInstrumentation::set_captureAllocations(bool value)
+{
+  _captureAllocations = value;
+}
+
+size_t SceneInstrumentation::getMemoryUsage(MemoryCategory category) const
+{
+  return MemoryTracker::LiveBytes(category);
+}
+
+size_t SceneInstrumentation::getTexturesMemoryUsage() const
+{
+  return scene->getEngine()->getLoadedTexturesCache().memoryUsage();
+}
+
 void SceneInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   scene->onAfterRenderObservable.remove(_onAfterRenderObserver);
@@ -30,7 +30,15 @@ void IRenderableScene::initialize(ICanvas* canvas)
   }
 
   // Load the 3D engine
-  _engine = Engine::New(_canvas);
+  initialize(_canvas, Engine::New(_canvas));
+}
+
+void IRenderableScene::initialize(ICanvas* canvas, std::unique_ptr<Engine>&& engine)
+{
+  _initialized = false;
+  _canvas      = canvas;
+  _scene       = nullptr;
+  _engine      = std::move(engine);
   // Creates the basic Babylon Scene object
   _scene = Scene::New(_engine.get());
   // Set the render function
@@ -9,6 +9,7 @@
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/lights/ishadow_light.h>
 #include <babylon/lights/point_light.h>
 #include <babylon/lights/shadows/shadow_generator_scene_component.h>
@@ -744,6 +745,7 @@ void ShadowGenerator::_renderForShadowMap(const std::vector<SubMesh*>& opaqueSub
                                           const std::vector<SubMesh*>& transparentSubMeshes,
                                           const std::vector<SubMesh*>& depthOnlySubMeshes)
 {
+  BABYLON_PROFILE_ZONE("Shadow map");
   auto engine = _scene->getEngine();
 
   const auto colorWrite = engine->getColorWrite();
@@ -0,0 +1,410 @@
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <babylon/core/json_util.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+#include <babylon/materials/material.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+static_assert(sizeof(BabylonBinaryFileHeader) == 32, "Unexpected binary .babylon header size");
+
+namespace {
+
+size_t alignBlockOffset(size_t offset)
+{
+  const auto alignment = BabylonBinaryFile::BlockAlignment;
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+bool writeFile(const std::string& data, const std::string& filename)
+{
+  std::ofstream ofs(filename.c_str(), std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFile", "Could not open file %s", filename.c_str())
+    return false;
+  }
+  ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+  return static_cast<bool>(ofs);
+}
+
+/**
+ * @brief Returns the type of the packed array stored for a json node in the current packed arrays
+ * table ('f' float, 'u' uint32_t), '\0' if there is none.
+ */
+char packedArrayType(const json& value)
+{
+  const auto* arrays = json_util::current_packed_arrays();
+  if (!arrays || !value.is_array() || !value.empty()) {
+    return '\0';
+  }
+  if (arrays->floats.count(&value)) {
+    return 'f';
+  }
+  if (arrays->indices.count(&value)) {
+    return 'u';
+  }
+  const auto it = arrays->views.find(&value);
+  return it == arrays->views.end() ? '\0' : (it->second.isFloat ? 'f' : 'u');
+}
+
+/**
+ * @brief Appends the numbers of a vertex data array to the blocks section.
+ * @returns the block reference replacing the array, a null value if the value is not a numeric
+ * array
+ */
+json appendBlock(const json& value, bool isIndices, std::string& blocks, json& blockTable)
+{
+  std::vector<float> floats;
+  std::vector<uint32_t> indices;
+  const auto packedType = packedArrayType(value);
+  if (packedType == 'f') {
+    json_util::get_packed_array(value, floats);
+  }
+  else if (packedType == 'u') {
+    json_util::get_packed_array(value, indices);
+  }
+  else if (value.is_array() && !value.empty()
+           && std::all_of(value.begin(), value.end(),
+                          [](const json& number) { return number.is_number(); })) {
+    const auto areIndices
+      = isIndices && std::all_of(value.begin(), value.end(), [](const json& number) {
+          return number.is_number_unsigned()
+                 && number.get<uint64_t>() <= std::numeric_limits<uint32_t>::max();
+        });
+    if (areIndices) {
+      indices = value.get<std::vector<uint32_t>>();
+    }
+    else {
+      floats = value.get<std::vector<float>>();
+    }
+  }
+  else {
+    return nullptr;
+  }
+
+  const auto isFloat = packedType == 'f' || (packedType == '\0' && indices.empty());
+  const auto count   = isFloat ? floats.size() : indices.size();
+  const auto offset  = alignBlockOffset(blocks.size());
+  blocks.resize(offset + count * 4, '\0');
+  if (count > 0) {
+    std::memcpy(&blocks[offset], isFloat ? static_cast<const void*>(floats.data()) : indices.data(),
+                count * 4);
+  }
+  blockTable.emplace_back(json::object(
+    {{"offset", offset}, {"count", count}, {"type", std::string(1, isFloat ? 'f' : 'u')}}));
+  return json::object({{"$block", blockTable.size() - 1}});
+}
+
+/**
+ * @brief Returns a copy of a value where the vertex data arrays are moved into the blocks section.
+ */
+json extractBlocks(const json& value, std::string& blocks, json& blockTable)
+{
+  if (value.is_object()) {
+    auto result = json::object();
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      if (BabylonFileReader::IsVertexDataKey(it.key())) {
+        auto reference = appendBlock(it.value(), it.key() == "indices", blocks, blockTable);
+        if (!reference.is_null()) {
+          result[it.key()] = std::move(reference);
+          continue;
+        }
+      }
+      result[it.key()] = extractBlocks(it.value(), blocks, blockTable);
+    }
+    return result;
+  }
+  if (value.is_array()) {
+    auto result = json::array();
+    for (const auto& element : value) {
+      result.emplace_back(extractBlocks(element, blocks, blockTable));
+    }
+    return result;
+  }
+  return value;
+}
+
+bool isBlockReference(const json& value)
+{
+  return value.is_object() && value.size() == 1 && json_util::has_key(value, "$block");
+}
+
+/**
+ * @brief Replaces a block reference by an empty array and a view on the block in the packed arrays.
+ */
+void readBlock(json& reference, const json& blockTable, std::string_view blocks,
+               json_util::packed_arrays& packedArrays)
+{
+  const auto index = json_util::get_number<size_t>(reference, "$block");
+  if (index >= blockTable.size()) {
+    throw std::runtime_error("Invalid block reference in binary .babylon file");
+  }
+  const auto& block = blockTable[index];
+  const auto offset = json_util::get_number<size_t>(block, "offset");
+  const auto count  = json_util::get_number<size_t>(block, "count");
+  const auto type   = json_util::get_string(block, "type");
+  if ((type != "f" && type != "u") || offset > blocks.size()
+      || count > (blocks.size() - offset) / 4) {
+    throw std::runtime_error("Invalid block in binary .babylon file");
+  }
+  reference = json::array();
+  packedArrays.views[&reference] = {type == "f", blocks.data() + offset, count};
+}
+
+void resolveBlocks(json& value, const json& blockTable, std::string_view blocks,
+                   json_util::packed_arrays& packedArrays)
+{
+  if (!value.is_object() && !value.is_array()) {
+    return;
+  }
+  for (auto& element : value) {
+    if (isBlockReference(element)) {
+      readBlock(element, blockTable, blocks, packedArrays);
+    }
+    else {
+      resolveBlocks(element, blockTable, blocks, packedArrays);
+    }
+  }
+}
+
+/**
+ * @brief Moves a vertex buffer of a mesh into the packed arrays of a document.
+ */
+void serializeVerticesData(Mesh& mesh, const std::string& kind, const std::string& key,
+                           json& serializationObject, json_util::packed_arrays& packedArrays)
+{
+  if (!mesh.isVerticesDataPresent(kind)) {
+    return;
+  }
+  auto& value                = serializationObject[key];
+  value                      = json::array();
+  packedArrays.floats[&value] = mesh.getVerticesData(kind);
+}
+
+/**
+ * @brief Packs the 4 bone indices of each vertex into one integer as in .babylon files.
+ */
+void serializeMatricesIndices(Mesh& mesh, const std::string& kind, const std::string& key,
+                              json& serializationObject, json_util::packed_arrays& packedArrays)
+{
+  if (!mesh.isVerticesDataPresent(kind)) {
+    return;
+  }
+  const auto matricesIndices = mesh.getVerticesData(kind);
+  std::vector<uint32_t> packedIndices(matricesIndices.size() / 4);
+  for (size_t i = 0; i < packedIndices.size(); ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      packedIndices[i] |= (static_cast<uint32_t>(matricesIndices[i * 4 + j]) & 0xff) << (j * 8);
+    }
+  }
+  auto& value                 = serializationObject[key];
+  value                       = json::array();
+  packedArrays.indices[&value] = std::move(packedIndices);
+}
+
+json serializeMesh(Mesh& mesh, json_util::packed_arrays& packedArrays)
+{
+  auto serializationObject = json::object();
+  serializationObject["name"]      = mesh.name;
+  serializationObject["id"]        = mesh.id;
+  serializationObject["isEnabled"] = mesh.isEnabled(false);
+  serializationObject["isVisible"] = mesh.isVisible;
+  serializationObject["position"]  = mesh.position().asArray();
+  if (mesh.rotationQuaternion()) {
+    serializationObject["rotationQuaternion"] = mesh.rotationQuaternion()->asArray();
+  }
+  else {
+    serializationObject["rotation"] = mesh.rotation().asArray();
+  }
+  serializationObject["scaling"] = mesh.scaling().asArray();
+  if (mesh.parent()) {
+    serializationObject["parentId"] = mesh.parent()->id;
+  }
+  if (mesh.material()) {
+    serializationObject["materialId"] = mesh.material()->id;
+  }
+  serializationObject["visibility"] = mesh.visibility();
+
+  // Vertex data
+  serializeVerticesData(mesh, VertexBuffer::PositionKind, "positions", serializationObject,
+                        packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::NormalKind, "normals", serializationObject,
+                        packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::TangentKind, "tangents", serializationObject,
+                        packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::UVKind, "uvs", serializationObject, packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::UV2Kind, "uvs2", serializationObject, packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::ColorKind, "colors", serializationObject,
+                        packedArrays);
+  serializeMatricesIndices(mesh, VertexBuffer::MatricesIndicesKind, "matricesIndices",
+                           serializationObject, packedArrays);
+  serializeVerticesData(mesh, VertexBuffer::MatricesWeightsKind, "matricesWeights",
+                        serializationObject, packedArrays);
+  auto& indices                = serializationObject["indices"];
+  indices                      = json::array();
+  packedArrays.indices[&indices] = mesh.getIndices();
+
+  // Sub meshes
+  auto subMeshes = json::array();
+  for (const auto& subMesh : mesh.subMeshes) {
+    subMeshes.emplace_back(json::object({{"materialIndex", subMesh->materialIndex},
+                                         {"verticesStart", subMesh->verticesStart},
+                                         {"verticesCount", subMesh->verticesCount},
+                                         {"indexStart", subMesh->indexStart},
+                                         {"indexCount", subMesh->indexCount}}));
+  }
+  serializationObject["subMeshes"] = std::move(subMeshes);
+
+  return serializationObject;
+}
+
+} // end of anonymous namespace
+
+bool BabylonBinaryFile::IsBinary(std::string_view data)
+{
+  return data.size() >= sizeof(BabylonBinaryFileHeader) && data.substr(0, 4) == Magic;
+}
+
+std::string BabylonBinaryFile::Serialize(const json& document)
+{
+  std::string blocks;
+  auto blockTable = json::array();
+  auto metadata   = extractBlocks(document, blocks, blockTable);
+  if (metadata.is_object()) {
+    metadata["$blocks"] = std::move(blockTable);
+  }
+  const auto metadataString = metadata.dump();
+
+  BabylonBinaryFileHeader header{};
+  std::memcpy(header.magic, Magic, sizeof(header.magic));
+  header.version        = Version;
+  header.metadataLength = metadataString.size();
+  header.blocksOffset   = alignBlockOffset(sizeof(header) + metadataString.size());
+  header.blocksLength   = blocks.size();
+
+  std::string data(header.blocksOffset + blocks.size(), '\0');
+  std::memcpy(&data[0], &header, sizeof(header));
+  std::memcpy(&data[sizeof(header)], metadataString.data(), metadataString.size());
+  if (!blocks.empty()) {
+    std::memcpy(&data[header.blocksOffset], blocks.data(), blocks.size());
+  }
+  return data;
+}
+
+std::string BabylonBinaryFile::Serialize(const BabylonFileData& fileData)
+{
+  json_util::packed_arrays_scope scope(&fileData.packedArrays);
+  return Serialize(fileData.root);
+}
+
+std::string BabylonBinaryFile::SerializeMeshes(const std::vector<MeshPtr>& meshes)
+{
+  BabylonFileData fileData;
+  auto& root = fileData.root;
+  root       = json::object();
+  root["producer"] = json::object({{"name", "BabylonCpp"}, {"file", ""}, {"version", ""},
+                                   {"exporter_version", ""}});
+
+  // The json values are only moved from here on, the nodes the packed arrays are keyed by stay valid
+  auto serializedMeshes = json::array();
+  for (const auto& mesh : meshes) {
+    if (mesh) {
+      serializedMeshes.emplace_back(serializeMesh(*mesh, fileData.packedArrays));
+    }
+  }
+  root["meshes"] = std::move(serializedMeshes);
+  return Serialize(fileData);
+}
+
+bool BabylonBinaryFile::Write(const json& document, const std::string& filename)
+{
+  return writeFile(Serialize(document), filename);
+}
+
+bool BabylonBinaryFile::WriteMeshes(const std::vector<MeshPtr>& meshes, const std::string& filename)
+{
+  return writeFile(SerializeMeshes(meshes), filename);
+}
+
+bool BabylonBinaryFile::Convert(const std::string& babylonFilename,
+                                const std::string& binaryFilename)
+{
+  MemoryMappedFile file;
+  if (!file.open(babylonFilename)) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFile", "Could not open file %s", babylonFilename.c_str())
+    return false;
+  }
+  BabylonFileData fileData;
+  try {
+    BabylonFileReader::Parse(file.view(), fileData);
+  }
+  catch (const std::exception& e) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFile", "Could not parse file %s: %s",
+                       babylonFilename.c_str(), e.what())
+    return false;
+  }
+  return writeFile(Serialize(fileData), binaryFilename);
+}
+
+void BabylonBinaryFile::Parse(std::string_view data, BabylonFileData& fileData)
+{
+  if (!IsBinary(data)) {
+    throw std::runtime_error("Not a binary .babylon file");
+  }
+  BabylonBinaryFileHeader header{};
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (header.version != Version) {
+    throw std::runtime_error("Unsupported binary .babylon file version "
+                             + std::to_string(header.version));
+  }
+  if (header.metadataLength > data.size() - sizeof(header)
+      || header.blocksOffset < sizeof(header) + header.metadataLength
+      || header.blocksOffset > data.size()
+      || header.blocksLength > data.size() - header.blocksOffset) {
+    throw std::runtime_error("Truncated binary .babylon file");
+  }
+
+  BabylonFileReader::Parse(data.substr(sizeof(header), header.metadataLength), fileData);
+
+  auto& root = fileData.root;
+  if (!root.is_object() || !json_util::has_key(root, "$blocks")) {
+    return;
+  }
+  const auto blockTable = std::move(root["$blocks"]);
+  root.erase("$blocks");
+  resolveBlocks(root, blockTable, data.substr(header.blocksOffset, header.blocksLength),
+                fileData.packedArrays);
+}
+
+bool BabylonBinaryFile::Read(const std::string& filename, BabylonFileData& fileData)
+{
+  auto file = std::make_shared<MemoryMappedFile>();
+  if (!file->open(filename)) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFile", "Could not open file %s", filename.c_str())
+    return false;
+  }
+  try {
+    Parse(file->view(), fileData);
+  }
+  catch (const std::exception& e) {
+    BABYLON_LOGF_ERROR("BabylonBinaryFile", "Could not parse file %s: %s", filename.c_str(),
+                       e.what())
+    return false;
+  }
+  // The packed arrays are views on the mapped blocks
+  fileData.mappedFile = std::move(file);
+  return true;
+}
+
+} // end of namespace BABYLON
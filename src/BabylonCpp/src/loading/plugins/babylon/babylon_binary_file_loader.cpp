@@ -0,0 +1,77 @@
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+
+namespace BABYLON {
+
+namespace {
+
+std::string rootUrlOf(const std::string& filename)
+{
+  const auto folder = Filesystem::baseDir(filename);
+  return folder.empty() ? "" : folder + "/";
+}
+
+} // end of anonymous namespace
+
+BabylonBinaryFileLoader::BabylonBinaryFileLoader()
+{
+  name          = "babylon.js binary";
+  extensions    = ISceneLoaderPluginExtensions{{{BabylonBinaryFile::Extension, true}}};
+  canDirectLoad = [](const std::string& data) { return BabylonBinaryFile::IsBinary(data); };
+}
+
+BabylonBinaryFileLoader::~BabylonBinaryFileLoader() = default;
+
+bool BabylonBinaryFileLoader::parseData(
+  const std::string& data, BabylonFileData& fileData, const std::string& operation,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  const std::function<bool(const std::string& section, const json& entry)>& /*onEntry*/) const
+{
+  // The metadata is small and the vertex data is read in place, the entries are created once the
+  // document is read
+  try {
+    BabylonBinaryFile::Parse(data, fileData);
+  }
+  catch (const std::exception& err) {
+    const auto msg = logOperation(operation) + " has failed binary parse";
+    if (onError) {
+      onError(msg, err.what());
+    }
+    else {
+      BABYLON_LOGF_ERROR("BabylonBinaryFileLoader", "%s", msg.c_str())
+    }
+    return false;
+  }
+  return true;
+}
+
+bool BabylonBinaryFileLoader::importMeshFromFile(const std::vector<std::string>& meshesNames,
+                                                 Scene* scene, const std::string& filename,
+                                                 std::vector<AbstractMeshPtr>& meshes,
+                                                 std::vector<SkeletonPtr>& skeletons) const
+{
+  BabylonFileData fileData;
+  if (!BabylonBinaryFile::Read(filename, fileData)) {
+    return false;
+  }
+
+  std::vector<IParticleSystemPtr> particleSystems;
+  return importMesh(meshesNames, scene, fileData, rootUrlOf(filename), meshes, particleSystems,
+                    skeletons);
+}
+
+bool BabylonBinaryFileLoader::loadFromFile(Scene* scene, const std::string& filename) const
+{
+  BabylonFileData fileData;
+  if (!BabylonBinaryFile::Read(filename, fileData)) {
+    return false;
+  }
+
+  return load(scene, fileData, rootUrlOf(filename));
+}
+
+} // end of namespace BABYLON
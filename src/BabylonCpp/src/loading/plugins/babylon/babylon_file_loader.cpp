@@ -1,5 +1,7 @@
 ﻿#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
 
+#include <unordered_set>
+
 #include <babylon/actions/action_manager.h>
 #include <babylon/animations/animation.h>
 #include <babylon/animations/animation_group.h>
@@ -15,6 +17,7 @@
 #include <babylon/lensflares/lens_flare_system.h>
 #include <babylon/lights/light.h>
 #include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
 #include <babylon/loading/scene_loader.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/multi_material.h>
@@ -32,6 +35,191 @@
 
 namespace BABYLON {
 
+namespace {
+
+void addActiveTextures(AssetContainer& container, const Material& material)
+{
+  for (const auto& t : material.getActiveTextures()) {
+    if (!stl_util::contains(container.textures, t)) {
+      container.textures.emplace_back(t);
+    }
+  }
+}
+
+/**
+ * @brief Creates the scene objects of the section entries of a .babylon file while it is read, so
+ * that their json and vertex data are released right away instead of once the whole document is
+ * built. The material and morph target manager of a mesh read before them are assigned once the file
+ * is read, any other entry referencing an object of the file which is not created yet (a mesh read
+ * before its geometry or skeleton for instance) is left in the document and created with the
+ * remaining entries.
+ */
+struct BabylonFileEntryLoader {
+
+  BabylonFileEntryLoader(Scene* iScene, const json& iRoot, const std::string& iRootUrl,
+                         bool iImportScene, AssetContainer& iContainer, std::ostringstream& iLog)
+      : scene{iScene}
+      , root{iRoot}
+      , rootUrl{iRootUrl}
+      , importScene{iImportScene}
+      , container{iContainer}
+      , log{iLog}
+      , fullDetails{SceneLoader::LoggingLevel() == SceneLoader::DETAILED_LOGGING}
+  {
+  }
+
+  /**
+   * @brief Creates the object of an entry, returns false if it has to wait for the remaining
+   * entries.
+   */
+  bool load(const std::string& section, const json& entry)
+  {
+    // The textures of the materials depend on this scene setting, the exporters write it before the
+    // entries
+    if (importScene && json_util::has_valid_key_value(root, "useDelayedTextureLoading")) {
+      scene->useDelayedTextureLoading = json_util::get_bool(root, "useDelayedTextureLoading")
+                                        && !SceneLoader::ForceFullSceneLoadingForIncremental();
+    }
+    try {
+      if (section == "materials") {
+        return loadMaterial(entry);
+      }
+      if (section == "multiMaterials") {
+        return loadMultiMaterial(entry);
+      }
+      if (section == "morphTargetManagers") {
+        container.morphTargetManagers.emplace_back(MorphTargetManager::Parse(entry, scene));
+        morphTargetManagerIds.insert(json_util::get_number<int>(entry, "id", 0));
+        return true;
+      }
+      if (section == "skeletons") {
+        auto skeleton = Skeleton::Parse(entry, scene);
+        container.skeletons.emplace_back(skeleton);
+        logEntry("Skeletons", skeleton->toString(fullDetails));
+        skeletonIds.insert(json_util::get_number<int>(entry, "id", -1));
+        return true;
+      }
+      if (section == "vertexData") {
+        if (auto geometry = Geometry::Parse(entry, scene, rootUrl)) {
+          container.geometries.emplace_back(geometry);
+        }
+        geometryIds.insert(json_util::get_string(entry, "id"));
+        return true;
+      }
+      if (section == "meshes") {
+        return loadMesh(entry);
+      }
+    }
+    catch (const std::exception& /*e*/) {
+      // Created again with the remaining entries, which reports the error
+    }
+    return false;
+  }
+
+  /**
+   * @brief Assigns the materials and morph target managers read after their meshes.
+   */
+  void resolveReferences()
+  {
+    for (const auto& [mesh, materialId] : pendingMaterials) {
+      mesh->setMaterialByID(materialId);
+    }
+    for (const auto& [mesh, morphTargetManagerId] : pendingMorphTargetManagers) {
+      mesh->morphTargetManager
+        = scene->getMorphTargetManagerById(static_cast<unsigned>(morphTargetManagerId));
+    }
+    pendingMaterials.clear();
+    pendingMorphTargetManagers.clear();
+  }
+
+private:
+  bool loadMaterial(const json& parsedMaterial)
+  {
+    auto mat = Material::Parse(parsedMaterial, scene, rootUrl);
+    if (mat) {
+      container.materials.emplace_back(mat);
+      logEntry("Materials", mat->toString(fullDetails));
+      addActiveTextures(container, *mat);
+    }
+    materialIds.insert(json_util::get_string(parsedMaterial, "id"));
+    return true;
+  }
+
+  bool loadMultiMaterial(const json& parsedMultiMaterial)
+  {
+    for (const auto& subMatId : json_util::get_array_ref(parsedMultiMaterial, "materials")) {
+      if (subMatId.is_string() && !materialIds.count(subMatId.get<std::string>())) {
+        return false;
+      }
+    }
+    auto mmat = MultiMaterial::ParseMultiMaterial(parsedMultiMaterial, scene);
+    if (mmat) {
+      container.multiMaterials.emplace_back(mmat);
+      logEntry("MultiMaterials", mmat->toString(fullDetails));
+      addActiveTextures(container, *mmat);
+    }
+    materialIds.insert(json_util::get_string(parsedMultiMaterial, "id"));
+    return true;
+  }
+
+  bool loadMesh(const json& parsedMesh)
+  {
+    // The geometry and the skeleton are used while the vertex data is imported
+    if (json_util::has_valid_key_value(parsedMesh, "geometryId")
+        && !geometryIds.count(json_util::get_string(parsedMesh, "geometryId"))) {
+      return false;
+    }
+    const auto skeletonId = json_util::get_number(parsedMesh, "skeletonId", -1);
+    if (skeletonId > -1 && !skeletonIds.count(skeletonId)) {
+      return false;
+    }
+
+    auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
+    const auto materialId = json_util::has_valid_key_value(parsedMesh, "materialId") ?
+                              json_util::get_string(parsedMesh, "materialId") :
+                              "";
+    if (!materialId.empty() && !materialIds.count(materialId)) {
+      pendingMaterials.emplace_back(mesh, materialId);
+    }
+    const auto morphTargetManagerId = json_util::get_number(parsedMesh, "morphTargetManagerId", -1);
+    if (morphTargetManagerId > -1 && !morphTargetManagerIds.count(morphTargetManagerId)) {
+      pendingMorphTargetManagers.emplace_back(mesh, morphTargetManagerId);
+    }
+    container.meshes.emplace_back(mesh);
+    if (mesh->hasInstances()) {
+      for (const auto& instance : mesh->instances) {
+        container.meshes.emplace_back(instance);
+      }
+    }
+    logEntry("Meshes", mesh->toString(fullDetails));
+    return true;
+  }
+
+  void logEntry(const std::string& section, const std::string& entry)
+  {
+    log << (loggedSections.insert(section).second ? "\n\t" + section + ":" : "");
+    log << "\n\t\t" << entry;
+  }
+
+  Scene* scene;
+  const json& root;
+  const std::string& rootUrl;
+  bool importScene;
+  AssetContainer& container;
+  std::ostringstream& log;
+  bool fullDetails;
+  std::unordered_set<std::string> materialIds;
+  std::unordered_set<std::string> geometryIds;
+  std::unordered_set<int> skeletonIds;
+  std::unordered_set<int> morphTargetManagerIds;
+  std::unordered_set<std::string> loggedSections;
+  std::vector<std::pair<MeshPtr, std::string>> pendingMaterials;
+  std::vector<std::pair<MeshPtr, int>> pendingMorphTargetManagers;
+
+}; // end of struct BabylonFileEntryLoader
+
+} // end of anonymous namespace
+
 BabylonFileLoader::BabylonFileLoader()
 {
   name          = "babylon.js";
@@ -44,15 +232,12 @@ BabylonFileLoader::BabylonFileLoader()
 
 BabylonFileLoader::~BabylonFileLoader() = default;
 
-MaterialPtr BabylonFileLoader::parseMaterialById(const std::string& id, const json& parsedData,
-                                                 Scene* scene, const std::string& rootUrl) const
+MaterialPtr BabylonFileLoader::parseMaterialById(const std::string& id,
+                                                 const BabylonFileData& fileData, Scene* scene,
+                                                 const std::string& rootUrl) const
 {
-  for (const auto& parsedMaterial : json_util::get_array<json>(parsedData, "materials")) {
-    if (json_util::get_string(parsedMaterial, "id") == id) {
-      return Material::Parse(parsedMaterial, scene, rootUrl);
-    }
-  }
-  return nullptr;
+  const auto parsedMaterial = fileData.getMaterialById(id);
+  return parsedMaterial ? Material::Parse(*parsedMaterial, scene, rootUrl) : nullptr;
 }
 
 bool BabylonFileLoader::isDescendantOf(const json& mesh, const std::vector<std::string>& names,
@@ -126,9 +311,66 @@ void BabylonFileLoader::loadDetailLevels(Scene* scene, const AbstractMeshPtr& me
   }
 }
 
+bool BabylonFileLoader::parseData(
+  const std::string& data, BabylonFileData& fileData, const std::string& operation,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  const std::function<bool(const std::string& section, const json& entry)>& onEntry) const
+{
+  try {
+    BabylonFileReader::Parse(data, fileData, onEntry);
+  }
+  catch (const std::exception& err) {
+    const auto msg = logOperation(operation) + " has failed JSON parse";
+    if (onError) {
+      onError(msg, err.what());
+    }
+    else {
+      BABYLON_LOGF_ERROR("BabylonFileLoader", "%s", msg.c_str())
+    }
+    return false;
+  }
+  return true;
+}
+
+bool BabylonFileLoader::_parseAndCreateEntries(
+  Scene* scene, const std::string& data, BabylonFileData& fileData, const std::string& rootUrl,
+  const std::string& operation,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  const AssetContainerPtr& container, std::ostringstream& log) const
+{
+  BabylonFileEntryLoader entryLoader(scene, fileData.root, rootUrl, operation == "importScene",
+                                     *container, log);
+  const auto onEntry = [&entryLoader](const std::string& section, const json& entry) {
+    return entryLoader.load(section, entry);
+  };
+  if (!parseData(data, fileData, operation, onError, onEntry)) {
+    // Nothing is loaded from an invalid file
+    container->dispose();
+    return false;
+  }
+  entryLoader.resolveReferences();
+  return true;
+}
+
 bool BabylonFileLoader::importMesh(
   const std::vector<std::string>& meshesNames, Scene* scene, const std::string& data,
   const std::string& rootUrl, std::vector<AbstractMeshPtr>& meshes,
+  std::vector<IParticleSystemPtr>& particleSystems, std::vector<SkeletonPtr>& skeletons,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError)
+  const
+{
+  BabylonFileData fileData;
+  if (!parseData(data, fileData, "importMesh", onError)) {
+    return false;
+  }
+
+  return importMesh(meshesNames, scene, fileData, rootUrl, meshes, particleSystems, skeletons,
+                    onError);
+}
+
+bool BabylonFileLoader::importMesh(
+  const std::vector<std::string>& meshesNames, Scene* scene, const BabylonFileData& fileData,
+  const std::string& rootUrl, std::vector<AbstractMeshPtr>& meshes,
   std::vector<IParticleSystemPtr>& /*particleSystems*/, std::vector<SkeletonPtr>& skeletons,
   const std::function<void(const std::string& message, const std::string& exception)>& onError)
   const
@@ -138,21 +380,17 @@ bool BabylonFileLoader::importMesh(
   // stored in var log instead of writing separate lines to support only writing in exception, and
   // avoid problems with multiple concurrent .babylon loads.
   std::ostringstream log;
-  log << "importMesh has failed JSON parse";
-  json parsedData;
+  const auto& parsedData = fileData.root;
+  json_util::packed_arrays_scope packedArraysScope(&fileData.packedArrays);
   try {
-    parsedData = json::parse(data);
-
-    log.str(" ");
-    log.clear();
-
     auto fullDetails = SceneLoader::LoggingLevel() == SceneLoader::DETAILED_LOGGING;
 
+    auto morphTargetManagersLoaded = false;
     std::vector<size_t> loadedSkeletonsIds;
     std::vector<std::string> loadedMaterialsIds;
     std::vector<std::string> hierarchyIds;
 
-    for (const auto& parsedMesh : json_util::get_array<json>(parsedData, "meshes")) {
+    for (const auto& parsedMesh : json_util::get_array_ref(parsedData, "meshes")) {
       if (meshesNames.empty() || isDescendantOf(parsedMesh, meshesNames, hierarchyIds)) {
 
         // Id
@@ -162,34 +400,13 @@ bool BabylonFileLoader::importMesh(
         if (json_util::has_valid_key_value(parsedMesh, "geometryId")) {
           const auto parsedMeshGeometryId = json_util::get_string(parsedMesh, "geometryId");
           // Does the file contain geometries?
-          if (json_util::has_valid_key_value(parsedMesh, "geometries")) {
-            auto geometries = parsedData["geometries"];
+          if (json_util::has_valid_key_value(parsedData, "geometries")) {
             // find the correct geometry and add it to the scene
-            bool found = false;
-            const std::array<std::string, 8> geometryTypes{{"boxes", "spheres", "cylinders",
-                                                            "toruses", "grounds", "planes",
-                                                            "torusKnots", "vertexData"}};
-            for (const auto& geometryType : geometryTypes) {
-              if (found || !json_util::has_key(geometries, geometryType)
-                  || !(geometries[geometryType].is_array())) {
-                break;
-              }
-              else {
-                for (const auto& parsedGeometryData :
-                     json_util::get_array<json>(geometries, geometryType)) {
-                  const std::string parsedGeometryDataId
-                    = json_util::get_string(parsedGeometryData, "id");
-                  if (!parsedGeometryDataId.empty()
-                      && (parsedGeometryDataId == parsedMeshGeometryId)) {
-                    if (geometryType == "vertexData") {
-                      Geometry::Parse(parsedGeometryData, scene, rootUrl);
-                    }
-                    found = true;
-                  }
-                }
-              }
+            const auto parsedGeometryData = fileData.getGeometryById(parsedMeshGeometryId);
+            if (parsedGeometryData) {
+              Geometry::Parse(*parsedGeometryData, scene, rootUrl);
             }
-            if (!found) {
+            else {
               BABYLON_LOGF_WARN("BabylonFileLoader", "Geometry not found for mesh %s",
                                 parsedMeshId.c_str())
             }
@@ -200,40 +417,34 @@ bool BabylonFileLoader::importMesh(
         if (json_util::has_key(parsedMesh, "materialId")) {
           const auto parsedMeshMaterialId = json_util::get_string(parsedMesh, "materialId");
           auto materialFound = stl_util::contains(loadedMaterialsIds, parsedMeshMaterialId);
-          if (!parsedMeshMaterialId.empty() && !materialFound
-              && json_util::has_key(parsedData, "multiMaterials")
-              && parsedData["multiMaterials"].is_array()) {
-            for (const auto& parsedMultiMaterial :
-                 json_util::get_array<json>(parsedData, "multiMaterials")) {
-              const auto parsedMultiMaterialId = json_util::get_string(parsedMultiMaterial, "id");
-              if ((!parsedMultiMaterialId.empty())
-                  && (parsedMultiMaterialId == parsedMeshMaterialId)) {
-                if (json_util::has_key(parsedMultiMaterial, "materials")
-                    && parsedMultiMaterial["materials"].is_array()) {
-                  for (const auto& subMatId :
-                       json_util::get_array<json>(parsedMultiMaterial, "materials")) {
-                    loadedMaterialsIds.emplace_back(subMatId.get<std::string>());
-                    auto mat
-                      = parseMaterialById(subMatId.get<std::string>(), parsedData, scene, rootUrl);
-                    if (mat) {
-                      log << "\n\tMaterial " << mat->toString(fullDetails);
-                    }
-                  }
+          const auto parsedMultiMaterial
+            = (!parsedMeshMaterialId.empty() && !materialFound) ?
+                fileData.getMultiMaterialById(parsedMeshMaterialId) :
+                nullptr;
+          if (parsedMultiMaterial) {
+            if (json_util::has_key(*parsedMultiMaterial, "materials")
+                && (*parsedMultiMaterial)["materials"].is_array()) {
+              for (const auto& subMatId :
+                   json_util::get_array<json>(*parsedMultiMaterial, "materials")) {
+                loadedMaterialsIds.emplace_back(subMatId.get<std::string>());
+                auto mat
+                  = parseMaterialById(subMatId.get<std::string>(), fileData, scene, rootUrl);
+                if (mat) {
+                  log << "\n\tMaterial " << mat->toString(fullDetails);
                 }
-                loadedMaterialsIds.emplace_back(parsedMultiMaterialId);
-                auto mmat = MultiMaterial::ParseMultiMaterial(parsedMultiMaterial, scene);
-                if (mmat) {
-                  materialFound = true;
-                  log << "\n\tMulti-Material " << mmat->toString(fullDetails);
-                }
-                break;
               }
             }
+            loadedMaterialsIds.emplace_back(parsedMeshMaterialId);
+            auto mmat = MultiMaterial::ParseMultiMaterial(*parsedMultiMaterial, scene);
+            if (mmat) {
+              materialFound = true;
+              log << "\n\tMulti-Material " << mmat->toString(fullDetails);
+            }
           }
 
           if (!materialFound && !parsedMeshMaterialId.empty()) {
             loadedMaterialsIds.emplace_back(parsedMeshMaterialId);
-            auto mat = parseMaterialById(parsedMeshMaterialId, parsedData, scene, rootUrl);
+            auto mat = parseMaterialById(parsedMeshMaterialId, fileData, scene, rootUrl);
             if (!mat) {
               BABYLON_LOGF_WARN("BabylonFileLoader", "Material not found for mesh %s",
                                 parsedMeshId.c_str())
@@ -248,28 +459,27 @@ bool BabylonFileLoader::importMesh(
         if (json_util::has_key(parsedMesh, "skeletonId")) {
           const auto parsedMeshSkeletonId
             = json_util::get_number<int>(parsedMesh, "skeletonId", -1);
-          if ((parsedMeshSkeletonId > -1) && json_util::has_key(parsedData, "skeletons")
-              && parsedData["skeletons"].is_array()
-              && !stl_util::contains(loadedSkeletonsIds, parsedMeshSkeletonId)) {
-            for (const auto& parsedSkeleton : json_util::get_array<json>(parsedData, "skeletons")) {
-              const auto parsedSkeletonId = json_util::get_number<int>(parsedSkeleton, "id", -1);
-              if (parsedSkeletonId == parsedMeshSkeletonId) {
-                auto skeleton = Skeleton::Parse(parsedSkeleton, scene);
-                skeletons.emplace_back(skeleton);
-                loadedSkeletonsIds.emplace_back(static_cast<size_t>(parsedSkeletonId));
-                log << "\n\tSkeleton " << skeleton->toString(fullDetails);
-              }
-            }
+          const auto parsedSkeleton
+            = (parsedMeshSkeletonId > -1
+               && !stl_util::contains(loadedSkeletonsIds, parsedMeshSkeletonId)) ?
+                fileData.getSkeletonById(parsedMeshSkeletonId) :
+                nullptr;
+          if (parsedSkeleton) {
+            auto skeleton = Skeleton::Parse(*parsedSkeleton, scene);
+            skeletons.emplace_back(skeleton);
+            loadedSkeletonsIds.emplace_back(static_cast<size_t>(parsedMeshSkeletonId));
+            log << "\n\tSkeleton " << skeleton->toString(fullDetails);
           }
         }
 
         // Morph targets ?
-        if (json_util::has_key(parsedData, "morphTargetManagers")
+        if (!morphTargetManagersLoaded && json_util::has_key(parsedData, "morphTargetManagers")
             && parsedData["morphTargetManagers"].is_array()) {
           for (const auto& managerData :
-               json_util::get_array<json>(parsedData, "morphTargetManagers")) {
+               json_util::get_array_ref(parsedData, "morphTargetManagers")) {
             MorphTargetManager::Parse(managerData, scene);
           }
+          morphTargetManagersLoaded = true;
         }
 
         auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
@@ -374,20 +584,39 @@ bool BabylonFileLoader::importMesh(
 bool BabylonFileLoader::load(Scene* scene, const std::string& data, const std::string& rootUrl,
                              const std::function<void(const std::string& message,
                                                       const std::string& exception)>& onError) const
+{
+  BabylonFileData fileData;
+  auto container = AssetContainer::New(scene);
+  std::ostringstream assetsLog;
+  if (!_parseAndCreateEntries(scene, data, fileData, rootUrl, "importScene", onError, container,
+                              assetsLog)) {
+    return false;
+  }
+
+  return _load(scene, fileData, rootUrl, onError, container, assetsLog);
+}
+
+bool BabylonFileLoader::load(Scene* scene, const BabylonFileData& fileData,
+                             const std::string& rootUrl,
+                             const std::function<void(const std::string& message,
+                                                      const std::string& exception)>& onError) const
+{
+  std::ostringstream assetsLog;
+  return _load(scene, fileData, rootUrl, onError, AssetContainer::New(scene), assetsLog);
+}
+
+bool BabylonFileLoader::_load(
+  Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  const AssetContainerPtr& container, std::ostringstream& assetsLog) const
 {
   // Entire method running in try block, so ALWAYS logs as far as it got, only actually writes
   // details when SceneLoader.debugLogging = true (default), or exception encountered. Everything
   // stored in var log instead of writing separate lines to support only writing in exception, and
   // avoid problems with multiple concurrent .babylon loads.
   std::ostringstream log;
-  log << "importMesh has failed JSON parse";
-  json parsedData;
+  const auto& parsedData = fileData.root;
   try {
-    parsedData = json::parse(data);
-
-    log.str(" ");
-    log.clear();
-
     // Scene
     if (json_util::has_valid_key_value(parsedData, "useDelayedTextureLoading")) {
       scene->useDelayedTextureLoading = json_util::get_bool(parsedData, "useDelayedTextureLoading")
@@ -445,8 +674,7 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data, const std::s
       scene->collisionsEnabled = json_util::get_bool(parsedData, "collisionsEnabled", true);
     }
 
-    auto container = loadAssetContainer(scene, data, rootUrl, onError, true);
-    if (!container) {
+    if (!_loadAssetContainer(scene, fileData, rootUrl, onError, true, container, assetsLog)) {
       return false;
     }
 
@@ -494,21 +722,39 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
   const std::function<void(const std::string& message, const std::string& exception)>& onError,
   bool addToScene) const
 {
+  BabylonFileData fileData;
   auto container = AssetContainer::New(scene);
+  std::ostringstream log;
+  if (!_parseAndCreateEntries(scene, data, fileData, rootUrl, "loadAssets", onError, container,
+                              log)) {
+    return AssetContainer::New(scene);
+  }
+
+  return _loadAssetContainer(scene, fileData, rootUrl, onError, addToScene, container, log);
+}
 
+AssetContainerPtr BabylonFileLoader::loadAssetContainer(
+  Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  bool addToScene) const
+{
+  std::ostringstream log;
+  return _loadAssetContainer(scene, fileData, rootUrl, onError, addToScene,
+                             AssetContainer::New(scene), log);
+}
+
+AssetContainerPtr BabylonFileLoader::_loadAssetContainer(
+  Scene* scene, const BabylonFileData& fileData, const std::string& rootUrl,
+  const std::function<void(const std::string& message, const std::string& exception)>& onError,
+  bool addToScene, const AssetContainerPtr& container, std::ostringstream& log) const
+{
   // Entire method running in try block, so ALWAYS logs as far as it got, only actually writes
   // details when SceneLoader.debugLogging = true (default), or exception encountered. Everything
   // stored in var log instead of writing separate lines to support only writing in exception, and
   // avoid problems with multiple concurrent .babylon loads.
-  std::ostringstream log;
-  log << "importMesh has failed JSON parse";
-  json parsedData;
+  const auto& parsedData = fileData.root;
+  json_util::packed_arrays_scope packedArraysScope(&fileData.packedArrays);
   try {
-    parsedData = json::parse(data);
-
-    log.str(" ");
-    log.clear();
-
     auto fullDetails = SceneLoader::LoggingLevel() == SceneLoader::DETAILED_LOGGING;
 
     // Environment texture
@@ -619,11 +865,7 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
         log << "\n\t\t" << mat->toString(fullDetails);
 
         // Textures
-        for (const auto& t : mat->getActiveTextures()) {
-          if (!stl_util::contains(container->textures, t)) {
-            container->textures.emplace_back(t);
-          }
-        }
+        addActiveTextures(*container, *mat);
       }
       ++index;
     }
@@ -639,17 +881,13 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
         log << "\n\t\t" << mmat->toString(fullDetails);
 
         // Textures
-        for (const auto& t : mmat->getActiveTextures()) {
-          if (!stl_util::contains(container->textures, t)) {
-            container->textures.emplace_back(t);
-          }
-        }
+        addActiveTextures(*container, *mmat);
       }
       ++index;
     }
 
     // Morph targets
-    for (const auto& managerData : json_util::get_array<json>(parsedData, "morphTargetManagers")) {
+    for (const auto& managerData : json_util::get_array_ref(parsedData, "morphTargetManagers")) {
       container->morphTargetManagers.emplace_back(MorphTargetManager::Parse(managerData, scene));
     }
 
@@ -669,7 +907,7 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
       std::vector<GeometryPtr> addedGeometry;
 
       // VertexData
-      for (const auto& parsedVertexData : json_util::get_array<json>(geometries, "vertexData")) {
+      for (const auto& parsedVertexData : json_util::get_array_ref(geometries, "vertexData")) {
         addedGeometry.emplace_back(Geometry::Parse(parsedVertexData, scene, rootUrl));
       }
 
@@ -689,7 +927,7 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
 
     // Meshes
     index = 0;
-    for (const auto& parsedMesh : json_util::get_array<json>(parsedData, "meshes")) {
+    for (const auto& parsedMesh : json_util::get_array_ref(parsedData, "meshes")) {
       auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
       container->meshes.emplace_back(mesh);
       if (mesh->hasInstances()) {
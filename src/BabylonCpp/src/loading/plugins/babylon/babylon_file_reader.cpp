@@ -0,0 +1,409 @@
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+
+#include <limits>
+#include <stdexcept>
+
+#include <babylon/core/json_util.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Type of the buffer a numeric array is parsed into.
+ */
+enum class PackedArrayType {
+  None,
+  Float,
+  Index,
+};
+
+/**
+ * @brief Returns the type of packed buffer used for the values of the given key.
+ */
+PackedArrayType packedArrayType(const std::string& key)
+{
+  static const std::unordered_map<std::string, PackedArrayType> packedKeys{
+    {"positions", PackedArrayType::Float},
+    {"normals", PackedArrayType::Float},
+    {"tangents", PackedArrayType::Float},
+    {"uvs", PackedArrayType::Float},
+    {"uvs2", PackedArrayType::Float},
+    {"uvs3", PackedArrayType::Float},
+    {"uvs4", PackedArrayType::Float},
+    {"uvs5", PackedArrayType::Float},
+    {"uvs6", PackedArrayType::Float},
+    {"colors", PackedArrayType::Float},
+    {"matricesIndices", PackedArrayType::Index},
+    {"matricesIndicesExtra", PackedArrayType::Index},
+    {"matricesWeights", PackedArrayType::Float},
+    {"matricesWeightsExtra", PackedArrayType::Float},
+    {"indices", PackedArrayType::Index},
+  };
+  const auto it = packedKeys.find(key);
+  return it == packedKeys.end() ? PackedArrayType::None : it->second;
+}
+
+/**
+ * @brief SAX event consumer building the json document, except for the vertex data arrays which are
+ * parsed into packed buffers.
+ */
+class BabylonFileSaxHandler {
+
+public:
+  using number_integer_t  = json::number_integer_t;
+  using number_unsigned_t = json::number_unsigned_t;
+  using number_float_t    = json::number_float_t;
+  using string_t          = json::string_t;
+
+  BabylonFileSaxHandler(json& root, json_util::packed_arrays& packedArrays,
+                        const BabylonFileEntryCallback& onEntry)
+      : _root{root}, _packedArrays{packedArrays}, _onEntry{onEntry}
+  {
+  }
+
+  bool null()
+  {
+    _handleValue(nullptr);
+    return true;
+  }
+
+  bool boolean(bool val)
+  {
+    _handleValue(val);
+    return true;
+  }
+
+  bool number_integer(number_integer_t val)
+  {
+    if (_packing == PackedArrayType::Float
+        || (_packing == PackedArrayType::Index && val >= 0
+            && val <= std::numeric_limits<uint32_t>::max())) {
+      _pack(static_cast<double>(val));
+      return true;
+    }
+    _handleValue(val);
+    return true;
+  }
+
+  bool number_unsigned(number_unsigned_t val)
+  {
+    if (_packing == PackedArrayType::Float
+        || (_packing == PackedArrayType::Index && val <= std::numeric_limits<uint32_t>::max())) {
+      _pack(static_cast<double>(val));
+      return true;
+    }
+    _handleValue(val);
+    return true;
+  }
+
+  bool number_float(number_float_t val, const string_t& /*s*/)
+  {
+    if (_packing == PackedArrayType::Float) {
+      _pack(val);
+      return true;
+    }
+    _handleValue(val);
+    return true;
+  }
+
+  bool string(string_t& val)
+  {
+    _handleValue(std::move(val));
+    return true;
+  }
+
+  bool start_object(std::size_t /*len*/)
+  {
+    _push(_handleValue(json::value_t::object));
+    if (!_section().empty()) {
+      _entryArrays.clear();
+    }
+    return true;
+  }
+
+  bool key(string_t& val)
+  {
+    _objectElement = &(*_refStack.back())[val];
+    _key           = val;
+    _pendingType   = _isVertexDataEntry() ? packedArrayType(val) : PackedArrayType::None;
+    return true;
+  }
+
+  bool end_object()
+  {
+    const auto section = _section();
+    auto& entry        = *_refStack.back();
+    _pop();
+    if (!section.empty() && _onEntry && _onEntry(section, entry)) {
+      // Consumed, the entry is the last element of the section array
+      for (const auto* packedValue : _entryArrays) {
+        _packedArrays.erase(packedValue);
+      }
+      auto& entries = *_refStack.back();
+      entries.erase(entries.size() - 1);
+    }
+    return true;
+  }
+
+  bool start_array(std::size_t /*len*/)
+  {
+    // Vertex data array, parse the numbers into a packed buffer
+    if (_pendingType != PackedArrayType::None && _packing == PackedArrayType::None) {
+      _packing     = _pendingType;
+      _pendingType = PackedArrayType::None;
+      _packedValue = _objectElement;
+      _floats.clear();
+      _indices.clear();
+      return true;
+    }
+    _push(_handleValue(json::value_t::array));
+    return true;
+  }
+
+  bool end_array()
+  {
+    if (_packing != PackedArrayType::None) {
+      // The document holds an empty array, the values are in the packed arrays table
+      *_packedValue = json::array();
+      _packedArrays.erase(_packedValue);
+      if (_packing == PackedArrayType::Float) {
+        _packedArrays.floats[_packedValue] = std::move(_floats);
+      }
+      else {
+        _packedArrays.indices[_packedValue] = std::move(_indices);
+      }
+      _entryArrays.emplace_back(_packedValue);
+      _floats      = {};
+      _indices     = {};
+      _packing     = PackedArrayType::None;
+      _packedValue = nullptr;
+      return true;
+    }
+    _pop();
+    return true;
+  }
+
+  bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/,
+                   const nlohmann::detail::exception& ex)
+  {
+    throw std::runtime_error(ex.what());
+  }
+
+private:
+  void _push(json* value)
+  {
+    // Key of the value in its parent, empty for the root and the elements of an array
+    const auto inArray = !_refStack.empty() && _refStack.back()->is_array();
+    _keys.emplace_back(inArray || _refStack.empty() ? std::string{} : _key);
+    _refStack.emplace_back(value);
+  }
+
+  void _pop()
+  {
+    _keys.pop_back();
+    _refStack.pop_back();
+  }
+
+  /**
+   * @brief Returns the name of the section when the current object is an entry of a section array,
+   * an empty string otherwise.
+   */
+  std::string _section() const
+  {
+    if (_refStack.size() == 3 && _refStack[1]->is_array() && _keys[2].empty()
+        && (_keys[1] == "materials" || _keys[1] == "multiMaterials"
+            || _keys[1] == "morphTargetManagers" || _keys[1] == "skeletons"
+            || _keys[1] == "meshes")) {
+      return _keys[1];
+    }
+    if (_refStack.size() == 4 && _keys[1] == "geometries" && _keys[2] == "vertexData"
+        && _refStack[2]->is_array()) {
+      return _keys[2];
+    }
+    return "";
+  }
+
+  /**
+   * @brief Returns true if the current object holds vertex data: a mesh, a vertex data geometry or a
+   * morph target. The arrays of other objects (metadata...) are kept as they are.
+   */
+  bool _isVertexDataEntry() const
+  {
+    if (!_refStack.back()->is_object()) {
+      return false;
+    }
+    switch (_refStack.size()) {
+      case 3:
+        return _keys[1] == "meshes";
+      case 4:
+        return _keys[1] == "geometries" && _keys[2] == "vertexData";
+      case 5:
+        return _keys[1] == "morphTargetManagers" && _keys[3] == "targets";
+      default:
+        return false;
+    }
+  }
+
+  void _pack(double value)
+  {
+    if (_packing == PackedArrayType::Float) {
+      _floats.emplace_back(static_cast<float>(value));
+    }
+    else {
+      _indices.emplace_back(static_cast<uint32_t>(value));
+    }
+  }
+
+  /**
+   * @brief Stops packing when the array contains something else than the expected numbers, the
+   * numbers parsed so far become regular json values.
+   */
+  void _unpack()
+  {
+    *_packedValue = json::array();
+    auto& values  = *_packedValue;
+    if (_packing == PackedArrayType::Float) {
+      for (auto value : _floats) {
+        values.emplace_back(value);
+      }
+    }
+    else {
+      for (auto value : _indices) {
+        values.emplace_back(value);
+      }
+    }
+    _push(_packedValue);
+    _packing     = PackedArrayType::None;
+    _packedValue = nullptr;
+  }
+
+  template <typename Value>
+  json* _handleValue(Value&& v)
+  {
+    _pendingType = PackedArrayType::None;
+    if (_packing != PackedArrayType::None) {
+      _unpack();
+    }
+    if (_refStack.empty()) {
+      _root = json(std::forward<Value>(v));
+      return &_root;
+    }
+    auto& parent = *_refStack.back();
+    if (parent.is_array()) {
+      parent.emplace_back(std::forward<Value>(v));
+      return &parent.back();
+    }
+    *_objectElement = json(std::forward<Value>(v));
+    return _objectElement;
+  }
+
+private:
+  json& _root;
+  json_util::packed_arrays& _packedArrays;
+  const BabylonFileEntryCallback& _onEntry;
+  std::vector<json*> _refStack;
+  std::vector<std::string> _keys;
+  std::string _key;
+  json* _objectElement         = nullptr;
+  PackedArrayType _pendingType = PackedArrayType::None;
+  PackedArrayType _packing     = PackedArrayType::None;
+  json* _packedValue           = nullptr;
+  std::vector<float> _floats;
+  std::vector<uint32_t> _indices;
+  // Packed arrays of the section entry being read
+  std::vector<const json*> _entryArrays;
+
+}; // end of class BabylonFileSaxHandler
+
+/**
+ * @brief Indexes the entries of an array of the document by their string id.
+ */
+void indexById(const json& parent, const std::string& key,
+               std::unordered_map<std::string, const json*>& index)
+{
+  const auto it = parent.find(key);
+  if (it == parent.end() || !it->is_array()) {
+    return;
+  }
+  for (const auto& entry : *it) {
+    const auto id = json_util::get_string(entry, "id");
+    if (!id.empty()) {
+      index.try_emplace(id, &entry);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+BabylonFileData::BabylonFileData() = default;
+
+BabylonFileData::~BabylonFileData() = default;
+
+const json* BabylonFileData::getMaterialById(const std::string& id) const
+{
+  const auto it = materials.find(id);
+  return it == materials.end() ? nullptr : it->second;
+}
+
+const json* BabylonFileData::getMultiMaterialById(const std::string& id) const
+{
+  const auto it = multiMaterials.find(id);
+  return it == multiMaterials.end() ? nullptr : it->second;
+}
+
+const json* BabylonFileData::getSkeletonById(int id) const
+{
+  const auto it = skeletons.find(id);
+  return it == skeletons.end() ? nullptr : it->second;
+}
+
+const json* BabylonFileData::getGeometryById(const std::string& id) const
+{
+  const auto it = geometries.find(id);
+  return it == geometries.end() ? nullptr : it->second;
+}
+
+void BabylonFileReader::Parse(std::string_view data, BabylonFileData& fileData,
+                              const BabylonFileEntryCallback& onEntry)
+{
+  fileData.root = nullptr;
+  fileData.packedArrays.clear();
+  fileData.materials.clear();
+  fileData.multiMaterials.clear();
+  fileData.skeletons.clear();
+  fileData.geometries.clear();
+
+  {
+    json_util::packed_arrays_scope scope(&fileData.packedArrays);
+    BabylonFileSaxHandler handler(fileData.root, fileData.packedArrays, onEntry);
+    json::sax_parse(data.data(), data.data() + data.size(), &handler);
+  }
+
+  const auto& root = fileData.root;
+  if (!root.is_object()) {
+    return;
+  }
+  indexById(root, "materials", fileData.materials);
+  indexById(root, "multiMaterials", fileData.multiMaterials);
+  const auto geometries = root.find("geometries");
+  if (geometries != root.end() && geometries->is_object()) {
+    indexById(*geometries, "vertexData", fileData.geometries);
+  }
+  const auto skeletons = root.find("skeletons");
+  if (skeletons != root.end() && skeletons->is_array()) {
+    for (const auto& skeleton : *skeletons) {
+      const auto id = json_util::get_number<int>(skeleton, "id", -1);
+      if (id > -1) {
+        fileData.skeletons.try_emplace(id, &skeleton);
+      }
+    }
+  }
+}
+
+bool BabylonFileReader::IsVertexDataKey(const std::string& key)
+{
+  return packedArrayType(key) != PackedArrayType::None;
+}
+
+} // end of namespace BABYLON
@@ -1,7 +1,14 @@
 #include <babylon/loading/plugins/obj/obj_file_loader.h>
 
+#include <charconv>
+#include <cstring>
+#include <future>
+#include <thread>
+
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/filesystem.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/standard_material.h>
 #include <babylon/maths/vector3.h>
@@ -12,6 +19,342 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Line of an OBJ file changing the mesh or the material of the next faces.
+ */
+struct OBJDirective {
+  enum class Kind { Object, UseMaterial, MaterialLibrary, Unhandled };
+  Kind kind;
+  size_t face; // Number of faces of the chunk defined before the directive
+  std::string value;
+}; // end of struct OBJDirective
+
+/**
+ * @brief Face of an OBJ file. The counts of elements defined before the face in its chunk are
+ * used to resolve the relative (negative) indices.
+ */
+struct OBJFace {
+  uint32_t firstVertex;
+  uint32_t vertexCount;
+  uint32_t positionCount;
+  uint32_t uvCount;
+  uint32_t normalCount;
+}; // end of struct OBJFace
+
+/**
+ * @brief Indices of a face vertex as written in the file: 1-based, negative when relative to the
+ * last element defined, 0 when not defined.
+ */
+struct OBJFaceVertex {
+  int32_t position = 0;
+  int32_t uv       = 0;
+  int32_t normal   = 0;
+}; // end of struct OBJFaceVertex
+
+/**
+ * @brief Elements parsed from a range of lines of an OBJ file.
+ */
+struct OBJChunk {
+  size_t positionBase = 0; // Number of elements defined in the previous chunks
+  size_t uvBase       = 0;
+  size_t normalBase   = 0;
+  Float32Array positions;
+  Float32Array colors;
+  Float32Array normals;
+  Float32Array uvs;
+  std::vector<OBJFace> faces;
+  std::vector<OBJFaceVertex> faceVertices;
+  std::vector<OBJDirective> directives;
+}; // end of struct OBJChunk
+
+inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline void skipBlanks(const char*& cursor, const char* end)
+{
+  while (cursor < end && isBlank(*cursor)) {
+    ++cursor;
+  }
+}
+
+/**
+ * @brief Returns the next blank separated token of a line.
+ */
+inline std::string_view nextToken(const char*& cursor, const char* end)
+{
+  skipBlanks(cursor, end);
+  const auto begin = cursor;
+  while (cursor < end && !isBlank(*cursor)) {
+    ++cursor;
+  }
+  return std::string_view(begin, static_cast<size_t>(cursor - begin));
+}
+
+/**
+ * @brief Returns the end of the line, without the trailing blanks.
+ */
+inline std::string_view remainingText(const char* cursor, const char* end)
+{
+  skipBlanks(cursor, end);
+  while (end > cursor && isBlank(end[-1])) {
+    --end;
+  }
+  return std::string_view(cursor, static_cast<size_t>(end - cursor));
+}
+
+/**
+ * @brief Parses a number in place.
+ * @returns false if the cursor does not point to a number
+ */
+bool parseFloat(const char*& cursor, const char* end, float& value)
+{
+  skipBlanks(cursor, end);
+  if (cursor < end && *cursor == '+') {
+    ++cursor;
+  }
+#if defined(__cpp_lib_to_chars)
+  const auto result = std::from_chars(cursor, end, value);
+  if (result.ec != std::errc() || (result.ptr < end && !isBlank(*result.ptr))) {
+    return false;
+  }
+  cursor = result.ptr;
+  return true;
+#else
+  // Floating point std::from_chars is not available, the token is copied to be null terminated
+  char buffer[64];
+  const auto token = nextToken(cursor, end);
+  if (token.empty() || token.size() >= sizeof(buffer)) {
+    return false;
+  }
+  std::memcpy(buffer, token.data(), token.size());
+  buffer[token.size()] = '\0';
+  char* last           = nullptr;
+  value                = std::strtof(buffer, &last);
+  return last == buffer + token.size();
+#endif
+}
+
+/**
+ * @brief Parses the floats of a line, up to `maxCount`.
+ * @returns the number of floats parsed, 0 if the line contains something else
+ */
+size_t parseFloats(const char* cursor, const char* end, float* values, size_t maxCount)
+{
+  size_t count = 0;
+  while (count < maxCount && parseFloat(cursor, end, values[count])) {
+    ++count;
+  }
+  skipBlanks(cursor, end);
+  return cursor == end ? count : 0;
+}
+
+inline bool parseInt(const char*& cursor, const char* end, int32_t& value)
+{
+  const auto result = std::from_chars(cursor, end, value);
+  if (result.ec != std::errc()) {
+    return false;
+  }
+  cursor = result.ptr;
+  return true;
+}
+
+/**
+ * @brief Parses a face vertex: "p", "p/t", "p/t/n" or "p//n".
+ */
+bool parseFaceVertex(std::string_view token, OBJFaceVertex& vertex)
+{
+  const char* cursor = token.data();
+  const char* end    = cursor + token.size();
+  vertex             = {};
+  if (!parseInt(cursor, end, vertex.position)) {
+    return false;
+  }
+  if (cursor < end && *cursor == '/') {
+    ++cursor;
+    if (cursor < end && *cursor != '/' && !parseInt(cursor, end, vertex.uv)) {
+      return false;
+    }
+    if (cursor < end && *cursor == '/') {
+      ++cursor;
+      if (!parseInt(cursor, end, vertex.normal)) {
+        return false;
+      }
+    }
+  }
+  return cursor == end;
+}
+
+/**
+ * @brief Tokenizes a range of complete lines of an OBJ file.
+ */
+void parseChunk(std::string_view text, const MeshLoadOptions& options, OBJChunk& chunk)
+{
+  const char* cursor  = text.data();
+  const char* textEnd = cursor + text.size();
+  float values[7];
+  while (cursor < textEnd) {
+    const auto lineBreak = static_cast<const char*>(
+      std::memchr(cursor, '\n', static_cast<size_t>(textEnd - cursor)));
+    const char* lineEnd  = lineBreak ? lineBreak : textEnd;
+    const char* line     = cursor;
+    cursor               = lineBreak ? lineBreak + 1 : textEnd;
+
+    auto handled       = true;
+    const auto keyword = nextToken(line, lineEnd);
+    // Comment or newLine
+    if (keyword.empty() || keyword[0] == '#') {
+      continue;
+    }
+    // Position and optional color: "v x y z [r g b [a]]"
+    else if (keyword == "v") {
+      const auto count = parseFloats(line, lineEnd, values, 7);
+      handled          = count >= 3;
+      if (handled) {
+        chunk.positions.insert(chunk.positions.end(), values, values + 3);
+        if (options.ImportVertexColors) {
+          if (count >= 6) {
+            chunk.colors.insert(chunk.colors.end(),
+                                {values[3], values[4], values[5], count == 7 ? values[6] : 1.f});
+          }
+          else {
+            chunk.colors.insert(chunk.colors.end(), {0.5f, 0.5f, 0.5f, 1.f});
+          }
+        }
+      }
+    }
+    // Normal: "vn x y z"
+    else if (keyword == "vn") {
+      handled = parseFloats(line, lineEnd, values, 3) == 3;
+      if (handled) {
+        chunk.normals.insert(chunk.normals.end(), values, values + 3);
+      }
+    }
+    // Texture coordinates: "vt u v [w]", w is not supported
+    else if (keyword == "vt") {
+      handled = parseFloats(line, lineEnd, values, 3) >= 2;
+      if (handled) {
+        chunk.uvs.insert(chunk.uvs.end(), {values[0] * options.UVScaling.x,
+                                           values[1] * options.UVScaling.y});
+      }
+    }
+    // Face: "f v1 v2 v3 ..."
+    else if (keyword == "f") {
+      OBJFace face{static_cast<uint32_t>(chunk.faceVertices.size()), 0,
+                   static_cast<uint32_t>(chunk.positions.size() / 3),
+                   static_cast<uint32_t>(chunk.uvs.size() / 2),
+                   static_cast<uint32_t>(chunk.normals.size() / 3)};
+      OBJFaceVertex vertex;
+      for (auto token = nextToken(line, lineEnd); handled && !token.empty();
+           token      = nextToken(line, lineEnd)) {
+        handled = parseFaceVertex(token, vertex);
+        chunk.faceVertices.emplace_back(vertex);
+      }
+      face.vertexCount = static_cast<uint32_t>(chunk.faceVertices.size()) - face.firstVertex;
+      handled          = handled && face.vertexCount >= 3;
+      if (handled) {
+        chunk.faces.emplace_back(face);
+      }
+      else {
+        chunk.faceVertices.resize(face.firstVertex);
+      }
+    }
+    // Define a mesh or an object
+    else if (keyword == "o" || keyword == "g") {
+      chunk.directives.push_back({OBJDirective::Kind::Object, chunk.faces.size(),
+                                  std::string(remainingText(line, lineEnd))});
+    }
+    // Keyword for applying a material
+    else if (keyword == "usemtl") {
+      chunk.directives.push_back({OBJDirective::Kind::UseMaterial, chunk.faces.size(),
+                                  std::string(remainingText(line, lineEnd))});
+    }
+    // Keyword for loading the mtl file
+    else if (keyword == "mtllib") {
+      chunk.directives.push_back({OBJDirective::Kind::MaterialLibrary, chunk.faces.size(),
+                                  std::string(remainingText(line, lineEnd))});
+    }
+    // Smooth shading is not supported
+    else if (keyword == "s") {
+    }
+    else {
+      handled = false;
+    }
+
+    if (!handled) {
+      chunk.directives.push_back({OBJDirective::Kind::Unhandled, chunk.faces.size(),
+                                  std::string(remainingText(keyword.data(), lineEnd))});
+    }
+  }
+}
+
+/**
+ * @brief Tokenizes an OBJ file. Large files are split in chunks of lines parsed in parallel.
+ */
+std::vector<OBJChunk> parseChunks(std::string_view data, const MeshLoadOptions& options)
+{
+  size_t chunkCount = 1;
+  if (options.ParallelParsingThreshold > 0 && data.size() >= options.ParallelParsingThreshold) {
+    chunkCount = std::max<size_t>(2, std::thread::hardware_concurrency());
+  }
+
+  // Chunks end after a line break
+  std::vector<std::string_view> ranges;
+  for (size_t i = 1, begin = 0; i <= chunkCount && begin < data.size(); ++i) {
+    auto end = std::max(begin, data.size() * i / chunkCount);
+    if (i < chunkCount) {
+      end = data.find('\n', end);
+    }
+    end = (end == std::string_view::npos || i == chunkCount) ? data.size() : end + 1;
+    ranges.emplace_back(data.substr(begin, end - begin));
+    begin = end;
+  }
+
+  std::vector<OBJChunk> chunks(ranges.size());
+  std::vector<std::future<void>> jobs;
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    jobs.emplace_back(std::async(std::launch::async, [&ranges, &options, &chunks, i]() {
+      parseChunk(ranges[i], options, chunks[i]);
+    }));
+  }
+  if (!ranges.empty()) {
+    parseChunk(ranges[0], options, chunks[0]);
+  }
+  for (auto& job : jobs) {
+    job.get();
+  }
+
+  return chunks;
+}
+
+/**
+ * @brief Converts an index of a face vertex to a 0-based index, -1 if not defined.
+ * @param index The index read from the file
+ * @param relativeBase The number of elements defined before the face
+ * @param count The number of elements in the file
+ * @param resolved Receives the 0-based index
+ * @returns false if the index is out of range
+ */
+bool resolveIndex(int32_t index, size_t relativeBase, size_t count, int32_t& resolved)
+{
+  if (index == 0) {
+    resolved = -1;
+    return true;
+  }
+  const auto absolute
+    = index > 0 ? static_cast<int64_t>(index) - 1 : static_cast<int64_t>(relativeBase) + index;
+  if (absolute < 0 || absolute >= static_cast<int64_t>(count)) {
+    return false;
+  }
+  resolved = static_cast<int32_t>(absolute);
+  return true;
+}
+
+} // end of anonymous namespace
+
 bool OBJFileLoader::OPTIMIZE_WITH_UV = true;
 
 bool OBJFileLoader::INVERT_Y = false;
@@ -26,6 +369,8 @@ bool OBJFileLoader::SKIP_MATERIALS = false;
 
 bool OBJFileLoader::MATERIAL_LOADING_FAILS_SILENTLY = true;
 
+size_t OBJFileLoader::PARALLEL_PARSING_THRESHOLD = 4 * 1024 * 1024;
+
 OBJFileLoader::OBJFileLoader(const std::optional<MeshLoadOptions>& meshLoadOptions)
 {
   _meshLoadOptions = meshLoadOptions.value_or(OBJFileLoader::currentMeshLoadOptions());
@@ -42,6 +387,7 @@ MeshLoadOptions OBJFileLoader::currentMeshLoadOptions()
   options.MaterialLoadingFailsSilently = OBJFileLoader::MATERIAL_LOADING_FAILS_SILENTLY;
   options.OptimizeWithUV               = OBJFileLoader::OPTIMIZE_WITH_UV;
   options.SkipMaterials                = OBJFileLoader::SKIP_MATERIALS;
+  options.ParallelParsingThreshold     = OBJFileLoader::PARALLEL_PARSING_THRESHOLD;
   return options;
 }
 
@@ -50,565 +396,244 @@ bool OBJFileLoader::canDirectLoad(const std::string& /*data*/)
   return false;
 }
 
-int OBJFileLoader::_isInArray(std::vector<TuplePosNormEntry>& arr, const std::vector<size_t>& iObj)
+bool OBJVertexKey::operator==(const OBJVertexKey& other) const
 {
-  if (arr.size() < iObj[0]) {
-    arr.resize(iObj[0] + 1);
-    arr[iObj[0]] = {};
-  }
-  auto idx = stl_util::index_of(arr[iObj[0]].normals, iObj[1]);
-
-  return idx == -1 ? -1 : static_cast<int>(arr[iObj[0]].idx[static_cast<size_t>(idx)]);
+  return position == other.position && uv == other.uv && normal == other.normal;
 }
 
-int OBJFileLoader::_isInArrayUV(std::vector<TuplePosNormEntry>& arr,
-                                const std::vector<size_t>& iObj)
+size_t OBJVertexKeyHash::operator()(const OBJVertexKey& key) const
 {
-  if (arr.size() < iObj[0]) {
-    arr.resize(iObj[0] + 1);
-    arr[iObj[0]] = {};
-  }
-  auto idx = stl_util::index_of(arr[iObj[0]].normals, iObj[1]);
-
-  if (idx != 1 && (iObj[2] == arr[iObj[0]].uv[static_cast<size_t>(idx)])) {
-    return static_cast<int>(arr[iObj[0]].idx[static_cast<size_t>(idx)]);
-  }
-  return -1;
+  auto hash = static_cast<uint64_t>(static_cast<uint32_t>(key.position));
+  hash      = hash * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(key.uv);
+  hash      = hash * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(key.normal);
+  return static_cast<size_t>(hash ^ (hash >> 32));
 }
 
-void OBJFileLoader::_setData(size_t indicePositionFromObj, size_t indiceUvsFromObj,
-                             size_t indiceNormalFromObj, const Vector3& positionVectorFromOBJ,
-                             const Vector2& textureVectorFromOBJ,
-                             const Vector3& normalsVectorFromOBJ, OBJParseSolidState& state,
-                             const std::optional<Color4>& positionColorsFromOBJ)
+void OBJFileLoader::_setData(const OBJVertexKey& key, OBJParseSolidState& state)
 {
+  // Without the uv optimization, the vertices sharing a position and a normal share the uv of the
+  // first one
+  auto lookupKey = key;
+  if (!_meshLoadOptions.OptimizeWithUV) {
+    lookupKey.uv = -1;
+  }
+
   // Check if this tuple already exists in the list of tuples
-  int _index;
-  if (_meshLoadOptions.OptimizeWithUV) {
-    _index = _isInArrayUV(state.tuplePosNorm,
-                          {indicePositionFromObj, indiceNormalFromObj, indiceUvsFromObj});
+  auto& mesh                = state.handledMesh;
+  const auto vertexIndex    = static_cast<uint32_t>(mesh.positions.size() / 3);
+  const auto [it, inserted] = state.vertexIndices.try_emplace(lookupKey, vertexIndex);
+  // The tuple already exists, add the index of the already existing tuple
+  mesh.indices.emplace_back(it->second);
+  if (!inserted) {
+    return;
   }
-  else {
-    _index = _isInArray(state.tuplePosNorm, {indicePositionFromObj, indiceNormalFromObj});
-  }
-
-  // If it not exists
-  if (_index == -1) {
-    // Add an new indice.
-    // The array of indices is only an array with his length equal to the number of triangles - 1.
-    // We add vertices data in this order
-    state.indicesForBabylon.emplace_back(
-      static_cast<uint32_t>(state.wrappedPositionForBabylon.size()));
-    // Push the position of vertice for Babylon
-    // Each element is a Vector3(x,y,z)
-    state.wrappedPositionForBabylon.emplace_back(positionVectorFromOBJ);
-    // Push the uvs for Babylon
-    // Each element is a Vector3(u,v)
-    state.wrappedUvsForBabylon.emplace_back(textureVectorFromOBJ);
-    // Push the normals for Babylon
-    // Each element is a Vector3(x,y,z)
-    state.wrappedNormalsForBabylon.emplace_back(normalsVectorFromOBJ);
-
-    if (positionColorsFromOBJ.has_value()) {
-      // Push the colors for Babylon
-      // Each element is a BABYLON.Color4(r,g,b,a)
-      state.wrappedColorsForBabylon.emplace_back(*positionColorsFromOBJ);
-    }
 
-    // Add the tuple in the comparison list
-    state.tuplePosNorm[indicePositionFromObj].normals.emplace_back(indiceNormalFromObj);
-    state.tuplePosNorm[indicePositionFromObj].idx.emplace_back(state.curPositionInIndices++);
-    if (_meshLoadOptions.OptimizeWithUV) {
-      state.tuplePosNorm[indicePositionFromObj].uv.emplace_back(indiceUvsFromObj);
-    }
+  // Push the position, uv, normal and color of the new vertex, default vectors are used for the
+  // elements not defined in the face
+  const auto p = static_cast<size_t>(key.position);
+  mesh.positions.insert(mesh.positions.end(), {state.positions[3 * p], state.positions[3 * p + 1],
+                                               state.positions[3 * p + 2]});
+  if (key.uv >= 0) {
+    const auto t = static_cast<size_t>(key.uv);
+    mesh.uvs.insert(mesh.uvs.end(), {state.uvs[2 * t], state.uvs[2 * t + 1]});
   }
   else {
-    // The tuple already exists
-    // Add the index of the already existing tuple
-    // At this index we can get the value of position, normal, color and uvs of vertex
-    state.indicesForBabylon.emplace_back(_index);
+    mesh.uvs.insert(mesh.uvs.end(), {0.f, 0.f});
   }
-}
-
-void OBJFileLoader::_unwrapData(OBJParseSolidState& state)
-{
-  // Every array has the same length
-  for (size_t l = 0; l < state.wrappedPositionForBabylon.size(); ++l) {
-    // Push the x, y, z values of each element in the unwrapped array
-    stl_util::concat(state.unwrappedPositionsForBabylon,
-                     {state.wrappedPositionForBabylon[l].x, state.wrappedPositionForBabylon[l].y,
-                      state.wrappedPositionForBabylon[l].z});
-    stl_util::concat(state.unwrappedNormalsForBabylon,
-                     {state.wrappedNormalsForBabylon[l].x, state.wrappedNormalsForBabylon[l].y,
-                      state.wrappedNormalsForBabylon[l].z});
-    stl_util::concat(
-      state.unwrappedUVForBabylon,
-      {state.wrappedUvsForBabylon[l].x,
-       state.wrappedUvsForBabylon[l].y}); // z is an optional value not supported by BABYLON
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      // Push the r, g, b, a values of each element in the unwrapped array
-      stl_util::concat(state.unwrappedColorsForBabylon,
-                       {state.wrappedColorsForBabylon[l].r, state.wrappedColorsForBabylon[l].g,
-                        state.wrappedColorsForBabylon[l].b, state.wrappedColorsForBabylon[l].a});
-    }
+  if (key.normal >= 0) {
+    const auto n = static_cast<size_t>(key.normal);
+    mesh.normals.insert(mesh.normals.end(), {state.normals[3 * n], state.normals[3 * n + 1],
+                                             state.normals[3 * n + 2]});
   }
-  // Reset arrays for the next new meshes
-  state.wrappedPositionForBabylon = {};
-  state.wrappedNormalsForBabylon  = {};
-  state.wrappedUvsForBabylon      = {};
-  state.wrappedColorsForBabylon   = {};
-  state.tuplePosNorm              = {};
-  state.curPositionInIndices      = 0;
-}
-
-void OBJFileLoader::_getTriangles(const std::vector<std::string>& faces, size_t v,
-                                  OBJParseSolidState& state)
-{
-  // Work for each element of the array
-  for (size_t faceIndex = v; faceIndex < faces.size() - 1; ++faceIndex) {
-    // Add on the triangle variable the indexes to obtain triangles
-    stl_util::concat(state.triangles, {faces[0], faces[faceIndex], faces[faceIndex + 1]});
-  }
-
-  // Result obtained after 2 iterations:
-  // Pattern1 => triangle = ["1","2","3","1","3","4"];
-  // Pattern2 => triangle = ["1/1","2/2","3/3","1/1","3/3","4/4"];
-  // Pattern3 => triangle = ["1/1/1","2/2/2","3/3/3","1/1/1","3/3/3","4/4/4"];
-  // Pattern4 => triangle = ["1//1","2//2","3//3","1//1","3//3","4//4"];
-  // Pattern5 => triangle = ["-1/-1/-1","-2/-2/-2","-3/-3/-3","-1/-1/-1","-3/-3/-3","-4/-4/-4"];
-}
-
-void OBJFileLoader::_setDataForCurrentFaceWithPattern1(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-  // For each element in the triangles array.
-  // This var could contains 1 to an infinity of triangles
-  for (const auto& triangle : state.triangles) {
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(triangle) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj, 0, 0, // In the pattern 1, normals and uvs are not defined
-             state.positions[indicePositionFromObj], // Get the vectors data
-             Vector2::Zero(), Vector3::Up(),         // Create default vectors
-             state, positionColorsFromOBJ);
+  else {
+    mesh.normals.insert(mesh.normals.end(), {0.f, 1.f, 0.f});
   }
-  // Reset variable for the next line
-  state.triangles = {};
-}
-
-void OBJFileLoader::_setDataForCurrentFaceWithPattern2(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1/1"
-    // Split the data for getting position and uv
-    const auto point = StringTools::split(triangle, '/'); // ["1", "1"]
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    // Set uv indice
-    const auto indiceUvsFromObj = StringTools::toNumber<size_t>(point[1]) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj, indiceUvsFromObj,
-             0,                                      // Default value for normals
-             state.positions[indicePositionFromObj], // Get the values for each element
-             state.uvs[indiceUvsFromObj],
-             Vector3::Up(), // Default value for normals
-             state, positionColorsFromOBJ);
+  if (_meshLoadOptions.ImportVertexColors) {
+    const auto first = state.colors.begin() + static_cast<std::ptrdiff_t>(4 * p);
+    mesh.colors.insert(mesh.colors.end(), first, first + 4);
   }
-
-  // Reset variable for the next line
-  state.triangles = {};
-}
-
-void OBJFileLoader::_setDataForCurrentFaceWithPattern3(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1/1/1"
-    // Split the data for getting position, uv, and normals
-    const auto point = StringTools::split(triangle, '/'); // ["1", "1", "1"]
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    // Set uv indice
-    const auto indiceUvsFromObj = StringTools::toNumber<size_t>(point[1]) - 1;
-    // Set normal indice
-    const auto indiceNormalFromObj = StringTools::toNumber<size_t>(point[2]) - 1;
-
-    _setData(indicePositionFromObj, indiceUvsFromObj, indiceNormalFromObj,
-             state.positions[indicePositionFromObj], state.uvs[indiceUvsFromObj],
-             state.normals[indiceNormalFromObj], // Set the vector for each component
-             state);
-  }
-  // Reset variable for the next line
-  state.triangles = {};
-}
-
-void OBJFileLoader::_setDataForCurrentFaceWithPattern4(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1//1"
-    // Split the data for getting position and normals
-    const auto point = StringTools::split(triangle, "//"); // ["1", "1"] // TODO FIXME
-    // We check indices, and normals
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    const auto indiceNormalFromObj   = StringTools::toNumber<size_t>(point[1]) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj,
-             1, // Default value for uv
-             indiceNormalFromObj,
-             state.positions[indicePositionFromObj], // Get each vector of data
-             Vector2::Zero(), state.normals[indiceNormalFromObj], state, positionColorsFromOBJ);
-  }
-  // Reset variable for the next line
-  state.triangles = {};
-}
-
-void OBJFileLoader::_setDataForCurrentFaceWithPattern5(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "-1/-1/-1"
-    // Split the data for getting position, uv, and normals
-    const auto point = StringTools::split(triangle, '/'); // ["-1", "-1", "-1"]
-    // Set position indice
-    const auto indicePositionFromObj
-      = state.positions.size() + StringTools::toNumber<size_t>(point[0]);
-    // Set uv indice
-    const auto indiceUvsFromObj = state.uvs.size() + StringTools::toNumber<size_t>(point[1]);
-    // Set normal indice
-    const auto indiceNormalFromObj = state.normals.size() + StringTools::toNumber<size_t>(point[2]);
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj, indiceUvsFromObj, indiceNormalFromObj,
-             state.positions[indicePositionFromObj], state.uvs[indiceUvsFromObj],
-             state.normals[indiceNormalFromObj], // Set the vector for each component
-             state, positionColorsFromOBJ);
-  }
-  // Reset variable for the next line
-  state.triangles = {};
 }
 
 void OBJFileLoader::_addPreviousObjMesh(OBJParseSolidState& state)
 {
   // Check if it is not the first mesh. Otherwise we don't have data.
-  if (state.meshesFromObj.size() > 0) {
+  if (!state.meshesFromObj.empty()) {
     // Get the previous mesh for applying the data about the faces
     // => in obj file, faces definition append after the name of the mesh
-    state.handledMesh = state.meshesFromObj.back();
-
-    // Set the data into Array for the mesh
-    _unwrapData(state);
+    auto& mesh    = state.meshesFromObj.back();
+    auto& handled = state.handledMesh;
 
     // Reverse tab. Otherwise face are displayed in the wrong sense
-    std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
+    std::reverse(handled.indices.begin(), handled.indices.end());
     // Set the information for the mesh
-    // Slice the array to avoid rewriting because of the fact this is the same var which be rewrited
-    state.handledMesh.indices   = state.indicesForBabylon;
-    state.handledMesh.positions = state.unwrappedPositionsForBabylon;
-    state.handledMesh.normals   = state.unwrappedNormalsForBabylon;
-    state.handledMesh.uvs       = state.unwrappedUVForBabylon;
+    mesh.indices   = std::move(handled.indices);
+    mesh.positions = std::move(handled.positions);
+    mesh.normals   = std::move(handled.normals);
+    mesh.uvs       = std::move(handled.uvs);
 
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.handledMesh.colors = state.unwrappedColorsForBabylon;
+    if (_meshLoadOptions.ImportVertexColors) {
+      mesh.colors = std::move(handled.colors);
     }
 
-    // Reset the array for the next mesh
-    state.indicesForBabylon            = {};
-    state.unwrappedPositionsForBabylon = {};
-    state.unwrappedColorsForBabylon    = {};
-    state.unwrappedNormalsForBabylon   = {};
-    state.unwrappedUVForBabylon        = {};
+    // Reset the data for the next mesh
+    handled = {};
+    state.vertexIndices.clear();
   }
 }
 
-std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::string>& meshesNames,
-                                                        Scene* scene, const std::string& data,
-                                                        const std::string& /*rootUrl*/)
+std::vector<AbstractMeshPtr> OBJFileLoader::importMesh(const std::vector<std::string>& meshesNames,
+                                                       Scene* scene, std::string_view data,
+                                                       const std::string& rootUrl)
 {
-  OBJParseSolidState state = {};
+  return _parseSolid(meshesNames, scene, data, rootUrl);
+}
 
-  // Split the file into lines
-  auto lines = StringTools::split(data, '\n');
-  const std::string regex{"\\s\\s"};
-  // Look at each line
-  for (auto line : lines) {
-    line = StringTools::regexReplace(StringTools::trim(line), regex, " ");
-    std::vector<std::string> result;
+std::vector<AbstractMeshPtr>
+OBJFileLoader::importMeshFromFile(const std::vector<std::string>& meshesNames, Scene* scene,
+                                  const std::string& filename)
+{
+  MemoryMappedFile file;
+  if (!file.open(filename)) {
+    BABYLON_LOGF_ERROR("OBJFileLoader", "Could not open file %s", filename.c_str())
+    return {};
+  }
 
-    // Comment or newLine
-    if (line.empty() || line[0] == '#') {
-      continue;
+  return _parseSolid(meshesNames, scene, file.view(), Filesystem::baseDir(filename));
+}
 
-      // Get information about one position possible for the vertices
-    }
-    else if (!StringTools::regexMatch(line, std::regex(vertexPattern, std::regex::optimize))
-                .empty()) {
-      result = StringTools::regexMatch(line, std::regex(R"([^ ]+)", std::regex::optimize));
-
-      // Value of result with line: "v 1.0 2.0 3.0"
-      // ["v", "1.0", "2.0", "3.0"]
-      // Create a Vector3 with the position x, y, z
-      state.positions.emplace_back(Vector3(StringTools::toNumber<float>(result[1]), //
-                                           StringTools::toNumber<float>(result[2]), //
-                                           StringTools::toNumber<float>(result[3])  //
-                                           ));
-
-      if (_meshLoadOptions.ImportVertexColors == true) {
-        if (result.size() >= 7) {
-          // TODO: if these numbers are > 1 we can use Color4.FromInts(r,g,b,a)
-          state.colors.emplace_back(Color4(StringTools::toNumber<float>(result[4]), //
-                                           StringTools::toNumber<float>(result[5]), //
-                                           StringTools::toNumber<float>(result[6]), //
-                                           (result.size() == 7 /* || result[7] == undefined */) ?
-                                             1.f :
-                                             StringTools::toNumber<float>(result[7])));
+std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::string>& meshesNames,
+                                                        Scene* scene, std::string_view data,
+                                                        const std::string& /*rootUrl*/)
+{
+  OBJParseSolidState state;
+
+  // Tokenize the file, then gather the elements of all the chunks
+  auto chunks = parseChunks(data, _meshLoadOptions);
+  for (auto& chunk : chunks) {
+    chunk.positionBase = state.positions.size() / 3;
+    chunk.uvBase       = state.uvs.size() / 2;
+    chunk.normalBase   = state.normals.size() / 3;
+    stl_util::concat(state.positions, chunk.positions);
+    stl_util::concat(state.normals, chunk.normals);
+    stl_util::concat(state.uvs, chunk.uvs);
+    stl_util::concat(state.colors, chunk.colors);
+    chunk.positions = {};
+    chunk.normals   = {};
+    chunk.uvs       = {};
+    chunk.colors    = {};
+  }
+
+  const auto applyDirective = [this, &state](const OBJDirective& directive) {
+    switch (directive.kind) {
+      case OBJDirective::Kind::Object: {
+        // Create a new mesh corresponding to the name of the group.
+        _addPreviousObjMesh(state);
+        state.objMeshName = directive.value;
+        // Push the last mesh created with only the name
+        MeshObject objMesh;
+        objMesh.name = directive.value;
+        state.meshesFromObj.emplace_back(std::move(objMesh));
+        // Set this variable to indicate that now meshesFromObj has objects defined inside
+        state.hasMeshes       = true;
+        state.isFirstMaterial = true;
+        state.increment       = 1;
+      } break;
+      case OBJDirective::Kind::UseMaterial: {
+        // Get the name of the material
+        state.materialNameFromObj = directive.value;
+        // If this new material is in the same mesh
+        if (!state.isFirstMaterial || !state.hasMeshes) {
+          // Set the data for the previous mesh
+          _addPreviousObjMesh(state);
+          // Create a new mesh
+          MeshObject objMesh;
+          objMesh.name
+            = StringTools::printf("%s_mm%zu",
+                                  (!state.objMeshName.empty() ? state.objMeshName.c_str() : "mesh"),
+                                  state.increment);
+          objMesh.materialName = state.materialNameFromObj;
+          ++state.increment;
+          state.meshesFromObj.emplace_back(std::move(objMesh));
+          state.hasMeshes = true;
         }
-        else {
-          // TODO: maybe push NULL and if all are NULL to skip (and remove grayColor var).
-          state.colors.emplace_back(state.grayColor);
+        // Set the material name if the previous line define a mesh
+        if (state.hasMeshes && state.isFirstMaterial) {
+          // Set the material name to the previous mesh (1 material per mesh)
+          state.meshesFromObj.back().materialName = state.materialNameFromObj;
+          state.isFirstMaterial                   = false;
         }
-      }
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(normalPattern, std::regex::optimize)))
-                .empty()) {
-      // Create a Vector3 with the normals x, y, z
-      // Value of result
-      //  ["vn 1.0 2.0 3.0", "1.0", "2.0", "3.0"]
-      // Add the Vector in the list of normals
-      state.normals.emplace_back(Vector3(StringTools::toNumber<float>(result[1]), //
-                                         StringTools::toNumber<float>(result[2]), //
-                                         StringTools::toNumber<float>(result[3])  //
-                                         ));
-    }
-    else if (!(result = StringTools::regexMatch(line, std::regex(uvPattern, std::regex::optimize)))
-                .empty()) {
-      // Create a Vector2 with the normals u, v
-      // Value of result
-      //  ["vt 0.1 0.2 0.3", "0.1", "0.2"]
-      // Add the Vector in the list of uvs
-      state.uvs.emplace_back(
-        Vector2(StringTools::toNumber<float>(result[1]) * OBJFileLoader::UV_SCALING.x,
-                StringTools::toNumber<float>(result[2]) * OBJFileLoader::UV_SCALING.y));
-
-      // Identify patterns of faces
-      // Face could be defined in different type of pattern
+      } break;
+      case OBJDirective::Kind::MaterialLibrary:
+        // Get the name of mtl file
+        state.fileToLoad = directive.value;
+        break;
+      default:
+        BABYLON_LOGF_ERROR("OBJFileLoader", "Unhandled expression at line : %s",
+                           directive.value.c_str())
+        break;
     }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern3, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f 1/1/1 2/2/2 3/3/3", "1/1/1 2/2/2 3/3/3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern3(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1/1/1", "2/2/2", "3/3/3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern4, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f 1//1 2//2 3//3", "1//1 2//2 3//3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern4(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1//1", "2//2", "3//3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern5, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f -1/-1/-1 -2/-2/-2 -3/-3/-3", "-1/-1/-1 -2/-2/-2 -3/-3/-3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern5(
-        StringTools::split(StringTools::trim(result[1]),
-                           " "), // ["-1/-1/-1", "-2/-2/-2", "-3/-3/-3"]
-        1,                       // v
-        state                    // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern2, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      //["f 1/1 2/2 3/3", "1/1 2/2 3/3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern2(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1/1", "2/2", "3/3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern2, std::regex::optimize)))
-                .empty()) {
-      // Value of result
-      //["f 1 2 3", "1 2 3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern1(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1", "2", "3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-
-      // Define a mesh or an object
-      // Each time this keyword is analysed, create a new Object with all data for creating a
-      // babylonMesh
-    }
-    else if ((!StringTools::regexMatch(line, std::regex(group, std::regex::optimize)).empty())
-             || (!StringTools::regexMatch(obj, std::regex(group, std::regex::optimize)).empty())) {
-      // Create a new mesh corresponding to the name of the group.
-      // Definition of the mesh
-      auto substr = line.substr(2);
-      MeshObject objMesh{
-        StringTools::trim(substr), // Set the name of the current obj mesh
-        {},                        // indices
-        {},                        // positions
-        {},                        // normals
-        {},                        // uvs
-        {},                        // colors
-        ""                         // materialName
-      };
-      _addPreviousObjMesh(state);
-
-      // Push the last mesh created with only the name
-      state.meshesFromObj.emplace_back(objMesh);
-
-      // Set this variable to indicate that now meshesFromObj has objects defined inside
-      state.hasMeshes       = true;
-      state.isFirstMaterial = true;
-      state.increment       = 1;
-      // Keyword for applying a material
-    }
-    else if (!StringTools::regexMatch(line, std::regex(usemtl, std::regex::optimize)).empty()) {
-      // Get the name of the material
-      auto substr               = line.substr(7);
-      state.materialNameFromObj = StringTools::trim(substr);
-
-      // If this new material is in the same mesh
-
-      if (!state.isFirstMaterial || !state.hasMeshes) {
-        // Set the data for the previous mesh
-        _addPreviousObjMesh(state);
-        // Create a new mesh
-        MeshObject objMesh
-          // Set the name of the current obj mesh
-          {
-            StringTools::printf("%s_mm%zu",
-                                (!state.objMeshName.empty() ? state.objMeshName.c_str() : "mesh"),
-                                state.increment), // Set the name of the current obj mesh
-            {},                                   // indices
-            {},                                   // positions
-            {},                                   // normals
-            {},                                   // uvs
-            {},                                   // colors
-            state.materialNameFromObj             // materialName
-          };
-        ++state.increment;
-        // If meshes are already defined
-        state.meshesFromObj.emplace_back(objMesh);
-        state.hasMeshes = true;
+  };
+
+  // Build the meshes, in file order
+  const auto positionCount = state.positions.size() / 3;
+  const auto uvCount       = state.uvs.size() / 2;
+  const auto normalCount   = state.normals.size() / 3;
+  size_t invalidFaces       = 0;
+  std::vector<OBJVertexKey> faceKeys;
+  for (const auto& chunk : chunks) {
+    size_t directive = 0;
+    for (size_t faceIndex = 0; faceIndex < chunk.faces.size(); ++faceIndex) {
+      for (; directive < chunk.directives.size() && chunk.directives[directive].face == faceIndex;
+           ++directive) {
+        applyDirective(chunk.directives[directive]);
       }
-      // Set the material name if the previous line define a mesh
 
-      if (state.hasMeshes && state.isFirstMaterial) {
-        // Set the material name to the previous mesh (1 material per mesh)
-        state.meshesFromObj.back().materialName = state.materialNameFromObj;
-        state.isFirstMaterial                   = false;
+      // Resolve the indices of the face vertices
+      const auto& face = chunk.faces[faceIndex];
+      auto valid       = true;
+      faceKeys.resize(face.vertexCount);
+      for (uint32_t v = 0; v < face.vertexCount && valid; ++v) {
+        const auto& vertex = chunk.faceVertices[face.firstVertex + v];
+        auto& key          = faceKeys[v];
+        valid = resolveIndex(vertex.position, chunk.positionBase + face.positionCount, positionCount,
+                             key.position)
+                && key.position >= 0
+                && resolveIndex(vertex.uv, chunk.uvBase + face.uvCount, uvCount, key.uv)
+                && resolveIndex(vertex.normal, chunk.normalBase + face.normalCount, normalCount,
+                                key.normal);
+      }
+      if (!valid) {
+        ++invalidFaces;
+        continue;
       }
-      // Keyword for loading the mtl file
-    }
-    else if (!StringTools::regexMatch(line, std::regex(mtllib, std::regex::optimize)).empty()) {
-      // Get the name of mtl file
-      auto substr      = line.substr(7);
-      state.fileToLoad = StringTools::trim(substr);
 
-      // Apply smoothing
+      // Create triangles from the polygon: [v0, v1, v2], [v0, v2, v3], ...
+      for (size_t v = 1; v + 1 < faceKeys.size(); ++v) {
+        _setData(faceKeys[0], state);
+        _setData(faceKeys[v], state);
+        _setData(faceKeys[v + 1], state);
+      }
     }
-    else if (!StringTools::regexMatch(line, std::regex(smooth, std::regex::optimize)).empty()) {
-      // smooth shading => apply smoothing
-      // Today I don't know it work with babylon and with obj.
-      // With the obj file  an integer is set
-    }
-    else {
-      // If there is another possibility
-      BABYLON_LOG_ERROR("OBJFileLoader", "Unhandled expression at line : %s", line.c_str())
+    for (; directive < chunk.directives.size(); ++directive) {
+      applyDirective(chunk.directives[directive]);
     }
   }
+  if (invalidFaces > 0) {
+    BABYLON_LOGF_ERROR("OBJFileLoader", "%zu faces reference undefined vertices", invalidFaces)
+  }
 
   // At the end of the file, add the last mesh into the meshesFromObj array
   if (state.hasMeshes) {
-    // Set the data for the last mesh
-    state.handledMesh = state.meshesFromObj.back();
-
-    // Reverse indices for displaying faces in the good sense
-    std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
-    // Get the good array
-    _unwrapData(state);
-    // Set array
-    state.handledMesh.indices   = state.indicesForBabylon;
-    state.handledMesh.positions = state.unwrappedPositionsForBabylon;
-    state.handledMesh.normals   = state.unwrappedNormalsForBabylon;
-    state.handledMesh.uvs       = state.unwrappedUVForBabylon;
-
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.handledMesh.colors = state.unwrappedColorsForBabylon;
-    }
+    _addPreviousObjMesh(state);
   }
-
   // If any o or g keyword found, create a mesh with a random id
-  if (!state.hasMeshes) {
+  else {
+    auto& handled = state.handledMesh;
     // reverse tab of indices
-    std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
-    // Get positions normals uvs
-    _unwrapData(state);
-    // Set data for one mesh
-    state.meshesFromObj.emplace_back(MeshObject{
-      Geometry::RandomId(),               // name
-      state.indicesForBabylon,            // indices
-      state.unwrappedPositionsForBabylon, // positions
-      state.unwrappedColorsForBabylon,    // colors
-      state.unwrappedNormalsForBabylon,   // normals
-      state.unwrappedUVForBabylon,        // uvs
-      state.materialNameFromObj           // materialName
-    });
+    std::reverse(handled.indices.begin(), handled.indices.end());
+    handled.name         = Geometry::RandomId();
+    handled.materialName = state.materialNameFromObj;
+    state.meshesFromObj.emplace_back(std::move(handled));
   }
 
   // Create a Mesh list
@@ -616,7 +641,7 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
   std::vector<std::string> materialToUse;
 
   // Set data for each mesh
-  for (const auto& meshFromObj : state.meshesFromObj) {
+  for (auto& meshFromObj : state.meshesFromObj) {
 
     // check meshesNames (stlFileLoader)
     if (!meshesNames.empty() && !meshFromObj.name.empty()) {
@@ -625,9 +650,6 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
       }
     }
 
-    // Get the current mesh
-    // Set the data with VertexBuffer for each mesh
-    state.handledMesh = meshFromObj;
     // Create a Mesh with the name of the obj mesh
 
     scene->_blockEntityCollection = _forAssetContainer;
@@ -640,19 +662,19 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
 
     auto vertexData = std::make_unique<VertexData>(); // The container for the values
     // Set the data for the babylonMesh
-    vertexData->uvs       = state.handledMesh.uvs;
-    vertexData->indices   = state.handledMesh.indices;
-    vertexData->positions = state.handledMesh.positions;
+    vertexData->uvs       = std::move(meshFromObj.uvs);
+    vertexData->indices   = std::move(meshFromObj.indices);
+    vertexData->positions = std::move(meshFromObj.positions);
     if (_meshLoadOptions.ComputeNormals == true) {
       Float32Array normals;
-      VertexData::ComputeNormals(state.handledMesh.positions, state.handledMesh.indices, normals);
-      vertexData->normals = normals;
+      VertexData::ComputeNormals(vertexData->positions, vertexData->indices, normals);
+      vertexData->normals = std::move(normals);
     }
     else {
-      vertexData->normals = state.handledMesh.normals;
+      vertexData->normals = std::move(meshFromObj.normals);
     }
     if (_meshLoadOptions.ImportVertexColors == true) {
-      vertexData->colors = state.handledMesh.colors;
+      vertexData->colors = std::move(meshFromObj.colors);
     }
     // Set the data from the VertexBuffer to the current Mesh
     vertexData->applyToMesh(*babylonMesh);
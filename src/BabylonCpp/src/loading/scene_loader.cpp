@@ -9,6 +9,7 @@
 #include <babylon/loading/iscene_loader_plugin.h>
 #include <babylon/loading/iscene_loader_plugin_async.h>
 #include <babylon/loading/iscene_loader_plugin_factory.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
 #include <babylon/loading/plugins/babylon/babylon_file_loader.h>
 #include <babylon/loading/scene_loader_flags.h>
 #include <babylon/loading/scene_loader_progress_event.h>
@@ -65,8 +66,9 @@ std::unordered_map<std::string, IRegisteredPlugin> SceneLoader::_registeredPlugi
 
 void SceneLoader::RegisterPlugins()
 {
-  // Register babylon.js file loader
+  // Register babylon.js file loaders
   SceneLoader::RegisterPlugin(std::make_shared<BabylonFileLoader>());
+  SceneLoader::RegisterPlugin(std::make_shared<BabylonBinaryFileLoader>());
 }
 
 IRegisteredPlugin SceneLoader::GetDefaultPlugin()
@@ -199,6 +201,13 @@ std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr> SceneLoader::_Lo
           return;
         }
 
+        if (std::holds_alternative<ArrayBufferView>(data)) {
+          // Binary plugins receive the raw bytes of the file
+          const auto& bytes = std::get<ArrayBufferView>(data).uint8Array();
+          onSuccess(plugin, std::string(bytes.begin(), bytes.end()), responseURL);
+          return;
+        }
+
         onSuccess(plugin, std::get<std::string>(data), responseURL);
       };
 
@@ -391,26 +391,15 @@ bool BaseTexture::canRescale()
 
 InternalTexturePtr BaseTexture::_getFromCache(const std::string& url, bool iNoMipmap,
                                               unsigned int sampling,
-                                              const std::optional<bool>& invertY)
+                                              const std::optional<bool>& invertY,
+                                              const std::optional<unsigned int>& format)
 {
   auto engine = _getEngine();
   if (!engine) {
     return nullptr;
   }
 
-  auto& texturesCache = engine->getLoadedTexturesCache();
-  for (auto& texturesCacheEntry : texturesCache) {
-    if (!invertY.has_value() || *invertY == texturesCacheEntry->invertY) {
-      if ((texturesCacheEntry->url == url) && texturesCacheEntry->generateMipMaps != iNoMipmap) {
-        if (!sampling || sampling == texturesCacheEntry->samplingMode) {
-          texturesCacheEntry->incrementReferences();
-          return texturesCacheEntry;
-        }
-      }
-    }
-  }
-
-  return nullptr;
+  return engine->getLoadedTexturesCache().find(url, iNoMipmap, sampling, invertY, format);
 }
 
 void BaseTexture::_rebuild(bool /*forceFullRebuild*/)
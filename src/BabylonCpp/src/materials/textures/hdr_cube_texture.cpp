@@ -1,5 +1,7 @@
 #include <babylon/materials/textures/hdr_cube_texture.h>
 
+#include <sstream>
+
 #include <nlohmann/json.hpp>
 
 #include <babylon/babylon_stl_util.h>
@@ -13,6 +15,7 @@
 #include <babylon/materials/textures/texture_constants.h>
 #include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
 #include <babylon/misc/highdynamicrange/hdr_tools.h>
+#include <babylon/misc/texture_disk_cache.h>
 #include <babylon/misc/tools.h>
 
 namespace BABYLON {
@@ -140,6 +143,29 @@ void HDRCubeTexture::loadTexture()
     lodGenerationOffset = 0.f;
     lodGenerationScale  = 0.8f;
 
+    // Reuse the faces processed by a previous run when the texture disk cache is enabled
+    std::string cacheKey;
+    if (TextureDiskCache::IsEnabled()) {
+      std::ostringstream parameters;
+      parameters << "hdr:size=" << _size << ":harmonics=" << _generateHarmonics
+                 << ":gamma=" << gammaSpace << ":float=" << engine->getCaps().textureFloat;
+      cacheKey = TextureDiskCache::Key(
+        std::string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()),
+        parameters.str());
+      const auto entry = TextureDiskCache::Load(cacheKey);
+      if (entry && entry->levels.size() == 6
+          && (!_generateHarmonics || entry->sphericalPolynomial)) {
+        if (_generateHarmonics) {
+          sphericalPolynomial = entry->sphericalPolynomial;
+        }
+        std::vector<ArrayBufferView> results;
+        for (const auto& level : entry->levels) {
+          results.emplace_back(ArrayBuffer(level.begin(), level.end()));
+        }
+        return results;
+      }
+    }
+
     // Extract the raw linear data.
     const auto data = HDRTools::GetCubeMapTextureData(buffer, _size);
 
@@ -205,6 +231,23 @@ void HDRCubeTexture::loadTexture()
       }
     }
 
+    if (!cacheKey.empty()) {
+      TextureDiskCacheEntry entry;
+      entry.width  = static_cast<int>(_size);
+      entry.height = static_cast<int>(_size);
+      entry.format = Constants::TEXTUREFORMAT_RGB;
+      entry.type   = engine->getCaps().textureFloat ? Constants::TEXTURETYPE_FLOAT :
+                                                      Constants::TEXTURETYPE_UNSIGNED_INT;
+      for (const auto& face : results) {
+        const auto& bytes = face.uint8Array();
+        entry.levels.emplace_back(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+      }
+      if (_generateHarmonics) {
+        entry.sphericalPolynomial = sphericalPolynomial;
+      }
+      TextureDiskCache::Store(cacheKey, entry);
+    }
+
     return results;
   };
 
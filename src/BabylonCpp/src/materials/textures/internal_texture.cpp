@@ -1,6 +1,5 @@
 #include <babylon/materials/textures/internal_texture.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
@@ -304,12 +303,8 @@ void InternalTexture::_swapAndDie(const InternalTexturePtr& target)
   }
 
   auto& cache = _engine->getLoadedTexturesCache();
-  stl_util::remove_vector_elements_equal_sharedptr(cache, this);
-
-  auto it = std::find(cache.begin(), cache.end(), target);
-  if (it == cache.end()) {
-    cache.emplace_back(target);
-  }
+  cache.remove(this);
+  cache.add(target);
 }
 
 void InternalTexture::dispose()
@@ -320,8 +315,7 @@ void InternalTexture::dispose()
 
   --_references;
   if (_references == 0) {
-    _engine->_releaseTexture(shared_from_this());
-    _webGLTexture = nullptr;
+    _engine->_releaseUnreferencedTexture(shared_from_this());
   }
 }
 
@@ -5,6 +5,7 @@
 #include <babylon/engines/depth_texture_creation_options.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/maths/matrix.h>
@@ -431,6 +432,7 @@ void RenderTargetTexture::resize(const std::variant<int, RenderTargetSize, float
 
 void RenderTargetTexture::render(bool iUseCameraPostProcess, bool dumpForDebug)
 {
+  BABYLON_PROFILE_ZONE("Render target");
   auto scene = getScene();
 
   if (!scene) {
@@ -688,18 +690,17 @@ void RenderTargetTexture::renderToTarget(unsigned int faceIndex, bool useCameraP
     onBeforeRenderObservable.notifyObservers(&_faceIndex);
   }
 
-  // Get the list of meshes to render
-  std::vector<AbstractMesh*> currentRenderList;
-  auto defaultRenderList = !renderList().empty() ? renderList() : scene->getActiveMeshes();
-  auto defaultRenderListLength
-    = !renderList().empty() ? renderList().size() : scene->getActiveMeshes().size();
+  // Get the list of meshes to render, the default list is referenced rather than copied
+  std::vector<AbstractMesh*> customRenderList;
+  const auto& defaultRenderList = !renderList().empty() ? renderList() : scene->getActiveMeshes();
+  const auto defaultRenderListLength = defaultRenderList.size();
 
   if (getCustomRenderList) {
-    currentRenderList = getCustomRenderList(is2DArray ? layer : faceIndex, defaultRenderList,
-                                            defaultRenderListLength);
+    customRenderList = getCustomRenderList(is2DArray ? layer : faceIndex, defaultRenderList,
+                                           defaultRenderListLength);
   }
 
-  if (currentRenderList.empty()) {
+  if (customRenderList.empty()) {
     // No custom render list provided, we prepare the rendering for the default list, but check
     // first if we did not already performed the preparation before so as to avoid re-doing it
     // several times
@@ -708,12 +709,12 @@ void RenderTargetTexture::renderToTarget(unsigned int faceIndex, bool useCameraP
                                renderList().empty());
       _defaultRenderListPrepared = true;
     }
-    currentRenderList = defaultRenderList;
   }
   else {
     // Prepare the rendering for the custom render list provided
-    _prepareRenderingManager(currentRenderList, defaultRenderListLength, camera, false);
+    _prepareRenderingManager(customRenderList, defaultRenderListLength, camera, false);
   }
+  const auto& currentRenderList = customRenderList.empty() ? defaultRenderList : customRenderList;
 
   // Clear
   if (onClearObservable.hasObservers()) {
@@ -1,5 +1,7 @@
 #include <babylon/meshes/buffer.h>
 
+#include <algorithm>
+
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/interfaces/igl_rendering_context.h>
@@ -20,6 +22,7 @@ Buffer::Buffer(ThinEngine* engine, const Float32Array& data, bool updatable,
   _divisor   = divisor.value_or(1);
 
   _data = data;
+  _trackDataMemory();
 
   if (!stride.has_value()) {
     stride = 0ull;
@@ -43,6 +46,7 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, std::option
   _divisor   = divisor.value_or(1);
 
   _data = data;
+  _trackDataMemory();
 
   if (!stride.has_value()) {
     stride = 0ull;
@@ -126,6 +130,8 @@ WebGLDataBufferPtr Buffer::create(Float32Array data)
   else { // Update data
     _data = std::move(data);
   }
+  _dirtyRanges.clear();
+  _trackDataMemory();
 
   return _buffer;
 }
@@ -153,11 +159,72 @@ WebGLDataBufferPtr Buffer::updateDirectly(const Float32Array& data, size_t offse
       _buffer, data, useBytes ? static_cast<int>(offset) : static_cast<int>(offset * sizeof(float)),
       (vertexCount.has_value() ? static_cast<int>(*vertexCount * byteStride) : -1));
     _data.clear();
+    _dirtyRanges.clear();
+    _trackDataMemory();
   }
 
   return _buffer;
 }
 
+void Buffer::markRange(size_t start, size_t count)
+{
+  auto end = std::min(start + count, _data.size());
+  if (!_updatable || start >= end) {
+    return;
+  }
+
+  // Merges the range with the ones it overlaps or touches
+  auto first = std::lower_bound(
+    _dirtyRanges.begin(), _dirtyRanges.end(), start,
+    [](const std::pair<size_t, size_t>& range, size_t value) { return range.second < value; });
+  auto last = first;
+  for (; last != _dirtyRanges.end() && last->first <= end; ++last) {
+    start = std::min(start, last->first);
+    end   = std::max(end, last->second);
+  }
+  first = _dirtyRanges.erase(first, last);
+  _dirtyRanges.insert(first, {start, end});
+
+  // Bounds the number of updates by merging the ranges separated by the smallest gaps
+  while (_dirtyRanges.size() > MaxDirtyRanges) {
+    size_t closest = 0;
+    for (size_t index = 1; index + 1 < _dirtyRanges.size(); ++index) {
+      if (_dirtyRanges[index + 1].first - _dirtyRanges[index].second
+          < _dirtyRanges[closest + 1].first - _dirtyRanges[closest].second) {
+        closest = index;
+      }
+    }
+    _dirtyRanges[closest].second = _dirtyRanges[closest + 1].second;
+    _dirtyRanges.erase(_dirtyRanges.begin() + static_cast<std::ptrdiff_t>(closest + 1));
+  }
+}
+
+void Buffer::uploadDirtyRanges()
+{
+  if (_dirtyRanges.empty()) {
+    return;
+  }
+
+  if (_buffer && _updatable) {
+    for (const auto& [start, end] : _dirtyRanges) {
+      if (start == 0 && end == _data.size()) {
+        _engine->updateDynamicVertexBuffer(_buffer, _data);
+        continue;
+      }
+      _rangeData.assign(_data.begin() + static_cast<std::ptrdiff_t>(start),
+                        _data.begin() + static_cast<std::ptrdiff_t>(end));
+      _engine->updateDynamicVertexBuffer(_buffer, _rangeData,
+                                         static_cast<int>(start * sizeof(float)));
+    }
+  }
+  _dirtyRanges.clear();
+}
+
+void Buffer::_trackDataMemory()
+{
+  _dataMemory.set(_data.capacity() * sizeof(float));
+}
+
 void Buffer::_increaseReferences()
 {
   if (!_buffer) {
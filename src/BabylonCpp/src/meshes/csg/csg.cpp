@@ -1,16 +1,111 @@
 #include <babylon/meshes/csg/csg.h>
 
+#include <numeric>
+#include <tuple>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/meshes/csg/node.h>
-#include <babylon/meshes/csg/polygon.h>
 #include <babylon/meshes/csg/vertex.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
-#include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Copies the polygons of two solids in a single arena.
+ */
+CSG::PolygonArena mergePolygons(const CSG::PolygonArena& polygonsA,
+                                const CSG::PolygonArena& polygonsB, std::vector<uint32_t>& a,
+                                std::vector<uint32_t>& b)
+{
+  CSG::PolygonArena arena{polygonsA};
+  const auto offset = arena.append(polygonsB);
+  a.resize(polygonsA.size());
+  b.resize(polygonsB.size());
+  std::iota(a.begin(), a.end(), 0u);
+  std::iota(b.begin(), b.end(), offset);
+  return arena;
+}
+
+CSG::PolygonArena unionPolygons(const CSG::PolygonArena& polygonsA,
+                                const CSG::PolygonArena& polygonsB)
+{
+  std::vector<uint32_t> polygonIndicesA, polygonIndicesB;
+  auto arena = mergePolygons(polygonsA, polygonsB, polygonIndicesA, polygonIndicesB);
+  CSG::Node a{arena, polygonIndicesA};
+  CSG::Node b{arena, polygonIndicesB};
+  a.clipTo(b);
+  b.clipTo(a);
+  b.invert();
+  b.clipTo(a);
+  b.invert();
+  a.build(b.allPolygons());
+  return arena.extract(a.allPolygons());
+}
+
+CSG::PolygonArena subtractPolygons(const CSG::PolygonArena& polygonsA,
+                                   const CSG::PolygonArena& polygonsB)
+{
+  std::vector<uint32_t> polygonIndicesA, polygonIndicesB;
+  auto arena = mergePolygons(polygonsA, polygonsB, polygonIndicesA, polygonIndicesB);
+  CSG::Node a{arena, polygonIndicesA};
+  CSG::Node b{arena, polygonIndicesB};
+  a.invert();
+  a.clipTo(b);
+  b.clipTo(a);
+  b.invert();
+  b.clipTo(a);
+  b.invert();
+  a.build(b.allPolygons());
+  a.invert();
+  return arena.extract(a.allPolygons());
+}
+
+CSG::PolygonArena intersectPolygons(const CSG::PolygonArena& polygonsA,
+                                    const CSG::PolygonArena& polygonsB)
+{
+  std::vector<uint32_t> polygonIndicesA, polygonIndicesB;
+  auto arena = mergePolygons(polygonsA, polygonsB, polygonIndicesA, polygonIndicesB);
+  CSG::Node a{arena, polygonIndicesA};
+  CSG::Node b{arena, polygonIndicesB};
+  a.invert();
+  b.clipTo(a);
+  b.invert();
+  a.clipTo(b);
+  b.clipTo(a);
+  a.build(b.allPolygons());
+  a.invert();
+  return arena.extract(a.allPolygons());
+}
+
+/**
+ * @brief Key used to merge the vertices sharing the same local position.
+ */
+struct VertexKey {
+  float x, y, z;
+
+  bool operator==(const VertexKey& other) const
+  {
+    return x == other.x && y == other.y && z == other.z;
+  }
+}; // end of struct VertexKey
+
+struct VertexKeyHash {
+  size_t operator()(const VertexKey& key) const
+  {
+    const std::hash<float> hasher;
+    auto seed = hasher(key.x);
+    seed ^= hasher(key.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= hasher(key.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+}; // end of struct VertexKeyHash
+
+} // end of anonymous namespace
+
 unsigned int CSG::CSG::currentCSGMeshId = 0;
 
 CSG::CSG::CSG() = default;
@@ -24,7 +119,7 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   Vector3 normal;
   Vector2 uv;
   Vector3 position;
-  std::vector<Polygon> polygons;
+  PolygonArena polygons;
 
   Matrix matrix;
   Vector3 meshPosition;
@@ -46,11 +141,15 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   Float32Array normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
   Float32Array uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
 
+  polygons.reserve(indices.size() / 3, indices.size());
+  std::vector<Vertex> vertices;
+  vertices.reserve(3);
+
   unsigned int sm = 0;
   for (auto& subMesh : mesh->subMeshes) {
     for (size_t i = subMesh->indexStart, il = subMesh->indexCount + subMesh->indexStart; i < il;
          i += 3) {
-      std::vector<Vertex> vertices;
+      vertices.clear();
       for (unsigned int j = 0; j < 3; ++j) {
         Vector3 sourceNormal(normals[indices[i + j] * 3], normals[indices[i + j] * 3 + 1],
                              normals[indices[i + j] * 3 + 2]);
@@ -68,20 +167,14 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
       shared.meshId        = currentCSGMeshId;
       shared.materialIndex = subMesh->materialIndex;
 
-      Polygon polygon(vertices, shared);
-      polygon.plane = Plane::FromPoints(vertices[0].pos, vertices[1].pos, vertices[2].pos);
-
-      // To handle the case of degenerated triangle
-      // polygon.plane == null <=> the polygon does not represent 1 single plane
-      // <=> the triangle is degenerated
-      if (polygon.plane.first) {
-        polygons.emplace_back(polygon);
-      }
+      // Degenerated triangles (not representing 1 single plane) are not added
+      uint32_t polygonIndex = 0;
+      polygons.addPolygon(vertices.data(), vertices.size(), shared, polygonIndex);
     }
     ++sm;
   }
 
-  auto csg                = CSG::FromPolygons(polygons);
+  auto csg                = CSG::FromPolygons(std::move(polygons));
   csg->matrix             = matrix;
   csg->position           = meshPosition;
   csg->rotation           = meshRotation;
@@ -92,118 +185,52 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   return csg;
 }
 
-std::unique_ptr<BABYLON::CSG::CSG>
-CSG::CSG::FromPolygons(const std::vector<BABYLON::CSG::Polygon>& _polygons)
+std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromPolygons(PolygonArena&& _polygons)
 {
   auto csg       = std::make_unique<BABYLON::CSG::CSG>();
-  csg->_polygons = _polygons;
+  csg->_polygons = std::move(_polygons);
   return csg;
 }
 
 std::unique_ptr<CSG::CSG> CSG::CSG::clone() const
 {
-  auto csg = std::make_unique<CSG>();
-  for (auto& p : _polygons) {
-    csg->_polygons.emplace_back(p.clone());
-  }
+  auto csg       = std::make_unique<CSG>();
+  csg->_polygons = _polygons;
   csg->copyTransformAttributes(*this);
   return csg;
 }
 
 CSG::CSG CSG::CSG::_union(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(unionPolygons(_polygons, csg->_polygons))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::unionInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-
-  _polygons = a.allPolygons();
+  _polygons = unionPolygons(_polygons, csg->_polygons);
 }
 
 CSG::CSG CSG::CSG::subtract(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(subtractPolygons(_polygons, csg->_polygons))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::subtractInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = subtractPolygons(_polygons, csg->_polygons);
 }
 
 CSG::CSG CSG::CSG::intersect(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(intersectPolygons(_polygons, csg->_polygons))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::intersectInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = intersectPolygons(_polygons, csg->_polygons);
 }
 
 std::unique_ptr<CSG::CSG> CSG::CSG::inverse()
@@ -215,9 +242,7 @@ std::unique_ptr<CSG::CSG> CSG::CSG::inverse()
 
 void CSG::CSG::inverseInPlace()
 {
-  for (auto& p : _polygons) {
-    p.flip();
-  }
+  _polygons.flipAll();
 }
 
 CSG::CSG& CSG::CSG::copyTransformAttributes(const BABYLON::CSG::CSG& csg)
@@ -243,31 +268,33 @@ MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool
   Uint32Array indices;
   Float32Array normals;
   Float32Array uvs;
-  auto vertex   = Vector3::Zero();
-  auto normal   = Vector3::Zero();
-  auto uv       = Vector2::Zero();
-  auto polygons = _polygons;
+  auto vertex = Vector3::Zero();
+  auto normal = Vector3::Zero();
+  auto uv     = Vector2::Zero();
+  std::vector<uint32_t> polygons(_polygons.size());
+  std::iota(polygons.begin(), polygons.end(), 0u);
   std::array<unsigned int, 3> polygonIndices{{0, 0, 0}};
-  std::unordered_map<std::string, size_t> vertice_dict;
-  bool vertexIdxDefined     = false;
+  std::unordered_map<VertexKey, size_t, VertexKeyHash> vertice_dict;
   size_t vertex_idx         = 0;
   unsigned int currentIndex = 0;
   std::unordered_map<unsigned int, std::unordered_map<unsigned int, SubMeshObj>> subMesh_dict;
   SubMeshObj subMesh_obj;
 
+  vertice_dict.reserve(polygons.size());
+
   if (keepSubMeshes) {
     // Sort Polygons, since subMeshes are indices range
-    BABYLON::stl_util::sort_js_style(polygons, [](const Polygon& a, const Polygon& b) {
-      if (a.shared.meshId == b.shared.meshId) {
-        return a.shared.subMeshId - b.shared.subMeshId;
-      }
-      else {
-        return a.shared.meshId - b.shared.meshId;
-      }
+    std::stable_sort(polygons.begin(), polygons.end(), [this](uint32_t a, uint32_t b) {
+      const auto& sharedA = _polygons.polygon(a).shared;
+      const auto& sharedB = _polygons.polygon(b).shared;
+      return std::tie(sharedA.meshId, sharedA.subMeshId)
+             < std::tie(sharedB.meshId, sharedB.subMeshId);
     });
   }
 
-  for (auto& polygon : polygons) {
+  for (auto polygonIndex : polygons) {
+    const auto& polygon         = _polygons.polygon(polygonIndex);
+    const auto* polygonVertices = _polygons.vertices(polygonIndex);
     // Building SubMeshes
     if (subMesh_dict.find(polygon.shared.meshId) == subMesh_dict.end()) {
       subMesh_dict[polygon.shared.meshId] = std::unordered_map<unsigned int, SubMeshObj>();
@@ -286,25 +313,25 @@ MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool
     }
     subMesh_obj = subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId];
 
-    for (unsigned int j = 2; j < polygon.vertices.size(); ++j) {
+    for (unsigned int j = 2; j < polygon.vertexCount; ++j) {
 
       polygonIndices[0] = 0;
       polygonIndices[1] = j - 1;
       polygonIndices[2] = j;
 
       for (unsigned int k = 0; k < 3; ++k) {
-        vertex.copyFrom(polygon.vertices[polygonIndices[k]].pos);
-        normal.copyFrom(polygon.vertices[polygonIndices[k]].normal);
-        uv.copyFrom(polygon.vertices[polygonIndices[k]].uv);
+        vertex.copyFrom(polygonVertices[polygonIndices[k]].pos);
+        normal.copyFrom(polygonVertices[polygonIndices[k]].normal);
+        uv.copyFrom(polygonVertices[polygonIndices[k]].uv);
         Vector3 localVertex = Vector3::TransformCoordinates(vertex, _matrix);
         Vector3 localNormal = Vector3::TransformNormal(normal, _matrix);
 
-        std::string vertexId
-          = StringTools::concat(localVertex.x, ",", localVertex.y, ",", localVertex.z);
-
-        if (stl_util::contains(vertice_dict, vertexId)) {
-          vertex_idx       = vertice_dict[vertexId];
-          vertexIdxDefined = true;
+        // Adding 0 maps -0 to +0 so that both share the same key
+        const VertexKey vertexId{localVertex.x + 0.f, localVertex.y + 0.f, localVertex.z + 0.f};
+        auto it               = vertice_dict.find(vertexId);
+        bool vertexIdxDefined = (it != vertice_dict.end());
+        if (vertexIdxDefined) {
+          vertex_idx = it->second;
         }
 
         // Check if 2 points can be merged
@@ -315,10 +342,9 @@ MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool
               && stl_util::almost_equal(uvs[vertex_idx * 2 + 1], uv.y))) {
           stl_util::concat(vertices, {localVertex.x, localVertex.y, localVertex.z});
           stl_util::concat(uvs, {uv.x, uv.y});
-          stl_util::concat(normals, {normal.x, normal.y, normal.z});
+          stl_util::concat(normals, {localNormal.x, localNormal.y, localNormal.z});
           vertex_idx             = (vertices.size() / 3) - 1;
           vertice_dict[vertexId] = vertex_idx;
-          vertexIdxDefined       = true;
         }
 
         indices.emplace_back(static_cast<unsigned int>(vertex_idx));
@@ -1,16 +1,30 @@
 #include <babylon/meshes/csg/node.h>
 
-#include <babylon/babylon_stl_util.h>
-#include <babylon/meshes/csg/polygon.h>
+#include <future>
+#include <thread>
+
+#include <babylon/meshes/csg/polygon_arena.h>
 
 namespace BABYLON {
 
-CSG::Node::Node() : _plane{nullptr}, _front{nullptr}, _back{nullptr}
+namespace {
+
+/**
+ * @brief Range of polygon indices in a work buffer waiting to be filtered down a BSP node.
+ */
+struct BspTask {
+  int32_t node;
+  size_t offset;
+  size_t count;
+}; // end of struct BspTask
+
+} // end of anonymous namespace
+
+CSG::Node::Node(PolygonArena& arena) : _arena{&arena}
 {
 }
 
-CSG::Node::Node(const std::vector<BABYLON::CSG::Polygon>& polygons)
-    : _plane{nullptr}, _front{nullptr}, _back{nullptr}
+CSG::Node::Node(PolygonArena& arena, const std::vector<uint32_t>& polygons) : _arena{&arena}
 {
   if (!polygons.empty()) {
     build(polygons);
@@ -19,103 +33,193 @@ CSG::Node::Node(const std::vector<BABYLON::CSG::Polygon>& polygons)
 
 CSG::Node::~Node() = default;
 
-std::unique_ptr<CSG::Node> CSG::Node::clone()
+void CSG::Node::invert()
 {
-  auto node       = std::make_unique<Node>();
-  node->_plane    = _plane ? _plane->cloneToNewObject() : nullptr;
-  node->_front    = _front ? _front->clone() : nullptr;
-  node->_back     = _back ? _back->clone() : nullptr;
-  node->_polygons = _polygons;
-  return node;
+  for (auto& node : _nodes) {
+    for (auto polygon : node.polygons) {
+      _arena->flip(polygon);
+    }
+    node.plane.flip();
+    std::swap(node.front, node.back);
+  }
 }
 
-void CSG::Node::invert()
+std::vector<uint32_t> CSG::Node::clipPolygons(const std::vector<uint32_t>& polygons,
+                                              PolygonArena& arena) const
 {
-  for (auto& polygon : _polygons) {
-    polygon.flip();
-  }
-  if (_plane) {
-    _plane->flip();
-  }
-  if (_front) {
-    _front->invert();
+  if (_nodes.empty() || polygons.empty()) {
+    return polygons;
   }
-  if (_back) {
-    _back->invert();
+
+  std::vector<uint32_t> result, front, back;
+  std::vector<uint32_t> buffer{polygons};
+  std::vector<BspTask> stack{{0, 0, polygons.size()}};
+  result.reserve(polygons.size());
+
+  // Depth-first traversal, front subtrees are visited first to keep the order of the recursive
+  // algorithm
+  while (!stack.empty()) {
+    const auto task = stack.back();
+    stack.pop_back();
+    const auto& node = _nodes[static_cast<size_t>(task.node)];
+
+    front.clear();
+    back.clear();
+    for (size_t i = task.offset; i < task.offset + task.count; ++i) {
+      arena.splitPolygon(node.plane, buffer[i], front, back, front, back);
+    }
+
+    // Polygons behind a leaf are inside the solid and discarded
+    if (node.back >= 0 && !back.empty()) {
+      stack.push_back({node.back, buffer.size(), back.size()});
+      buffer.insert(buffer.end(), back.begin(), back.end());
+    }
+    if (!front.empty()) {
+      if (node.front >= 0) {
+        stack.push_back({node.front, buffer.size(), front.size()});
+        buffer.insert(buffer.end(), front.begin(), front.end());
+      }
+      else {
+        result.insert(result.end(), front.begin(), front.end());
+      }
+    }
   }
-  std::swap(_front, _back);
+
+  return result;
 }
 
-std::vector<CSG::Polygon>
-CSG::Node::clipPolygons(const std::vector<BABYLON::CSG::Polygon>& polygons)
+void CSG::Node::_clipNodes(const Node& bsp, size_t begin, size_t end, PolygonArena& arena)
 {
-  if (!_plane) {
-    return polygons;
-  }
-  std::vector<Polygon> front, back;
-  for (auto& polygon : polygons) {
-    _plane->splitPolygon(polygon, front, back, front, back);
+  for (size_t i = begin; i < end; ++i) {
+    _nodes[i].polygons = bsp.clipPolygons(_nodes[i].polygons, arena);
   }
-  if (_front) {
-    front = _front->clipPolygons(front);
+}
+
+void CSG::Node::clipTo(const Node& bsp)
+{
+  size_t polygonCount = 0;
+  for (const auto& node : _nodes) {
+    polygonCount += node.polygons.size();
   }
-  if (_back) {
-    back = _back->clipPolygons(back);
+
+  const size_t concurrency = std::thread::hardware_concurrency();
+  if (polygonCount < ParallelClipThreshold || concurrency < 2 || _nodes.size() < 2) {
+    _clipNodes(bsp, 0, _nodes.size(), *_arena);
+    return;
   }
-  else {
-    back.clear();
+
+  // Split the nodes in ranges holding roughly the same number of polygons. Each range is clipped
+  // in its own arena, the shared arena is only read until all the ranges are done
+  const size_t chunkCount = std::min(concurrency, _nodes.size());
+  std::vector<std::pair<size_t, size_t>> ranges;
+  size_t begin = 0, accumulated = 0;
+  for (size_t i = 0; i < _nodes.size(); ++i) {
+    accumulated += _nodes[i].polygons.size();
+    if (accumulated * chunkCount >= polygonCount * (ranges.size() + 1)
+        || i + 1 == _nodes.size()) {
+      ranges.emplace_back(begin, i + 1);
+      begin = i + 1;
+    }
   }
-  stl_util::concat(front, back);
-  return front;
-}
 
-void BABYLON::CSG::Node::clipTo(BABYLON::CSG::Node& bsp)
-{
-  _polygons = bsp.clipPolygons(_polygons);
-  if (_front) {
-    _front->clipTo(bsp);
+  std::vector<PolygonArena> arenas(ranges.size(), PolygonArena(_arena));
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(ranges.size());
+  for (size_t r = 1; r < ranges.size(); ++r) {
+    jobs.emplace_back(std::async(std::launch::async, [this, &bsp, &ranges, &arenas, r]() {
+      _clipNodes(bsp, ranges[r].first, ranges[r].second, arenas[r]);
+    }));
+  }
+  _clipNodes(bsp, ranges[0].first, ranges[0].second, arenas[0]);
+  for (auto& job : jobs) {
+    job.get();
   }
-  if (_back) {
-    _back->clipTo(bsp);
+
+  // Move the polygon fragments to the shared arena
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    const auto offset = _arena->append(arenas[r]);
+    for (size_t i = ranges[r].first; i < ranges[r].second; ++i) {
+      for (auto& polygon : _nodes[i].polygons) {
+        if (polygon & PolygonArena::LocalFlag) {
+          polygon = (polygon & ~PolygonArena::LocalFlag) + offset;
+        }
+      }
+    }
   }
 }
 
-std::vector<BABYLON::CSG::Polygon> BABYLON::CSG::Node::allPolygons()
+std::vector<uint32_t> CSG::Node::allPolygons() const
 {
-  std::vector<Polygon> polygons = _polygons;
-  if (_front) {
-    polygons = stl_util::concat(polygons, _front->allPolygons());
+  std::vector<uint32_t> polygons;
+  if (_nodes.empty()) {
+    return polygons;
   }
-  if (_back) {
-    polygons = stl_util::concat(polygons, _back->allPolygons());
+
+  std::vector<int32_t> stack{0};
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    polygons.insert(polygons.end(), node.polygons.begin(), node.polygons.end());
+    if (node.back >= 0) {
+      stack.emplace_back(node.back);
+    }
+    if (node.front >= 0) {
+      stack.emplace_back(node.front);
+    }
   }
+
   return polygons;
 }
 
-void BABYLON::CSG::Node::build(
-  const std::vector<BABYLON::CSG::Polygon>& polygons)
+void CSG::Node::build(const std::vector<uint32_t>& polygons)
 {
   if (polygons.empty()) {
     return;
   }
-  if (!_plane) {
-    _plane = polygons[0].plane.second.cloneToNewObject();
-  }
-  std::vector<Polygon> front, back;
-  for (auto& polygon : polygons) {
-    _plane->splitPolygon(polygon, _polygons, _polygons, front, back);
+  if (_nodes.empty()) {
+    _nodes.emplace_back();
+    _nodes.back().plane = _arena->polygon(polygons[0]).plane;
   }
-  if (!front.empty()) {
-    if (!_front) {
-      _front = std::make_unique<Node>();
+
+  std::vector<uint32_t> front, back;
+  std::vector<uint32_t> buffer{polygons};
+  std::vector<BspTask> stack{{0, 0, polygons.size()}};
+
+  // Creates (if needed) the child node of a node and queue the polygons to filter down to it
+  const auto pushChild = [&](int32_t& child, const std::vector<uint32_t>& childPolygons) {
+    if (child < 0) {
+      child = static_cast<int32_t>(_nodes.size());
+      _BspNode node;
+      node.plane = _arena->polygon(childPolygons[0]).plane;
+      _nodes.emplace_back(std::move(node));
     }
-    _front->build(front);
-  }
-  if (!back.empty()) {
-    if (!_back) {
-      _back = std::make_unique<Node>();
+    stack.push_back({child, buffer.size(), childPolygons.size()});
+    buffer.insert(buffer.end(), childPolygons.begin(), childPolygons.end());
+  };
+
+  while (!stack.empty()) {
+    const auto task = stack.back();
+    stack.pop_back();
+    const auto index = static_cast<size_t>(task.node);
+
+    front.clear();
+    back.clear();
+    for (size_t i = task.offset; i < task.offset + task.count; ++i) {
+      auto& node = _nodes[index];
+      _arena->splitPolygon(node.plane, buffer[i], node.polygons, node.polygons, front, back);
+    }
+
+    // _nodes may grow when a child is created, children are linked by index
+    if (!front.empty()) {
+      auto child = _nodes[index].front;
+      pushChild(child, front);
+      _nodes[index].front = child;
+    }
+    if (!back.empty()) {
+      auto child = _nodes[index].back;
+      pushChild(child, back);
+      _nodes[index].back = child;
     }
-    _back->build(back);
   }
 }
 
@@ -0,0 +1,189 @@
+#include <babylon/meshes/csg/polygon_arena.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+CSG::PolygonArena::PolygonArena(const PolygonArena* parent)
+    : _parent{parent}, _flag{parent ? LocalFlag : 0u}
+{
+}
+
+CSG::PolygonArena::PolygonArena(const PolygonArena& other) = default;
+CSG::PolygonArena::PolygonArena(PolygonArena&& other)      = default;
+CSG::PolygonArena& CSG::PolygonArena::operator=(const PolygonArena& other) = default;
+CSG::PolygonArena& CSG::PolygonArena::operator=(PolygonArena&& other) = default;
+CSG::PolygonArena::~PolygonArena()                                    = default;
+
+size_t CSG::PolygonArena::size() const
+{
+  return _polygons.size();
+}
+
+void CSG::PolygonArena::reserve(size_t polygonCount, size_t vertexCount)
+{
+  _polygons.reserve(polygonCount);
+  _vertices.reserve(vertexCount);
+}
+
+bool CSG::PolygonArena::_isLocal(uint32_t index) const
+{
+  return !_parent || (index & LocalFlag);
+}
+
+bool CSG::PolygonArena::addPolygon(const Vertex* vertices, size_t count,
+                                   const PolygonOptions& shared, uint32_t& index)
+{
+  if (count < 3) {
+    return false;
+  }
+  auto plane = Plane::FromPoints(vertices[0].pos, vertices[1].pos, vertices[2].pos);
+  if (!plane.first) {
+    return false;
+  }
+  index = static_cast<uint32_t>(_polygons.size()) | _flag;
+  _polygons.emplace_back(ArenaPolygon{static_cast<uint32_t>(_vertices.size()),
+                                      static_cast<uint32_t>(count), shared, plane.second});
+  _vertices.insert(_vertices.end(), vertices, vertices + count);
+  return true;
+}
+
+uint32_t CSG::PolygonArena::append(const PolygonArena& other)
+{
+  const auto polygonOffset = static_cast<uint32_t>(_polygons.size());
+  const auto vertexOffset  = static_cast<uint32_t>(_vertices.size());
+  _polygons.reserve(_polygons.size() + other._polygons.size());
+  for (const auto& polygon : other._polygons) {
+    _polygons.emplace_back(polygon);
+    _polygons.back().firstVertex += vertexOffset;
+  }
+  _vertices.insert(_vertices.end(), other._vertices.begin(), other._vertices.end());
+  return polygonOffset;
+}
+
+CSG::PolygonArena CSG::PolygonArena::extract(const std::vector<uint32_t>& indices) const
+{
+  size_t vertexCount = 0;
+  for (auto index : indices) {
+    vertexCount += polygon(index).vertexCount;
+  }
+  PolygonArena arena;
+  arena.reserve(indices.size(), vertexCount);
+  for (auto index : indices) {
+    const auto& source = polygon(index);
+    const auto* first  = vertices(index);
+    arena._polygons.emplace_back(source);
+    arena._polygons.back().firstVertex = static_cast<uint32_t>(arena._vertices.size());
+    arena._vertices.insert(arena._vertices.end(), first, first + source.vertexCount);
+  }
+  return arena;
+}
+
+const CSG::ArenaPolygon& CSG::PolygonArena::polygon(uint32_t index) const
+{
+  return _isLocal(index) ? _polygons[index & ~_flag] : _parent->polygon(index);
+}
+
+const CSG::Vertex* CSG::PolygonArena::vertices(uint32_t index) const
+{
+  return _isLocal(index) ? _vertices.data() + _polygons[index & ~_flag].firstVertex :
+                           _parent->vertices(index);
+}
+
+void CSG::PolygonArena::flip(uint32_t index)
+{
+  auto& polygon = _polygons[index & ~_flag];
+  auto first    = _vertices.begin() + polygon.firstVertex;
+  auto last     = first + polygon.vertexCount;
+  std::reverse(first, last);
+  for (auto it = first; it != last; ++it) {
+    it->flip();
+  }
+  polygon.plane.flip();
+}
+
+void CSG::PolygonArena::flipAll()
+{
+  for (uint32_t i = 0; i < _polygons.size(); ++i) {
+    flip(i);
+  }
+}
+
+void CSG::PolygonArena::splitPolygon(const Plane& plane, uint32_t index,
+                                     std::vector<uint32_t>& coplanarFront,
+                                     std::vector<uint32_t>& coplanarBack,
+                                     std::vector<uint32_t>& front, std::vector<uint32_t>& back)
+{
+  const auto& source       = polygon(index);
+  const auto* sourceVertex = vertices(index);
+  const auto vertexCount   = source.vertexCount;
+
+  // Classify each point as well as the entire polygon into one of the four classes
+  int polygonType = 0;
+  _types.resize(vertexCount);
+  for (uint32_t i = 0; i < vertexCount; ++i) {
+    const float t = Vector3::Dot(plane.normal, sourceVertex[i].pos) - plane.w;
+    const int type
+      = (t < -Plane::EPSILON) ? Plane::BACK : (t > Plane::EPSILON) ? Plane::FRONT : Plane::COPLANAR;
+    polygonType |= type;
+    _types[i] = type;
+  }
+
+  // Put the polygon in the correct list, splitting it when necessary
+  switch (polygonType) {
+    case Plane::COPLANAR:
+      (Vector3::Dot(plane.normal, source.plane.normal) > 0 ? coplanarFront : coplanarBack)
+        .emplace_back(index);
+      break;
+    case Plane::FRONT:
+      front.emplace_back(index);
+      break;
+    case Plane::BACK:
+      back.emplace_back(index);
+      break;
+    default: {
+      _front.clear();
+      _back.clear();
+      for (uint32_t i = 0; i < vertexCount; ++i) {
+        const uint32_t j = (i + 1) % vertexCount;
+        const int ti = _types[i], tj = _types[j];
+        const auto& vi = sourceVertex[i];
+        const auto& vj = sourceVertex[j];
+        if (ti != Plane::BACK) {
+          _front.emplace_back(vi);
+        }
+        if (ti != Plane::FRONT) {
+          _back.emplace_back(vi);
+        }
+        if ((ti | tj) == Plane::SPANNING) {
+          const float t = (plane.w - Vector3::Dot(plane.normal, vi.pos))
+                          / Vector3::Dot(plane.normal, vj.pos.subtract(vi.pos));
+          auto v = Vertex(vi).interpolate(vj, t);
+          _front.emplace_back(v);
+          _back.emplace_back(std::move(v));
+        }
+      }
+      // The source may live in this arena: it is no longer accessed once the fragments have been
+      // gathered in the scratch buffers
+      const auto shared = source.shared;
+      uint32_t fragment = 0;
+      if (addPolygon(_front.data(), _front.size(), shared, fragment)) {
+        front.emplace_back(fragment);
+      }
+      if (addPolygon(_back.data(), _back.size(), shared, fragment)) {
+        back.emplace_back(fragment);
+      }
+    } break;
+  }
+}
+
+CSG::Polygon CSG::PolygonArena::toPolygon(uint32_t index) const
+{
+  const auto& source = polygon(index);
+  const auto* first  = vertices(index);
+  Polygon result(std::vector<Vertex>(first, first + source.vertexCount), source.shared);
+  result.plane = std::make_pair(true, source.plane);
+  return result;
+}
+
+} // end of namespace BABYLON
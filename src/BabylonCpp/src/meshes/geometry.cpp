@@ -263,6 +263,40 @@ AbstractMesh* Geometry::updateVerticesData(const std::string& kind, const Float3
   return nullptr;
 }
 
+void Geometry::markRange(const std::string& kind, size_t start, size_t count, bool updateExtends)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+
+  if (!vertexBuffer || count == 0) {
+    return;
+  }
+
+  vertexBuffer->markRange(start, count);
+
+  if (kind == VertexBuffer::PositionKind) {
+    _resetPointsArrayCache();
+    if (updateExtends && !(useBoundingInfoFromGeometry && _boundingInfo)) {
+      // Growing the extends only needs the modified vertices
+      const auto& data = vertexBuffer->getData();
+      const auto tightlyPacked
+        = vertexBuffer->byteOffset == 0 && vertexBuffer->byteStride == 3 * sizeof(float);
+      if (_extend && tightlyPacked && (start + count) * 3 <= data.size()) {
+        const auto range = extractMinAndMax(data, start, count, boundingBias(), 3);
+        _extend->min.minimizeInPlace(range.min);
+        _extend->max.maximizeInPlace(range.max);
+      }
+      else {
+        _updateExtend(Float32Array());
+      }
+      _updateMeshesBoundingInfo();
+    }
+  }
+
+  if (onGeometryUpdated) {
+    onGeometryUpdated(this, kind);
+  }
+}
+
 void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
 {
   if (updateExtends) {
@@ -272,17 +306,22 @@ void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
   _resetPointsArrayCache();
 
   if (updateExtends) {
-    for (const auto& mesh : _meshes) {
-      if (mesh->_boundingInfo) {
-        mesh->_boundingInfo->reConstruct(extend().min, extend().max);
-      }
-      else {
-        mesh->_boundingInfo = std::make_unique<BoundingInfo>(extend().min, extend().max);
-      }
+    _updateMeshesBoundingInfo();
+  }
+}
 
-      for (const auto& subMesh : mesh->subMeshes) {
-        subMesh->refreshBoundingInfo();
-      }
+void Geometry::_updateMeshesBoundingInfo()
+{
+  for (const auto& mesh : _meshes) {
+    if (mesh->_boundingInfo) {
+      mesh->_boundingInfo->reConstruct(extend().min, extend().max);
+    }
+    else {
+      mesh->_boundingInfo = std::make_unique<BoundingInfo>(extend().min, extend().max);
+    }
+
+    for (const auto& subMesh : mesh->subMeshes) {
+      subMesh->refreshBoundingInfo();
     }
   }
 }
@@ -303,6 +342,13 @@ void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
     return;
   }
 
+  // Uploads the ranges marked as modified since the last bind
+  for (const auto& item : vbs) {
+    if (item.second) {
+      item.second->_uploadDirtyRanges();
+    }
+  }
+
   if (indexToBind != _indexBuffer /*|| _vertexArrayObjects.empty()*/) {
     _engine->bindBuffers(vbs, indexToBind, effect);
     return;
@@ -424,6 +470,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset, bool gpuMe
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _trackMemory();
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -445,6 +492,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVert
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _trackMemory();
   if (!_meshes.empty()) {
     _indexBuffer = _engine->createIndexBuffer(_indices, updatable);
   }
@@ -550,7 +598,7 @@ void Geometry::applyToMesh(Mesh* mesh)
   }
 }
 
-void Geometry::_updateExtend(Float32Array data)
+void Geometry::_updateExtend(const Float32Array& data)
 {
   if (useBoundingInfoFromGeometry && _boundingInfo) {
     _extend = MinMax{
@@ -560,10 +608,12 @@ void Geometry::_updateExtend(Float32Array data)
   }
   else {
     if (data.empty()) {
-      data = getVerticesData(VertexBuffer::PositionKind);
+      _extend = extractMinAndMax(getVerticesData(VertexBuffer::PositionKind), 0, _totalVertices,
+                                 boundingBias(), 3);
+    }
+    else {
+      _extend = extractMinAndMax(data, 0, _totalVertices, boundingBias(), 3);
     }
-
-    _extend = extractMinAndMax(data, 0, _totalVertices, boundingBias(), 3);
   }
 }
 
@@ -711,6 +761,7 @@ bool Geometry::_generatePointsArray()
   _positionsCache.resize(data.size() / 3);
 
   _positions = _positionsCache;
+  _trackMemory();
 
   return true;
 }
@@ -730,6 +781,12 @@ void Geometry::_disposeVertexArrayObjects()
   }
 }
 
+void Geometry::_trackMemory()
+{
+  _trackedMemory.set(_indices.capacity() * sizeof(IndicesArray::value_type)
+                     + (_positions.capacity() + _positionsCache.capacity()) * sizeof(Vector3));
+}
+
 void Geometry::dispose()
 {
   for (const auto& mesh : _meshes) {
@@ -751,6 +808,12 @@ void Geometry::dispose()
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _indices.shrink_to_fit();
+  _positions.clear();
+  _positions.shrink_to_fit();
+  _positionsCache.clear();
+  _positionsCache.shrink_to_fit();
+  _trackMemory();
 
   delayLoadState = Constants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
@@ -902,7 +965,8 @@ void Geometry::_ImportGeometry(const json& parsedGeometry, const MeshPtr& mesh)
 
     if (json_util::has_key(parsedGeometry, "matricesIndices")
         && !json_util::is_null(parsedGeometry["matricesIndices"])) {
-      auto matricesIndices = json_util::get_array<float>(parsedGeometry, "matricesIndices");
+      // Packed indices, read as integers as a float cannot hold the 4 bytes exactly
+      auto matricesIndices = json_util::get_array<uint32_t>(parsedGeometry, "matricesIndices");
       Float32Array floatIndices;
 
       for (auto matricesIndice : matricesIndices) {
@@ -921,7 +985,7 @@ void Geometry::_ImportGeometry(const json& parsedGeometry, const MeshPtr& mesh)
     if (json_util::has_key(parsedGeometry, "matricesIndicesExtra")
         && !json_util::is_null(parsedGeometry["matricesIndicesExtra"])) {
       auto matricesIndicesExtra
-        = json_util::get_array<float>(parsedGeometry, "matricesIndicesExtra");
+        = json_util::get_array<uint32_t>(parsedGeometry, "matricesIndicesExtra");
       Float32Array floatIndices;
 
       for (auto i : matricesIndicesExtra) {
@@ -1,5 +1,8 @@
 ﻿#include <babylon/meshes/sub_mesh.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
@@ -56,6 +59,7 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/file_tools.h>
@@ -106,6 +110,7 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , areNormalsFrozen{this, &Mesh::get_areNormalsFrozen}
     , overridenInstanceCount{this, &Mesh::set_overridenInstanceCount}
     , thinInstanceEnablePicking{false}
+    , thinInstanceEnableCulling{false}
     , thinInstanceCount{this, &Mesh::get_thinInstanceCount, &Mesh::set_thinInstanceCount}
     , _instanceDataStorage{std::make_unique<_InstanceDataStorage>()}
     , _internalMeshDataInfo{std::make_unique<_InternalMeshDataInfo>()}
@@ -474,6 +479,20 @@ Mesh& Mesh::addLODLevel(float distance, const MeshPtr& mesh)
   return *this;
 }
 
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings,
+                     bool parallelProcessing, SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
+{
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.parallelProcessing = parallelProcessing;
+  task.mesh               = shared_from_base<Mesh>();
+  task.simplificationType = simplificationType;
+  task.successCallback    = successCallback;
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
+}
+
 MeshPtr Mesh::getLODLevelAtDistance(float distance)
 {
   auto& _LODLevels = _internalMeshDataInfo->_LODLevels;
@@ -767,7 +786,9 @@ void Mesh::set_thinInstanceCount(size_t value)
   const auto numMaxInstances = (_thinInstanceDataStorage->matrixData.size()) / 16;
 
   if (value <= numMaxInstances) {
-    _thinInstanceDataStorage->instancesCount = value;
+    _thinInstanceRestoreBuffers();
+    _thinInstanceDataStorage->instancesCount   = value;
+    _thinInstanceDataStorage->cullingDataDirty = true;
   }
 }
 
@@ -1179,7 +1200,8 @@ _InstancesBatchPtr Mesh::_getInstancesRenderList(size_t subMeshId, bool isReplac
   batchCache->mustReturn         = false;
   batchCache->renderSelf[subMeshId]
     = isReplacementMode || (!onlyForInstances && isEnabled() && isVisible);
-  batchCache->visibleInstances[subMeshId] = std::vector<InstancedMesh*>();
+  // Cleared rather than replaced, the batch vectors keep their capacity from frame to frame
+  batchCache->visibleInstances[subMeshId].clear();
 
   if (_instanceDataStorage->visibleInstances && !isReplacementMode) {
     auto& visibleInstances = _instanceDataStorage->visibleInstances;
@@ -1195,19 +1217,53 @@ _InstancesBatchPtr Mesh::_getInstancesRenderList(size_t subMeshId, bool isReplac
     }
   }
 
+  // Meshes batched by the scene automatic instancing are only drawn by the main rendering pass,
+  // render targets draw them individually
+  batchCache->renderAutoInstances = !isReplacementMode && !isInIntermediateRendering
+                                    && !_instanceDataStorage->autoInstances.empty();
+
   if (subMeshId >= batchCache->hardwareInstancedRendering.size()) {
     batchCache->hardwareInstancedRendering.resize(subMeshId + 1);
   }
 
   batchCache->hardwareInstancedRendering[subMeshId]
     = !isReplacementMode && _instanceDataStorage->hardwareInstancedRendering
-      && (batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
-      && (!batchCache->visibleInstances[subMeshId].empty());
+      && (((batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
+           && (!batchCache->visibleInstances[subMeshId].empty()))
+          || batchCache->renderAutoInstances);
   _instanceDataStorage->previousBatch = batchCache;
 
   return batchCache;
 }
 
+bool Mesh::_canBeAutoInstanced()
+{
+  if (type() != Type::MESH || subMeshes.size() != 1 || !_geometry || isAnInstance()
+      || hasInstances() || hasThinInstances() || skeleton() || morphTargetManager()
+      || !getLODLevels().empty() || edgesRenderer() || renderOutline() || renderOverlay()
+      || occlusionType() != AbstractMesh::OCCLUSION_TYPE_NONE || visibility() < 1.f) {
+    return false;
+  }
+
+  // The instance storage must be driven by the batch
+  const auto& instanceStorage = *_instanceDataStorage;
+  if (!instanceStorage.hardwareInstancedRendering || instanceStorage.isFrozen
+      || instanceStorage.manualUpdate) {
+    return false;
+  }
+
+  // The render observers of the batched meshes would not be notified
+  if (_internalMeshDataInfo->_onBeforeRenderObservable.hasObservers()
+      || _internalMeshDataInfo->_onAfterRenderObservable.hasObservers()
+      || _internalMeshDataInfo->_onBeforeDrawObservable.hasObservers()) {
+    return false;
+  }
+
+  // Transparent meshes are sorted by distance
+  const auto material = subMeshes[0]->getMaterial();
+  return material && !material->needAlphaBlendingForMesh(*this);
+}
+
 Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
                                  const _InstancesBatchPtr& batch, const EffectPtr& effect,
                                  Engine* engine)
@@ -1216,15 +1272,17 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
     return *this;
   }
 
-  auto& visibleInstances = batch->visibleInstances[subMesh->_id];
-  if (visibleInstances.empty()) {
+  auto& visibleInstances        = batch->visibleInstances[subMesh->_id];
+  const auto& autoInstances     = _instanceDataStorage->autoInstances;
+  const auto autoInstancesCount = batch->renderAutoInstances ? autoInstances.size() : 0;
+  if (visibleInstances.empty() && autoInstancesCount == 0) {
     return *this;
   }
 
   auto& instanceStorage           = _instanceDataStorage;
   auto currentInstancesBufferSize = instanceStorage->instancesBufferSize;
   auto& instancesBuffer           = instanceStorage->instancesBuffer;
-  size_t matricesCount            = visibleInstances.size() + 1;
+  size_t matricesCount            = visibleInstances.size() + autoInstancesCount + 1;
   size_t bufferSize               = matricesCount * 16 * 4;
 
   while (instanceStorage->instancesBufferSize < bufferSize) {
@@ -1259,9 +1317,16 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
         ++instancesCount;
       }
     }
+
+    for (size_t i = 0; i < autoInstancesCount; ++i) {
+      autoInstances[i]->getWorldMatrix().copyToArray(instanceStorage->instancesData, offset);
+      offset += 16;
+      ++instancesCount;
+    }
   }
   else {
-    instancesCount = (renderSelf ? 1 : 0) + static_cast<unsigned int>(visibleInstances.size());
+    instancesCount = (renderSelf ? 1 : 0)
+                     + static_cast<unsigned int>(visibleInstances.size() + autoInstancesCount);
   }
 
   if (needUpdateBuffer) {
@@ -1330,6 +1395,7 @@ size_t Mesh::thinInstanceAddSelf(bool refresh)
 
 void Mesh::thinInstanceRegisterAttribute(const std::string& kind, unsigned int stride)
 {
+  _thinInstanceRestoreBuffers();
   removeVerticesData(kind);
 
   _thinInstanceInitializeUserStorage();
@@ -1403,7 +1469,10 @@ void Mesh::thinInstanceSetBuffer(const std::string& kind, const Float32Array& bu
 {
   stride = (stride == 0) ? 16u : stride;
 
+  _thinInstanceRestoreBuffers();
+
   if (kind == "matrix") {
+    _thinInstanceDataStorage->cullingDataDirty = true;
     if (_thinInstanceDataStorage->matrixBuffer) {
       _thinInstanceDataStorage->matrixBuffer->dispose();
       _thinInstanceDataStorage->matrixBuffer = nullptr;
@@ -1464,7 +1533,10 @@ void Mesh::thinInstanceSetBuffer(const std::string& kind, const Float32Array& bu
 
 void Mesh::thinInstanceBufferUpdated(const std::string& kind)
 {
+  _thinInstanceRestoreBuffers();
+
   if (kind == "matrix") {
+    _thinInstanceDataStorage->cullingDataDirty = true;
     if (_thinInstanceDataStorage->matrixBuffer) {
       _thinInstanceDataStorage->matrixBuffer->updateDirectly(
         _thinInstanceDataStorage->matrixData, 0, _thinInstanceDataStorage->instancesCount);
@@ -1481,7 +1553,10 @@ void Mesh::thinInstanceBufferUpdated(const std::string& kind)
 void Mesh::thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
                                            size_t offset)
 {
+  _thinInstanceRestoreBuffers();
+
   if (kind == "matrix") {
+    _thinInstanceDataStorage->cullingDataDirty = true;
     if (_thinInstanceDataStorage->matrixBuffer) {
       _thinInstanceDataStorage->matrixBuffer->updateDirectly(data, offset);
     }
@@ -1493,15 +1568,17 @@ void Mesh::thinInstancePartialBufferUpdate(const std::string& kind, const Float3
   }
 }
 
-std::vector<Matrix> Mesh::thinInstanceGetWorldMatrices()
+std::vector<Matrix>& Mesh::thinInstanceGetWorldMatrices()
 {
   if (_thinInstanceDataStorage->matrixData.empty() || !_thinInstanceDataStorage->matrixBuffer) {
-    return {};
+    _thinInstanceDataStorage->worldMatrices = std::vector<Matrix>();
+    return *_thinInstanceDataStorage->worldMatrices;
   }
   const auto& matrixData = _thinInstanceDataStorage->matrixData;
 
   if (!_thinInstanceDataStorage->worldMatrices) {
     _thinInstanceDataStorage->worldMatrices = std::vector<Matrix>();
+    _thinInstanceDataStorage->worldMatrices->reserve(_thinInstanceDataStorage->instancesCount);
 
     for (unsigned int i = 0; i < _thinInstanceDataStorage->instancesCount; ++i) {
       _thinInstanceDataStorage->worldMatrices->emplace_back(Matrix::FromArray(matrixData, i * 16));
@@ -1511,6 +1588,13 @@ std::vector<Matrix> Mesh::thinInstanceGetWorldMatrices()
   return *_thinInstanceDataStorage->worldMatrices;
 }
 
+size_t Mesh::thinInstanceGetVisibleCount() const
+{
+  const auto& storage = *_thinInstanceDataStorage;
+  return (thinInstanceEnableCulling && storage.cullingPlanesSet) ? storage.visibleInstances.size() :
+                                                                    storage.instancesCount;
+}
+
 void Mesh::thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo)
 {
   if (_thinInstanceDataStorage->matrixData.empty() || !_thinInstanceDataStorage->matrixBuffer) {
@@ -1556,6 +1640,8 @@ void Mesh::_thinInstanceUpdateBufferSize(const std::string& kind, size_t numInst
 {
   const auto kindIsMatrix = kind == "matrix";
 
+  _thinInstanceRestoreBuffers();
+
   if (!kindIsMatrix
       && (!_userThinInstanceBuffersStorage
           || !stl_util::contains(_userThinInstanceBuffersStorage->strides, kind)
@@ -1590,7 +1676,9 @@ void Mesh::_thinInstanceUpdateBufferSize(const std::string& kind, size_t numInst
     }
 
     if (kindIsMatrix) {
-      _thinInstanceDataStorage->matrixBuffer->dispose();
+      if (_thinInstanceDataStorage->matrixBuffer) {
+        _thinInstanceDataStorage->matrixBuffer->dispose();
+      }
 
       const auto matrixBuffer
         = std::make_shared<Buffer>(getEngine(), data, true, stride, false, true);
@@ -1627,9 +1715,19 @@ void Mesh::_thinInstanceInitializeUserStorage()
 void Mesh::_renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode,
                                     const EffectPtr& effect, Engine* engine)
 {
-  // Stats
-  const auto instancesCount = _thinInstanceDataStorage->instancesCount;
+  size_t instancesCount = 0;
+  if (thinInstanceEnableCulling) {
+    instancesCount = _thinInstanceCull();
+    if (instancesCount == 0) {
+      return;
+    }
+  }
+  else {
+    _thinInstanceRestoreBuffers();
+    instancesCount = _thinInstanceDataStorage->instancesCount;
+  }
 
+  // Stats
   getScene()->_activeIndices.addCount(subMesh->indexCount * instancesCount, false);
 
   // Draw
@@ -1639,6 +1737,241 @@ void Mesh::_renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode,
   engine->unbindInstanceAttributes();
 }
 
+namespace {
+
+// Number of consecutive thin instances tested at once against the frustum
+constexpr size_t ThinInstanceClusterSize = 64;
+
+// Returns -1 when the sphere is outside of the frustum, 1 when it is inside and 0 otherwise
+int classifySphere(const std::array<float, 24>& planes, float x, float y, float z, float radius)
+{
+  auto result = 1;
+  for (size_t p = 0; p < planes.size(); p += 4) {
+    const auto distance = planes[p] * x + planes[p + 1] * y + planes[p + 2] * z + planes[p + 3];
+    if (distance <= -radius) {
+      return -1;
+    }
+    if (distance < radius) {
+      result = 0;
+    }
+  }
+  return result;
+}
+
+// Branchless plane tests of a run of spheres, vectorized by the compiler
+void cullSpheres(const std::array<float, 24>& planes, const float* xs, const float* ys,
+                 const float* zs, const float* radii, size_t count, uint8_t* visible)
+{
+  std::fill(visible, visible + count, uint8_t{1});
+  for (size_t p = 0; p < planes.size(); p += 4) {
+    const auto a = planes[p], b = planes[p + 1], c = planes[p + 2], d = planes[p + 3];
+    for (size_t i = 0; i < count; ++i) {
+      visible[i] &= static_cast<uint8_t>(a * xs[i] + b * ys[i] + c * zs[i] + d > -radii[i]);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+size_t Mesh::_thinInstanceCull()
+{
+  auto& storage = *_thinInstanceDataStorage;
+  auto scene    = getScene();
+
+  // Render targets and shadow maps see other parts of the scene than the camera frustum
+  auto canCull = !scene->_isInIntermediateRendering() && storage.matrixBuffer
+                 && storage.matrixBuffer->isUpdatable();
+  if (canCull && _userThinInstanceBuffersStorage) {
+    for (const auto& item : _userThinInstanceBuffersStorage->vertexBuffers) {
+      canCull = canCull && item.second && item.second->isUpdatable();
+    }
+  }
+  if (!canCull) {
+    _thinInstanceRestoreBuffers();
+    return storage.instancesCount;
+  }
+
+  _thinInstanceUpdateCullingData();
+
+  std::array<float, 24> planes{};
+  const auto& frustumPlanes = scene->frustumPlanes();
+  for (size_t p = 0; p < frustumPlanes.size(); ++p) {
+    planes[p * 4 + 0] = frustumPlanes[p].normal.x;
+    planes[p * 4 + 1] = frustumPlanes[p].normal.y;
+    planes[p * 4 + 2] = frustumPlanes[p].normal.z;
+    planes[p * 4 + 3] = frustumPlanes[p].d;
+  }
+
+  if (!storage.cullingPlanesSet || planes != storage.cullingPlanes) {
+    storage.cullingPlanes    = planes;
+    storage.cullingPlanesSet = true;
+    std::swap(storage.visibleInstances, storage.previousVisibleInstances);
+
+    auto& visibleInstances = storage.visibleInstances;
+    auto& mask             = storage.cullingMask;
+    visibleInstances.clear();
+    mask.resize(ThinInstanceClusterSize);
+    const auto count = storage.instancesCount;
+    for (size_t start = 0, cluster = 0; start < count;
+         start += ThinInstanceClusterSize, cluster += 4) {
+      const auto end         = std::min(start + ThinInstanceClusterSize, count);
+      const auto* sphere     = &storage.clusterSpheres[cluster];
+      const auto containment = classifySphere(planes, sphere[0], sphere[1], sphere[2], sphere[3]);
+      if (containment < 0) {
+        continue;
+      }
+      if (containment > 0) {
+        for (auto i = start; i < end; ++i) {
+          visibleInstances.emplace_back(static_cast<uint32_t>(i));
+        }
+        continue;
+      }
+      cullSpheres(planes, &storage.sphereCentersX[start], &storage.sphereCentersY[start],
+                  &storage.sphereCentersZ[start], &storage.sphereRadii[start], end - start,
+                  mask.data());
+      for (auto i = start; i < end; ++i) {
+        if (mask[i - start]) {
+          visibleInstances.emplace_back(static_cast<uint32_t>(i));
+        }
+      }
+    }
+
+    if (storage.gpuDataCompacted && visibleInstances == storage.previousVisibleInstances) {
+      return visibleInstances.size();
+    }
+  }
+  else if (storage.gpuDataCompacted) {
+    return storage.visibleInstances.size();
+  }
+
+  // Pack the visible instances at the start of the gpu buffers
+  const auto& visibleInstances = storage.visibleInstances;
+  if (!visibleInstances.empty()) {
+    auto& compacted = storage.compactedMatrixData;
+    compacted.resize(storage.matrixData.size());
+    for (size_t i = 0; i < visibleInstances.size(); ++i) {
+      std::memcpy(&compacted[i * 16], &storage.matrixData[size_t{visibleInstances[i]} * 16],
+                  16 * sizeof(float));
+    }
+    storage.matrixBuffer->updateDirectly(compacted, 0, visibleInstances.size());
+
+    if (_userThinInstanceBuffersStorage) {
+      auto& userStorage = *_userThinInstanceBuffersStorage;
+      for (const auto& [kind, vertexBuffer] : userStorage.vertexBuffers) {
+        const auto stride   = userStorage.strides[kind];
+        const auto& data    = userStorage.data[kind];
+        auto& compactedData = userStorage.compactedData[kind];
+        compactedData.resize(data.size());
+        for (size_t i = 0; i < visibleInstances.size(); ++i) {
+          std::memcpy(&compactedData[i * stride], &data[size_t{visibleInstances[i]} * stride],
+                      stride * sizeof(float));
+        }
+        vertexBuffer->updateDirectly(compactedData, 0);
+      }
+    }
+  }
+  storage.gpuDataCompacted = true;
+
+  return visibleInstances.size();
+}
+
+void Mesh::_thinInstanceUpdateCullingData()
+{
+  auto& storage     = *_thinInstanceDataStorage;
+  const auto& world = getWorldMatrix();
+  if (!storage.cullingDataDirty && storage.cullingWorldMatrixFlag == world.updateFlag) {
+    return;
+  }
+  storage.cullingDataDirty       = false;
+  storage.cullingWorldMatrixFlag = world.updateFlag;
+  storage.cullingPlanesSet       = false;
+
+  // Bounding box of the mesh, before being extended to the thin instances
+  auto center  = getBoundingInfo()->boundingBox.center;
+  auto extents = getBoundingInfo()->boundingBox.extendSize;
+  Vector3 minimum, maximum;
+  if (!storage.boundingVectors.empty()) {
+    minimum.setAll(std::numeric_limits<float>::max());
+    maximum.setAll(std::numeric_limits<float>::lowest());
+    for (const auto& vector : storage.boundingVectors) {
+      minimum.minimizeInPlace(vector);
+      maximum.maximizeInPlace(vector);
+    }
+    center  = minimum.add(maximum).scale(0.5f);
+    extents = maximum.subtract(minimum).scale(0.5f);
+  }
+
+  // World space bounding sphere of each instance, enclosing its transformed bounding box
+  const auto count = storage.instancesCount;
+  storage.sphereCentersX.resize(count);
+  storage.sphereCentersY.resize(count);
+  storage.sphereCentersZ.resize(count);
+  storage.sphereRadii.resize(count);
+  auto& instanceWorld = TmpVectors::MatrixArray[0];
+  for (size_t i = 0; i < count; ++i) {
+    Matrix::FromArrayToRef(storage.matrixData, static_cast<unsigned int>(i * 16),
+                           TmpVectors::MatrixArray[1]);
+    TmpVectors::MatrixArray[1].multiplyToRef(world, instanceWorld);
+    const auto& m = instanceWorld.m();
+
+    storage.sphereCentersX[i] = center.x * m[0] + center.y * m[4] + center.z * m[8] + m[12];
+    storage.sphereCentersY[i] = center.x * m[1] + center.y * m[5] + center.z * m[9] + m[13];
+    storage.sphereCentersZ[i] = center.x * m[2] + center.y * m[6] + center.z * m[10] + m[14];
+    const auto x = extents.x * std::abs(m[0]) + extents.y * std::abs(m[4])
+                   + extents.z * std::abs(m[8]);
+    const auto y = extents.x * std::abs(m[1]) + extents.y * std::abs(m[5])
+                   + extents.z * std::abs(m[9]);
+    const auto z = extents.x * std::abs(m[2]) + extents.y * std::abs(m[6])
+                   + extents.z * std::abs(m[10]);
+
+    storage.sphereRadii[i] = std::sqrt(x * x + y * y + z * z);
+  }
+
+  // Bounding sphere of each cluster of instances
+  const auto clusterCount = (count + ThinInstanceClusterSize - 1) / ThinInstanceClusterSize;
+  storage.clusterSpheres.resize(clusterCount * 4);
+  for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+    const auto start = cluster * ThinInstanceClusterSize;
+    const auto end   = std::min(start + ThinInstanceClusterSize, count);
+    minimum.setAll(std::numeric_limits<float>::max());
+    maximum.setAll(std::numeric_limits<float>::lowest());
+    for (auto i = start; i < end; ++i) {
+      const auto radius = storage.sphereRadii[i];
+      minimum.x         = std::min(minimum.x, storage.sphereCentersX[i] - radius);
+      minimum.y         = std::min(minimum.y, storage.sphereCentersY[i] - radius);
+      minimum.z         = std::min(minimum.z, storage.sphereCentersZ[i] - radius);
+      maximum.x         = std::max(maximum.x, storage.sphereCentersX[i] + radius);
+      maximum.y         = std::max(maximum.y, storage.sphereCentersY[i] + radius);
+      maximum.z         = std::max(maximum.z, storage.sphereCentersZ[i] + radius);
+    }
+    auto* sphere = &storage.clusterSpheres[cluster * 4];
+    sphere[0]    = (minimum.x + maximum.x) * 0.5f;
+    sphere[1]    = (minimum.y + maximum.y) * 0.5f;
+    sphere[2]    = (minimum.z + maximum.z) * 0.5f;
+    sphere[3]    = Vector3::Distance(minimum, maximum) * 0.5f;
+  }
+}
+
+void Mesh::_thinInstanceRestoreBuffers()
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (!storage.gpuDataCompacted) {
+    return;
+  }
+  storage.gpuDataCompacted = false;
+
+  if (storage.matrixBuffer) {
+    storage.matrixBuffer->updateDirectly(storage.matrixData, 0, storage.instancesCount);
+  }
+  if (_userThinInstanceBuffersStorage) {
+    for (const auto& [kind, vertexBuffer] : _userThinInstanceBuffersStorage->vertexBuffers) {
+      if (vertexBuffer) {
+        vertexBuffer->updateDirectly(_userThinInstanceBuffersStorage->data[kind], 0);
+      }
+    }
+  }
+}
+
 void Mesh::registerInstancedBuffer(const std::string& kind, size_t stride)
 {
   // Remove existing one
@@ -3054,7 +3387,8 @@ void Mesh::_syncGeometryWithMorphTargetManager()
   _markSubMeshesAsAttributesDirty();
 
   auto iMorphTargetManager = _internalMeshDataInfo->_morphTargetManager;
-  if (iMorphTargetManager && iMorphTargetManager->vertexCount()) {
+  const auto cpuMorphing   = iMorphTargetManager && iMorphTargetManager->enableCpuMorphing();
+  if (iMorphTargetManager && iMorphTargetManager->vertexCount() && !cpuMorphing) {
     if (iMorphTargetManager->vertexCount() != getTotalVertices()) {
       BABYLON_LOG_ERROR("Mesh",
                         "Mesh is incompatible with morph targets. Targets and "
@@ -3114,6 +3448,20 @@ void Mesh::_syncGeometryWithMorphTargetManager()
       indexStr = std::to_string(index);
     }
   }
+
+  // Morphing on the CPU writes the blended shape in the buffers, restored when it stops
+  auto& internalDataInfo = *_internalMeshDataInfo;
+  if (cpuMorphing) {
+    iMorphTargetManager->_applyToMesh(*this);
+    internalDataInfo._cpuMorphed = true;
+  }
+  else if (internalDataInfo._cpuMorphed && !internalDataInfo._sourcePositions.empty()) {
+    internalDataInfo._cpuMorphed = false;
+    updateVerticesData(VertexBuffer::PositionKind, internalDataInfo._sourcePositions);
+    if (!internalDataInfo._sourceNormals.empty()) {
+      updateVerticesData(VertexBuffer::NormalKind, internalDataInfo._sourceNormals);
+    }
+  }
 }
 
 std::vector<Vector3> Mesh::createInnerPoints(size_t pointsNb)
@@ -32,8 +32,12 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
-    scene->simplificationQueue()->executeNext();
+  const auto& simplificationQueue = scene->simplificationQueue();
+  if (simplificationQueue) {
+    simplificationQueue->processCompletedTasks();
+    if (!simplificationQueue->running) {
+      simplificationQueue->executeNext();
+    }
   }
 }
 
@@ -2,13 +2,14 @@
 
 namespace BABYLON {
 
-DecimationTriangle::DecimationTriangle(const std::vector<DecimationVertex>& iVertices)
-    : vertices{iVertices}
+DecimationTriangle::DecimationTriangle(const std::array<size_t, 3>& iVertices)
+    : error{{0.f, 0.f, 0.f, 0.f}}, vertices{iVertices}
 {
-  deleted       = false;
-  isDirty       = false;
-  deletePending = false;
-  borderFactor  = 0;
+  deleted        = false;
+  isDirty        = false;
+  deletePending  = false;
+  borderFactor   = 0;
+  originalOffset = 0;
 }
 
 DecimationTriangle::~DecimationTriangle() = default;
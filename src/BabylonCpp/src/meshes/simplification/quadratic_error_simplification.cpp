@@ -0,0 +1,781 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
+#include <babylon/meshes/simplification/reference.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct EdgeCollapse {
+  float error;
+  size_t v0;
+  size_t v1;
+  uint32_t version0;
+  uint32_t version1;
+}; // end of struct EdgeCollapse
+
+struct EdgeCollapseCompare {
+  bool operator()(const EdgeCollapse& a, const EdgeCollapse& b) const
+  {
+    return a.error > b.error;
+  }
+}; // end of struct EdgeCollapseCompare
+
+constexpr auto InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : maximumError{std::numeric_limits<float>::max()}, _mesh{mesh}
+{
+  _positions               = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto totalVertices = _positions.size() / 3;
+  if (totalVertices == 0) {
+    return;
+  }
+
+  // Attributes interpolated along the collapsed edges
+  static const std::array<std::pair<const char*, bool>, 9> attributeKinds{{
+    {VertexBuffer::NormalKind, true},  //
+    {VertexBuffer::TangentKind, true}, //
+    {VertexBuffer::UVKind, false},     //
+    {VertexBuffer::UV2Kind, false},    //
+    {VertexBuffer::UV3Kind, false},    //
+    {VertexBuffer::UV4Kind, false},    //
+    {VertexBuffer::UV5Kind, false},    //
+    {VertexBuffer::UV6Kind, false},    //
+    {VertexBuffer::ColorKind, false},  //
+  }};
+  for (const auto& [kind, isDirection] : attributeKinds) {
+    if (!mesh->isVerticesDataPresent(kind)) {
+      continue;
+    }
+    auto data = mesh->getVerticesData(kind);
+    if (data.empty() || data.size() % totalVertices != 0) {
+      continue;
+    }
+    const auto stride = data.size() / totalVertices;
+    _attributes.emplace_back(_AttributeStream{kind, stride, isDirection, std::move(data)});
+  }
+
+  // Skinning influences
+  if (mesh->isVerticesDataPresent(VertexBuffer::MatricesIndicesKind)
+      && mesh->isVerticesDataPresent(VertexBuffer::MatricesWeightsKind)) {
+    _matricesIndices = mesh->getVerticesData(VertexBuffer::MatricesIndicesKind);
+    _matricesWeights = mesh->getVerticesData(VertexBuffer::MatricesWeightsKind);
+    if (_matricesIndices.size() != totalVertices * 4
+        || _matricesWeights.size() != totalVertices * 4) {
+      _matricesIndices.clear();
+      _matricesWeights.clear();
+    }
+    else if (mesh->isVerticesDataPresent(VertexBuffer::MatricesIndicesExtraKind)
+             && mesh->isVerticesDataPresent(VertexBuffer::MatricesWeightsExtraKind)) {
+      _matricesIndicesExtra = mesh->getVerticesData(VertexBuffer::MatricesIndicesExtraKind);
+      _matricesWeightsExtra = mesh->getVerticesData(VertexBuffer::MatricesWeightsExtraKind);
+      if (_matricesIndicesExtra.size() != totalVertices * 4
+          || _matricesWeightsExtra.size() != totalVertices * 4) {
+        _matricesIndicesExtra.clear();
+        _matricesWeightsExtra.clear();
+      }
+    }
+  }
+
+  // Indices
+  _indices = mesh->getIndices();
+  if (_indices.empty()) {
+    _indices.resize(totalVertices);
+    for (size_t i = 0; i < totalVertices; ++i) {
+      _indices[i] = static_cast<uint32_t>(i);
+    }
+  }
+
+  // Submeshes
+  for (const auto& subMesh : mesh->subMeshes) {
+    _subMeshes.emplace_back(
+      _SubMeshRange{subMesh->materialIndex, subMesh->indexStart, subMesh->indexCount});
+  }
+  if (_subMeshes.empty()) {
+    _subMeshes.emplace_back(_SubMeshRange{0, 0, _indices.size()});
+  }
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  const auto simplifiedMesh = reconstructMesh(decimate(settings));
+  if (successCallback) {
+    successCallback(simplifiedMesh);
+  }
+}
+
+SimplifiedMeshData QuadraticErrorSimplification::decimate(
+  const ISimplificationSettings& settings) const
+{
+  SimplifiedMeshData result;
+  result.vertexData[VertexBuffer::PositionKind] = {};
+  result.strides[VertexBuffer::PositionKind]    = 3;
+  for (const auto& attribute : _attributes) {
+    result.vertexData[attribute.kind] = {};
+    result.strides[attribute.kind]    = attribute.stride;
+  }
+  if (!_matricesIndices.empty()) {
+    result.vertexData[VertexBuffer::MatricesIndicesKind] = {};
+    result.vertexData[VertexBuffer::MatricesWeightsKind] = {};
+    result.strides[VertexBuffer::MatricesIndicesKind]    = 4;
+    result.strides[VertexBuffer::MatricesWeightsKind]    = 4;
+    if (!_matricesIndicesExtra.empty()) {
+      result.vertexData[VertexBuffer::MatricesIndicesExtraKind] = {};
+      result.vertexData[VertexBuffer::MatricesWeightsExtraKind] = {};
+      result.strides[VertexBuffer::MatricesIndicesExtraKind]    = 4;
+      result.strides[VertexBuffer::MatricesWeightsExtraKind]    = 4;
+    }
+  }
+
+  for (const auto& subMesh : _subMeshes) {
+    _decimateSubMesh(subMesh, settings, result);
+  }
+
+  return result;
+}
+
+void QuadraticErrorSimplification::_decimateSubMesh(const _SubMeshRange& subMesh,
+                                                    const ISimplificationSettings& settings,
+                                                    SimplifiedMeshData& result) const
+{
+  const auto totalVertices = _positions.size() / 3;
+  const auto hasSkin       = !_matricesIndices.empty();
+  const size_t influences  = _matricesIndicesExtra.empty() ? 4 : 8;
+
+  // Welding of the exact duplicates (same position and attributes) when optimizing the mesh
+  const auto vertexHash = [this](uint32_t index) {
+    size_t seed           = 0;
+    const auto hashStream = [&seed](const Float32Array& data, size_t stride, uint32_t i) {
+      for (size_t c = 0; c < stride; ++c) {
+        uint32_t bits;
+        std::memcpy(&bits, &data[i * stride + c], sizeof(bits));
+        seed ^= bits + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+    };
+    hashStream(_positions, 3, index);
+    for (const auto& attribute : _attributes) {
+      hashStream(attribute.data, attribute.stride, index);
+    }
+    return seed;
+  };
+  const auto vertexEqual = [this](uint32_t a, uint32_t b) {
+    const auto equalStream = [a, b](const Float32Array& data, size_t stride) {
+      return std::equal(data.begin() + a * stride, data.begin() + (a + 1) * stride,
+                        data.begin() + b * stride);
+    };
+    if (!equalStream(_positions, 3)) {
+      return false;
+    }
+    for (const auto& attribute : _attributes) {
+      if (!equalStream(attribute.data, attribute.stride)) {
+        return false;
+      }
+    }
+    const auto skinStreams = {&_matricesIndices, &_matricesWeights, &_matricesIndicesExtra,
+                              &_matricesWeightsExtra};
+    for (const auto* stream : skinStreams) {
+      if (!stream->empty() && !equalStream(*stream, 4)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::unordered_map<uint32_t, uint32_t, decltype(vertexHash), decltype(vertexEqual)> welded(
+    settings.optimizeMesh ? subMesh.indexCount : 0, vertexHash, vertexEqual);
+
+  // Collect the vertices and faces of the submesh
+  std::vector<uint32_t> localIndices(totalVertices, InvalidIndex);
+  std::vector<uint32_t> sourceVertices;
+  std::vector<std::array<size_t, 3>> faces;
+  const auto indexEnd = std::min(subMesh.indexStart + subMesh.indexCount, _indices.size());
+  faces.reserve((indexEnd - std::min(subMesh.indexStart, indexEnd)) / 3);
+  for (size_t i = subMesh.indexStart; i + 2 < indexEnd; i += 3) {
+    std::array<size_t, 3> face{{0, 0, 0}};
+    bool valid = true;
+    for (size_t j = 0; j < 3; ++j) {
+      auto sourceIndex = _indices[i + j];
+      if (sourceIndex >= totalVertices) {
+        valid = false;
+        break;
+      }
+      if (settings.optimizeMesh) {
+        sourceIndex = welded.try_emplace(sourceIndex, sourceIndex).first->second;
+      }
+      if (localIndices[sourceIndex] == InvalidIndex) {
+        localIndices[sourceIndex] = static_cast<uint32_t>(sourceVertices.size());
+        sourceVertices.emplace_back(sourceIndex);
+      }
+      face[j] = localIndices[sourceIndex];
+    }
+    if (valid && face[0] != face[1] && face[1] != face[2] && face[2] != face[0]) {
+      faces.emplace_back(face);
+    }
+  }
+
+  if (faces.empty()) {
+    return;
+  }
+
+  // Normalize the positions to keep the quadrics well conditioned with float precision
+  Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+  Vector3 maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+  for (const auto sourceIndex : sourceVertices) {
+    const auto position = Vector3::FromArray(_positions, sourceIndex * 3);
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+  const auto center = minimum.add(maximum).scaleInPlace(0.5f);
+  const auto extent = std::max({maximum.x - minimum.x, maximum.y - minimum.y, //
+                                maximum.z - minimum.z});
+  const auto scale  = extent > 0.f ? 2.f / extent : 1.f;
+
+  // Working copies of the vertex data
+  std::vector<DecimationVertex> vertices;
+  vertices.reserve(sourceVertices.size());
+  std::vector<Float32Array> attributes(_attributes.size());
+  Float32Array skinIndices, skinWeights;
+  for (size_t a = 0; a < _attributes.size(); ++a) {
+    attributes[a].reserve(sourceVertices.size() * _attributes[a].stride);
+  }
+  if (hasSkin) {
+    skinIndices.resize(sourceVertices.size() * influences, 0.f);
+    skinWeights.resize(sourceVertices.size() * influences, 0.f);
+  }
+  for (size_t v = 0; v < sourceVertices.size(); ++v) {
+    const auto sourceIndex = sourceVertices[v];
+    auto position          = Vector3::FromArray(_positions, sourceIndex * 3);
+    vertices.emplace_back(position.subtractInPlace(center).scaleInPlace(scale),
+                          static_cast<int>(v));
+    vertices.back().isBorder = false;
+    for (size_t a = 0; a < _attributes.size(); ++a) {
+      const auto stride = _attributes[a].stride;
+      const auto& data  = _attributes[a].data;
+      attributes[a].insert(attributes[a].end(), data.begin() + sourceIndex * stride,
+                           data.begin() + (sourceIndex + 1) * stride);
+    }
+    if (hasSkin) {
+      for (size_t c = 0; c < 4; ++c) {
+        skinIndices[v * influences + c] = _matricesIndices[sourceIndex * 4 + c];
+        skinWeights[v * influences + c] = _matricesWeights[sourceIndex * 4 + c];
+        if (influences == 8) {
+          skinIndices[v * influences + 4 + c] = _matricesIndicesExtra[sourceIndex * 4 + c];
+          skinWeights[v * influences + 4 + c] = _matricesWeightsExtra[sourceIndex * 4 + c];
+        }
+      }
+    }
+  }
+
+  // Triangles and quadrics
+  std::vector<DecimationTriangle> triangles;
+  triangles.reserve(faces.size());
+  const auto updateNormal = [&vertices](DecimationTriangle& triangle) {
+    const auto& p0  = vertices[triangle.vertices[0]].position;
+    const auto& p1  = vertices[triangle.vertices[1]].position;
+    const auto& p2  = vertices[triangle.vertices[2]].position;
+    triangle.normal = Vector3::Cross(p1.subtract(p0), p2.subtract(p0)).normalize();
+  };
+  for (const auto& face : faces) {
+    triangles.emplace_back(DecimationTriangle(face));
+    auto& triangle = triangles.back();
+    updateNormal(triangle);
+    const auto& n = triangle.normal;
+    const auto q  = QuadraticMatrix::DataFromNumbers(
+      n.x, n.y, n.z, -Vector3::Dot(n, vertices[face[0]].position));
+    for (const auto v : face) {
+      vertices[v].q.addArrayInPlace(q);
+    }
+  }
+
+  // References from the vertices to their triangles
+  for (const auto& triangle : triangles) {
+    for (const auto v : triangle.vertices) {
+      ++vertices[v].triangleCount;
+    }
+  }
+  int triangleStart = 0;
+  for (auto& vertex : vertices) {
+    vertex.triangleStart = triangleStart;
+    triangleStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+  std::vector<Reference> references(static_cast<size_t>(triangleStart), Reference(0, 0));
+  references.reserve(references.size() * 4);
+  for (size_t t = 0; t < triangles.size(); ++t) {
+    for (size_t j = 0; j < 3; ++j) {
+      auto& vertex = vertices[triangles[t].vertices[j]];
+      references[static_cast<size_t>(vertex.triangleStart + vertex.triangleCount)]
+        = Reference(static_cast<int>(j), static_cast<int>(t));
+      ++vertex.triangleCount;
+    }
+  }
+
+  const auto forEachTriangle = [&](size_t v, auto&& callback) {
+    const auto& vertex = vertices[v];
+    for (int i = 0; i < vertex.triangleCount; ++i) {
+      const auto& reference = references[static_cast<size_t>(vertex.triangleStart + i)];
+      auto& triangle        = triangles[static_cast<size_t>(reference.triangleId)];
+      if (!triangle.deleted) {
+        callback(triangle, reference);
+      }
+    }
+  };
+
+  std::vector<size_t> neighbors0, neighbors1;
+  const auto collectNeighbors = [&](size_t v, std::vector<size_t>& neighbors) {
+    neighbors.clear();
+    forEachTriangle(v, [&neighbors](DecimationTriangle& triangle, const Reference& reference) {
+      const auto s = static_cast<size_t>(reference.vertexId);
+      neighbors.emplace_back(triangle.vertices[(s + 1) % 3]);
+      neighbors.emplace_back(triangle.vertices[(s + 2) % 3]);
+    });
+    std::sort(neighbors.begin(), neighbors.end());
+  };
+
+  // Border edges belong to a single triangle, the vertices of non-manifold edges are locked
+  std::vector<bool> locked(vertices.size(), false);
+  for (size_t v = 0; v < vertices.size(); ++v) {
+    collectNeighbors(v, neighbors0);
+    for (size_t i = 0; i < neighbors0.size();) {
+      size_t j = i;
+      while (j < neighbors0.size() && neighbors0[j] == neighbors0[i]) {
+        ++j;
+      }
+      if (j - i == 1) {
+        vertices[v].isBorder             = true;
+        vertices[neighbors0[i]].isBorder = true;
+      }
+      else if (j - i != 2) {
+        locked[v]             = true;
+        locked[neighbors0[i]] = true;
+      }
+      i = j;
+    }
+  }
+
+  const auto isBorderEdge = [&](size_t v0, size_t v1) {
+    size_t count = 0;
+    forEachTriangle(v0, [&count, v1](DecimationTriangle& triangle, const Reference& /*reference*/) {
+      const auto& corners = triangle.vertices;
+      if (corners[0] == v1 || corners[1] == v1 || corners[2] == v1) {
+        ++count;
+      }
+    });
+    return count == 1;
+  };
+
+  // Attribute seams split a vertex in two border vertices with the same position. The seam
+  // vertices share their quadrics and their border edges collapse in pairs, one per side, so that
+  // the seam stays closed. Open borders and seam junctions do not move.
+  constexpr auto NoTwin = std::numeric_limits<size_t>::max();
+  std::vector<size_t> twins(vertices.size(), NoTwin);
+  std::vector<size_t> borderVertices;
+  for (size_t v = 0; v < vertices.size(); ++v) {
+    if (vertices[v].isBorder && !locked[v]) {
+      borderVertices.emplace_back(v);
+    }
+  }
+  const auto positionLess = [&vertices](size_t a, size_t b) {
+    const auto& pa = vertices[a].position;
+    const auto& pb = vertices[b].position;
+    return std::tie(pa.x, pa.y, pa.z) < std::tie(pb.x, pb.y, pb.z);
+  };
+  std::sort(borderVertices.begin(), borderVertices.end(), positionLess);
+  for (size_t i = 0; i < borderVertices.size();) {
+    size_t j = i + 1;
+    while (j < borderVertices.size() && !positionLess(borderVertices[i], borderVertices[j])) {
+      ++j;
+    }
+    if (j - i == 2) {
+      twins[borderVertices[i]]     = borderVertices[i + 1];
+      twins[borderVertices[i + 1]] = borderVertices[i];
+    }
+    i = j;
+  }
+  std::vector<size_t> openBorderVertices;
+  for (const auto v : borderVertices) {
+    auto closed = twins[v] != NoTwin;
+    collectNeighbors(v, neighbors0);
+    for (size_t i = 0; closed && i < neighbors0.size();) {
+      size_t j = i;
+      while (j < neighbors0.size() && neighbors0[j] == neighbors0[i]) {
+        ++j;
+      }
+      if (j - i == 1) {
+        const auto neighbor = neighbors0[i];
+        closed = twins[neighbor] != NoTwin && isBorderEdge(twins[v], twins[neighbor]);
+      }
+      i = j;
+    }
+    if (!closed) {
+      openBorderVertices.emplace_back(v);
+    }
+  }
+  for (const auto v : openBorderVertices) {
+    if (twins[v] != NoTwin) {
+      twins[twins[v]] = NoTwin;
+      twins[v]        = NoTwin;
+    }
+  }
+  for (const auto v : borderVertices) {
+    if (twins[v] != NoTwin && v < twins[v]) {
+      vertices[v].q.addInPlace(vertices[twins[v]].q);
+      vertices[twins[v]].q = vertices[v].q;
+    }
+  }
+  const auto isSeamEdge = [&](size_t v0, size_t v1) {
+    return twins[v0] != NoTwin && twins[v1] != NoTwin && twins[v0] != v1
+           && isBorderEdge(v0, v1) && isBorderEdge(twins[v0], twins[v1]);
+  };
+
+  const auto calculateError = [&vertices](size_t v0, size_t v1, Vector3& pointResult) {
+    const auto& vertex1 = vertices[v0];
+    const auto& vertex2 = vertices[v1];
+    const auto q        = QuadraticMatrix(vertex1.q).add(vertex2.q);
+    const auto qDet     = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+    const auto diagonal = std::abs(q[0] * q[4] * q[7]);
+    if (std::abs(qDet) > 1e-6f * diagonal) {
+      pointResult.x = -1.f / qDet * (q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+      pointResult.y = 1.f / qDet * (q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+      pointResult.z = -1.f / qDet * (q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+      // Reject optimal points far away from the collapsed edge
+      const auto edgeLength = Vector3::Distance(vertex1.position, vertex2.position);
+      const auto midPoint   = vertex1.position.add(vertex2.position).scaleInPlace(0.5f);
+      if (Vector3::Distance(pointResult, midPoint) <= edgeLength) {
+        return q.vertexError(pointResult.x, pointResult.y, pointResult.z);
+      }
+    }
+    const auto p3 = vertex1.position.add(vertex2.position).scaleInPlace(0.5f);
+    const auto error1
+      = q.vertexError(vertex1.position.x, vertex1.position.y, vertex1.position.z);
+    const auto error2
+      = q.vertexError(vertex2.position.x, vertex2.position.y, vertex2.position.z);
+    const auto error3 = q.vertexError(p3.x, p3.y, p3.z);
+    const auto error  = std::min({error1, error2, error3});
+    if (error == error1) {
+      pointResult.copyFrom(vertex1.position);
+    }
+    else if (error == error2) {
+      pointResult.copyFrom(vertex2.position);
+    }
+    else {
+      pointResult.copyFrom(p3);
+    }
+    return error;
+  };
+
+  // An interior vertex collapses onto a border vertex without moving it
+  const auto calculateCollapseError = [&](size_t v0, size_t v1, Vector3& pointResult) {
+    if (vertices[v0].isBorder && !vertices[v1].isBorder) {
+      pointResult.copyFrom(vertices[v0].position);
+      return QuadraticMatrix(vertices[v0].q)
+        .add(vertices[v1].q)
+        .vertexError(pointResult.x, pointResult.y, pointResult.z);
+    }
+    return calculateError(v0, v1, pointResult);
+  };
+
+  const auto isFlipped = [&](size_t vertex1, size_t vertex2, const Vector3& point) {
+    bool flipped = false;
+    forEachTriangle(vertex1, [&](DecimationTriangle& triangle, const Reference& reference) {
+      const auto s  = static_cast<size_t>(reference.vertexId);
+      const auto v1 = triangle.vertices[(s + 1) % 3];
+      const auto v2 = triangle.vertices[(s + 2) % 3];
+      if (flipped || v1 == vertex2 || v2 == vertex2) {
+        return;
+      }
+      const auto d1 = vertices[v1].position.subtract(point).normalize();
+      const auto d2 = vertices[v2].position.subtract(point).normalize();
+      if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+        flipped = true;
+        return;
+      }
+      const auto normal = Vector3::Cross(d1, d2).normalize();
+      if (Vector3::Dot(normal, triangle.normal) < 0.2f) {
+        flipped = true;
+      }
+    });
+    return flipped;
+  };
+
+  // Priority queue of the edge collapses
+  std::vector<uint32_t> versions(vertices.size(), 0);
+  std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>, EdgeCollapseCompare> queue;
+  Vector3 point;
+  const auto pushCollapse = [&](size_t v0, size_t v1) {
+    if (vertices[v1].isBorder && !vertices[v0].isBorder) {
+      std::swap(v0, v1);
+    }
+    if (locked[v0] || locked[v1] || (vertices[v1].isBorder && !isSeamEdge(v0, v1))) {
+      return;
+    }
+    const auto error = calculateCollapseError(v0, v1, point);
+    queue.push(EdgeCollapse{error, v0, v1, versions[v0], versions[v1]});
+  };
+  for (const auto& triangle : triangles) {
+    for (size_t j = 0; j < 3; ++j) {
+      const auto v0 = triangle.vertices[j];
+      const auto v1 = triangle.vertices[(j + 1) % 3];
+      if (v0 < v1) {
+        pushCollapse(v0, v1);
+      }
+    }
+  }
+
+  // Edge collapses
+  const auto quality     = std::clamp(settings.quality, 0.f, 1.f);
+  const auto targetCount = static_cast<size_t>(static_cast<float>(triangles.size()) * quality);
+  auto triangleCount     = triangles.size();
+  const auto isCollapsible = [&](size_t v0, size_t v1, bool borderEdge) {
+    // Link condition: the collapse must keep the surface manifold
+    collectNeighbors(v0, neighbors0);
+    collectNeighbors(v1, neighbors1);
+    neighbors0.erase(std::unique(neighbors0.begin(), neighbors0.end()), neighbors0.end());
+    neighbors1.erase(std::unique(neighbors1.begin(), neighbors1.end()), neighbors1.end());
+    size_t sharedNeighbors = 0;
+    for (size_t i = 0, j = 0; i < neighbors0.size() && j < neighbors1.size();) {
+      if (neighbors0[i] < neighbors1[j]) {
+        ++i;
+      }
+      else if (neighbors1[j] < neighbors0[i]) {
+        ++j;
+      }
+      else {
+        ++sharedNeighbors, ++i, ++j;
+      }
+    }
+    if (sharedNeighbors != (borderEdge ? 1u : 2u)) {
+      return false;
+    }
+
+    return !isFlipped(v0, v1, point) && !isFlipped(v1, v0, point);
+  };
+
+  const auto collapseEdge = [&](size_t v0, size_t v1) {
+    // Interpolate the attributes along the collapsed edge
+    auto& vertex0     = vertices[v0];
+    auto& vertex1     = vertices[v1];
+    const auto edge   = vertex1.position.subtract(vertex0.position);
+    const auto length = edge.lengthSquared();
+    const auto t
+      = length > 0.f ?
+          std::clamp(Vector3::Dot(point.subtract(vertex0.position), edge) / length, 0.f, 1.f) :
+          0.f;
+    for (size_t a = 0; a < attributes.size(); ++a) {
+      const auto stride = _attributes[a].stride;
+      auto* a0          = &attributes[a][v0 * stride];
+      const auto* a1    = &attributes[a][v1 * stride];
+      for (size_t c = 0; c < stride; ++c) {
+        a0[c] = a0[c] * (1.f - t) + a1[c] * t;
+      }
+      if (_attributes[a].isDirection && stride >= 3) {
+        const auto norm = std::sqrt(a0[0] * a0[0] + a0[1] * a0[1] + a0[2] * a0[2]);
+        if (norm > 0.f) {
+          a0[0] /= norm, a0[1] /= norm, a0[2] /= norm;
+        }
+      }
+    }
+    if (hasSkin) {
+      // Merge the bone influences of both vertices and keep the strongest ones
+      std::array<std::pair<float, float>, 16> merged{};
+      size_t mergedCount = 0;
+      const auto accumulate = [&](size_t v, float factor) {
+        for (size_t c = 0; c < influences; ++c) {
+          const auto weight = skinWeights[v * influences + c] * factor;
+          if (weight <= 0.f) {
+            continue;
+          }
+          const auto bone = skinIndices[v * influences + c];
+          auto it         = std::find_if(merged.begin(), merged.begin() + mergedCount,
+                                 [bone](const auto& influence) { return influence.first == bone; });
+          if (it != merged.begin() + mergedCount) {
+            it->second += weight;
+          }
+          else {
+            merged[mergedCount++] = {bone, weight};
+          }
+        }
+      };
+      accumulate(v0, 1.f - t);
+      accumulate(v1, t);
+      std::sort(merged.begin(), merged.begin() + mergedCount,
+                [](const auto& a, const auto& b) { return a.second > b.second; });
+      mergedCount = std::min(mergedCount, influences);
+      float totalWeight = 0.f;
+      for (size_t c = 0; c < mergedCount; ++c) {
+        totalWeight += merged[c].second;
+      }
+      for (size_t c = 0; c < influences; ++c) {
+        const auto used                  = c < mergedCount && totalWeight > 0.f;
+        skinIndices[v0 * influences + c] = used ? merged[c].first : 0.f;
+        skinWeights[v0 * influences + c] = used ? merged[c].second / totalWeight : 0.f;
+      }
+    }
+
+    // Collapse v1 into v0
+    vertex0.q.addInPlace(vertex1.q);
+    vertex0.updatePosition(point);
+    const auto tStart = references.size();
+    for (const auto v : {v0, v1}) {
+      const auto& vertex = vertices[v];
+      for (int i = 0; i < vertex.triangleCount; ++i) {
+        const auto reference = references[static_cast<size_t>(vertex.triangleStart + i)];
+        auto& triangle       = triangles[static_cast<size_t>(reference.triangleId)];
+        if (triangle.deleted) {
+          continue;
+        }
+        const auto& corners = triangle.vertices;
+        if (v == v0 && (corners[0] == v1 || corners[1] == v1 || corners[2] == v1)) {
+          triangle.deleted = true;
+          --triangleCount;
+          continue;
+        }
+        triangle.vertices[static_cast<size_t>(reference.vertexId)] = v0;
+        updateNormal(triangle);
+        references.emplace_back(reference);
+      }
+    }
+    vertex0.triangleStart = static_cast<int>(tStart);
+    vertex0.triangleCount = static_cast<int>(references.size() - tStart);
+    vertex1.triangleCount = 0;
+    ++versions[v0];
+    ++versions[v1];
+  };
+
+  while (triangleCount > targetCount && !queue.empty()) {
+    const auto collapse = queue.top();
+    queue.pop();
+    if (collapse.error > maximumError) {
+      break;
+    }
+    const auto v0 = collapse.v0;
+    const auto v1 = collapse.v1;
+    if (versions[v0] != collapse.version0 || versions[v1] != collapse.version1) {
+      continue;
+    }
+
+    calculateCollapseError(v0, v1, point);
+
+    // A seam edge collapses with its twin on the other side of the seam
+    const auto seam = vertices[v1].isBorder;
+    if (!isCollapsible(v0, v1, seam) || (seam && !isCollapsible(twins[v0], twins[v1], seam))) {
+      continue;
+    }
+    collapseEdge(v0, v1);
+    if (seam) {
+      collapseEdge(twins[v0], twins[v1]);
+    }
+
+    collectNeighbors(v0, neighbors0);
+    neighbors0.erase(std::unique(neighbors0.begin(), neighbors0.end()), neighbors0.end());
+    for (const auto neighbor : neighbors0) {
+      pushCollapse(v0, neighbor);
+    }
+  }
+
+  // Compact the remaining vertices and triangles into the result
+  auto& positions          = result.vertexData[VertexBuffer::PositionKind];
+  const auto verticesStart = static_cast<unsigned int>(positions.size() / 3);
+  const auto indexStart    = static_cast<unsigned int>(result.indices.size());
+  uint32_t simplifiedCount = 0;
+  std::vector<uint32_t> remap(vertices.size(), InvalidIndex);
+  const auto inverseScale = 1.f / scale;
+  for (const auto& triangle : triangles) {
+    if (triangle.deleted) {
+      continue;
+    }
+    for (const auto v : triangle.vertices) {
+      if (remap[v] == InvalidIndex) {
+        remap[v]            = simplifiedCount++;
+        const auto position = vertices[v].position.scale(inverseScale).addInPlace(center);
+        positions.insert(positions.end(), {position.x, position.y, position.z});
+        for (size_t a = 0; a < attributes.size(); ++a) {
+          const auto stride = _attributes[a].stride;
+          auto& data        = result.vertexData[_attributes[a].kind];
+          data.insert(data.end(), attributes[a].begin() + v * stride,
+                      attributes[a].begin() + (v + 1) * stride);
+        }
+        if (hasSkin) {
+          auto& indices = result.vertexData[VertexBuffer::MatricesIndicesKind];
+          auto& weights = result.vertexData[VertexBuffer::MatricesWeightsKind];
+          indices.insert(indices.end(), skinIndices.begin() + v * influences,
+                         skinIndices.begin() + v * influences + 4);
+          weights.insert(weights.end(), skinWeights.begin() + v * influences,
+                         skinWeights.begin() + v * influences + 4);
+          if (influences == 8) {
+            auto& indicesExtra = result.vertexData[VertexBuffer::MatricesIndicesExtraKind];
+            auto& weightsExtra = result.vertexData[VertexBuffer::MatricesWeightsExtraKind];
+            indicesExtra.insert(indicesExtra.end(), skinIndices.begin() + v * influences + 4,
+                                skinIndices.begin() + (v + 1) * influences);
+            weightsExtra.insert(weightsExtra.end(), skinWeights.begin() + v * influences + 4,
+                                skinWeights.begin() + (v + 1) * influences);
+          }
+        }
+      }
+      result.indices.emplace_back(verticesStart + remap[v]);
+    }
+  }
+
+  SimplifiedSubMesh simplifiedSubMesh;
+  simplifiedSubMesh.materialIndex = subMesh.materialIndex;
+  simplifiedSubMesh.verticesStart = verticesStart;
+  simplifiedSubMesh.verticesCount = simplifiedCount;
+  simplifiedSubMesh.indexStart    = indexStart;
+  simplifiedSubMesh.indexCount    = result.indices.size() - indexStart;
+  result.subMeshes.emplace_back(simplifiedSubMesh);
+}
+
+MeshPtr QuadraticErrorSimplification::reconstructMesh(const SimplifiedMeshData& data) const
+{
+  auto reconstructedMesh              = Mesh::New(_mesh->name + "Decimated", _mesh->getScene());
+  reconstructedMesh->material         = _mesh->material();
+  reconstructedMesh->parent           = _mesh->parent();
+  reconstructedMesh->isVisible        = false;
+  reconstructedMesh->renderingGroupId = _mesh->renderingGroupId();
+  if (!_matricesIndices.empty()) {
+    reconstructedMesh->skeleton = _mesh->skeleton();
+  }
+
+  for (const auto& [kind, vertexData] : data.vertexData) {
+    if (vertexData.empty()) {
+      continue;
+    }
+    const auto stride = data.strides.find(kind);
+    reconstructedMesh->setVerticesData(
+      kind, vertexData, false,
+      stride != data.strides.end() ? std::optional<size_t>(stride->second) : std::nullopt);
+  }
+  reconstructedMesh->setIndices(data.indices);
+
+  reconstructedMesh->releaseSubMeshes();
+  for (const auto& subMesh : data.subMeshes) {
+    SubMesh::AddToMesh(subMesh.materialIndex, subMesh.verticesStart, subMesh.verticesCount,
+                       subMesh.indexStart, subMesh.indexCount, reconstructedMesh);
+  }
+
+  return reconstructedMesh;
+}
+
+} // end of namespace BABYLON
@@ -23,9 +23,14 @@ QuadraticMatrix& QuadraticMatrix::operator=(QuadraticMatrix&& other) = default;
 
 QuadraticMatrix::~QuadraticMatrix() = default;
 
+float QuadraticMatrix::operator[](unsigned int index) const
+{
+  return data[index];
+}
+
 float QuadraticMatrix::det(unsigned int a11, unsigned int a12, int unsigned a13, unsigned int a21,
                            unsigned int a22, unsigned int a23, unsigned int a31, unsigned int a32,
-                           unsigned int a33)
+                           unsigned int a33) const
 {
   return data[a11] * data[a22] * data[a33]   //
          + data[a13] * data[a21] * data[a32] //
@@ -58,6 +63,13 @@ QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
   return m;
 }
 
+float QuadraticMatrix::vertexError(float x, float y, float z) const
+{
+  return data[0] * x * x + 2.f * data[1] * x * y + 2.f * data[2] * x * z + 2.f * data[3] * x
+         + data[4] * y * y + 2.f * data[5] * y * z + 2.f * data[6] * y + data[7] * z * z
+         + 2.f * data[8] * z + data[9];
+}
+
 QuadraticMatrix QuadraticMatrix::FromData(float a, float b, float c, float d)
 {
   return QuadraticMatrix(QuadraticMatrix::DataFromNumbers(a, b, c, d));
@@ -1,5 +1,11 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <chrono>
+#include <numeric>
+
+#include <babylon/core/logging.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
@@ -18,8 +24,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running         = true;
+    const auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +34,107 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  _runningTask = task;
+  _pendingDecimations.clear();
+
+  if (!task.mesh || task.settings.empty()) {
+    processCompletedTasks();
+    return;
+  }
+
+  // The simplifier copies the mesh data on the calling thread
+  auto simplifier    = getSimplifier(task);
+  _runningSimplifier = simplifier;
+
+  if (task.parallelProcessing) {
+    // parallel simplifier
+    for (size_t i = 0; i < task.settings.size(); ++i) {
+      const auto setting = task.settings[i];
+      _pendingDecimations.emplace_back(
+        _PendingDecimation{{i}, std::async(std::launch::async, [simplifier, setting]() {
+                             return std::vector<SimplifiedMeshData>{simplifier->decimate(setting)};
+                           })});
+    }
+  }
+  else {
+    // single simplifier
+    std::vector<size_t> settingIndices(task.settings.size());
+    std::iota(settingIndices.begin(), settingIndices.end(), 0);
+    const auto settings = task.settings;
+    _pendingDecimations.emplace_back(
+      _PendingDecimation{settingIndices, std::async(std::launch::async, [simplifier, settings]() {
+                           std::vector<SimplifiedMeshData> decimations;
+                           decimations.reserve(settings.size());
+                           for (const auto& setting : settings) {
+                             decimations.emplace_back(simplifier->decimate(setting));
+                           }
+                           return decimations;
+                         })});
+  }
+}
+
+void SimplificationQueue::processCompletedTasks()
+{
+  for (auto it = _pendingDecimations.begin(); it != _pendingDecimations.end();) {
+    if (it->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++it;
+      continue;
+    }
+    // A failed decimation only drops its levels of detail
+    std::vector<SimplifiedMeshData> decimations;
+    try {
+      decimations = it->result.get();
+    }
+    catch (const std::exception& e) {
+      BABYLON_LOGF_ERROR("SimplificationQueue", "Failed to simplify the mesh: %s", e.what())
+      it = _pendingDecimations.erase(it);
+      continue;
+    }
+    const auto& mesh = _runningTask.mesh;
+    if (mesh && !mesh->isDisposed()) {
+      for (size_t i = 0; i < decimations.size(); ++i) {
+        const auto& setting = _runningTask.settings[it->settingIndices[i]];
+        auto newMesh        = _runningSimplifier->reconstructMesh(decimations[i]);
+        mesh->addLODLevel(setting.distance, newMesh);
+        newMesh->isVisible = true;
+      }
+    }
+    it = _pendingDecimations.erase(it);
+  }
+
+  if (running && _pendingDecimations.empty()) {
+    // all done, run the success callback.
+    const auto successCallback = _runningTask.successCallback;
+    _runningTask               = ISimplificationTask{};
+    _runningSimplifier         = nullptr;
+    if (successCallback) {
+      successCallback();
+    }
+    executeNext();
+  }
+}
+
+void SimplificationQueue::flush()
+{
+  if (!running) {
+    executeNext();
+  }
+  while (running) {
+    for (auto& pendingDecimation : _pendingDecimations) {
+      pendingDecimation.result.wait();
+    }
+    processCompletedTasks();
+  }
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+ISimplifierPtr SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_shared<QuadraticErrorSimplification>(task.mesh.get());
   }
 }
 
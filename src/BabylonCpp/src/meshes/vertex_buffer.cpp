@@ -167,6 +167,23 @@ WebGLDataBufferPtr VertexBuffer::updateDirectly(const Float32Array& data, size_t
   return _getBuffer()->updateDirectly(data, offset, std::nullopt, useBytes);
 }
 
+void VertexBuffer::markRange(size_t start, size_t count)
+{
+  if (count == 0) {
+    return;
+  }
+
+  // The vertices may be interleaved with other attributes, the span covers their strides
+  const auto stride = byteStride / sizeof(float);
+  _getBuffer()->markRange(byteOffset / sizeof(float) + start * stride,
+                          (count - 1) * stride + _size);
+}
+
+void VertexBuffer::_uploadDirtyRanges()
+{
+  _getBuffer()->uploadDirtyRanges();
+}
+
 void VertexBuffer::dispose()
 {
   if (_ownsBuffer && _ownedBuffer) {
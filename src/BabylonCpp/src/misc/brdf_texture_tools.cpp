@@ -1,6 +1,5 @@
 #include <babylon/misc/brdf_texture_tools.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/textures/texture.h>
@@ -24,11 +23,7 @@ BaseTexturePtr BRDFTextureTools::GetEnvironmentBRDFTexture(Scene* scene)
       scene, true, false, TextureConstants::BILINEAR_SAMPLINGMODE);
     scene->_blockEntityCollection = previousState;
     // BRDF Texture should not be cached here due to pre processing and redundant scene caches.
-    auto& texturesCache = scene->getEngine()->getLoadedTexturesCache();
-    auto index          = stl_util::index_of(texturesCache, texture->getInternalTexture());
-    if (index != -1) {
-      stl_util::splice(texturesCache, index, 1);
-    }
+    scene->getEngine()->getLoadedTexturesCache().remove(texture->getInternalTexture().get());
 
     texture->isRGBD               = true;
     texture->wrapU                = TextureConstants::CLAMP_ADDRESSMODE;
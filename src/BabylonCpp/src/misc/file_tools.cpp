@@ -33,15 +33,36 @@
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/core/logging.h>
+#include <babylon/engines/constants.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/loading/progress_event.h>
 #include <babylon/misc/string_tools.h>
+#include <babylon/misc/texture_disk_cache.h>
 #include <babylon/utils/base64.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Flips decoded image rows in place. The stb flip flag is process global, flipping after
+ * decoding keeps the decoding safe to run on several threads.
+ */
+void flipRowsVertically(unsigned char* data, int width, int height, size_t bytesPerPixel)
+{
+  const auto rowBytes = static_cast<size_t>(width) * bytesPerPixel;
+  for (int top = 0, bottom = height - 1; top < bottom; ++top, --bottom) {
+    std::swap_ranges(data + static_cast<size_t>(top) * rowBytes,
+                     data + static_cast<size_t>(top + 1) * rowBytes,
+                     data + static_cast<size_t>(bottom) * rowBytes);
+  }
+}
+
+} // end of anonymous namespace
+
 namespace sync_io_impl {
 
 struct ErrorMessage {
@@ -257,17 +278,45 @@ Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertical
   int w = -1, h = -1, n = -1;
   int req_comp = STBI_rgb_alpha;
 
-  stbi_set_flip_vertically_on_load(flipVertically);
+  // Decoded images are read from the texture disk cache when it is enabled
+  std::string cacheKey;
+  if (TextureDiskCache::IsEnabled()) {
+    cacheKey = TextureDiskCache::Key(
+      std::string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()),
+      flipVertically ? "image:rgba8:flipY" : "image:rgba8");
+    const auto entry = TextureDiskCache::Load(cacheKey);
+    if (entry && entry->levels.size() == 1) {
+      const auto& pixels = entry->levels[0];
+      return Image(ArrayBuffer(pixels.begin(), pixels.end()), entry->width, entry->height,
+                   STBI_rgb_alpha, GL::RGBA);
+    }
+  }
+
   unsigned char* ucharBuffer
     = stbi_load_from_memory(buffer.data(), bufferSize, &w, &h, &n, req_comp);
-  stbi_set_flip_vertically_on_load(false);
 
   if (!ucharBuffer)
     return Image();
 
+  if (flipVertically) {
+    flipRowsVertically(ucharBuffer, w, h, STBI_rgb_alpha);
+  }
+
   n = STBI_rgb_alpha;
   Image image(ucharBuffer, w * h * n, w, h, n, (n == 3) ? GL::RGB : GL::RGBA);
   stbi_image_free(ucharBuffer);
+
+  if (!cacheKey.empty()) {
+    TextureDiskCacheEntry entry;
+    entry.width  = w;
+    entry.height = h;
+    entry.format = Constants::TEXTUREFORMAT_RGBA;
+    entry.type   = Constants::TEXTURETYPE_UNSIGNED_BYTE;
+    entry.levels = {
+      std::string_view(reinterpret_cast<const char*>(image.data.data()), image.data.size())};
+    TextureDiskCache::Store(cacheKey, entry);
+  }
+
   return image;
 }
 
@@ -391,8 +440,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
     req_comp = 4;
     int bits = 8;
 
-    stbi_set_flip_vertically_on_load(flipVertically);
-
     // It is possible that the image we want to load is a 16bit per channel
     // image We are going to attempt to load it as 16bit per channel, and if it
     // worked, set the image data accodingly. We are casting the returned
@@ -424,8 +471,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       return false;
     }
 
-    stbi_set_flip_vertically_on_load(false);
-
     if ((w < 1) || (h < 1)) {
       stbi_image_free(data);
       BABYLON_LOG_ERROR("StringToImage", "Invalid image data for image")
@@ -448,6 +493,10 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       }
     }
 
+    if (flipVertically) {
+      flipRowsVertically(data, w, h, static_cast<size_t>(req_comp * (bits / 8)));
+    }
+
     image.width  = w;
     image.height = h;
     image.depth  = req_comp;
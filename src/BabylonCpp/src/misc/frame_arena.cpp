@@ -0,0 +1,73 @@
+#include <babylon/misc/frame_arena.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace BABYLON {
+
+FrameArena::FrameArena(size_t initialBlockSize) : _currentBlock{0}, _offset{0}, _bytesUsed{0}
+{
+  _addBlock(std::max(initialBlockSize, size_t{64}));
+}
+
+FrameArena::~FrameArena() = default;
+
+void FrameArena::reset()
+{
+  if (_blocks.size() > 1) {
+    // Coalesce the blocks of the frame into one
+    const auto size = capacity();
+    _blocks.clear();
+    _addBlock(size);
+  }
+  _currentBlock = 0;
+  _offset       = 0;
+  _bytesUsed    = 0;
+}
+
+size_t FrameArena::capacity() const
+{
+  size_t size = 0;
+  for (const auto& block : _blocks) {
+    size += block.size;
+  }
+  return size;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+  bytes = std::max(bytes, size_t{1});
+  while (true) {
+    auto& block        = _blocks[_currentBlock];
+    const auto address = reinterpret_cast<std::uintptr_t>(block.data.get()) + _offset;
+    const auto padding = (alignment - address % alignment) % alignment;
+    if (_offset + padding + bytes <= block.size) {
+      _offset += padding + bytes;
+      _bytesUsed += bytes;
+      return block.data.get() + _offset - bytes;
+    }
+    // Move on to the next block, kept from a previous frame or added large enough
+    ++_currentBlock;
+    _offset = 0;
+    if (_currentBlock == _blocks.size()) {
+      _addBlock(std::max(_blocks.back().size * 2, bytes + alignment));
+    }
+  }
+}
+
+void FrameArena::do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*alignment*/)
+{
+  // Released by reset()
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+  return this == &other;
+}
+
+void FrameArena::_addBlock(size_t size)
+{
+  _blocks.emplace_back(Block{std::make_unique<std::byte[]>(size), size});
+}
+
+} // end of namespace BABYLON
@@ -1,9 +1,11 @@
 #include <babylon/misc/highdynamicrange/cmg_bounding_box.h>
 
+#include <limits>
+
 namespace BABYLON {
 
 float CMGBoundinBox::MAX = std::numeric_limits<float>::max();
-float CMGBoundinBox::MIN = std::numeric_limits<float>::max();
+float CMGBoundinBox::MIN = std::numeric_limits<float>::lowest();
 
 CMGBoundinBox::CMGBoundinBox()
     : min{Vector3(0.f, 0.f, 0.f)}, max{Vector3(0.f, 0.f, 0.f)}
@@ -50,7 +52,7 @@ void CMGBoundinBox::clampMax(float x, float y, float z)
 
 bool CMGBoundinBox::empty() const
 {
-  return (min.x > max.y) || (min.y > max.y) || (min.z > max.y);
+  return (min.x > max.x) || (min.y > max.y) || (min.z > max.z);
 }
 
 } // end of namespace BABYLON
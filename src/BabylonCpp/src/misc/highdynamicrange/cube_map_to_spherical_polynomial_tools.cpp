@@ -1,5 +1,7 @@
 #include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
 
+#include <future>
+
 #include <babylon/engines/constants.h>
 #include <babylon/materials/textures/base_texture.h>
 #include <babylon/maths/color3.h>
@@ -10,6 +12,119 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Radiance of a cube face weighted by the texel solid angles and projected on the 9 SH3
+ * basis functions, without their constant factors.
+ */
+struct FaceHarmonics {
+  std::array<double, 27> coefficients{};
+  double solidAngle = 0.0;
+}; // end of struct FaceHarmonics
+
+FaceHarmonics integrateFace(const CubeMapInfo& cubeInfo, const FileFaceOrientation& fileFace)
+{
+  FaceHarmonics result;
+
+  // The (u,v) range is [-1,+1], so the distance between each texel is 2/Size.
+  const auto du = 2.f / static_cast<float>(cubeInfo.size);
+  const auto dv = du;
+
+  // The (u,v) of the first texel is half a texel from the corner (-1,-1).
+  const auto minUV = du * 0.5f - 1.f;
+
+  const auto& axisX      = fileFace.worldAxisForFileX;
+  const auto& axisY      = fileFace.worldAxisForFileY;
+  const auto& axisNormal = fileFace.worldAxisForNormal;
+  const auto dataArray   = cubeInfo[fileFace.name].float32Array();
+  const auto stride      = cubeInfo.format == Constants::TEXTUREFORMAT_RGBA ? 4u : 3u;
+  auto v                 = minUV;
+
+  for (size_t y = 0; y < cubeInfo.size; ++y) {
+    // Rows are summed in float then accumulated in double
+    std::array<float, 27> rowCoefficients{};
+    auto rowSolidAngle = 0.f;
+    auto u             = minUV;
+    const auto* texel  = dataArray.data() + y * cubeInfo.size * stride;
+
+    for (size_t x = 0; x < cubeInfo.size; ++x, texel += stride) {
+      // World direction
+      auto dx = axisX.x * u + axisY.x * v + axisNormal.x;
+      auto dy = axisX.y * u + axisY.y * v + axisNormal.y;
+      auto dz = axisX.z * u + axisY.z * v + axisNormal.z;
+
+      const auto length2   = 1.f + u * u + v * v;
+      const auto invLength = 1.f / std::sqrt(length2);
+      dx *= invLength;
+      dy *= invLength;
+      dz *= invLength;
+
+      // (1 + u^2 + v^2)^(-3/2)
+      const auto deltaSolidAngle = invLength / length2;
+
+      auto r = texel[0];
+      auto g = texel[1];
+      auto b = texel[2];
+
+      // Prevent NaN harmonics with extreme HDRI data.
+      if (isNaN(r)) {
+        r = 0.f;
+      }
+      if (isNaN(g)) {
+        g = 0.f;
+      }
+      if (isNaN(b)) {
+        b = 0.f;
+      }
+
+      // Handle Integer types.
+      if (cubeInfo.type == Constants::TEXTURETYPE_UNSIGNED_INT) {
+        r /= 255.f;
+        g /= 255.f;
+        b /= 255.f;
+      }
+
+      // Handle Gamma space textures.
+      if (cubeInfo.gammaSpace) {
+        r = std::pow(Scalar::Clamp(r), Math::ToLinearSpace);
+        g = std::pow(Scalar::Clamp(g), Math::ToLinearSpace);
+        b = std::pow(Scalar::Clamp(b), Math::ToLinearSpace);
+      }
+
+      // Prevent to explode in case of really high dynamic ranges.
+      // sh 3 would not be enough to accurately represent it.
+      const auto max = 4096.f;
+      r              = Scalar::Clamp(r, 0.f, max) * deltaSolidAngle;
+      g              = Scalar::Clamp(g, 0.f, max) * deltaSolidAngle;
+      b              = Scalar::Clamp(b, 0.f, max) * deltaSolidAngle;
+
+      // SphericalHarmonics::SH3ylmBasisTrigonometricTerms
+      const float terms[9] = {1.f,     dy,      dz, dx, dx * dy, dy * dz, 3.f * dz * dz - 1.f,
+                              dx * dz, dx * dx - dy * dy};
+      for (size_t lm = 0; lm < 9; ++lm) {
+        rowCoefficients[lm * 3 + 0] += r * terms[lm];
+        rowCoefficients[lm * 3 + 1] += g * terms[lm];
+        rowCoefficients[lm * 3 + 2] += b * terms[lm];
+      }
+      rowSolidAngle += deltaSolidAngle;
+
+      u += du;
+    }
+
+    for (size_t i = 0; i < rowCoefficients.size(); ++i) {
+      result.coefficients[i] += rowCoefficients[i];
+    }
+    result.solidAngle += rowSolidAngle;
+
+    v += dv;
+  }
+
+  return result;
+}
+
+} // end of anonymous namespace
+
 std::array<FileFaceOrientation, 6> CubeMapToSphericalPolynomialTools::FileFaces = {{
   FileFaceOrientation("right", Vector3(1, 0, 0), Vector3(0, 0, -1), Vector3(0, -1, 0)), // +X east
   FileFaceOrientation("left", Vector3(-1, 0, 0), Vector3(0, 0, 1), Vector3(0, -1, 0)),  // -X west
@@ -73,85 +188,34 @@ CubeMapToSphericalPolynomialTools::ConvertCubeMapTextureToSphericalPolynomial(Ba
 SphericalPolynomialPtr
 CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(const CubeMapInfo& cubeInfo)
 {
-  SphericalHarmonics sphericalHarmonics;
-  auto totalSolidAngle = 0.f;
-
-  // The (u,v) range is [-1,+1], so the distance between each texel is 2/Size.
-  const auto du = 2.f / static_cast<float>(cubeInfo.size);
-  const auto dv = du;
-
-  // The (u,v) of the first texel is half a texel from the corner (-1,-1).
-  const auto minUV = du * 0.5f - 1.f;
-
-  for (auto faceIndex = 0u; faceIndex < 6; ++faceIndex) {
-    const auto& fileFace = FileFaces[faceIndex];
-    const auto dataArray = cubeInfo[fileFace.name].float32Array();
-    auto v               = minUV;
-
-    // TODO: we could perform the summation directly into a SphericalPolynomial (SP), which is more
-    // efficient than SphericalHarmonic (SH). This is possible because during the summation we do
-    // not need the SH-specific properties, e.g. orthogonality. Because SP is still linear, so
-    // summation is fine in that basis.
-    const auto stride = cubeInfo.format == Constants::TEXTUREFORMAT_RGBA ? 4u : 3u;
-    for (auto y = 0ull; y < cubeInfo.size; ++y) {
-      auto u = minUV;
-
-      for (size_t x = 0; x < cubeInfo.size; ++x) {
-        // World direction (not normalised)
-        auto worldDirection = fileFace.worldAxisForFileX.scale(u)
-                                .add(fileFace.worldAxisForFileY.scale(v))
-                                .add(fileFace.worldAxisForNormal);
-        worldDirection.normalize();
-
-        const auto deltaSolidAngle = std::pow(1.f + u * u + v * v, -3.f / 2.f);
-
-        auto r = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 0];
-        auto g = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 1];
-        auto b = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 2];
-
-        // Prevent NaN harmonics with extreme HDRI data.
-        if (isNaN(r)) {
-          r = 0.f;
-        }
-        if (isNaN(g)) {
-          g = 0.f;
-        }
-        if (isNaN(b)) {
-          b = 0.f;
-        }
-
-        // Handle Integer types.
-        if (cubeInfo.type == Constants::TEXTURETYPE_UNSIGNED_INT) {
-          r /= 255.f;
-          g /= 255.f;
-          b /= 255.f;
-        }
-
-        // Handle Gamma space textures.
-        if (cubeInfo.gammaSpace) {
-          r = std::pow(Scalar::Clamp(r), Math::ToLinearSpace);
-          g = std::pow(Scalar::Clamp(g), Math::ToLinearSpace);
-          b = std::pow(Scalar::Clamp(b), Math::ToLinearSpace);
-        }
-
-        // Prevent to explode in case of really high dynamic ranges.
-        // sh 3 would not be enough to accurately represent it.
-        const auto max = 4096.f;
-        r              = Scalar::Clamp(r, 0.f, max);
-        g              = Scalar::Clamp(g, 0.f, max);
-        b              = Scalar::Clamp(b, 0.f, max);
-
-        Color3 color(r, g, b);
-
-        sphericalHarmonics.addLight(worldDirection, color, deltaSolidAngle);
-
-        totalSolidAngle += deltaSolidAngle;
-
-        u += du;
-      }
+  // The faces are integrated in parallel and summed in order
+  std::vector<std::future<FaceHarmonics>> jobs;
+  for (auto faceIndex = 1u; faceIndex < 6; ++faceIndex) {
+    jobs.emplace_back(std::async(std::launch::async, [&cubeInfo, faceIndex]() {
+      return integrateFace(cubeInfo, FileFaces[faceIndex]);
+    }));
+  }
 
-      v += dv;
+  auto sum = integrateFace(cubeInfo, FileFaces[0]);
+  for (auto& job : jobs) {
+    const auto face = job.get();
+    for (size_t i = 0; i < sum.coefficients.size(); ++i) {
+      sum.coefficients[i] += face.coefficients[i];
     }
+    sum.solidAngle += face.solidAngle;
+  }
+
+  SphericalHarmonics sphericalHarmonics;
+  const auto totalSolidAngle = static_cast<float>(sum.solidAngle);
+  const std::array<Vector3*, 9> coefficients{
+    {&sphericalHarmonics.l00, &sphericalHarmonics.l1_1, &sphericalHarmonics.l10,
+     &sphericalHarmonics.l11, &sphericalHarmonics.l2_2, &sphericalHarmonics.l2_1,
+     &sphericalHarmonics.l20, &sphericalHarmonics.l21, &sphericalHarmonics.l22}};
+  for (size_t lm = 0; lm < coefficients.size(); ++lm) {
+    const auto constant = static_cast<double>(SphericalHarmonics::SH3ylmBasisConstants[lm]);
+    coefficients[lm]->set(static_cast<float>(sum.coefficients[lm * 3 + 0] * constant),
+                          static_cast<float>(sum.coefficients[lm * 3 + 1] * constant),
+                          static_cast<float>(sum.coefficients[lm * 3 + 2] * constant));
   }
 
   // Solid angle for entire sphere is 4*pi
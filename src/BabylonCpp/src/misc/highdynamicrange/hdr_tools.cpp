@@ -1,41 +1,92 @@
 #include <babylon/misc/highdynamicrange/hdr_tools.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <thread>
+
 #include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 
-float HDRTools::Ldexp(float mantissa, float exponent)
+namespace {
+
+/**
+ * @brief Returns the scale of the mantissas for each RGBE exponent, 2^(exponent - 136) or 0 for a
+ * zero pixel.
+ */
+const std::array<float, 256>& rgbeScales()
 {
-  if (exponent > 1023.f) {
-    return mantissa * std::pow(2.f, 1023.f) * std::pow(2.f, exponent - 1023.f);
-  }
+  static const auto scales = []() {
+    std::array<float, 256> values{};
+    for (int exponent = 1; exponent < 256; ++exponent) {
+      values[static_cast<size_t>(exponent)] = std::ldexp(1.f, exponent - (128 + 8));
+    }
+    return values;
+  }();
+  return scales;
+}
 
-  if (exponent < -1074.f) {
-    return mantissa * std::pow(2.f, -1074.f) * std::pow(2.f, exponent + 1074.f);
+/**
+ * @brief Converts rows of RGBE pixels to RGB floats.
+ * @param rgbe The RGBE bytes of the first row
+ * @param rowStride The distance in bytes between two rows
+ * @param channelStride The distance in bytes between two channels of a pixel
+ * @param pixelStride The distance in bytes between two pixels of a row
+ * @param width The number of pixels per row
+ * @param rowCount The number of rows
+ * @param result Receives the RGB floats of the first row
+ */
+void rgbeToFloat(const uint8_t* rgbe, size_t rowStride, size_t channelStride, size_t pixelStride,
+                 size_t width, size_t rowCount, float* result)
+{
+  const auto& scales = rgbeScales();
+  for (size_t row = 0; row < rowCount; ++row, rgbe += rowStride) {
+    const auto* red   = rgbe;
+    const auto* green = rgbe + channelStride;
+    const auto* blue  = rgbe + 2 * channelStride;
+    const auto* e     = rgbe + 3 * channelStride;
+    for (size_t i = 0; i < width; ++i, result += 3) {
+      const auto offset = i * pixelStride;
+      const auto scale  = scales[e[offset]];
+      result[0]         = static_cast<float>(red[offset]) * scale;
+      result[1]         = static_cast<float>(green[offset]) * scale;
+      result[2]         = static_cast<float>(blue[offset]) * scale;
+    }
   }
-
-  return mantissa * std::pow(2.f, exponent);
 }
 
-void HDRTools::Rgbe2float(Float32Array& float32array, float red, float green, float blue,
-                          float exponent, size_t index)
+/**
+ * @brief Converts an RGBE image to RGB floats, large images are split in bands of rows converted
+ * in parallel.
+ */
+void rgbeImageToFloat(const uint8_t* rgbe, size_t rowStride, size_t channelStride,
+                      size_t pixelStride, size_t width, size_t height, float* result)
 {
-  if (exponent > 0.f) { /*nonzero pixel*/
-    exponent = Ldexp(1.f, exponent - (128.f + 8.f));
-
-    float32array[index + 0] = red * exponent;
-    float32array[index + 1] = green * exponent;
-    float32array[index + 2] = blue * exponent;
+  constexpr size_t minRowsPerBand = 64;
+  const auto bandCount            = std::clamp<size_t>(height / minRowsPerBand, 1,
+                                            std::max(1u, std::thread::hardware_concurrency()));
+
+  std::vector<std::future<void>> jobs;
+  for (size_t band = 1; band < bandCount; ++band) {
+    const auto rowBegin = height * band / bandCount;
+    const auto rowEnd   = height * (band + 1) / bandCount;
+    jobs.emplace_back(std::async(std::launch::async, [=]() {
+      rgbeToFloat(rgbe + rowBegin * rowStride, rowStride, channelStride, pixelStride, width,
+                  rowEnd - rowBegin, result + rowBegin * width * 3);
+    }));
   }
-  else {
-    float32array[index + 0] = 0.f;
-    float32array[index + 1] = 0.f;
-    float32array[index + 2] = 0.f;
+  rgbeToFloat(rgbe, rowStride, channelStride, pixelStride, width, height / bandCount, result);
+  for (auto& job : jobs) {
+    job.get();
   }
 }
 
+} // end of anonymous namespace
+
 std::string HDRTools::readStringLine(const Uint8Array& uint8array, size_t startIndex)
 {
   std::ostringstream line;
@@ -137,15 +188,15 @@ Float32Array HDRTools::RGBE_ReadPixels_RLE(const Uint8Array& uint8array, const H
   auto dataIndex = hdrInfo.dataPosition;
   auto index = 0ull, endIndex = 0ull, i = 0ull;
 
-  ArrayBuffer scanLineArrayBuffer(scanline_width * 4); // four channel R G B E
-  auto scanLineArray = stl_util::to_array<uint8_t>(scanLineArrayBuffer);
-
-  // 3 channels of 4 bytes per pixel in float.
-  ArrayBuffer resultBuffer(hdrInfo.width * hdrInfo.height * 4 * 3);
-  auto resultArray = stl_util::to_array<float>(resultBuffer);
+  // The scanlines are decoded one after the other in four channels R G B E, then converted to
+  // floats in parallel.
+  Uint8Array scanLinesArray(scanline_width * hdrInfo.height * 4);
 
   // read in each successive scanline
   while (num_scanlines > 0) {
+    auto scanLineArray
+      = scanLinesArray.data() + (hdrInfo.height - num_scanlines) * scanline_width * 4;
+
     a = uint8array[dataIndex++];
     b = uint8array[dataIndex++];
     c = uint8array[dataIndex++];
@@ -176,9 +227,8 @@ Float32Array HDRTools::RGBE_ReadPixels_RLE(const Uint8Array& uint8array, const H
             throw std::runtime_error("HDR Bad Format, bad scanline data (run)");
           }
 
-          while (count-- > 0) {
-            scanLineArray[index++] = b;
-          }
+          std::fill_n(scanLineArray + index, count, b);
+          index += count;
         }
         else {
           // a non-run
@@ -189,28 +239,25 @@ Float32Array HDRTools::RGBE_ReadPixels_RLE(const Uint8Array& uint8array, const H
 
           scanLineArray[index++] = b;
           if (--count > 0) {
-            for (size_t j = 0; j < count; ++j) {
-              scanLineArray[index++] = uint8array[dataIndex++];
+            if (dataIndex + count > uint8array.size()) {
+              throw std::runtime_error("HDR Bad Format, bad scanline data (non-run)");
             }
+            std::memcpy(scanLineArray + index, uint8array.data() + dataIndex, count);
+            index += count;
+            dataIndex += count;
           }
         }
       }
     }
 
-    // now convert data from buffer into floats
-    for (i = 0; i < scanline_width; ++i) {
-      a = scanLineArray[i];
-      b = scanLineArray[i + scanline_width];
-      c = scanLineArray[i + 2 * scanline_width];
-      d = scanLineArray[i + 3 * scanline_width];
-
-      Rgbe2float(resultArray, a, b, c, d,
-                 (hdrInfo.height - num_scanlines) * scanline_width * 3 + i * 3);
-    }
-
     --num_scanlines;
   }
 
+  // now convert data from buffer into floats
+  Float32Array resultArray(hdrInfo.width * hdrInfo.height * 3);
+  rgbeImageToFloat(scanLinesArray.data(), scanline_width * 4, scanline_width, 1, scanline_width,
+                   hdrInfo.height, resultArray.data());
+
   return resultArray;
 }
 
@@ -219,32 +266,16 @@ Float32Array HDRTools::RGBE_ReadPixels_NOT_RLE(const Uint8Array& uint8array, con
   // this file is not run length encoded
   // read values sequentially
 
-  auto num_scanlines        = hdrInfo.height;
   const auto scanline_width = hdrInfo.width;
-
-  uint8_t a = 0, b = 0, c = 0, d = 0;
-  auto i         = 0ull;
-  auto dataIndex = hdrInfo.dataPosition;
-
-  // 3 channels of 4 bytes per pixel in float.
-  Float32Array resultArray(hdrInfo.width * hdrInfo.height * 4 * 3);
-
-  // read in each successive scanline
-  while (num_scanlines > 0) {
-    for (i = 0; i < hdrInfo.width; i++) {
-      a = uint8array[dataIndex++];
-      b = uint8array[dataIndex++];
-      c = uint8array[dataIndex++];
-      d = uint8array[dataIndex++];
-
-      Rgbe2float(resultArray, //
-                 a, b, c, d,  //
-                 (hdrInfo.height - num_scanlines) * scanline_width * 3 + i * 3);
-    }
-
-    --num_scanlines;
+  if (hdrInfo.dataPosition + scanline_width * hdrInfo.height * 4 > uint8array.size()) {
+    throw std::runtime_error("HDR Bad Format, missing pixel data");
   }
 
+  // 3 channels per pixel in float.
+  Float32Array resultArray(hdrInfo.width * hdrInfo.height * 3);
+  rgbeImageToFloat(uint8array.data() + hdrInfo.dataPosition, scanline_width * 4, 1, 4,
+                   scanline_width, hdrInfo.height, resultArray.data());
+
   return resultArray;
 }
 
@@ -1,12 +1,40 @@
 #include <babylon/misc/highdynamicrange/panorama_to_cube_map_tools.h>
 
+#include <algorithm>
 #include <cmath>
+#include <future>
 
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Samples the panorama (nearest texel) in a normalized direction.
+ */
+inline void sampleSpherical(float x, float y, float z, const float* panorama, size_t inputWidth,
+                            size_t inputHeight, float* result)
+{
+  // atan2 is in [-PI, PI] and acos in [0, PI], recentered in [0, 1]
+  const auto dx = std::atan2(z, x) / Math::PI * 0.5f + 0.5f;
+  const auto dy = std::acos(std::clamp(y, -1.f, 1.f)) / Math::PI;
+
+  const auto px = std::clamp(static_cast<int>(std::round(dx * static_cast<float>(inputWidth))), 0,
+                             static_cast<int>(inputWidth) - 1);
+  const auto py = std::clamp(static_cast<int>(std::round(dy * static_cast<float>(inputHeight))),
+                             0, static_cast<int>(inputHeight) - 1);
+
+  const auto inputY = inputHeight - static_cast<size_t>(py) - 1;
+  const auto* texel = panorama + (inputY * inputWidth + static_cast<size_t>(px)) * 3;
+  result[0]         = texel[0];
+  result[1]         = texel[1];
+  result[2]         = texel[2];
+}
+
+} // end of anonymous namespace
+
 std::array<Vector3, 4> PanoramaToCubeMapTools::FACE_LEFT{{
   Vector3(-1.f, -1.f, -1.f), //
   Vector3(1.f, -1.f, -1.f),  //
@@ -60,12 +88,22 @@ CubeMapInfo PanoramaToCubeMapTools::ConvertPanoramaToCubemap(const Float32Array&
     return cubeMapInfo;
   }
 
+  // The faces are generated in parallel
+  const std::array<const std::array<Vector3, 4>*, 6> faces{
+    {&FACE_FRONT, &FACE_BACK, &FACE_LEFT, &FACE_RIGHT, &FACE_UP, &FACE_DOWN}};
+  std::vector<std::future<Float32Array>> jobs;
+  for (size_t i = 1; i < faces.size(); ++i) {
+    jobs.emplace_back(std::async(std::launch::async, [&, i]() {
+      return CreateCubemapTexture(size, *faces[i], float32Array, inputWidth, inputHeight);
+    }));
+  }
+
   cubeMapInfo.front = CreateCubemapTexture(size, FACE_FRONT, float32Array, inputWidth, inputHeight);
-  cubeMapInfo.back  = CreateCubemapTexture(size, FACE_BACK, float32Array, inputWidth, inputHeight);
-  cubeMapInfo.left  = CreateCubemapTexture(size, FACE_LEFT, float32Array, inputWidth, inputHeight);
-  cubeMapInfo.right = CreateCubemapTexture(size, FACE_RIGHT, float32Array, inputWidth, inputHeight);
-  cubeMapInfo.up    = CreateCubemapTexture(size, FACE_UP, float32Array, inputWidth, inputHeight);
-  cubeMapInfo.down  = CreateCubemapTexture(size, FACE_DOWN, float32Array, inputWidth, inputHeight);
+  cubeMapInfo.back  = jobs[0].get();
+  cubeMapInfo.left  = jobs[1].get();
+  cubeMapInfo.right = jobs[2].get();
+  cubeMapInfo.up    = jobs[3].get();
+  cubeMapInfo.down  = jobs[4].get();
   cubeMapInfo.size  = size;
   cubeMapInfo.type  = Constants::TEXTURETYPE_FLOAT;
   cubeMapInfo.format     = Constants::TEXTUREFORMAT_RGB;
@@ -79,7 +117,8 @@ Float32Array PanoramaToCubeMapTools::CreateCubemapTexture(size_t texSize,
                                                           const Float32Array& float32Array,
                                                           size_t inputWidth, size_t inputHeight)
 {
-  Float32Array textureArray(texSize * texSize * 4 * 3);
+  // 3 channels per pixels
+  Float32Array textureArray(texSize * texSize * 3);
 
   const auto texSizef = static_cast<float>(texSize);
   const auto rotDX1   = faceData[1].subtract(faceData[0]).scale(1.f / texSizef);
@@ -88,23 +127,33 @@ Float32Array PanoramaToCubeMapTools::CreateCubemapTexture(size_t texSize,
   const auto dy = 1.f / static_cast<float>(texSize);
   auto fy       = 0.f;
 
+  auto* texel = textureArray.data();
   for (size_t y = 0; y < texSize; ++y) {
-    auto xv1 = faceData[0];
-    auto xv2 = faceData[2];
-
-    for (size_t x = 0; x < texSize; ++x) {
-      auto v = xv2.subtract(xv1).scale(fy).add(xv1);
-      v.normalize();
-
-      auto color = CalcProjectionSpherical(v, float32Array, inputWidth, inputHeight);
-
-      // 3 channels per pixels
-      textureArray[y * texSize * 3 + (x * 3) + 0] = color.r;
-      textureArray[y * texSize * 3 + (x * 3) + 1] = color.g;
-      textureArray[y * texSize * 3 + (x * 3) + 2] = color.b;
-
-      xv1 = xv1.add(rotDX1);
-      xv2 = xv2.add(rotDX2);
+    // The directions of the row are interpolated between the two edges of the face
+    float xv1[3] = {faceData[0].x, faceData[0].y, faceData[0].z};
+    float xv2[3] = {faceData[2].x, faceData[2].y, faceData[2].z};
+
+    for (size_t x = 0; x < texSize; ++x, texel += 3) {
+      auto vx = (xv2[0] - xv1[0]) * fy + xv1[0];
+      auto vy = (xv2[1] - xv1[1]) * fy + xv1[1];
+      auto vz = (xv2[2] - xv1[2]) * fy + xv1[2];
+
+      const auto length = std::sqrt(vx * vx + vy * vy + vz * vz);
+      if (length != 0.f) {
+        const auto invLength = 1.f / length;
+        vx *= invLength;
+        vy *= invLength;
+        vz *= invLength;
+      }
+
+      sampleSpherical(vx, vy, vz, float32Array.data(), inputWidth, inputHeight, texel);
+
+      xv1[0] += rotDX1.x;
+      xv1[1] += rotDX1.y;
+      xv1[2] += rotDX1.z;
+      xv2[0] += rotDX2.x;
+      xv2[1] += rotDX2.y;
+      xv2[2] += rotDX2.z;
     }
 
     fy += dy;
@@ -113,49 +162,4 @@ Float32Array PanoramaToCubeMapTools::CreateCubemapTexture(size_t texSize,
   return textureArray;
 }
 
-Color3 PanoramaToCubeMapTools::CalcProjectionSpherical(const Vector3& vDir,
-                                                       const Float32Array& float32Array,
-                                                       size_t inputWidth, size_t inputHeight)
-{
-  auto theta = std::atan2(vDir.z, vDir.x);
-  auto phi   = std::acos(vDir.y);
-
-  while (theta < -Math::PI) {
-    theta += 2.f * Math::PI;
-  }
-  while (theta > Math::PI) {
-    theta -= 2.f * Math::PI;
-  }
-
-  auto dx = theta / Math::PI;
-  auto dy = phi / Math::PI;
-
-  // recenter.
-  dx = dx * 0.5f + 0.5f;
-
-  auto px = static_cast<int>(std::round(dx * static_cast<float>(inputWidth)));
-  if (px < 0) {
-    px = 0;
-  }
-  else if (static_cast<size_t>(px) >= inputWidth) {
-    px = static_cast<int>(inputWidth) - 1;
-  }
-
-  auto py = static_cast<int>(std::round(dy * static_cast<float>(inputHeight)));
-  if (py < 0) {
-    py = 0;
-  }
-  else if (static_cast<size_t>(py) >= inputHeight) {
-    py = static_cast<int>(inputHeight) - 1;
-  }
-
-  const auto inputY = (inputHeight - static_cast<size_t>(py) - 1);
-  const auto _px    = static_cast<size_t>(px);
-  const auto r      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 0];
-  const auto g      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 1];
-  const auto b      = float32Array[inputY * inputWidth * 3 + (_px * 3) + 2];
-
-  return Color3(r, g, b);
-}
-
 } // end of namespace BABYLON
@@ -1,6 +1,10 @@
 #include <babylon/misc/highdynamicrange/pmrem_generator.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <future>
+#include <thread>
 
 namespace BABYLON {
 
@@ -122,6 +126,10 @@ PMREMGenerator<ArrayBufferView>::PMREMGenerator(
     , cosinePowerDropPerMip{_cosinePowerDropPerMip}
     , excludeBase{_excludeBase}
     , fixup{_fixup}
+    , importanceSampling{false}
+    , sampleCount{64}
+    , workerCount{0}
+    , _numMipLevels{0}
 {
 }
 
@@ -157,6 +165,7 @@ void PMREMGenerator<ArrayBufferView>::init()
 
   // Iterate over mip chain, and init ArrayBufferView for mip-chain
   _outputSurface.resize(maxNumMipLevels);
+  _numMipLevels = 0;
   for (unsigned int j = 0; j < maxNumMipLevels; ++j) {
     _outputSurface[j].resize(6);
     // Iterate over faces for output images
@@ -172,7 +181,8 @@ void PMREMGenerator<ArrayBufferView>::init()
 
     // terminate if mip chain becomes too small
     if (mipLevelSize == 0) {
-      maxNumMipLevels = j;
+      _outputSurface.resize(_numMipLevels);
+      maxNumMipLevels = _numMipLevels;
       return;
     }
   }
@@ -193,7 +203,19 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
   float currentSpecularPower = specularPower;
 
   // Build filter lookup tables based on the source miplevel size
-  precomputeFilterLookupTables(inputSize);
+  if (importanceSampling) {
+    buildInputMipChain();
+  }
+  else {
+    precomputeFilterLookupTables(inputSize);
+  }
+
+  // Special case for cosine power mipmap chain. For quality requirement, we
+  // always process the current mipmap from the top mipmap, so every level, face
+  // and row of the output can be filtered independently. The work is split in
+  // tiles of rows processed in parallel.
+  constexpr size_t tileRows = 8;
+  std::vector<_FilterTile> tiles;
 
   // Note that we need to filter the first level before generating mipmap
   // So LevelIndex == 0 is base filtering hen LevelIndex > 0 is mipmap
@@ -208,23 +230,16 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
       currentSpecularPower = 100000.f;
     }
 
-    // Special case for cosine power mipmap chain. For quality requirement, we
-    // always process the current mipmap from the top mipmap
-    std::vector<ArrayBufferView>& srcCubeImage = input;
-    std::vector<std::vector<ArrayBufferView>>& dstCubeImage
-      = _outputSurface[levelIndex];
-    size_t dstSize = outputSize >> levelIndex;
+    const size_t dstSize = static_cast<size_t>(outputSize) >> levelIndex;
 
     // Compute required angle.
-    float angle = getBaseFilterAngle(currentSpecularPower);
+    const float angle = getBaseFilterAngle(currentSpecularPower);
 
-    // filter cube surfaces
-    filterCubeSurfaces(srcCubeImage, inputSize, dstCubeImage, dstSize, angle,
-                       currentSpecularPower);
-
-    // fix seams
-    if (fixup) {
-      fixupCubeEdges(dstCubeImage, dstSize);
+    for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
+      for (size_t v = 0; v < dstSize; v += tileRows) {
+        tiles.emplace_back(_FilterTile{levelIndex, iCubeFace, v, std::min(v + tileRows, dstSize),
+                                       angle, currentSpecularPower});
+      }
     }
 
     // Decrease the specular power to generate the mipmap chain
@@ -236,6 +251,41 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
 
     currentSpecularPower *= cosinePowerDropPerMip;
   }
+
+  // filter cube surfaces
+  std::atomic<size_t> nextTile{0};
+  const auto filterTiles = [this, &tiles, &nextTile]() {
+    for (auto i = nextTile++; i < tiles.size(); i = nextTile++) {
+      const auto& tile   = tiles[i];
+      const auto dstSize = static_cast<size_t>(outputSize) >> tile.levelIndex;
+      if (importanceSampling) {
+        filterCubeSurfacesGGX(_outputSurface[tile.levelIndex], dstSize, tile);
+      }
+      else {
+        filterCubeSurfaces(input, static_cast<size_t>(inputSize), _outputSurface[tile.levelIndex],
+                           dstSize, tile);
+      }
+    }
+  };
+
+  const auto threadCount = std::min<size_t>(
+    tiles.size(),
+    workerCount > 0 ? workerCount : std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> jobs;
+  for (size_t i = 1; i < threadCount; ++i) {
+    jobs.emplace_back(std::async(std::launch::async, filterTiles));
+  }
+  filterTiles();
+  for (auto& job : jobs) {
+    job.get();
+  }
+
+  // fix seams
+  if (fixup) {
+    for (size_t levelIndex = 0; levelIndex < _numMipLevels; ++levelIndex) {
+      fixupCubeEdges(_outputSurface[levelIndex], static_cast<size_t>(outputSize) >> levelIndex);
+    }
+  }
 }
 
 template <typename ArrayBufferView>
@@ -261,9 +311,6 @@ template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::precomputeFilterLookupTables(
   size_t srcCubeMapWidth)
 {
-  // clear pre-existing normalizer cube map
-  _normCubeMap.clear();
-
   // Normalized vectors per cubeface and per-texel solid angle
   buildNormalizerSolidAngleCubemap(srcCubeMapWidth);
 }
@@ -274,23 +321,58 @@ void PMREMGenerator<ArrayBufferView>::buildNormalizerSolidAngleCubemap(
 {
   // iterate over cube faces
   for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
-    // First three channels for norm cube, and last channel for solid angle
-    _normCubeMap.emplace_back(Float32Array(size * size * 4));
+    // Directions and solid angles are stored in separate arrays so that a row
+    // of taps is read with contiguous loads
+    auto& face = _normCubeMap[iCubeFace];
+    face.x.assign(size * size, 0.f);
+    face.y.assign(size * size, 0.f);
+    face.z.assign(size * size, 0.f);
+    face.solidAngle.assign(size * size, 0.f);
 
     // fast texture walk, build normalizer cube map
-    // ArrayBufferView& facesData = input[iCubeFace];
-
     for (size_t v = 0; v < size; v++) {
       for (size_t u = 0; u < size; u++) {
-        Vector3 vect = texelCoordToVect(iCubeFace, u, v, size, fixup);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 0] = vect.x;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 1] = vect.y;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 2] = vect.z;
+        const auto vect = texelCoordToVect(iCubeFace, static_cast<float>(u),
+                                           static_cast<float>(v), size, fixup);
+        face.x[v * size + u] = vect.x;
+        face.y[v * size + u] = vect.y;
+        face.z[v * size + u] = vect.z;
+
+        face.solidAngle[v * size + u] = texelCoordSolidAngle(
+          iCubeFace, static_cast<float>(u), static_cast<float>(v), size);
+      }
+    }
+  }
+}
 
-        float solidAngle = texelCoordSolidAngle(iCubeFace, u, v, size);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 4] = solidAngle;
+template <typename ArrayBufferView>
+void PMREMGenerator<ArrayBufferView>::buildInputMipChain()
+{
+  // Each level is the 2x2 box filtered previous level
+  _inputMips.clear();
+  _inputMips.emplace_back(input);
+  for (size_t parentSize = static_cast<size_t>(inputSize); parentSize > 1; parentSize /= 2) {
+    const auto& previous = _inputMips.back();
+    const auto size      = parentSize / 2;
+    std::vector<ArrayBufferView> level(6);
+    for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
+      const auto& src = previous[iCubeFace];
+      auto& dst       = level[iCubeFace];
+      dst.resize(size * size * numChannels);
+      for (size_t v = 0; v < size; ++v) {
+        for (size_t u = 0; u < size; ++u) {
+          const auto topLeft    = ((2 * v) * parentSize + 2 * u) * numChannels;
+          const auto bottomLeft = topLeft + parentSize * numChannels;
+          for (size_t k = 0; k < numChannels; ++k) {
+            dst[(v * size + u) * numChannels + k]
+              = 0.25f
+                * (src[topLeft + k] + src[topLeft + numChannels + k] + src[bottomLeft + k]
+                   + src[bottomLeft + numChannels + k]);
+          }
+        }
       }
     }
+    _inputMips.emplace_back(std::move(level));
   }
 }
 
@@ -350,11 +432,10 @@ Vector4 PMREMGenerator<ArrayBufferView>::texelCoordToVect(unsigned int faceIdx,
 }
 
 template <typename ArrayBufferView>
-Vector4 PMREMGenerator<ArrayBufferView>::vectToTexelCoord(float x, float y,
-                                                          float z,
-                                                          size_t size) const
+typename PMREMGenerator<ArrayBufferView>::_TexelCoord
+PMREMGenerator<ArrayBufferView>::vectToTexelCoord(float x, float y, float z,
+                                                  size_t size) const
 {
-  Vector4 _vectorTemp{0.f, 0.f, 0.f, 0.f};
   float maxCoord;
   unsigned int faceIdx;
 
@@ -415,11 +496,8 @@ Vector4 PMREMGenerator<ArrayBufferView>::vectToTexelCoord(float x, float y,
   float u = std::floor(static_cast<float>(size - 1) * 0.5f * (nvcU + 1.f));
   float v = std::floor(static_cast<float>(size - 1) * 0.5f * (nvcV + 1.f));
 
-  _vectorTemp.x = static_cast<float>(faceIdx);
-  _vectorTemp.y = u;
-  _vectorTemp.z = v;
-
-  return _vectorTemp;
+  return _TexelCoord{faceIdx, static_cast<size_t>(std::max(u, 0.f)),
+                     static_cast<size_t>(std::max(v, 0.f))};
 }
 
 template <typename ArrayBufferView>
@@ -454,19 +532,24 @@ float PMREMGenerator<ArrayBufferView>::texelCoordSolidAngle(
 
 template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
-  const std::vector<ArrayBufferView>& srcCubeMap, float srcSize,
+  const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
   std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize,
-  float filterConeAngle, float _specularPower)
+  const _FilterTile& tile) const
 {
   // bounding box per face to specify region to process
   std::array<CMGBoundinBox, 6> filterExtents;
 
+  // scratch row of tap dot products
+  Float32Array tapDotProducts(srcSize);
+
+  const auto srcSizef = static_cast<float>(srcSize);
+
   // min angle a src texel can cover (in degrees)
-  float srcTexelAngle = (180.f / (Math::PI)*std::atan2(1.f, srcSize));
+  float srcTexelAngle = (180.f / (Math::PI)*std::atan2(1.f, srcSizef));
 
   // angle about center tap to define filter cone
   // filter angle is 1/2 the cone angle
-  float filterAngle = filterConeAngle / 2.f;
+  float filterAngle = tile.filterConeAngle / 2.f;
 
   // ensure filter angle is larger than a texel
   if (filterAngle < srcTexelAngle) {
@@ -492,30 +575,126 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
   //  reside within the cone angle
   float dotProdThresh = std::cos((Math::PI / 180.f) * filterAngle);
 
-  // process required faces
-  for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
-    // iterate over dst cube map face texel
-    for (unsigned int v = 0; v < dstSize; ++v) {
-      for (unsigned int u = 0; u < dstSize; ++u) {
-        // get center tap direction
-        Vector4 centerTapDir
-          = texelCoordToVect(iCubeFace, u, v, dstSize, fixup).clone();
-
-        // clear old per-face filter extents
-        clearFilterExtents(filterExtents);
-
-        // define per-face filter extents
-        determineFilterExtents(centerTapDir, srcSize, filterSize,
-                               filterExtents);
-
-        // perform filtering of src faces using filter extents
-        Vector3 vect
-          = processFilterExtents(centerTapDir, dotProdThresh, filterExtents,
-                                 srcCubeMap, srcSize, _specularPower);
-
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 0] = vect.x;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 1] = vect.y;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 2] = vect.z;
+  // iterate over the rows of the tile
+  auto& dstFace = dstCubeMap[tile.faceIdx];
+  for (size_t v = tile.vBegin; v < tile.vEnd; ++v) {
+    for (size_t u = 0; u < dstSize; ++u) {
+      // get center tap direction
+      const auto centerTapDir = texelCoordToVect(tile.faceIdx, static_cast<float>(u),
+                                                 static_cast<float>(v), dstSize, fixup);
+
+      // clear old per-face filter extents
+      clearFilterExtents(filterExtents);
+
+      // define per-face filter extents
+      determineFilterExtents(centerTapDir, srcSize, filterSize, filterExtents);
+
+      // perform filtering of src faces using filter extents
+      const auto vect = processFilterExtents(centerTapDir, dotProdThresh, filterExtents,
+                                             srcCubeMap, srcSize, tile.specularPower,
+                                             tapDotProducts);
+
+      dstFace[(v * dstSize + u) * numChannels + 0] = vect.x;
+      dstFace[(v * dstSize + u) * numChannels + 1] = vect.y;
+      dstFace[(v * dstSize + u) * numChannels + 2] = vect.z;
+      if (numChannels > 3) {
+        dstFace[(v * dstSize + u) * numChannels + 3] = vect.w;
+      }
+    }
+  }
+}
+
+template <typename ArrayBufferView>
+void PMREMGenerator<ArrayBufferView>::filterCubeSurfacesGGX(
+  std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize, const _FilterTile& tile) const
+{
+  // Roughness of the GGX distribution matching the Phong specular power
+  const float alpha  = std::sqrt(2.f / (tile.specularPower + 2.f));
+  const float alpha2 = alpha * alpha;
+
+  // Solid angle of a texel of the input
+  const auto srcSizef         = static_cast<float>(inputSize);
+  const float texelSolidAngle = 4.f * Math::PI / (6.f * srcSizef * srcSizef);
+  const auto maxLod           = static_cast<float>(_inputMips.size() - 1);
+
+  // Light directions of the Hammersley samples of the GGX distribution in
+  // tangent space (N = V = R), with their weight (N.L) and their input mip level
+  Float32Array sampleX, sampleY, sampleZ, sampleWeight;
+  std::vector<size_t> sampleLod;
+  for (size_t i = 0; i < sampleCount; ++i) {
+    auto bits = static_cast<uint32_t>(i);
+    bits      = (bits << 16u) | (bits >> 16u);
+    bits      = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits      = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits      = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits      = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    const auto xi1 = static_cast<float>(i) / static_cast<float>(sampleCount);
+    const auto xi2 = static_cast<float>(bits) * 2.3283064365386963e-10f;
+
+    const auto phi      = 2.f * Math::PI * xi1;
+    const auto cosTheta = std::sqrt((1.f - xi2) / (1.f + (alpha2 - 1.f) * xi2));
+    const auto sinTheta = std::sqrt(std::max(0.f, 1.f - cosTheta * cosTheta));
+
+    // L = 2 (V.H) H - V
+    const auto NdotL = 2.f * cosTheta * cosTheta - 1.f;
+    if (NdotL <= 0.f) {
+      continue;
+    }
+    sampleX.emplace_back(2.f * cosTheta * sinTheta * std::cos(phi));
+    sampleY.emplace_back(2.f * cosTheta * sinTheta * std::sin(phi));
+    sampleZ.emplace_back(NdotL);
+    sampleWeight.emplace_back(NdotL);
+
+    // Filtered importance sampling: the mip level whose texels cover the solid
+    // angle of the sample, pdf = D(H) / 4 when N = V
+    const auto d                = cosTheta * cosTheta * (alpha2 - 1.f) + 1.f;
+    const auto pdf              = alpha2 / (Math::PI * d * d) / 4.f;
+    const auto sampleSolidAngle = 1.f / (static_cast<float>(sampleCount) * pdf);
+    const auto lod
+      = std::clamp(0.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.f, 0.f, maxLod);
+    sampleLod.emplace_back(static_cast<size_t>(std::round(lod)));
+  }
+
+  auto& dstFace = dstCubeMap[tile.faceIdx];
+  std::array<double, 4> dstAccum;
+  for (size_t v = tile.vBegin; v < tile.vEnd; ++v) {
+    for (size_t u = 0; u < dstSize; ++u) {
+      const auto n = texelCoordToVect(tile.faceIdx, static_cast<float>(u), static_cast<float>(v),
+                                      dstSize, fixup);
+
+      // tangent frame around the normal
+      const bool useZ = std::abs(n.z) < 0.999f;
+      auto tx = useZ ? -n.y : 0.f;
+      auto ty = useZ ? n.x : -n.z;
+      auto tz = useZ ? 0.f : n.y;
+      const auto invLength = 1.f / std::sqrt(tx * tx + ty * ty + tz * tz);
+      tx *= invLength;
+      ty *= invLength;
+      tz *= invLength;
+      const auto bx = n.y * tz - n.z * ty;
+      const auto by = n.z * tx - n.x * tz;
+      const auto bz = n.x * ty - n.y * tx;
+
+      dstAccum.fill(0.0);
+      double weightAccum = 0.0;
+      for (size_t i = 0; i < sampleX.size(); ++i) {
+        const auto lx = tx * sampleX[i] + bx * sampleY[i] + n.x * sampleZ[i];
+        const auto ly = ty * sampleX[i] + by * sampleY[i] + n.y * sampleZ[i];
+        const auto lz = tz * sampleX[i] + bz * sampleY[i] + n.z * sampleZ[i];
+
+        const auto lodSize = static_cast<size_t>(inputSize) >> sampleLod[i];
+        const auto coord   = vectToTexelCoord(lx, ly, lz, lodSize);
+        const auto* texel  = &_inputMips[sampleLod[i]][coord.faceIdx][
+          (coord.v * lodSize + coord.u) * numChannels];
+        for (size_t k = 0; k < numChannels; ++k) {
+          dstAccum[k] += sampleWeight[i] * texel[k];
+        }
+        weightAccum += sampleWeight[i];
+      }
+
+      for (size_t k = 0; k < numChannels; ++k) {
+        dstFace[(v * dstSize + u) * numChannels + k]
+          = static_cast<float>(dstAccum[k] / weightAccum);
       }
     }
   }
@@ -523,7 +702,7 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
 
 template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::clearFilterExtents(
-  std::array<CMGBoundinBox, 6>& filterExtents)
+  std::array<CMGBoundinBox, 6>& filterExtents) const
 {
   for (auto& filterExtent : filterExtents) {
     filterExtent.clear();
@@ -532,7 +711,7 @@ void PMREMGenerator<ArrayBufferView>::clearFilterExtents(
 
 template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::determineFilterExtents(
-  const Vector4& centerTapDir, size_t srcSize, size_t bboxSize,
+  const Vector4& centerTapDir, size_t _srcSize, float bboxSize,
   std::array<CMGBoundinBox, 6>& filterExtents) const
 {
   // neighboring face and bleed over amount, and width of BBOX for
@@ -546,11 +725,12 @@ void PMREMGenerator<ArrayBufferView>::determineFilterExtents(
   unsigned int oppositeFaceIdx = 0;
 
   // get face idx, and u, v info from center tap dir
-  Vector3 result
-    = vectToTexelCoord(centerTapDir.x, centerTapDir.y, centerTapDir.z, srcSize);
-  auto faceIdx         = static_cast<unsigned>(result.x);
-  float u              = result.y;
-  float v              = result.z;
+  const auto srcSize = static_cast<float>(_srcSize);
+  const auto result
+    = vectToTexelCoord(centerTapDir.x, centerTapDir.y, centerTapDir.z, _srcSize);
+  const auto faceIdx = result.faceIdx;
+  const auto u       = static_cast<float>(result.u);
+  const auto v       = static_cast<float>(result.v);
 
   // define bbox size within face
   filterExtents[faceIdx].augment(u - bboxSize, v - bboxSize, 0);
@@ -687,127 +867,101 @@ Vector4 PMREMGenerator<ArrayBufferView>::processFilterExtents(
   const Vector4& centerTapDir, float dotProdThresh,
   const std::array<CMGBoundinBox, 6>& filterExtents,
   const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
-  size_t _specularPower) const
+  float _specularPower, Float32Array& tapDotProducts) const
 {
   Vector4 _vectorTemp{0.f, 0.f, 0.f, 0.f};
 
   // accumulators are 64-bit floats in order to have the precision needed
   // over a summation of a large number of pixels
-  std::array<float, 4> dstAccum{{0, 0, 0, 0}};
-  float weightAccum   = 0.f;
+  std::array<double, 4> dstAccum{{0, 0, 0, 0}};
+  double weightAccum  = 0.0;
   size_t nSrcChannels = numChannels;
 
   // norm cube map and srcCubeMap have same face width
   size_t faceWidth = srcSize;
 
-  // amount to add to pointer to move to next scanline in images
-  size_t normCubePitch = faceWidth * 4; // 4 channels in normCubeMap.
-  size_t srcCubePitch
-    = faceWidth
-      * numChannels; // numChannels correponds to the cubemap number of channel
-
   unsigned int IsPhongBRDF = 1; // Only works in Phong BRDF yet.
   //(a_LightingModel == CP_LIGHTINGMODEL_PHONG_BRDF || a_LightingModel ==
   // CP_LIGHTINGMODEL_BLINN_BRDF) ? 1 : 0; // This value will be added to the
   // specular power
+  const auto exponent = _specularPower + static_cast<float>(IsPhongBRDF);
 
   // iterate over cubefaces
   for (unsigned int iFaceIdx = 0; iFaceIdx < 6; iFaceIdx++) {
 
     // if bbox is non empty
     if (!filterExtents[iFaceIdx].empty()) {
-      float uStart = filterExtents[iFaceIdx].min.x;
-      float vStart = filterExtents[iFaceIdx].min.y;
-      float uEnd   = filterExtents[iFaceIdx].max.x;
-      float vEnd   = filterExtents[iFaceIdx].max.y;
+      const auto uStart = static_cast<size_t>(filterExtents[iFaceIdx].min.x);
+      const auto vStart = static_cast<size_t>(filterExtents[iFaceIdx].min.y);
+      const auto uEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.x);
+      const auto vEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.y);
 
-      auto startIndexNormCubeMap = static_cast<size_t>(4.f * ((vStart * faceWidth) + uStart));
-      auto startIndexSrcCubeMap
-        = static_cast<size_t>(numChannels * ((vStart * faceWidth) + uStart));
+      const auto& normFace = _normCubeMap[iFaceIdx];
+      const auto& srcFace  = srcCubeMap[iFaceIdx];
 
       // note that <= is used to ensure filter extents always encompass at least
       // one pixel if bbox is non empty
-      for (float v = vStart; v <= vEnd; v++) {
-        float normCubeRowWalk = 0;
-        float srcCubeRowWalk  = 0;
-
-        for (float u = uStart; u <= uEnd; u++) {
-          // pointer to direction in cube map associated with texel
-          float texelVectX = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 0];
-          float texelVectY = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 1];
-          float texelVectZ = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 2];
-
-          // check dot product to see if texel is within cone
-          float tapDotProd = texelVectX * centerTapDir.x
-                             + texelVectY * centerTapDir.y
-                             + texelVectZ * centerTapDir.z;
+      for (size_t v = vStart; v <= vEnd; v++) {
+        const auto rowStart = v * faceWidth + uStart;
+        const auto rowSize  = uEnd - uStart + 1;
+
+        // check dot product to see if texel is within cone, the directions of
+        // the row are contiguous so this loop is vectorized
+        const auto* texelVectX = normFace.x.data() + rowStart;
+        const auto* texelVectY = normFace.y.data() + rowStart;
+        const auto* texelVectZ = normFace.z.data() + rowStart;
+        for (size_t i = 0; i < rowSize; ++i) {
+          tapDotProducts[i] = texelVectX[i] * centerTapDir.x + texelVectY[i] * centerTapDir.y
+                              + texelVectZ[i] * centerTapDir.z;
+        }
 
+        for (size_t i = 0; i < rowSize; ++i) {
+          const auto tapDotProd = tapDotProducts[i];
           if (tapDotProd >= dotProdThresh && tapDotProd > 0.f) {
-            // solid angle stored in 4th channel of normalizer/solid angle cube
-            // map
-            float weight = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                  + normCubeRowWalk + 3];
+            // solid angle stored in the normalizer/solid angle cube map
+            float weight = normFace.solidAngle[rowStart + i];
 
             // Here we decide if we use a Phong/Blinn or a Phong/Blinn BRDF.
             // Phong/Blinn BRDF is just the Phong/Blinn model multiply by the
             // cosine of the lambert law
             // so just adding one to specularpower do the trick.
-            weight *= std::pow(tapDotProd, (_specularPower + IsPhongBRDF));
-
-            // iterate over channels
-            for (size_t k = 0; k < nSrcChannels;
-                 k++) //(aSrcCubeMap[iFaceIdx].m_NumChannels) //up to 4 channels
-            {
-              dstAccum[k] += weight
-                             * srcCubeMap[iFaceIdx][startIndexSrcCubeMap
-                                                    + srcCubeRowWalk];
-              srcCubeRowWalk++;
+            weight *= std::pow(tapDotProd, exponent);
+
+            // iterate over channels, up to 4 channels
+            const auto* texel = srcFace.data() + (rowStart + i) * nSrcChannels;
+            for (size_t k = 0; k < nSrcChannels; k++) {
+              dstAccum[k] += weight * texel[k];
             }
 
             weightAccum += weight; // accumulate weight
           }
-          else {
-            // step across source pixel
-            srcCubeRowWalk += nSrcChannels;
-          }
-
-          normCubeRowWalk += 4; // 4 channels per norm cube map.
         }
-
-        startIndexNormCubeMap += normCubePitch;
-        startIndexSrcCubeMap += srcCubePitch;
       }
     }
   }
 
   // divide through by weights if weight is non zero
-  if (weightAccum != 0.f) {
-    _vectorTemp.x = (dstAccum[0] / weightAccum);
-    _vectorTemp.y = (dstAccum[1] / weightAccum);
-    _vectorTemp.z = (dstAccum[2] / weightAccum);
+  if (weightAccum != 0.0) {
+    _vectorTemp.x = static_cast<float>(dstAccum[0] / weightAccum);
+    _vectorTemp.y = static_cast<float>(dstAccum[1] / weightAccum);
+    _vectorTemp.z = static_cast<float>(dstAccum[2] / weightAccum);
     if (numChannels > 3) {
-      _vectorTemp.w = (dstAccum[3] / weightAccum);
+      _vectorTemp.w = static_cast<float>(dstAccum[3] / weightAccum);
     }
   }
   else {
     // otherwise sample nearest
     // get face idx and u, v texel coordinate in face
-    Vector3 coord = vectToTexelCoord(centerTapDir.x, centerTapDir.y,
-                                     centerTapDir.z, srcSize)
-                      .clone();
-
-    _vectorTemp.x
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 0];
-    _vectorTemp.y
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 1];
-    _vectorTemp.z
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 2];
+    const auto coord
+      = vectToTexelCoord(centerTapDir.x, centerTapDir.y, centerTapDir.z, srcSize);
+    const auto* texel
+      = srcCubeMap[coord.faceIdx].data() + numChannels * (coord.v * srcSize + coord.u);
+
+    _vectorTemp.x = texel[0];
+    _vectorTemp.y = texel[1];
+    _vectorTemp.z = texel[2];
     if (numChannels > 3) {
-      _vectorTemp.z
-        = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 3];
+      _vectorTemp.w = texel[3];
     }
   }
 
@@ -837,7 +991,7 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   if (cubeMapSize == 1) {
     // iterate over channels
     for (unsigned int k = 0; k < numChannels; ++k) {
-      size_t accum = 0.f;
+      float accum = 0.f;
 
       // iterate over faces to accumulate face colors
       for (unsigned int iFace = 0; iFace < 6; ++iFace) {
@@ -859,13 +1013,13 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   // iterate over faces to collect list of corner texel pointers
   for (unsigned int iFace = 0; iFace < 6; ++iFace) {
     // the 4 corner pointers for this face
+    const auto size            = static_cast<uint32_t>(cubeMapSize);
+    const auto channels        = static_cast<uint32_t>(numChannels);
     faceCornerStartIndicies[0] = {iFace, 0};
-    faceCornerStartIndicies[1] = {iFace, ((cubeMapSize - 1) * numChannels)};
-    faceCornerStartIndicies[2]
-      = {iFace, ((cubeMapSize) * (cubeMapSize - 1) * numChannels)};
+    faceCornerStartIndicies[1] = {iFace, ((size - 1) * channels)};
+    faceCornerStartIndicies[2] = {iFace, ((size) * (size - 1) * channels)};
     faceCornerStartIndicies[3]
-      = {iFace, ((((cubeMapSize) * (cubeMapSize - 1)) + (cubeMapSize - 1))
-                 * numChannels)};
+      = {iFace, ((((size) * (size - 1)) + (size - 1)) * channels)};
 
     // iterate over face corners to collect cube corner pointers
     for (unsigned int iCorner = 0; iCorner < 4; ++iCorner) {
@@ -909,30 +1063,32 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
     unsigned int neighborFace = PMREMGenerator::_sgCubeNgh[face][edge][0];
     unsigned int neighborEdge = PMREMGenerator::_sgCubeNgh[face][edge][1];
 
-    unsigned int edgeStartIndex = 0; // a_CubeMap[face].m_ImgData;
-    unsigned int neighborEdgeStartIndex
-      = 0; // a_CubeMap[neighborFace].m_ImgData;
-    unsigned int edgeWalk         = 0;
-    unsigned int neighborEdgeWalk = 0;
+    // signed, the neighbor edge can be walked backwards
+    const auto size     = static_cast<int64_t>(cubeMapSize);
+    const auto channels = static_cast<int64_t>(numChannels);
+    int64_t edgeStartIndex         = 0; // a_CubeMap[face].m_ImgData;
+    int64_t neighborEdgeStartIndex = 0; // a_CubeMap[neighborFace].m_ImgData;
+    int64_t edgeWalk               = 0;
+    int64_t neighborEdgeWalk       = 0;
 
     // Determine walking pointers based on edge type
     // e.g. CP_EDGE_LEFT, CP_EDGE_RIGHT, CP_EDGE_TOP, CP_EDGE_BOTTOM
     switch (edge) {
       case PMREMGenerator::CP_EDGE_LEFT:
         // no change to faceEdgeStartPtr
-        edgeWalk = numChannels * cubeMapSize;
+        edgeWalk = channels * size;
         break;
       case PMREMGenerator::CP_EDGE_RIGHT:
-        edgeStartIndex += (cubeMapSize - 1) * numChannels;
-        edgeWalk = numChannels * cubeMapSize;
+        edgeStartIndex += (size - 1) * channels;
+        edgeWalk = channels * size;
         break;
       case PMREMGenerator::CP_EDGE_TOP:
         // no change to faceEdgeStartPtr
-        edgeWalk = numChannels;
+        edgeWalk = channels;
         break;
       case PMREMGenerator::CP_EDGE_BOTTOM:
-        edgeStartIndex += (cubeMapSize) * (cubeMapSize - 1) * numChannels;
-        edgeWalk = numChannels;
+        edgeStartIndex += (size) * (size - 1) * channels;
+        edgeWalk = channels;
         break;
     }
 
@@ -956,25 +1112,25 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
       switch (neighborEdge) {
         case PMREMGenerator::CP_EDGE_LEFT: // start at lower left and walk up
           neighborEdgeStartIndex
-            += (cubeMapSize - 1) * (cubeMapSize)*numChannels;
-          neighborEdgeWalk = -(numChannels * cubeMapSize);
+            += (size - 1) * (size)*channels;
+          neighborEdgeWalk = -(channels * size);
           break;
         case PMREMGenerator::CP_EDGE_RIGHT: // start at lower right and walk up
           neighborEdgeStartIndex
-            += ((cubeMapSize - 1) * (cubeMapSize) + (cubeMapSize - 1))
-               * numChannels;
-          neighborEdgeWalk = -(numChannels * cubeMapSize);
+            += ((size - 1) * (size) + (size - 1))
+               * channels;
+          neighborEdgeWalk = -(channels * size);
           break;
         case PMREMGenerator::CP_EDGE_TOP: // start at upper right and walk left
-          neighborEdgeStartIndex += (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = -numChannels;
+          neighborEdgeStartIndex += (size - 1) * channels;
+          neighborEdgeWalk = -channels;
           break;
         case PMREMGenerator::CP_EDGE_BOTTOM: // start at lower right and walk
                                              // left
           neighborEdgeStartIndex
-            += ((cubeMapSize - 1) * (cubeMapSize) + (cubeMapSize - 1))
-               * numChannels;
-          neighborEdgeWalk = -numChannels;
+            += ((size - 1) * (size) + (size - 1))
+               * channels;
+          neighborEdgeWalk = -channels;
           break;
       }
     }
@@ -984,23 +1140,23 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
         case PMREMGenerator::CP_EDGE_LEFT: // start at upper left and walk down
           // no change to neighborEdgeStartPtr for this case since it points
           // to the upper left corner already
-          neighborEdgeWalk = numChannels * cubeMapSize;
+          neighborEdgeWalk = channels * size;
           break;
         case PMREMGenerator::CP_EDGE_RIGHT: // start at upper right and walk
                                             // down
-          neighborEdgeStartIndex += (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = numChannels * cubeMapSize;
+          neighborEdgeStartIndex += (size - 1) * channels;
+          neighborEdgeWalk = channels * size;
           break;
         case PMREMGenerator::CP_EDGE_TOP: // start at upper left and walk left
           // no change to neighborEdgeStartPtr for this case since it points
           // to the upper left corner already
-          neighborEdgeWalk = numChannels;
+          neighborEdgeWalk = channels;
           break;
         case PMREMGenerator::CP_EDGE_BOTTOM: // start at lower left and walk
                                              // left
           neighborEdgeStartIndex
-            += (cubeMapSize) * (cubeMapSize - 1) * numChannels;
-          neighborEdgeWalk = numChannels;
+            += (size) * (size - 1) * channels;
+          neighborEdgeWalk = channels;
           break;
       }
     }
@@ -1019,17 +1175,17 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
     for (unsigned int j = 1; j < (cubeMapSize - 1); j++) {
       // for each set of taps along edge, average them
       // and rewrite the results into the edges
-      for (unsigned int k = 0; k < numChannels; k++) {
-        ArrayBufferView& edgeTap = cubeMap[face][edgeStartIndex + k];
-        ArrayBufferView& neighborEdgeTap
-          = cubeMap[neighborFace][neighborEdgeStartIndex + k];
+      for (int64_t k = 0; k < channels; k++) {
+        auto& edgeTap         = cubeMap[face][static_cast<size_t>(edgeStartIndex + k)];
+        auto& neighborEdgeTap
+          = cubeMap[neighborFace][static_cast<size_t>(neighborEdgeStartIndex + k)];
 
         // compute average of tap intensity values
         float avgTap = 0.5f * (edgeTap + neighborEdgeTap);
 
         // propagate average of taps to edge taps
-        cubeMap[face][edgeStartIndex + k]                 = avgTap;
-        cubeMap[neighborFace][neighborEdgeStartIndex + k] = avgTap;
+        edgeTap         = avgTap;
+        neighborEdgeTap = avgTap;
       }
 
       edgeStartIndex += edgeWalk;
@@ -1038,4 +1194,6 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   }
 }
 
+template class PMREMGenerator<Float32Array>;
+
 } // end of namespace BABYLON
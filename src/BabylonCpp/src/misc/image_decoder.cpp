@@ -0,0 +1,186 @@
+#include <babylon/misc/image_decoder.h>
+
+#include <algorithm>
+
+#include <babylon/misc/file_tools.h>
+
+namespace BABYLON {
+
+ImageDecoder::ImageDecoder(size_t workerCount) : _pendingCount{0}, _stopping{false}
+{
+  if (workerCount == 0) {
+    workerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  _workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ImageDecoder::~ImageDecoder()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _jobAvailable.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t ImageDecoder::workerCount() const
+{
+  return _workers.size();
+}
+
+size_t ImageDecoder::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pendingCount;
+}
+
+void ImageDecoder::decode(const std::variant<std::string, ArrayBuffer, ArrayBufferView>& input,
+                          bool flipVertically, const OnDecodedFunction& onDecoded,
+                          const OnErrorFunction& onError)
+{
+  _enqueue(
+    [input, flipVertically](_DecodeResult& result) {
+      if (std::holds_alternative<std::string>(input)) {
+        result.image = FileTools::StringToImage(std::get<std::string>(input), flipVertically);
+      }
+      else if (std::holds_alternative<ArrayBuffer>(input)) {
+        result.image = FileTools::ArrayBufferToImage(std::get<ArrayBuffer>(input), flipVertically);
+      }
+      else {
+        result.image = FileTools::ArrayBufferToImage(
+          std::get<ArrayBufferView>(input).uint8Array(), flipVertically);
+      }
+    },
+    onDecoded, onError);
+}
+
+void ImageDecoder::decodeUrl(const std::string& url, bool flipVertically,
+                             const OnDecodedFunction& onDecoded, const OnErrorFunction& onError)
+{
+  _enqueue(
+    [url, flipVertically](_DecodeResult& result) {
+      FileTools::LoadImageFromUrl(
+        url, [&result](const Image& image) { result.image = image; },
+        [&result](const std::string& message, const std::string& exception) {
+          result.failed       = true;
+          result.errorMessage = message;
+          result.exception    = exception;
+        },
+        flipVertically);
+    },
+    onDecoded, onError);
+}
+
+size_t ImageDecoder::processDecodedImages()
+{
+  std::vector<_DecodeResult> decoded;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    decoded.swap(_decoded);
+    _pendingCount -= decoded.size();
+  }
+
+  for (const auto& result : decoded) {
+    if (result.failed) {
+      if (result.onError) {
+        result.onError(result.errorMessage, result.exception);
+      }
+    }
+    else if (result.onDecoded) {
+      result.onDecoded(result.image);
+    }
+  }
+
+  return decoded.size();
+}
+
+size_t ImageDecoder::waitForDecodedImages()
+{
+  size_t count = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _jobDone.wait(lock, [this]() { return _decoded.size() == _pendingCount; });
+      if (_pendingCount == 0) {
+        break;
+      }
+    }
+    // The callbacks can queue more images
+    count += processDecodedImages();
+  }
+
+  return count;
+}
+
+std::vector<Image> ImageDecoder::DecodeBatch(const std::vector<ArrayBuffer>& buffers,
+                                             bool flipVertically, size_t workerCount)
+{
+  if (workerCount == 0) {
+    workerCount = std::thread::hardware_concurrency();
+  }
+
+  std::vector<Image> images(buffers.size());
+  ImageDecoder decoder(std::max<size_t>(1, std::min(workerCount, buffers.size())));
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    decoder.decode(buffers[i], flipVertically,
+                   [&images, i](const Image& image) { images[i] = image; });
+  }
+  decoder.waitForDecodedImages();
+
+  return images;
+}
+
+void ImageDecoder::_enqueue(const std::function<void(_DecodeResult& result)>& job,
+                            const OnDecodedFunction& onDecoded, const OnErrorFunction& onError)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_pendingCount;
+    _jobs.emplace_back([this, job, onDecoded, onError]() {
+      _DecodeResult result;
+      try {
+        job(result);
+      }
+      catch (const std::exception& e) {
+        result.failed       = true;
+        result.errorMessage = "Image decoding failed";
+        result.exception    = e.what();
+      }
+      result.onDecoded = onDecoded;
+      result.onError   = onError;
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _decoded.emplace_back(std::move(result));
+      }
+      _jobDone.notify_all();
+    });
+  }
+  _jobAvailable.notify_one();
+}
+
+void ImageDecoder::_workerLoop()
+{
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _jobAvailable.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+      if (_stopping && _jobs.empty()) {
+        return;
+      }
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+    job();
+  }
+}
+
+} // end of namespace BABYLON
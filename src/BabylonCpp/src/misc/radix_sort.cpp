@@ -0,0 +1,113 @@
+#include <babylon/misc/radix_sort.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Strict ordering of the indices by key, ties broken by index (stable sort order).
+ */
+inline bool isBefore(const std::vector<uint64_t>& keys, uint32_t a, uint32_t b)
+{
+  return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+}
+
+} // end of anonymous namespace
+
+RadixSort::RadixSort() = default;
+
+RadixSort::~RadixSort() = default;
+
+void RadixSort::sort(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order)
+{
+  const auto count = keys.size();
+  order.resize(count);
+  std::iota(order.begin(), order.end(), 0u);
+  if (count < 2) {
+    return;
+  }
+
+  // Build the histograms of all the passes at once
+  std::array<std::array<uint32_t, 256>, 8> histograms{};
+  for (auto key : keys) {
+    for (size_t pass = 0; pass < 8; ++pass) {
+      ++histograms[pass][(key >> (pass * 8)) & 0xFF];
+    }
+  }
+
+  _scratch.resize(count);
+  for (size_t pass = 0; pass < 8; ++pass) {
+    auto& histogram = histograms[pass];
+    // All keys share the same byte, the pass would not change the order
+    if (histogram[(keys[0] >> (pass * 8)) & 0xFF] == count) {
+      continue;
+    }
+    uint32_t offset = 0;
+    for (auto& bucket : histogram) {
+      const auto bucketCount = bucket;
+      bucket                 = offset;
+      offset += bucketCount;
+    }
+    for (auto index : order) {
+      _scratch[histogram[(keys[index] >> (pass * 8)) & 0xFF]++] = index;
+    }
+    order.swap(_scratch);
+  }
+}
+
+bool RadixSort::sortCoherent(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order)
+{
+  const auto count = keys.size();
+  if (order.size() != count) {
+    sort(keys, order);
+    return false;
+  }
+
+  // Count the elements out of order
+  size_t descents = 0;
+  for (size_t i = 1; i < count; ++i) {
+    if (isBefore(keys, order[i], order[i - 1])) {
+      ++descents;
+    }
+  }
+  if (descents == 0) {
+    return true;
+  }
+
+  // Nearly sorted, use an insertion sort as long as the elements do not move too far
+  if (descents <= std::max<size_t>(8, count / 32)) {
+    size_t moves          = 0;
+    const size_t maxMoves = count * 4;
+    for (size_t i = 1; i < count && moves <= maxMoves; ++i) {
+      const auto index = order[i];
+      size_t j         = i;
+      while (j > 0 && isBefore(keys, index, order[j - 1])) {
+        order[j] = order[j - 1];
+        --j;
+      }
+      order[j] = index;
+      moves += i - j;
+    }
+    if (moves <= maxMoves) {
+      return false;
+    }
+  }
+
+  sort(keys, order);
+  return false;
+}
+
+uint32_t RadixSort::FloatToOrderedBits(float value)
+{
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  // Negative floats are ordered backwards, positive floats need to go after them
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,278 @@
+#include <babylon/misc/texture_disk_cache.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/maths/spherical_polynomial.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr char Magic[8]               = {'B', 'T', 'E', 'X', 'C', 'A', 'C', 'H'};
+constexpr uint32_t Version            = 1;
+constexpr size_t Alignment            = 16;
+constexpr size_t PolynomialFloatCount = 27;
+
+struct CacheFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+  uint32_t format;
+  uint32_t type;
+  uint32_t levelCount;
+  uint32_t polynomialFloatCount;
+  uint32_t reserved;
+}; // end of struct CacheFileHeader
+
+struct CacheState {
+  std::mutex mutex;
+  std::string directory;
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> misses{0};
+  std::atomic<size_t> stores{0};
+  std::atomic<size_t> bytesSaved{0};
+}; // end of struct CacheState
+
+CacheState& cacheState()
+{
+  static CacheState state;
+  return state;
+}
+
+std::string cacheDirectory()
+{
+  auto& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.directory;
+}
+
+std::string cacheFilename(const std::string& directory, const std::string& key)
+{
+  return directory + "/" + key + TextureDiskCache::Extension;
+}
+
+size_t align(size_t offset)
+{
+  return (offset + Alignment - 1) / Alignment * Alignment;
+}
+
+/**
+ * @brief FNV-1a variant hashing 8 bytes per step.
+ */
+uint64_t hashBytes(const char* data, size_t size, uint64_t hash)
+{
+  constexpr uint64_t prime = 0x100000001b3ull;
+  size_t i                 = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, data + i, sizeof(uint64_t));
+    hash = (hash ^ word) * prime;
+    hash ^= hash >> 29;
+  }
+  for (; i < size; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+  }
+  return hash;
+}
+
+std::vector<float> polynomialToArray(const SphericalPolynomial& polynomial)
+{
+  std::vector<float> values;
+  values.reserve(PolynomialFloatCount);
+  for (const auto* coefficient :
+       {&polynomial.x, &polynomial.y, &polynomial.z, &polynomial.xx, &polynomial.yy,
+        &polynomial.zz, &polynomial.xy, &polynomial.yz, &polynomial.zx}) {
+    values.insert(values.end(), {coefficient->x, coefficient->y, coefficient->z});
+  }
+  return values;
+}
+
+SphericalPolynomialPtr polynomialFromArray(const float* values)
+{
+  auto polynomial = std::make_shared<SphericalPolynomial>();
+  for (auto* coefficient :
+       {&polynomial->x, &polynomial->y, &polynomial->z, &polynomial->xx, &polynomial->yy,
+        &polynomial->zz, &polynomial->xy, &polynomial->yz, &polynomial->zx}) {
+    coefficient->set(values[0], values[1], values[2]);
+    values += 3;
+  }
+  return polynomial;
+}
+
+} // end of anonymous namespace
+
+void TextureDiskCache::SetDirectory(const std::string& directory)
+{
+  auto& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.directory = directory;
+}
+
+bool TextureDiskCache::IsEnabled()
+{
+  return !cacheDirectory().empty();
+}
+
+std::string TextureDiskCache::Key(std::string_view source, const std::string& parameters)
+{
+  auto hash = hashBytes(source.data(), source.size(), 0xcbf29ce484222325ull);
+  hash      = hashBytes(parameters.data(), parameters.size(), hash);
+
+  std::ostringstream key;
+  key << std::hex << hash << "-" << std::dec << source.size();
+  return key.str();
+}
+
+std::optional<TextureDiskCacheEntry> TextureDiskCache::Load(const std::string& key)
+{
+  const auto directory = cacheDirectory();
+  if (directory.empty()) {
+    return std::nullopt;
+  }
+
+  auto& state     = cacheState();
+  auto mappedFile = std::make_shared<MemoryMappedFile>();
+  if (!mappedFile->open(cacheFilename(directory, key))) {
+    ++state.misses;
+    return std::nullopt;
+  }
+
+  // The file is validated before use, a corrupted file counts as a miss
+  const auto data = mappedFile->view();
+  CacheFileHeader header{};
+  if (data.size() < sizeof(header)) {
+    ++state.misses;
+    return std::nullopt;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version
+      || (header.polynomialFloatCount != 0 && header.polynomialFloatCount != PolynomialFloatCount)
+      || header.levelCount > (data.size() - sizeof(header)) / sizeof(uint64_t)) {
+    ++state.misses;
+    return std::nullopt;
+  }
+
+  std::vector<uint64_t> levelSizes(header.levelCount);
+  size_t offset = sizeof(header);
+  std::memcpy(levelSizes.data(), data.data() + offset, levelSizes.size() * sizeof(uint64_t));
+  offset += levelSizes.size() * sizeof(uint64_t);
+
+  const auto polynomialOffset = offset;
+  offset                      = align(offset + header.polynomialFloatCount * sizeof(float));
+  if (polynomialOffset + header.polynomialFloatCount * sizeof(float) > data.size()) {
+    ++state.misses;
+    return std::nullopt;
+  }
+
+  TextureDiskCacheEntry entry;
+  size_t payloadSize = 0;
+  for (const auto levelSize : levelSizes) {
+    if (offset > data.size() || levelSize > data.size() - offset) {
+      ++state.misses;
+      return std::nullopt;
+    }
+    entry.levels.emplace_back(data.substr(offset, levelSize));
+    payloadSize += levelSize;
+    offset = align(offset + levelSize);
+  }
+
+  if (header.polynomialFloatCount == PolynomialFloatCount) {
+    float values[PolynomialFloatCount];
+    std::memcpy(values, data.data() + polynomialOffset, sizeof(values));
+    entry.sphericalPolynomial = polynomialFromArray(values);
+  }
+
+  entry.width      = static_cast<int>(header.width);
+  entry.height     = static_cast<int>(header.height);
+  entry.format     = header.format;
+  entry.type       = header.type;
+  entry.mappedFile = std::move(mappedFile);
+
+  ++state.hits;
+  state.bytesSaved += payloadSize;
+  return entry;
+}
+
+bool TextureDiskCache::Store(const std::string& key, const TextureDiskCacheEntry& entry)
+{
+  const auto directory = cacheDirectory();
+  if (directory.empty()) {
+    return false;
+  }
+
+  const auto polynomial = entry.sphericalPolynomial ?
+                            polynomialToArray(*entry.sphericalPolynomial) :
+                            std::vector<float>();
+
+  CacheFileHeader header{};
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version              = Version;
+  header.width                = static_cast<uint32_t>(entry.width);
+  header.height               = static_cast<uint32_t>(entry.height);
+  header.format               = entry.format;
+  header.type                 = entry.type;
+  header.levelCount           = static_cast<uint32_t>(entry.levels.size());
+  header.polynomialFloatCount = static_cast<uint32_t>(polynomial.size());
+
+  std::string data(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (const auto& level : entry.levels) {
+    const auto levelSize = static_cast<uint64_t>(level.size());
+    data.append(reinterpret_cast<const char*>(&levelSize), sizeof(levelSize));
+  }
+  data.append(reinterpret_cast<const char*>(polynomial.data()), polynomial.size() * sizeof(float));
+  for (const auto& level : entry.levels) {
+    data.resize(align(data.size()), '\0');
+    data.append(level.data(), level.size());
+  }
+
+  // Written to a temporary file first so that readers never see a partial file
+  const auto filename = cacheFilename(directory, key);
+  std::ostringstream temporaryFilename;
+  temporaryFilename << filename << "." << std::this_thread::get_id() << ".tmp";
+  {
+    std::ofstream file(temporaryFilename.str(), std::ios::binary | std::ios::trunc);
+    if (!file.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+      BABYLON_LOGF_WARN("TextureDiskCache", "Could not write the cache file %s",
+                        temporaryFilename.str().c_str())
+      return false;
+    }
+  }
+  if (std::rename(temporaryFilename.str().c_str(), filename.c_str()) != 0) {
+    std::remove(temporaryFilename.str().c_str());
+    return false;
+  }
+
+  ++cacheState().stores;
+  return true;
+}
+
+TextureDiskCacheStats TextureDiskCache::GetStats()
+{
+  const auto& state = cacheState();
+  TextureDiskCacheStats stats;
+  stats.hits       = state.hits;
+  stats.misses     = state.misses;
+  stats.stores     = state.stores;
+  stats.bytesSaved = state.bytesSaved;
+  return stats;
+}
+
+void TextureDiskCache::ResetStats()
+{
+  auto& state      = cacheState();
+  state.hits       = 0;
+  state.misses     = 0;
+  state.stores     = 0;
+  state.bytesSaved = 0;
+}
+
+} // end of namespace BABYLON
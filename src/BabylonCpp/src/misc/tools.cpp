@@ -3,6 +3,7 @@
 #include <babylon/core/logging.h>
 #include <babylon/core/random.h>
 #include <babylon/engines/engine_store.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/maths/color4.h>
 #include <babylon/maths/isize.h>
@@ -195,20 +196,32 @@ void Tools::DumpFramebuffer(int /*width*/, int /*height*/, Engine* /*engine*/)
 {
 }
 
-void Tools::StartPerformanceCounter(const std::string&)
+void Tools::StartPerformanceCounter(const std::string& counterName)
 {
+  StartPerformanceCounter(counterName, true);
 }
 
-void Tools::StartPerformanceCounter(const std::string&, bool)
+void Tools::StartPerformanceCounter(const std::string& counterName, bool condition)
 {
+  if (!condition || !FrameProfiler::IsEnabled()) {
+    return;
+  }
+
+  FrameProfiler::BeginZone(counterName);
 }
 
-void Tools::EndPerformanceCounter(const std::string&)
+void Tools::EndPerformanceCounter(const std::string& counterName)
 {
+  EndPerformanceCounter(counterName, true);
 }
 
-void Tools::EndPerformanceCounter(const std::string&, bool)
+void Tools::EndPerformanceCounter(const std::string& /*counterName*/, bool condition)
 {
+  if (!condition) {
+    return;
+  }
+
+  FrameProfiler::EndZone();
 }
 
 void Tools::ExitFullscreen()
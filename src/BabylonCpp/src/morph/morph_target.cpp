@@ -133,7 +133,8 @@ void MorphTarget::setPositions(const Float32Array& data)
 {
   const auto hadPositions = hasPositions();
 
-  _positions = data;
+  _positions      = data;
+  _deltas.isDirty = true;
 
   if (hadPositions != hasPositions) {
     _onDataLayoutChanged.notifyObservers(nullptr);
@@ -149,7 +150,8 @@ void MorphTarget::setNormals(const Float32Array& data)
 {
   const auto hadNormals = hasNormals();
 
-  _normals = data;
+  _normals        = data;
+  _deltas.isDirty = true;
 
   if (hadNormals != hasNormals) {
     _onDataLayoutChanged.notifyObservers(nullptr);
@@ -223,6 +225,76 @@ std::string MorphTarget::getClassName() const
   return "MorphTarget";
 }
 
+const _MorphTargetDeltas& MorphTarget::_getDeltas(const Float32Array& basePositions,
+                                                  const Float32Array* baseNormals)
+{
+  if (baseNormals && baseNormals->size() != _normals.size()) {
+    baseNormals = nullptr;
+  }
+  const auto* iBaseNormals = baseNormals ? baseNormals->data() : nullptr;
+  if (!_deltas.isDirty && _deltas.basePositions == basePositions.data()
+      && _deltas.baseNormals == iBaseNormals) {
+    return _deltas;
+  }
+
+  _deltas.isDirty       = false;
+  _deltas.basePositions = basePositions.data();
+  _deltas.baseNormals   = iBaseNormals;
+  _deltas.indices.clear();
+  _deltas.positions.clear();
+  _deltas.normals.clear();
+  if (_positions.size() != basePositions.size()) {
+    _deltas.sparse = true;
+    return _deltas;
+  }
+
+  // Vertices left in place by the target, which are most of them for the facial expressions
+  const auto vertexCount = _positions.size() / 3;
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    for (size_t index = vertex * 3; index < vertex * 3 + 3; ++index) {
+      if (_positions[index] != basePositions[index]
+          || (iBaseNormals && _normals[index] != iBaseNormals[index])) {
+        _deltas.indices.emplace_back(static_cast<uint32_t>(vertex));
+        break;
+      }
+    }
+  }
+
+  const auto movingCount = static_cast<float>(_deltas.indices.size());
+  _deltas.sparse         = movingCount < SparseDeltasRatio * static_cast<float>(vertexCount);
+  if (!_deltas.sparse) {
+    _deltas.indices.clear();
+    _deltas.positions.resize(_positions.size());
+    for (size_t index = 0; index < _positions.size(); ++index) {
+      _deltas.positions[index] = _positions[index] - basePositions[index];
+    }
+    if (iBaseNormals) {
+      _deltas.normals.resize(_normals.size());
+      for (size_t index = 0; index < _normals.size(); ++index) {
+        _deltas.normals[index] = _normals[index] - iBaseNormals[index];
+      }
+    }
+    return _deltas;
+  }
+
+  _deltas.positions.resize(_deltas.indices.size() * 3);
+  if (iBaseNormals) {
+    _deltas.normals.resize(_deltas.indices.size() * 3);
+  }
+  for (size_t moving = 0; moving < _deltas.indices.size(); ++moving) {
+    const size_t vertex = _deltas.indices[moving];
+    for (size_t component = 0; component < 3; ++component) {
+      const auto index                          = vertex * 3 + component;
+      _deltas.positions[moving * 3 + component] = _positions[index] - basePositions[index];
+      if (iBaseNormals) {
+        _deltas.normals[moving * 3 + component] = _normals[index] - iBaseNormals[index];
+      }
+    }
+  }
+
+  return _deltas;
+}
+
 MorphTargetPtr MorphTarget::Parse(const json& serializationObject)
 {
   auto result
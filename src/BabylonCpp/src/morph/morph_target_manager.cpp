@@ -1,14 +1,64 @@
 #include <babylon/morph/morph_target_manager.h>
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
 
 namespace BABYLON {
 
+namespace {
+
+using WeightedDeltas = std::pair<const _MorphTargetDeltas*, float>;
+
+/**
+ * @brief Blends the deltas of the weighted targets on the base data of the vertices [start, end).
+ * The dense targets are contiguous multiply-adds the compiler vectorizes, the sparse ones only
+ * visit their moving vertices of the range. The targets are accumulated in the same order whatever
+ * the range, so that the chunks blended in parallel give the serial result.
+ */
+void blendDeltas(const Float32Array& base, const std::vector<WeightedDeltas>& targets,
+                 Float32Array _MorphTargetDeltas::*data, Float32Array& result, size_t start,
+                 size_t end)
+{
+  auto* output = result.data();
+  std::copy(base.begin() + static_cast<std::ptrdiff_t>(start * 3),
+            base.begin() + static_cast<std::ptrdiff_t>(end * 3), output + start * 3);
+
+  for (const auto& [deltas, weight] : targets) {
+    const auto& values = deltas->*data;
+    if (values.empty()) {
+      continue;
+    }
+    const auto* delta = values.data();
+    if (!deltas->sparse) {
+      for (size_t index = start * 3; index < end * 3; ++index) {
+        output[index] += weight * delta[index];
+      }
+      continue;
+    }
+    const auto& indices = deltas->indices;
+    auto first          = std::lower_bound(indices.begin(), indices.end(), start);
+    const auto last     = std::lower_bound(first, indices.end(), end);
+    for (; first != last; ++first) {
+      const auto moving = static_cast<size_t>(first - indices.begin()) * 3;
+      auto* vertex      = output + static_cast<size_t>(*first) * 3;
+      vertex[0] += weight * delta[moving];
+      vertex[1] += weight * delta[moving + 1];
+      vertex[2] += weight * delta[moving + 2];
+    }
+  }
+}
+
+} // end of anonymous namespace
+
 MorphTargetManager::MorphTargetManager(Scene* scene)
     : enableNormalMorphing{true}
     , enableTangentMorphing{true}
@@ -21,11 +71,15 @@ MorphTargetManager::MorphTargetManager(Scene* scene)
     , numTargets{this, &MorphTargetManager::get_numTargets}
     , numInfluencers{this, &MorphTargetManager::get_numInfluencers}
     , influences{this, &MorphTargetManager::get_influences}
+    , enableCpuMorphing{this, &MorphTargetManager::get_enableCpuMorphing,
+                        &MorphTargetManager::set_enableCpuMorphing}
     , _supportsNormals{false}
     , _supportsTangents{false}
     , _supportsUVs{false}
     , _vertexCount{0}
     , _uniqueId{0}
+    , _enableCpuMorphing{false}
+    , _cpuMorphingDirty{false}
 {
   _scene = scene ? scene : Engine::LastCreatedScene();
 }
@@ -73,7 +127,7 @@ std::size_t MorphTargetManager::get_numTargets() const
 
 size_t MorphTargetManager::get_numInfluencers() const
 {
-  return _activeTargets.size();
+  return _enableCpuMorphing ? 0 : _activeTargets.size();
 }
 
 Float32Array& MorphTargetManager::get_influences()
@@ -81,6 +135,21 @@ Float32Array& MorphTargetManager::get_influences()
   return _influences;
 }
 
+bool MorphTargetManager::get_enableCpuMorphing() const
+{
+  return _enableCpuMorphing;
+}
+
+void MorphTargetManager::set_enableCpuMorphing(bool value)
+{
+  if (_enableCpuMorphing == value) {
+    return;
+  }
+
+  _enableCpuMorphing = value;
+  synchronize();
+}
+
 MorphTargetPtr MorphTargetManager::getActiveTarget(size_t index)
 {
   if (index < _activeTargets.size()) {
@@ -181,6 +250,10 @@ void MorphTargetManager::_syncActiveTargets(bool needUpdate)
   if (needUpdate) {
     synchronize();
   }
+  else if (_enableCpuMorphing) {
+    // Blended once per frame, whatever the number of influences changed
+    _cpuMorphingDirty = true;
+  }
 }
 
 void MorphTargetManager::synchronize()
@@ -195,6 +268,90 @@ void MorphTargetManager::synchronize()
       mesh->_syncGeometryWithMorphTargetManager();
     }
   }
+  _cpuMorphingDirty = false;
+}
+
+void MorphTargetManager::_updateCpuMorphing()
+{
+  if (!_cpuMorphingDirty || !_scene) {
+    return;
+  }
+
+  _cpuMorphingDirty = false;
+  for (auto& abstractMesh : _scene->meshes) {
+    auto mesh = std::static_pointer_cast<Mesh>(abstractMesh);
+    if (mesh && (mesh->morphTargetManager().get() == this)) {
+      _applyToMesh(*mesh);
+    }
+  }
+}
+
+void MorphTargetManager::_applyToMesh(Mesh& mesh)
+{
+  if (!mesh.isVerticesDataPresent(VertexBuffer::PositionKind)) {
+    return;
+  }
+  if (_vertexCount && _vertexCount != mesh.getTotalVertices()) {
+    BABYLON_LOG_ERROR("MorphTargetManager",
+                      "Mesh is incompatible with morph targets. Targets and mesh must all have "
+                      "the same vertices count.")
+    return;
+  }
+
+  // The base shape is saved the first time, making the buffers updatable if needed
+  auto subMeshes              = std::move(mesh.subMeshes);
+  const auto& basePositions   = mesh.setPositionsForCPUSkinning();
+  const Float32Array* normals = nullptr;
+  if (get_supportsNormals() && mesh.isVerticesDataPresent(VertexBuffer::NormalKind)) {
+    normals = &mesh.setNormalsForCPUSkinning();
+  }
+  mesh.subMeshes = std::move(subMeshes);
+
+  _cpuTargets.clear();
+  for (const auto& target : _activeTargets) {
+    const auto weight = target->influence();
+    if (weight != 0.f && target->hasPositions()) {
+      _cpuTargets.emplace_back(&target->_getDeltas(basePositions, normals), weight);
+    }
+  }
+
+  const auto vertexCount = basePositions.size() / 3;
+  _cpuPositions.resize(basePositions.size());
+  if (normals) {
+    _cpuNormals.resize(normals->size());
+  }
+  const auto blendRange = [&](size_t start, size_t end) {
+    blendDeltas(basePositions, _cpuTargets, &_MorphTargetDeltas::positions, _cpuPositions, start,
+                end);
+    if (normals) {
+      blendDeltas(*normals, _cpuTargets, &_MorphTargetDeltas::normals, _cpuNormals, start, end);
+    }
+  };
+
+  // The vertices are independent, large meshes are split in chunks blended in parallel
+  const size_t concurrency = std::thread::hardware_concurrency();
+  if (vertexCount < ParallelBlendThreshold || concurrency < 2 || _cpuTargets.empty()) {
+    blendRange(0, vertexCount);
+  }
+  else {
+    const auto chunkCount
+      = std::min<size_t>(concurrency, vertexCount / (ParallelBlendThreshold / 4));
+    std::vector<std::future<void>> jobs;
+    jobs.reserve(chunkCount);
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+      jobs.emplace_back(std::async(std::launch::async, blendRange, vertexCount * chunk / chunkCount,
+                                   vertexCount * (chunk + 1) / chunkCount));
+    }
+    blendRange(0, vertexCount / chunkCount);
+    for (auto& job : jobs) {
+      job.get();
+    }
+  }
+
+  mesh.updateVerticesData(VertexBuffer::PositionKind, _cpuPositions, false, false);
+  if (normals) {
+    mesh.updateVerticesData(VertexBuffer::NormalKind, _cpuNormals, false, false);
+  }
 }
 
 MorphTargetManagerPtr MorphTargetManager::Parse(const json& serializationObject, Scene* scene)
@@ -205,7 +362,7 @@ MorphTargetManagerPtr MorphTargetManager::Parse(const json& serializationObject,
 
   if (json_util::has_key(serializationObject, "targets")
       && (serializationObject["targets"].is_array())) {
-    for (auto& targetData : json_util::get_array<json>(serializationObject, "targets")) {
+    for (const auto& targetData : json_util::get_array_ref(serializationObject, "targets")) {
       result->addTarget(MorphTarget::Parse(targetData));
     }
   }
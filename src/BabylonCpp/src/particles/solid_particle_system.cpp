@@ -1,5 +1,8 @@
 #include <babylon/particles/solid_particle_system.h>
 
+#include <future>
+#include <thread>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/target_camera.h>
@@ -13,6 +16,7 @@
 #include <babylon/maths/color4.h>
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/geometry.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_builder.h>
 #include <babylon/meshes/sub_mesh.h>
@@ -74,6 +78,7 @@ SolidParticleSystem::SolidParticleSystem(const std::string& iName, Scene* scene,
     , _translation{TmpVectors::Vector3Array[3]}
     , _needs32Bits{false}
     , _isNotBuilt{true}
+    , _verticesNotUploaded{false}
     , _lastParticleId{0}
     , _multimaterialEnabled{false}
     , _useModelMaterial{false}
@@ -846,7 +851,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
   // custom beforeUpdate
   beforeUpdateParticles(start, end, update);
 
-  auto& rotMatrix      = TmpVectors::MatrixArray[0];
   auto& invertedMatrix = TmpVectors::MatrixArray[1];
   auto& colors32       = _colors32;
   auto& positions32    = _positions32;
@@ -856,18 +860,15 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
   auto& indices        = _indices;
   auto& fixedNormal32  = _fixedNormal32;
 
-  auto& tempVectors         = TmpVectors::Vector3Array;
-  auto& camAxisX            = tempVectors[5].copyFromFloats(1.f, 0.f, 0.f);
-  auto& camAxisY            = tempVectors[6].copyFromFloats(0.f, 1.f, 0.f);
-  auto& camAxisZ            = tempVectors[7].copyFromFloats(0.f, 0.f, 1.f);
-  auto& minimum             = tempVectors[8].setAll(std::numeric_limits<float>::max());
-  auto& maximum             = tempVectors[9].setAll(std::numeric_limits<float>::lowest());
-  auto& camInvertedPosition = tempVectors[10].setAll(0.f);
-
-  auto& tmpVertex = *_tmpVertex;
-  auto& tmpVector = tmpVertex.position;
-  auto& tmpColor  = tmpVertex.color;
-  auto& tmpUV     = tmpVertex.uv;
+  auto& tempVectors = TmpVectors::Vector3Array;
+  std::array<Vector3, 3> camAxes{Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f),
+                                 Vector3(0.f, 0.f, 1.f)};
+  auto& camAxisX = camAxes[0];
+  auto& camAxisY = camAxes[1];
+  auto& camAxisZ = camAxes[2];
+  Vector3 minimum, maximum, camInvertedPosition;
+  minimum.setAll(std::numeric_limits<float>::max());
+  maximum.setAll(std::numeric_limits<float>::lowest());
 
   // cases when the World Matrix is to be computed first
   if (billboard || _depthSort) {
@@ -896,17 +897,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
                                        camInvertedPosition); // then un-rotate the camera
   }
 
-  Matrix::IdentityToRef(rotMatrix);
-  auto idx   = 0ull;      // current position index in the global array positions32
-  auto index = 0ull;      // position start index in the global array positions32 of
-                          // the current particle
-  auto colidx     = 0ull; // current color index in the global array colors32
-  auto colorIndex = 0ull; // color start index in the global array colors32 of
-                          // the current particle
-  auto uvidx   = 0ull;    // current uv index in the global array uvs32
-  auto uvIndex = 0ull;    // uv start index in the global array uvs32 of the current particle
-  auto pt      = 0ull;    // current index in the particle model shape
-
   if (mesh->isFacetDataEnabled()) {
     _computeBoundingBox = true;
   }
@@ -924,17 +914,169 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     }
   }
 
-  // particle loop
-  index      = particles[start]->_pos;
-  auto vpos  = (index / 3);
-  colorIndex = vpos * 4;
-  uvIndex    = vpos * 2;
+  // call to custom user function to update the particle properties
+  updateParticles(start, end);
 
-  for (size_t p = start; p <= end; p++) {
-    auto particle = particles[p].get();
+  // The particles are independent unless they have a parent or a vertex function, large ranges
+  // are then split in chunks processed in parallel, each one with its own bounding box
+  const size_t concurrency = std::thread::hardware_concurrency();
+  auto parallel = end - start + 1 >= ParallelUpdateThreshold && concurrency > 1
+                  && !_computeParticleVertex;
+  for (size_t p = start; parallel && p <= end; ++p) {
+    parallel = !particles[p]->parentId.has_value();
+  }
+
+  if (!parallel) {
+    _setParticlesRange(start, end, camAxes, camInvertedPosition, minimum, maximum);
+  }
+  else {
+    const auto count      = end - start + 1;
+    const auto chunkCount = std::min<size_t>(concurrency, count / (ParallelUpdateThreshold / 4));
+    std::vector<std::pair<Vector3, Vector3>> chunkBounds(chunkCount, {minimum, maximum});
+    std::vector<std::future<void>> jobs;
+    jobs.reserve(chunkCount);
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+      jobs.emplace_back(std::async(std::launch::async, [&, chunk]() {
+        auto& [chunkMinimum, chunkMaximum] = chunkBounds[chunk];
+        _setParticlesRange(start + count * chunk / chunkCount,
+                           start + count * (chunk + 1) / chunkCount - 1, camAxes,
+                           camInvertedPosition, chunkMinimum, chunkMaximum);
+      }));
+    }
+    _setParticlesRange(start, start + count / chunkCount - 1, camAxes, camInvertedPosition,
+                       chunkBounds[0].first, chunkBounds[0].second);
+    for (auto& job : jobs) {
+      job.get();
+    }
+    for (const auto& bounds : chunkBounds) {
+      minimum.minimizeInPlace(bounds.first);
+      maximum.maximizeInPlace(bounds.second);
+    }
+  }
+
+  // if the VBO must be updated
+  if (update) {
+    // Only the vertices of the updated particles are uploaded, unless other particles were set
+    // without updating the vertex buffers before
+    auto firstVertex = particles[start]->_pos / 3;
+    auto vertexCount
+      = particles[end]->_pos / 3 + particles[end]->_model->_shape.size() - firstVertex;
+    if (_verticesNotUploaded) {
+      firstVertex = 0;
+      vertexCount = mesh->getTotalVertices();
+    }
+    if (_computeParticleColor) {
+      _updateVerticesData(VertexBuffer::ColorKind, colors32, firstVertex, vertexCount);
+    }
+    if (_computeParticleTexture) {
+      _updateVerticesData(VertexBuffer::UVKind, uvs32, firstVertex, vertexCount);
+    }
+    _updateVerticesData(VertexBuffer::PositionKind, positions32, firstVertex, vertexCount);
+    if (!mesh->areNormalsFrozen || mesh->isFacetDataEnabled) {
+      if (_computeParticleVertex || mesh->isFacetDataEnabled) {
+        // recompute the normals only if the particles can be morphed, update then also the normal
+        // reference array _fixedNormal32[]
+        if (mesh->isFacetDataEnabled) {
+          VertexData::ComputeNormals(positions32, indices32, normals32,
+                                     mesh->getFacetDataParameters());
+        }
+        else {
+          VertexData::ComputeNormals(positions32, indices32, normals32, std::nullopt);
+        }
+        for (size_t i = 0; i < normals32.size(); ++i) {
+          fixedNormal32[i] = normals32[i];
+        }
+      }
+      if (!mesh->areNormalsFrozen && (_computeParticleVertex || mesh->isFacetDataEnabled)) {
+        mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false, false);
+      }
+      else if (!mesh->areNormalsFrozen) {
+        _updateVerticesData(VertexBuffer::NormalKind, normals32, firstVertex, vertexCount);
+      }
+    }
+    if (_depthSort && _depthSortParticles) {
+      std::sort(depthSortedParticles.begin(), depthSortedParticles.end(), _depthSortFunction);
+      const auto dspl = depthSortedParticles.size();
+      auto sid        = 0ull;
+      auto faceId     = 0ull;
+      for (size_t sorted = 0; sorted < dspl; ++sorted) {
+        const auto sortedParticle = depthSortedParticles[sorted];
+        const auto lind           = sortedParticle.indicesLength;
+        const auto sind           = sortedParticle.ind;
+        for (size_t i = 0; i < lind; i++) {
+          indices32[sid] = indices[sind + i];
+          ++sid;
+          if (_pickable) {
+            const auto f = i % 3;
+            if (f == 0) {
+              auto& pickedData  = pickedParticles[faceId];
+              pickedData.idx    = sortedParticle.idx;
+              pickedData.faceId = faceId;
+              ++faceId;
+            }
+          }
+        }
+      }
+      mesh->updateIndices(indices32);
+    }
+  }
+  _verticesNotUploaded = !update;
+  if (_computeBoundingBox) {
+    if (mesh->_boundingInfo) {
+      mesh->_boundingInfo->reConstruct(minimum, maximum, mesh->_worldMatrix);
+    }
+    else {
+      mesh->_boundingInfo = std::make_unique<BoundingInfo>(minimum, maximum, mesh->_worldMatrix);
+    }
+  }
+  if (_autoUpdateSubMeshes) {
+    computeSubMeshes();
+  }
+  afterUpdateParticles(start, end, update);
+  return *this;
+}
+
+void SolidParticleSystem::_updateVerticesData(const std::string& kind, const Float32Array& data,
+                                              size_t firstVertex, size_t vertexCount)
+{
+  const auto& geometry     = mesh->geometry();
+  auto vertexBuffer        = mesh->getVertexBuffer(kind);
+  const auto totalVertices = mesh->getTotalVertices();
+  if (!geometry || !vertexBuffer || !vertexBuffer->isUpdatable() || vertexCount >= totalVertices
+      || vertexBuffer->getData().size() != data.size()) {
+    mesh->updateVerticesData(kind, data, false, false);
+    return;
+  }
+
+  const auto size  = data.size() / totalVertices;
+  const auto first = data.begin() + static_cast<std::ptrdiff_t>(firstVertex * size);
+  std::copy(first, first + static_cast<std::ptrdiff_t>(vertexCount * size),
+            vertexBuffer->getData().begin() + static_cast<std::ptrdiff_t>(firstVertex * size));
+  geometry->markRange(kind, firstVertex, vertexCount);
+}
 
-    // call to custom user function to update the particle properties
-    updateParticle(particle);
+void SolidParticleSystem::_setParticlesRange(size_t start, size_t end,
+                                             const std::array<Vector3, 3>& camAxes,
+                                             const Vector3& camInvertedPosition, Vector3& minimum,
+                                             Vector3& maximum)
+{
+  auto& colors32      = _colors32;
+  auto& positions32   = _positions32;
+  auto& normals32     = _normals32;
+  auto& uvs32         = _uvs32;
+  auto& fixedNormal32 = _fixedNormal32;
+
+  const auto& camAxisX = camAxes[0];
+  const auto& camAxisY = camAxes[1];
+  const auto& camAxisZ = camAxes[2];
+
+  auto rotMatrix  = Matrix::Identity();
+  auto index      = particles[start]->_pos; // position start index of the current particle
+  auto colorIndex = index / 3 * 4;          // color start index of the current particle
+  auto uvIndex    = index / 3 * 2;          // uv start index of the current particle
+
+  for (size_t p = start; p <= end; ++p) {
+    auto particle = particles[p].get();
 
     auto& shape                  = particle->_model->_shape;
     auto& shapeUV                = particle->_model->_shapeUV;
@@ -943,6 +1085,7 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     auto& particleRotation       = particle->rotation;
     auto& particleScaling        = particle->scaling;
     auto& particleGlobalPosition = particle->_globalPosition;
+    const auto nbVertices        = shape.size();
 
     // camera-particle distance for depth sorting
     if (_depthSort && _depthSortParticles) {
@@ -956,17 +1099,16 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     // skip the computations for inactive or already invisible particles
     if (!particle->alive || (particle->_stillInvisible && !particle->isVisible)) {
       // increment indexes for the next particle
-      pt = shape.size();
-      index += pt * 3;
-      colorIndex += pt * 4;
-      uvIndex += pt * 2;
+      index += nbVertices * 3;
+      colorIndex += nbVertices * 4;
+      uvIndex += nbVertices * 2;
       continue;
     }
 
     if (particle->isVisible) {
       particle->_stillInvisible = false; // un-mark permanent invisibility
 
-      auto& scaledPivot = tempVectors[12];
+      Vector3 scaledPivot;
       particle->pivot.multiplyToRef(particleScaling, scaledPivot);
 
       // particle rotation matrix
@@ -1053,106 +1195,137 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
         }
       }
 
-      auto& pivotBackTranslation = tempVectors[11];
-      if (particle->translateFromPivot) {
-        pivotBackTranslation.setAll(0.f);
-      }
-      else {
-        pivotBackTranslation.copyFrom(scaledPivot);
-      }
-
-      // particle vertex loop
-      for (pt = 0; pt < shape.size(); ++pt) {
-        idx           = index + pt * 3;
-        colidx        = colorIndex + pt * 4;
-        uvidx         = uvIndex + pt * 2;
-        const auto iu = 2 * pt;
-        const auto iv = iu + 1;
-
-        tmpVector.copyFrom(shape[pt]);
-        if (_computeParticleColor && particle->color) {
-          tmpColor.copyFrom(*particle->color);
-        }
-        if (_computeParticleTexture) {
-          tmpUV.copyFromFloats(shapeUV[iu], shapeUV[iv]);
-        }
-        if (_computeParticleVertex) {
-          updateParticleVertex(particle, tmpVertex, pt);
-        }
+      const auto pivotBackTranslation
+        = particle->translateFromPivot ? Vector3::Zero() : scaledPivot;
 
-        // positions
-        auto vertexX = tmpVector.x * particleScaling.x - scaledPivot.x;
-        auto vertexY = tmpVector.y * particleScaling.y - scaledPivot.y;
-        auto vertexZ = tmpVector.z * particleScaling.z - scaledPivot.z;
-
-        auto rotatedX = vertexX * particleRotationMatrix[0] + vertexY * particleRotationMatrix[3]
-                        + vertexZ * particleRotationMatrix[6];
-        auto rotatedY = vertexX * particleRotationMatrix[1] + vertexY * particleRotationMatrix[4]
-                        + vertexZ * particleRotationMatrix[7];
-        auto rotatedZ = vertexX * particleRotationMatrix[2] + vertexY * particleRotationMatrix[5]
-                        + vertexZ * particleRotationMatrix[8];
-
-        rotatedX += pivotBackTranslation.x;
-        rotatedY += pivotBackTranslation.y;
-        rotatedZ += pivotBackTranslation.z;
-
-        auto px = positions32[idx] = particleGlobalPosition.x + camAxisX.x * rotatedX
-                                     + camAxisY.x * rotatedY + camAxisZ.x * rotatedZ;
-        auto py = positions32[idx + 1] = particleGlobalPosition.y + camAxisX.y * rotatedX
-                                         + camAxisY.y * rotatedY + camAxisZ.y * rotatedZ;
-        auto pz = positions32[idx + 2] = particleGlobalPosition.z + camAxisX.z * rotatedX
-                                         + camAxisY.z * rotatedY + camAxisZ.z * rotatedZ;
+      // The particle rotation followed by the camera axes, as a single 3x3 matrix applied to the
+      // normals. Row i is the image of the axis i of the model.
+      std::array<float, 9> normalMatrix;
+      for (size_t i = 0; i < 3; ++i) {
+        const auto r0 = particleRotationMatrix[i * 3];
+        const auto r1 = particleRotationMatrix[i * 3 + 1];
+        const auto r2 = particleRotationMatrix[i * 3 + 2];
 
+        normalMatrix[i * 3]     = camAxisX.x * r0 + camAxisY.x * r1 + camAxisZ.x * r2;
+        normalMatrix[i * 3 + 1] = camAxisX.y * r0 + camAxisY.y * r1 + camAxisZ.y * r2;
+        normalMatrix[i * 3 + 2] = camAxisX.z * r0 + camAxisY.z * r1 + camAxisZ.z * r2;
+      }
+      // The vertices are scaled, moved from the pivot and translated to the particle position too
+      std::array<float, 9> vertexMatrix;
+      std::array<float, 3> translation;
+      for (size_t k = 0; k < 3; ++k) {
+        vertexMatrix[k]     = normalMatrix[k] * particleScaling.x;
+        vertexMatrix[3 + k] = normalMatrix[3 + k] * particleScaling.y;
+        vertexMatrix[6 + k] = normalMatrix[6 + k] * particleScaling.z;
+        translation[k]      = -normalMatrix[k] * scaledPivot.x - normalMatrix[3 + k] * scaledPivot.y
+                         - normalMatrix[6 + k] * scaledPivot.z;
+      }
+      translation[0] += particleGlobalPosition.x + camAxisX.x * pivotBackTranslation.x
+                        + camAxisY.x * pivotBackTranslation.y
+                        + camAxisZ.x * pivotBackTranslation.z;
+      translation[1] += particleGlobalPosition.y + camAxisX.y * pivotBackTranslation.x
+                        + camAxisY.y * pivotBackTranslation.y
+                        + camAxisZ.y * pivotBackTranslation.z;
+      translation[2] += particleGlobalPosition.z + camAxisX.z * pivotBackTranslation.x
+                        + camAxisY.z * pivotBackTranslation.y
+                        + camAxisZ.z * pivotBackTranslation.z;
+
+      const auto setPosition = [&](const Vector3& vertex, size_t idx) {
+        const auto px = translation[0] + vertex.x * vertexMatrix[0] + vertex.y * vertexMatrix[3]
+                        + vertex.z * vertexMatrix[6];
+        const auto py = translation[1] + vertex.x * vertexMatrix[1] + vertex.y * vertexMatrix[4]
+                        + vertex.z * vertexMatrix[7];
+        const auto pz = translation[2] + vertex.x * vertexMatrix[2] + vertex.y * vertexMatrix[5]
+                        + vertex.z * vertexMatrix[8];
+        positions32[idx]     = px;
+        positions32[idx + 1] = py;
+        positions32[idx + 2] = pz;
         if (_computeBoundingBox) {
           minimum.minimizeInPlaceFromFloats(px, py, pz);
           maximum.maximizeInPlaceFromFloats(px, py, pz);
         }
+      };
+
+      const auto& uvs = particle->uvs;
+      if (!_computeParticleVertex) {
+        // Straight loops over the particle vertices, one per vertex attribute
+        for (size_t pt = 0; pt < nbVertices; ++pt) {
+          setPosition(shape[pt], index + pt * 3);
+        }
 
         // normals : if the particles can't be morphed then just rotate the normals, what is much
         // more faster than ComputeNormals()
-        if (!_computeParticleVertex) {
-          const auto& normalx = fixedNormal32[idx];
-          const auto& normaly = fixedNormal32[idx + 1];
-          const auto& normalz = fixedNormal32[idx + 2];
-
-          const auto rotatedx = normalx * particleRotationMatrix[0]
-                                + normaly * particleRotationMatrix[3]
-                                + normalz * particleRotationMatrix[6];
-          const auto rotatedy = normalx * particleRotationMatrix[1]
-                                + normaly * particleRotationMatrix[4]
-                                + normalz * particleRotationMatrix[7];
-          const auto rotatedz = normalx * particleRotationMatrix[2]
-                                + normaly * particleRotationMatrix[5]
-                                + normalz * particleRotationMatrix[8];
-
-          normals32[idx] = camAxisX.x * rotatedx + camAxisY.x * rotatedy + camAxisZ.x * rotatedz;
-          normals32[idx + 1]
-            = camAxisX.y * rotatedx + camAxisY.y * rotatedy + camAxisZ.y * rotatedz;
-          normals32[idx + 2]
-            = camAxisX.z * rotatedx + camAxisY.z * rotatedy + camAxisZ.z * rotatedz;
+        for (size_t idx = index; idx < index + nbVertices * 3; idx += 3) {
+          const auto normalx = fixedNormal32[idx];
+          const auto normaly = fixedNormal32[idx + 1];
+          const auto normalz = fixedNormal32[idx + 2];
+          normals32[idx]     = normalx * normalMatrix[0] + normaly * normalMatrix[3]
+                           + normalz * normalMatrix[6];
+          normals32[idx + 1] = normalx * normalMatrix[1] + normaly * normalMatrix[4]
+                               + normalz * normalMatrix[7];
+          normals32[idx + 2] = normalx * normalMatrix[2] + normaly * normalMatrix[5]
+                               + normalz * normalMatrix[8];
         }
 
         if (_computeParticleColor && particle->color.has_value()) {
-          _colors32[colidx]     = tmpColor.r;
-          _colors32[colidx + 1] = tmpColor.g;
-          _colors32[colidx + 2] = tmpColor.b;
-          _colors32[colidx + 3] = tmpColor.a;
+          const auto& color = *particle->color;
+          for (size_t colidx = colorIndex; colidx < colorIndex + nbVertices * 4; colidx += 4) {
+            colors32[colidx]     = color.r;
+            colors32[colidx + 1] = color.g;
+            colors32[colidx + 2] = color.b;
+            colors32[colidx + 3] = color.a;
+          }
         }
 
         if (_computeParticleTexture) {
-          const auto& uvs  = particle->uvs;
-          uvs32[uvidx]     = tmpUV.x * (uvs.z - uvs.x) + uvs.x;
-          uvs32[uvidx + 1] = tmpUV.y * (uvs.w - uvs.y) + uvs.y;
+          for (size_t pt = 0; pt < nbVertices; ++pt) {
+            uvs32[uvIndex + pt * 2]     = shapeUV[pt * 2] * (uvs.z - uvs.x) + uvs.x;
+            uvs32[uvIndex + pt * 2 + 1] = shapeUV[pt * 2 + 1] * (uvs.w - uvs.y) + uvs.y;
+          }
+        }
+      }
+      else {
+        // particle vertex loop, calling the custom vertex function
+        auto& tmpVertex = *_tmpVertex;
+        auto& tmpVector = tmpVertex.position;
+        auto& tmpColor  = tmpVertex.color;
+        auto& tmpUV     = tmpVertex.uv;
+        for (size_t pt = 0; pt < nbVertices; ++pt) {
+          const auto colidx = colorIndex + pt * 4;
+          const auto uvidx  = uvIndex + pt * 2;
+
+          tmpVector.copyFrom(shape[pt]);
+          if (_computeParticleColor && particle->color) {
+            tmpColor.copyFrom(*particle->color);
+          }
+          if (_computeParticleTexture) {
+            tmpUV.copyFromFloats(shapeUV[pt * 2], shapeUV[pt * 2 + 1]);
+          }
+          updateParticleVertex(particle, tmpVertex, pt);
+
+          setPosition(tmpVector, index + pt * 3);
+
+          if (_computeParticleColor && particle->color.has_value()) {
+            colors32[colidx]     = tmpColor.r;
+            colors32[colidx + 1] = tmpColor.g;
+            colors32[colidx + 2] = tmpColor.b;
+            colors32[colidx + 3] = tmpColor.a;
+          }
+
+          if (_computeParticleTexture) {
+            uvs32[uvidx]     = tmpUV.x * (uvs.z - uvs.x) + uvs.x;
+            uvs32[uvidx + 1] = tmpUV.y * (uvs.w - uvs.y) + uvs.y;
+          }
         }
       }
     }
     // particle just set invisible : scaled to zero and positioned at the origin
     else {
       particle->_stillInvisible = true; // mark the particle as invisible
-      for (pt = 0; pt < shape.size(); ++pt) {
-        idx    = index + pt * 3;
-        colidx = colorIndex + pt * 4;
-        uvidx  = uvIndex + pt * 2;
+      for (size_t pt = 0; pt < nbVertices; ++pt) {
+        const auto idx    = index + pt * 3;
+        const auto colidx = colorIndex + pt * 4;
+        const auto uvidx  = uvIndex + pt * 2;
 
         positions32[idx] = positions32[idx + 1] = positions32[idx + 2] = 0;
         normals32[idx] = normals32[idx + 1] = normals32[idx + 2] = 0;
@@ -1181,10 +1354,9 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
         // place, scale and rotate the particle bbox within the SPS local system, then update it
         auto& modelBoundingInfoVectors = modelBoundingInfo->boundingBox.vectors;
 
-        auto& tempMin = tempVectors[1];
-        auto& tempMax = tempVectors[2];
+        Vector3 tempMin, tempMax;
         tempMin.setAll(std::numeric_limits<float>::max());
-        tempMax.setAll(std::numeric_limits<float>::min());
+        tempMax.setAll(std::numeric_limits<float>::lowest());
         for (uint32_t b = 0; b < 8; ++b) {
           const auto scaledX  = modelBoundingInfoVectors[b].x * particleScaling.x;
           const auto scaledY  = modelBoundingInfoVectors[b].y * particleScaling.y;
@@ -1212,92 +1384,19 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
       }
 
       // place and scale the particle bouding sphere in the SPS local system, then update it
-      auto minBbox = modelBoundingInfo->minimum().multiplyToRef(particleScaling, tempVectors[1]);
-      auto maxBbox = modelBoundingInfo->maximum().multiplyToRef(particleScaling, tempVectors[2]);
-
-      const auto bSphereCenter = maxBbox.addToRef(minBbox, tempVectors[3])
-                                   .scaleInPlace(0.5f)
-                                   .addInPlace(particleGlobalPosition);
-      const auto halfDiag
-        = maxBbox.subtractToRef(minBbox, tempVectors[4]).scaleInPlace(0.5f * _bSphereRadiusFactor);
-      const auto bSphereMinBbox = bSphereCenter.subtractToRef(halfDiag, tempVectors[1]);
-      const auto bSphereMaxBbox = bSphereCenter.addToRef(halfDiag, tempVectors[2]);
-      bSphere.reConstruct(bSphereMinBbox, bSphereMaxBbox, mesh->_worldMatrix);
+      const auto minBbox       = modelBoundingInfo->minimum().multiply(particleScaling);
+      const auto maxBbox       = modelBoundingInfo->maximum().multiply(particleScaling);
+      const auto bSphereCenter = maxBbox.add(minBbox).scale(0.5f).add(particleGlobalPosition);
+      const auto halfDiag      = maxBbox.subtract(minBbox).scale(0.5f * _bSphereRadiusFactor);
+      bSphere.reConstruct(bSphereCenter.subtract(halfDiag), bSphereCenter.add(halfDiag),
+                          mesh->_worldMatrix);
     }
 
     // increment indexes for the next particle
-    index      = idx + 3;
-    colorIndex = colidx + 4;
-    uvIndex    = uvidx + 2;
-  }
-
-  // if the VBO must be updated
-  if (update) {
-    if (_computeParticleColor) {
-      mesh->updateVerticesData(VertexBuffer::ColorKind, colors32, false, false);
-    }
-    if (_computeParticleTexture) {
-      mesh->updateVerticesData(VertexBuffer::UVKind, uvs32, false, false);
-    }
-    mesh->updateVerticesData(VertexBuffer::PositionKind, positions32, false, false);
-    if (!mesh->areNormalsFrozen || mesh->isFacetDataEnabled) {
-      if (_computeParticleVertex || mesh->isFacetDataEnabled) {
-        // recompute the normals only if the particles can be morphed, update then also the normal
-        // reference array _fixedNormal32[]
-        if (mesh->isFacetDataEnabled) {
-          VertexData::ComputeNormals(positions32, indices32, normals32,
-                                     mesh->getFacetDataParameters());
-        }
-        else {
-          VertexData::ComputeNormals(positions32, indices32, normals32, std::nullopt);
-        }
-        for (size_t i = 0; i < normals32.size(); ++i) {
-          fixedNormal32[i] = normals32[i];
-        }
-      }
-      if (!mesh->areNormalsFrozen) {
-        mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false, false);
-      }
-    }
-    if (_depthSort && _depthSortParticles) {
-      std::sort(depthSortedParticles.begin(), depthSortedParticles.end(), _depthSortFunction);
-      const auto dspl = depthSortedParticles.size();
-      auto sid        = 0ull;
-      auto faceId     = 0ull;
-      for (size_t sorted = 0; sorted < dspl; ++sorted) {
-        const auto sortedParticle = depthSortedParticles[sorted];
-        const auto lind           = sortedParticle.indicesLength;
-        const auto sind           = sortedParticle.ind;
-        for (size_t i = 0; i < lind; i++) {
-          indices32[sid] = indices[sind + i];
-          ++sid;
-          if (_pickable) {
-            const auto f = i % 3;
-            if (f == 0) {
-              auto& pickedData  = pickedParticles[faceId];
-              pickedData.idx    = sortedParticle.idx;
-              pickedData.faceId = faceId;
-              ++faceId;
-            }
-          }
-        }
-      }
-      mesh->updateIndices(indices32);
-    }
-  }
-  if (_computeBoundingBox) {
-    if (mesh->_boundingInfo) {
-      mesh->_boundingInfo->reConstruct(minimum, maximum, mesh->_worldMatrix);
-    }
-    else {
-      mesh->_boundingInfo = std::make_unique<BoundingInfo>(minimum, maximum, mesh->_worldMatrix);
-    }
-  }
-  if (_autoUpdateSubMeshes) {
-    computeSubMeshes();
+    index += nbVertices * 3;
+    colorIndex += nbVertices * 4;
+    uvIndex += nbVertices * 2;
   }
-  afterUpdateParticles(start, end, update);
-  return *this;
 }
 
 void SolidParticleSystem::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
@@ -1677,6 +1776,13 @@ SolidParticle* SolidParticleSystem::updateParticle(SolidParticle* particle)
   return particle;
 }
 
+void SolidParticleSystem::updateParticles(size_t start, size_t stop)
+{
+  for (size_t p = start; p <= stop; ++p) {
+    updateParticle(particles[p].get());
+  }
+}
+
 SolidParticleSystem&
 SolidParticleSystem::updateParticleVertex(SolidParticle* /*particle*/,
                                           const SolidParticleVertex& /*vertex*/, size_t /*pt*/)
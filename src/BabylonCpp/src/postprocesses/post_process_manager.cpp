@@ -5,6 +5,7 @@
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/materials/material.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/string_tools.h>
@@ -134,6 +135,7 @@ void PostProcessManager::_finalizeFrame(bool doNotPresent, const InternalTexture
                                         const std::vector<PostProcessPtr>& _postProcesses,
                                         bool forceFullscreenViewport)
 {
+  BABYLON_PROFILE_ZONE("Post-processes");
   const auto& camera = _scene->activeCamera();
   if (!camera) {
     return;
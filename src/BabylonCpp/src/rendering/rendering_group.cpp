@@ -7,8 +7,11 @@
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
 #include <babylon/materials/material.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/rendering/edges_renderer.h>
@@ -16,6 +19,63 @@
 
 namespace BABYLON {
 
+namespace {
+
+using SubMeshSortCompareFn = bool (*)(const SubMesh* a, const SubMesh* b);
+
+uint32_t materialId(const SubMesh* subMesh)
+{
+  // getMaterial only refreshes the cached effective material of multi-material submeshes
+  const auto material = const_cast<SubMesh*>(subMesh)->getMaterial();
+  return material ? static_cast<uint32_t>(material->uniqueId) : 0u;
+}
+
+uint64_t stateSortKey(const SubMesh* subMesh)
+{
+  // Effect (20 bits), material (22 bits), then geometry (22 bits)
+  auto mutableSubMesh = const_cast<SubMesh*>(subMesh);
+  const auto& effect  = mutableSubMesh->effect();
+  const auto& mesh    = mutableSubMesh->getRenderingMesh();
+  const auto geometry = mesh ? mesh->geometry() : nullptr;
+
+  const uint64_t effectId   = effect ? (effect->uniqueId & 0xFFFFF) : 0;
+  const uint64_t geometryId = geometry ? (geometry->uniqueId & 0x3FFFFF) : 0;
+  return (effectId << 44) | (static_cast<uint64_t>(materialId(subMesh) & 0x3FFFFF) << 22)
+         | geometryId;
+}
+
+uint64_t depthKey(const SubMesh* subMesh)
+{
+  return RadixSort::FloatToOrderedBits(subMesh->_distanceToCamera);
+}
+
+uint64_t alphaIndexKey(const SubMesh* subMesh)
+{
+  return static_cast<uint64_t>(static_cast<uint32_t>(subMesh->_alphaIndex) ^ 0x80000000u) << 32;
+}
+
+uint64_t backToFrontSortKey(const SubMesh* subMesh)
+{
+  return ~depthKey(subMesh) & 0xFFFFFFFFull;
+}
+
+uint64_t frontToBackSortKey(const SubMesh* subMesh)
+{
+  return depthKey(subMesh);
+}
+
+uint64_t defaultTransparentSortKey(const SubMesh* subMesh)
+{
+  return alphaIndexKey(subMesh) | backToFrontSortKey(subMesh);
+}
+
+uint64_t materialSortKey(const SubMesh* subMesh)
+{
+  return (static_cast<uint64_t>(materialId(subMesh)) << 32) | depthKey(subMesh);
+}
+
+} // end of anonymous namespace
+
 Vector3 RenderingGroup::_zeroVector = Vector3::Zero();
 
 RenderingGroup::RenderingGroup(
@@ -55,7 +115,8 @@ RenderingGroup::~RenderingGroup() = default;
 void RenderingGroup::set_opaqueSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
-  _opaqueSortCompareFn = value;
+  _opaqueSortCompareFn     = value;
+  _opaqueSortCache.sortKey = getSortKey(value);
   if (value) {
     _renderOpaque
       = [this](const std::vector<SubMesh*>& subMeshes) { renderOpaqueSorted(subMeshes); };
@@ -69,7 +130,9 @@ void RenderingGroup::set_opaqueSortCompareFn(
 void RenderingGroup::set_alphaTestSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
-  _alphaTestSortCompareFn = value;
+  _alphaTestSortCompareFn     = value;
+  _alphaTestSortCache.sortKey = getSortKey(value);
+  _depthOnlySortCache.sortKey = _alphaTestSortCache.sortKey;
   if (value) {
     _renderAlphaTest
       = [this](const std::vector<SubMesh*>& subMeshes) { renderAlphaTestSorted(subMeshes); };
@@ -87,10 +150,9 @@ void RenderingGroup::set_transparentSortCompareFn(
     _transparentSortCompareFn = value;
   }
   else {
-    _transparentSortCompareFn = [](const SubMesh* a, const SubMesh* b) {
-      return RenderingGroup::defaultTransparentSortCompare(a, b);
-    };
+    _transparentSortCompareFn = &RenderingGroup::defaultTransparentSortCompare;
   }
+  _transparentSortCache.sortKey = getSortKey(_transparentSortCompareFn);
   _renderTransparent
     = [this](const std::vector<SubMesh*>& subMeshes) { renderTransparentSorted(subMeshes); };
 }
@@ -170,25 +232,88 @@ void RenderingGroup::render(
 
 void RenderingGroup::renderOpaqueSorted(const std::vector<SubMesh*>& subMeshes)
 {
-  return RenderingGroup::renderSorted(subMeshes, _opaqueSortCompareFn, _scene->activeCamera(),
-                                      false);
+  return RenderingGroup::renderSorted(subMeshes, _opaqueSortCompareFn, _opaqueSortCache,
+                                      _scene->activeCamera(), false);
 }
 
 void RenderingGroup::renderAlphaTestSorted(const std::vector<SubMesh*>& subMeshes)
 {
-  return RenderingGroup::renderSorted(subMeshes, _alphaTestSortCompareFn, _scene->activeCamera(),
-                                      false);
+  // The depth only queue is rendered with the alpha test function, keep its own frame to frame
+  // order
+  auto& cache = (&subMeshes == &_depthOnlySubMeshes) ? _depthOnlySortCache : _alphaTestSortCache;
+  return RenderingGroup::renderSorted(subMeshes, _alphaTestSortCompareFn, cache,
+                                      _scene->activeCamera(), false);
 }
 
 void RenderingGroup::renderTransparentSorted(const std::vector<SubMesh*>& subMeshes)
 {
-  return RenderingGroup::renderSorted(subMeshes, _transparentSortCompareFn, _scene->activeCamera(),
-                                      true);
+  return RenderingGroup::renderSorted(subMeshes, _transparentSortCompareFn, _transparentSortCache,
+                                      _scene->activeCamera(), true);
 }
 
-void RenderingGroup::renderSorted(
+RenderingGroup::SortKeyFn
+RenderingGroup::getSortKey(const std::function<bool(const SubMesh* a, const SubMesh* b)>& fn)
+{
+  const auto target = fn ? fn.target<SubMeshSortCompareFn>() : nullptr;
+  if (!target) {
+    return nullptr;
+  }
+  if (*target == &RenderingGroup::defaultTransparentSortCompare) {
+    return &defaultTransparentSortKey;
+  }
+  if (*target == &RenderingGroup::backToFrontSortCompare) {
+    return &backToFrontSortKey;
+  }
+  if (*target == &RenderingGroup::frontToBackSortCompare) {
+    return &frontToBackSortKey;
+  }
+  if (*target == &RenderingGroup::materialSortCompare) {
+    return &materialSortKey;
+  }
+  if (*target == &RenderingGroup::stateSortCompare) {
+    return &stateSortKey;
+  }
+  return nullptr;
+}
+
+const std::vector<SubMesh*>& RenderingGroup::sortSubMeshes(
   const std::vector<SubMesh*>& subMeshes,
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
+  _SortCache& cache)
+{
+  auto& sortedSubMeshes = cache.sortedSubMeshes;
+
+  // Custom comparison function
+  if (!cache.sortKey) {
+    sortedSubMeshes.assign(subMeshes.begin(), subMeshes.end());
+    std::stable_sort(sortedSubMeshes.begin(), sortedSubMeshes.end(), sortCompareFn);
+    return sortedSubMeshes;
+  }
+
+  cache.keys.resize(subMeshes.size());
+  for (size_t i = 0; i < subMeshes.size(); ++i) {
+    cache.keys[i] = cache.sortKey(subMeshes[i]);
+  }
+
+  // The previous order is a good guess when the same submeshes are dispatched in the same order
+  if (subMeshes == cache.previousSubMeshes) {
+    cache.sorter.sortCoherent(cache.keys, cache.order);
+  }
+  else {
+    cache.sorter.sort(cache.keys, cache.order);
+    cache.previousSubMeshes.assign(subMeshes.begin(), subMeshes.end());
+  }
+
+  sortedSubMeshes.resize(subMeshes.size());
+  for (size_t i = 0; i < subMeshes.size(); ++i) {
+    sortedSubMeshes[i] = subMeshes[cache.order[i]];
+  }
+  return sortedSubMeshes;
+}
+
+void RenderingGroup::renderSorted(
+  const std::vector<SubMesh*>& subMeshes,
+  const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn, _SortCache& cache,
   const CameraPtr& camera, bool transparent)
 {
   auto cameraPosition = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
@@ -198,12 +323,7 @@ void RenderingGroup::renderSorted(
       = Vector3::Distance(subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
   }
 
-  auto sortedArray = subMeshes;
-
-  // sort using a custom function object
-  if (sortCompareFn) {
-    std::stable_sort(sortedArray.begin(), sortedArray.end(), sortCompareFn);
-  }
+  const auto& sortedArray = sortSubMeshes(subMeshes, sortCompareFn, cache);
 
   for (const auto& subMesh : sortedArray) {
     if (transparent) {
@@ -232,10 +352,10 @@ void RenderingGroup::renderUnsorted(const std::vector<SubMesh*>& subMeshes)
 bool RenderingGroup::defaultTransparentSortCompare(const SubMesh* a, const SubMesh* b)
 {
   // Alpha index first
-  if (a->_alphaIndex > b->_alphaIndex) {
+  if (a->_alphaIndex < b->_alphaIndex) {
     return true;
   }
-  if (a->_alphaIndex < b->_alphaIndex) {
+  if (a->_alphaIndex > b->_alphaIndex) {
     return false;
   }
 
@@ -245,24 +365,32 @@ bool RenderingGroup::defaultTransparentSortCompare(const SubMesh* a, const SubMe
 
 bool RenderingGroup::backToFrontSortCompare(const SubMesh* a, const SubMesh* b)
 {
-  // Then distance to camera
-  if (a->_distanceToCamera < b->_distanceToCamera) {
-    return true;
-  }
-  if (a->_distanceToCamera > b->_distanceToCamera) {
-    return false;
-  }
+  // Farthest first
+  return a->_distanceToCamera > b->_distanceToCamera;
+}
 
-  return false;
+bool RenderingGroup::frontToBackSortCompare(const SubMesh* a, const SubMesh* b)
+{
+  // Closest first
+  return a->_distanceToCamera < b->_distanceToCamera;
 }
 
-bool RenderingGroup::frontToBackSortCompare(SubMesh* a, SubMesh* b)
+bool RenderingGroup::materialSortCompare(const SubMesh* a, const SubMesh* b)
 {
-  // Then distance to camera
-  if (a->_distanceToCamera < b->_distanceToCamera) {
-    return false;
+  // Material first
+  const auto idA = materialId(a);
+  const auto idB = materialId(b);
+  if (idA != idB) {
+    return idA < idB;
   }
-  return a->_distanceToCamera > b->_distanceToCamera;
+
+  // Then distance to camera
+  return RenderingGroup::frontToBackSortCompare(a, b);
+}
+
+bool RenderingGroup::stateSortCompare(const SubMesh* a, const SubMesh* b)
+{
+  return stateSortKey(a) < stateSortKey(b);
 }
 
 void RenderingGroup::prepare()
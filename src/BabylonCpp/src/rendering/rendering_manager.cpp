@@ -4,6 +4,7 @@
 #include <babylon/engines/engine.h>
 #include <babylon/engines/rendering_group_info.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/frame_profiler.h>
 #include <babylon/materials/material.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
@@ -18,6 +19,7 @@ bool RenderingManager::AUTOCLEAR = true;
 RenderingManager::RenderingManager(Scene* scene)
     : _useSceneAutoClearSetup{false}
     , _scene{scene}
+    , _stateSortedRendering{false}
     , _renderingGroupInfo{std::make_unique<RenderingGroupInfo>()}
 {
   _autoClearDepthStencil.resize(MAX_RENDERINGGROUPS);
@@ -103,6 +105,9 @@ void RenderingManager::render(std::function<void(const std::vector<SubMesh*>& op
     }
 
     // Render
+    static constexpr const char* zoneNames[RenderingManager::MAX_RENDERINGGROUPS]
+      = {"Rendering group 0", "Rendering group 1", "Rendering group 2", "Rendering group 3"};
+    BABYLON_PROFILE_ZONE(zoneNames[index]);
     const auto iIndex = static_cast<int>(index);
     for (const auto& step : _scene->_beforeRenderingGroupDrawStage) {
       step.action(iIndex);
@@ -160,10 +165,41 @@ void RenderingManager::_prepareRenderingGroup(unsigned int renderingGroupId)
   }
 
   if (!_renderingGroups[renderingGroupId]) {
-    _renderingGroups[renderingGroupId] = std::make_unique<RenderingGroup>(
-      renderingGroupId, _scene, _customOpaqueSortCompareFn[renderingGroupId],
-      _customAlphaTestSortCompareFn[renderingGroupId],
-      _customTransparentSortCompareFn[renderingGroupId]);
+    _renderingGroups[renderingGroupId]
+      = std::make_unique<RenderingGroup>(renderingGroupId, _scene);
+    _applyRenderingOrder(renderingGroupId);
+  }
+}
+
+void RenderingManager::_applyRenderingOrder(unsigned int renderingGroupId)
+{
+  auto& group = _renderingGroups[renderingGroupId];
+
+  // The built-in state sort is used when no custom sort function is defined
+  const auto stateSort = [this](const std::function<int(const SubMesh* a, const SubMesh* b)>& fn)
+    -> std::function<bool(const SubMesh* a, const SubMesh* b)> {
+    if (!fn && _stateSortedRendering) {
+      return &RenderingGroup::stateSortCompare;
+    }
+    return fn;
+  };
+
+  group->opaqueSortCompareFn      = stateSort(_customOpaqueSortCompareFn[renderingGroupId]);
+  group->alphaTestSortCompareFn   = stateSort(_customAlphaTestSortCompareFn[renderingGroupId]);
+  group->transparentSortCompareFn = _customTransparentSortCompareFn[renderingGroupId];
+}
+
+void RenderingManager::setStateSortedRendering(bool enabled)
+{
+  if (_stateSortedRendering == enabled) {
+    return;
+  }
+
+  _stateSortedRendering = enabled;
+  for (unsigned int index = 0; index < _renderingGroups.size(); ++index) {
+    if (_renderingGroups[index]) {
+      _applyRenderingOrder(index);
+    }
   }
 }
 
@@ -207,11 +243,8 @@ void RenderingManager::setRenderingOrder(
   _customAlphaTestSortCompareFn[renderingGroupId]   = alphaTestSortCompareFn;
   _customTransparentSortCompareFn[renderingGroupId] = transparentSortCompareFn;
 
-  if (_renderingGroups[renderingGroupId]) {
-    auto& group                     = _renderingGroups[renderingGroupId];
-    group->opaqueSortCompareFn      = _customOpaqueSortCompareFn[renderingGroupId];
-    group->alphaTestSortCompareFn   = _customAlphaTestSortCompareFn[renderingGroupId];
-    group->transparentSortCompareFn = _customTransparentSortCompareFn[renderingGroupId];
+  if (renderingGroupId < _renderingGroups.size() && _renderingGroups[renderingGroupId]) {
+    _applyRenderingOrder(renderingGroupId);
   }
 }
 
@@ -0,0 +1,110 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <babylon/core/logging.h>
+
+namespace {
+
+std::atomic<size_t> receivedCount{0};
+std::string lastMessage;
+
+void onLogMessage(const BABYLON::LogMessage& logMessage)
+{
+  // Only written by the thread dispatching the messages
+  lastMessage = logMessage.message();
+  ++receivedCount;
+}
+
+} // end of anonymous namespace
+
+TEST(TestLogger, skipsLevelsWithoutListener)
+{
+  using namespace BABYLON;
+
+  auto listener = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger  = LoggerInstance();
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_WARN));
+
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, listener);
+  EXPECT_TRUE(logger.takes(LogLevels::LEVEL_WARN));
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_DEBUG));
+
+  // The arguments of a message nobody listens to are not evaluated
+  size_t evaluated = 0;
+  receivedCount    = 0;
+  BABYLON_LOGF_DEBUG("TestLogger", "%zu", ++evaluated);
+  BABYLON_LOGF_WARN("TestLogger", "%zu", ++evaluated);
+  EXPECT_EQ(evaluated, 1ull);
+  EXPECT_EQ(receivedCount, 1ull);
+  EXPECT_EQ(lastMessage, "1");
+
+  logger.setMaxLevel(LogLevels::LEVEL_ERROR);
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_WARN));
+  logger.setMaxLevel(LogLevels::LEVEL_TRACE);
+  EXPECT_TRUE(logger.takes(LogLevels::LEVEL_WARN));
+
+  logger.unregisterLogMessageListener(LogLevels::LEVEL_WARN, listener);
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_WARN));
+}
+
+TEST(TestLogger, moveKeepsMessage)
+{
+  using namespace BABYLON;
+
+  LogMessage logMessage{LogLevels::LEVEL_INFO, "TestLogger"};
+  logMessage.write("moved", 42);
+  LogMessage moved{std::move(logMessage)};
+  EXPECT_EQ(moved.message(), "moved 42");
+
+  LogMessage assigned;
+  assigned.write("previous");
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.message(), "moved 42");
+
+  LogMessage copied;
+  copied.write("previous");
+  copied = assigned;
+  EXPECT_EQ(copied.message(), "moved 42");
+}
+
+TEST(TestLogger, asyncFromSeveralThreads)
+{
+  using namespace BABYLON;
+
+  auto listener = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger  = LoggerInstance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_INFO, listener);
+  const auto before = logger.statistics();
+
+  // Small queue, some messages may be dropped
+  logger.startAsync(64);
+  EXPECT_TRUE(logger.isAsync());
+  receivedCount = 0;
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([]() {
+      for (size_t i = 0; i < 1000; ++i) {
+        BABYLON_LOGF_INFO("TestLogger", "message %zu", i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  logger.flush();
+
+  const auto statistics = logger.statistics();
+  EXPECT_EQ(statistics.written - before.written, receivedCount.load());
+  EXPECT_EQ(statistics.written + statistics.dropped - before.written - before.dropped, 4000ull);
+
+  // Back to synchronous dispatching
+  logger.stopAsync();
+  EXPECT_FALSE(logger.isAsync());
+  BABYLON_LOGF_INFO("TestLogger", "%s", "synchronous");
+  EXPECT_EQ(lastMessage, "synchronous");
+
+  logger.unregisterLogMessageListener(listener);
+}
@@ -0,0 +1,119 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/core/profiling/memory_tracker.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+TEST(TestMemoryTracker, trackedMemory)
+{
+  using namespace BABYLON;
+
+  const auto liveBytes = MemoryTracker::LiveBytes(MemoryCategory::Animations);
+  {
+    TrackedMemory memory{MemoryCategory::Animations, 100};
+    EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes + 100);
+    memory.set(40);
+    EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes + 40);
+    {
+      // A copy accounts the bytes again
+      auto copy = memory;
+      EXPECT_EQ(copy.bytes(), 40ull);
+      EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes + 80);
+    }
+    EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes + 40);
+    EXPECT_GE(MemoryTracker::PeakBytes(MemoryCategory::Animations), liveBytes + 100);
+  }
+  EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes);
+
+  {
+    std::vector<float, TrackedAllocator<float, MemoryCategory::Animations>> values(16);
+    EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations),
+              liveBytes + 16 * sizeof(float));
+  }
+  EXPECT_EQ(MemoryTracker::LiveBytes(MemoryCategory::Animations), liveBytes);
+  EXPECT_STREQ(MemoryTracker::CategoryName(MemoryCategory::VertexBuffers), "Vertex buffers");
+}
+
+TEST(TestMemoryTracker, allocationHooks)
+{
+  using namespace BABYLON;
+  if (!MemoryTracker::HasAllocationHooks()) {
+    GTEST_SKIP() << "BabylonCpp is built without BABYLON_TRACK_ALLOCATIONS";
+  }
+
+  const auto before = MemoryTracker::ThreadAllocations();
+  auto values       = std::make_unique<std::vector<int>>(100);
+  const auto after  = MemoryTracker::ThreadAllocations();
+  EXPECT_EQ(after.allocations - before.allocations, 2ull);
+  EXPECT_GE(after.bytes - before.bytes, 100 * sizeof(int));
+  EXPECT_GE(MemoryTracker::Allocations().allocations, after.allocations);
+}
+
+TEST(TestMemoryTracker, subsystemsMemory)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  SceneInstrumentation instrumentation(scene.get());
+  const auto geometryBytes     = instrumentation.getMemoryUsage(MemoryCategory::Geometry);
+  const auto vertexBufferBytes = instrumentation.getMemoryUsage(MemoryCategory::VertexBuffers);
+
+  BoxOptions boxOptions;
+  auto box = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  // 36 indices and 24 positions, normals and uvs
+  EXPECT_GE(instrumentation.getMemoryUsage(MemoryCategory::Geometry),
+            geometryBytes + 36 * sizeof(uint32_t));
+  EXPECT_GE(instrumentation.getMemoryUsage(MemoryCategory::VertexBuffers),
+            vertexBufferBytes + 24 * 8 * sizeof(float));
+
+  box->dispose();
+  EXPECT_EQ(instrumentation.getMemoryUsage(MemoryCategory::Geometry), geometryBytes);
+  instrumentation.dispose();
+}
+
+// Enabled once the per-frame containers of the render loop are reused between frames
+TEST(TestMemoryTracker, DISABLED_staticSceneSteadyStateAllocations)
+{
+  using namespace BABYLON;
+  if (!MemoryTracker::HasAllocationHooks()) {
+    GTEST_SKIP() << "BabylonCpp is built without BABYLON_TRACK_ALLOCATIONS";
+  }
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 5.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  for (int i = 0; i < 10; ++i) {
+    BoxOptions boxOptions;
+    auto box          = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+    box->position().x = static_cast<float>(i * 2 - 10);
+    box->material     = material;
+  }
+
+  SceneInstrumentation instrumentation(scene.get());
+  instrumentation.captureAllocations = true;
+  // Warm up, the effects are compiled and the per-frame containers reach their final size
+  for (int frame = 0; frame < 10; ++frame) {
+    scene->render();
+  }
+  for (int frame = 0; frame < 10; ++frame) {
+    scene->render();
+    EXPECT_EQ(instrumentation.allocationsCounter().current(), 0ull);
+  }
+  instrumentation.dispose();
+}
@@ -0,0 +1,145 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/directional_light.h>
+#include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+
+namespace {
+
+/**
+ * @brief Creates a scene with a camera looking at the clones of a box sharing its material.
+ */
+std::unique_ptr<BABYLON::Scene> createScene(BABYLON::Engine* engine, size_t count,
+                                            std::vector<BABYLON::MeshPtr>& meshes)
+{
+  using namespace BABYLON;
+  engine->getCaps().instancedArrays = true;
+  auto scene                        = Scene::New(engine);
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  BoxOptions boxOptions;
+  auto box      = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  box->material = StandardMaterial::New("material", scene.get());
+  meshes        = {box};
+  for (size_t i = 1; i < count; ++i) {
+    meshes.emplace_back(box->clone("box" + std::to_string(i)));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    meshes[i]->position().x = static_cast<float>(i % 5) * 2.f - 4.f;
+    meshes[i]->position().y = static_cast<float>(i / 5) * 2.f - 4.f;
+  }
+  return scene;
+}
+
+/**
+ * @brief Renders a frame and returns its draw calls.
+ */
+size_t renderFrame(BABYLON::Engine* engine, BABYLON::Scene* scene)
+{
+  engine->_drawCalls.fetchNewFrame();
+  scene->render();
+  return engine->_drawCalls.current();
+}
+
+} // end of anonymous namespace
+
+TEST(AutoInstancing, drawCalls)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  std::vector<MeshPtr> meshes;
+  auto scene = createScene(engine.get(), 20, meshes);
+
+  EXPECT_EQ(renderFrame(engine.get(), scene.get()), 20ull);
+  EXPECT_EQ(scene->getActiveMeshes().size(), 20ull);
+  EXPECT_EQ(scene->getActiveIndices(), 20 * 36ull);
+
+  // A single instanced draw call, the batched meshes are still active meshes
+  scene->autoInstancing = true;
+  EXPECT_EQ(renderFrame(engine.get(), scene.get()), 1ull);
+  EXPECT_EQ(scene->getActiveMeshes().size(), 20ull);
+  EXPECT_EQ(scene->getActiveIndices(), 20 * 36ull);
+  for (size_t i = 1; i < meshes.size(); ++i) {
+    EXPECT_TRUE(meshes[i]->_canBeAutoInstanced());
+  }
+
+  scene->autoInstancing = false;
+  EXPECT_EQ(renderFrame(engine.get(), scene.get()), 20ull);
+}
+
+TEST(AutoInstancing, neverBatched)
+{
+  using namespace BABYLON;
+  const std::vector<std::pair<std::string, std::function<void(const MeshPtr& mesh)>>> cases{
+    {"skeleton",
+     [](const MeshPtr& mesh) {
+       mesh->skeleton = Skeleton::New("skeleton", "skeleton", mesh->getScene());
+     }},
+    {"morph targets",
+     [](const MeshPtr& mesh) {
+       auto manager = MorphTargetManager::New(mesh->getScene());
+       auto target  = MorphTarget::New("target", 0.5f, mesh->getScene());
+       target->setPositions(mesh->getVerticesData(VertexBuffer::PositionKind));
+       manager->addTarget(target);
+       mesh->morphTargetManager = manager;
+     }},
+    {"LOD", [](const MeshPtr& mesh) { mesh->addLODLevel(1000.f, nullptr); }},
+    {"alpha blending", [](const MeshPtr& mesh) { mesh->material()->alpha = 0.5f; }},
+    {"visibility", [](const MeshPtr& mesh) { mesh->visibility = 0.5f; }},
+  };
+
+  for (const auto& [name, apply] : cases) {
+    SCOPED_TRACE(name);
+    auto engine = createSubject();
+    std::vector<MeshPtr> meshes;
+    auto scene            = createScene(engine.get(), 4, meshes);
+    scene->autoInstancing = true;
+    for (const auto& mesh : meshes) {
+      apply(mesh);
+    }
+    EXPECT_EQ(renderFrame(engine.get(), scene.get()), 4ull);
+    for (const auto& mesh : meshes) {
+      EXPECT_FALSE(mesh->_canBeAutoInstanced());
+    }
+  }
+}
+
+TEST(AutoInstancing, renderTargetsDrawEveryMesh)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  std::vector<MeshPtr> meshes;
+  auto scene = createScene(engine.get(), 10, meshes);
+
+  // A render target and a shadow map rendering all the meshes
+  auto renderTarget    = RenderTargetTexture::New("renderTarget", 256, scene.get());
+  auto light           = DirectionalLight::New("light", Vector3(0.f, 0.f, 1.f), scene.get());
+  auto shadowGenerator = ShadowGenerator::New(256, light);
+  for (const auto& mesh : meshes) {
+    renderTarget->renderList().emplace_back(mesh.get());
+    shadowGenerator->addShadowCaster(mesh);
+  }
+  scene->customRenderTargets.emplace_back(renderTarget);
+  renderFrame(engine.get(), scene.get());
+  const auto drawCalls = renderFrame(engine.get(), scene.get());
+  EXPECT_GE(drawCalls, 30ull);
+
+  // Only the main pass is batched
+  scene->autoInstancing = true;
+  EXPECT_EQ(renderFrame(engine.get(), scene.get()), drawCalls - 9);
+}
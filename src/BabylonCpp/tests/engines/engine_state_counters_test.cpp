@@ -0,0 +1,166 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/engine_instrumentation.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/states/depth_culling_state.h>
+
+namespace {
+
+/**
+ * @brief Creates a scene with a light and a camera looking at the clones of a box and a sphere,
+ * alternating two materials compiling to different effects.
+ */
+std::unique_ptr<BABYLON::Scene> createScene(BABYLON::Engine* engine, size_t count)
+{
+  using namespace BABYLON;
+  auto scene  = Scene::New(engine);
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+
+  auto litMaterial               = StandardMaterial::New("lit", scene.get());
+  auto unlitMaterial             = StandardMaterial::New("unlit", scene.get());
+  unlitMaterial->disableLighting = true;
+  BoxOptions boxOptions;
+  SphereOptions sphereOptions;
+  auto box    = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  auto sphere = MeshBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+  for (size_t i = 0; i < count; ++i) {
+    auto mesh          = (i % 2 == 0) ? box->clone("clone" + std::to_string(i)) :
+                                        sphere->clone("clone" + std::to_string(i));
+    mesh->material     = ((i / 2) % 2 == 0) ? litMaterial : unlitMaterial;
+    mesh->position().x = static_cast<float>(i % 5) * 2.f - 4.f;
+    mesh->position().y = static_cast<float>(i / 5) * 2.f - 4.f;
+  }
+  box->setEnabled(false);
+  sphere->setEnabled(false);
+  return scene;
+}
+
+} // end of anonymous namespace
+
+TEST(EngineStateCounters, redundantStateChanges)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  auto box = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  engine->resetStateCounters();
+
+  // Alpha mode
+  engine->setAlphaMode(Constants::ALPHA_COMBINE);
+  engine->setAlphaMode(Constants::ALPHA_COMBINE);
+  EXPECT_EQ(engine->getStateCounters().alphaModeChanges, 1ull);
+  EXPECT_EQ(engine->getStateCounters().alphaModeChangesAvoided, 1ull);
+
+  // Depth and culling state
+  engine->setState(true, 0.f, false, false);
+  engine->setState(true, 0.f, false, false);
+  engine->setState(false, 0.f, false, false);
+  EXPECT_EQ(engine->getStateCounters().depthCullingStateChangesAvoided, 1ull);
+
+  // Vertex and index buffers
+  const auto vertexBuffers = box->geometry()->getVertexBuffers();
+  const auto indexBuffer   = box->geometry()->getIndexBuffer();
+  engine->bindBuffers(vertexBuffers, indexBuffer, nullptr);
+  engine->bindBuffers(vertexBuffers, indexBuffer, nullptr);
+  EXPECT_EQ(engine->getStateCounters().vertexBufferBindings, 1ull);
+  EXPECT_EQ(engine->getStateCounters().vertexBufferBindingsAvoided, 1ull);
+  EXPECT_EQ(engine->getStateCounters().indexBufferBindings, 1ull);
+  EXPECT_EQ(engine->getStateCounters().indexBufferBindingsAvoided, 1ull);
+
+  EXPECT_GE(engine->getStateCounters().stateChangesAvoided(), 5ull);
+  engine->resetStateCounters();
+  EXPECT_EQ(engine->getStateCounters().stateChanges(), 0ull);
+  EXPECT_EQ(engine->getStateCounters().stateChangesAvoided(), 0ull);
+}
+
+TEST(EngineStateCounters, nullEngineSkipsRepeatedEffect)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = createScene(engine.get(), 2);
+  scene->render();
+  auto effect = scene->meshes.back()->subMeshes[0]->effect();
+  ASSERT_NE(effect, nullptr);
+
+  // The callbacks of an effect only run when it becomes the current effect
+  size_t onBindCount = 0;
+  effect->onBind     = [&onBindCount](Effect* /*effect*/) { ++onBindCount; };
+  engine->wipeCaches(true);
+  engine->enableEffect(effect);
+  engine->enableEffect(effect);
+  EXPECT_EQ(onBindCount, 1ull);
+  engine->wipeCaches(true);
+  engine->enableEffect(effect);
+  EXPECT_EQ(onBindCount, 2ull);
+}
+
+TEST(EngineStateCounters, nullEngineUpdatesDepthCullingState)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+
+  engine->setState(true, 0.5f, false, true);
+  EXPECT_EQ(engine->depthCullingState()->cull(), true);
+  EXPECT_FLOAT_EQ(engine->depthCullingState()->zOffset(), 0.5f);
+  engine->setState(false, 0.f, false, false);
+  EXPECT_EQ(engine->depthCullingState()->cull(), false);
+  EXPECT_FLOAT_EQ(engine->depthCullingState()->zOffset(), 0.f);
+}
+
+TEST(EngineStateCounters, stateSortedRendering)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = createScene(engine.get(), 20);
+  scene->render();
+
+  // Interleaved materials and geometries rebind the effect and the vertex buffers on most draws
+  engine->resetStateCounters();
+  scene->render();
+  const auto unsorted = engine->getStateCounters();
+  EXPECT_GE(unsorted.effectBindings, 10ull);
+
+  scene->setStateSortedRendering(true);
+  engine->resetStateCounters();
+  scene->render();
+  const auto sorted = engine->getStateCounters();
+  EXPECT_LE(sorted.effectBindings, 2ull);
+  EXPECT_LT(sorted.effectBindings, unsorted.effectBindings);
+  EXPECT_LT(sorted.vertexBufferBindings, unsorted.vertexBufferBindings);
+}
+
+TEST(EngineStateCounters, instrumentation)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  EngineInstrumentation instrumentation(engine.get());
+  instrumentation.captureStateChanges = true;
+
+  engine->beginFrame();
+  engine->setAlphaMode(Constants::ALPHA_ADD);
+  engine->setAlphaMode(Constants::ALPHA_COMBINE);
+  engine->setAlphaMode(Constants::ALPHA_COMBINE);
+  engine->endFrame();
+
+  EXPECT_EQ(instrumentation.stateChangesCounter().current(), 1ull);
+  EXPECT_EQ(instrumentation.stateChangesAvoidedCounter().current(), 2ull);
+  instrumentation.dispose();
+}
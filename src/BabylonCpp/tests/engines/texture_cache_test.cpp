@@ -0,0 +1,113 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/engines/texture_cache.h>
+#include <babylon/instrumentation/engine_instrumentation.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/materials/textures/texture.h>
+
+TEST(TextureCache, sharesTexturesLoadedFromTheSameUrl)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto& cache = engine->getLoadedTexturesCache();
+  cache.resetCounters();
+
+  auto texture1 = Texture::New("a.png", scene.get());
+  auto texture2 = Texture::New("a.png", scene.get());
+  auto texture3 = Texture::New("a.png", scene.get(), true);
+  EXPECT_EQ(texture1->getInternalTexture(), texture2->getInternalTexture());
+  EXPECT_NE(texture1->getInternalTexture(), texture3->getInternalTexture());
+  EXPECT_EQ(cache.counters().hits, 1ull);
+  EXPECT_EQ(cache.counters().misses, 2ull);
+
+  // 256x256 RGBA texture with mip maps
+  EXPECT_EQ(TextureCache::ByteSize(*texture1->getInternalTexture()), 256ull * 256 * 4 * 4 / 3);
+}
+
+TEST(TextureCache, evictsUnreferencedTexturesOverBudget)
+{
+  using namespace BABYLON;
+  auto engine       = createSubject();
+  auto& cache       = engine->getLoadedTexturesCache();
+  const auto cached = [&cache](const InternalTexturePtr& texture) {
+    return cache.contains(texture.get());
+  };
+
+  // Without budget the textures are released as soon as they are no longer referenced
+  auto a = engine->createTexture("a.png", false, true, nullptr);
+  a->dispose();
+  EXPECT_EQ(a->_webGLTexture, nullptr);
+  EXPECT_FALSE(cached(a));
+  EXPECT_EQ(cache.unreferencedCount(), 0ull);
+
+  // The budget fits one texture
+  engine->setTexturesCacheMemoryBudget(TextureCache::ByteSize(*a));
+  auto b = engine->createTexture("b.png", false, true, nullptr);
+  b->dispose();
+  EXPECT_NE(b->_webGLTexture, nullptr);
+  EXPECT_EQ(cache.unreferencedCount(), 1ull);
+
+  // An unreferenced texture is reused
+  cache.resetCounters();
+  EXPECT_EQ(cache.find("b.png", false), b);
+  EXPECT_EQ(b->_references, 1);
+  EXPECT_EQ(cache.unreferencedCount(), 0ull);
+  b->dispose();
+
+  // The least recently used texture is evicted
+  auto c = engine->createTexture("c.png", false, true, nullptr);
+  c->dispose();
+  EXPECT_FALSE(cached(b));
+  EXPECT_EQ(b->_webGLTexture, nullptr);
+  EXPECT_TRUE(cached(c));
+  EXPECT_EQ(cache.counters().evictions, 1ull);
+  EXPECT_EQ(cache.find("b.png", false), nullptr);
+
+  // Referenced textures are never evicted
+  auto d = engine->createTexture("d.png", false, true, nullptr);
+  auto e = engine->createTexture("e.png", false, true, nullptr);
+  e->dispose();
+  EXPECT_FALSE(cached(c));
+  EXPECT_FALSE(cached(e));
+  EXPECT_TRUE(cached(d));
+  EXPECT_GT(cache.memoryUsage(), cache.memoryBudget());
+  EXPECT_EQ(cache.counters().evictions, 3ull);
+
+  // Removing the budget releases the unreferenced textures
+  engine->setTexturesCacheMemoryBudget(4 * TextureCache::ByteSize(*a));
+  auto f = engine->createTexture("f.png", false, true, nullptr);
+  f->dispose();
+  EXPECT_TRUE(cached(f));
+  engine->setTexturesCacheMemoryBudget(0);
+  EXPECT_FALSE(cached(f));
+  EXPECT_TRUE(cached(d));
+}
+
+TEST(TextureCache, instrumentation)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  EngineInstrumentation instrumentation(engine.get());
+  instrumentation.captureTexturesCache = true;
+
+  auto texture1 = Texture::New("a.png", scene.get());
+  auto texture2 = Texture::New("a.png", scene.get());
+  engine->beginFrame();
+  engine->endFrame();
+
+  EXPECT_EQ(instrumentation.texturesCacheHitsCounter().current(), 1ull);
+  EXPECT_EQ(instrumentation.texturesCacheMissesCounter().current(), 1ull);
+  EXPECT_EQ(instrumentation.texturesCacheEvictionsCounter().current(), 0ull);
+
+  engine->beginFrame();
+  engine->endFrame();
+  EXPECT_EQ(instrumentation.texturesCacheHitsCounter().current(), 0ull);
+  instrumentation.dispose();
+}
@@ -0,0 +1,151 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/instrumentation/frame_profiler.h>
+#include <babylon/misc/tools.h>
+
+namespace {
+
+std::vector<BABYLON::ProfilerEvent> eventsNamed(const std::string& name)
+{
+  std::vector<BABYLON::ProfilerEvent> events;
+  for (const auto& event : BABYLON::FrameProfiler::Events()) {
+    if (event.name && name == event.name) {
+      events.emplace_back(event);
+    }
+  }
+  return events;
+}
+
+} // end of anonymous namespace
+
+TEST(TestFrameProfiler, disabledRecordsNothing)
+{
+  using namespace BABYLON;
+
+  FrameProfiler::SetEnabled(false);
+  FrameProfiler::Clear();
+  {
+    BABYLON_PROFILE_ZONE("Disabled");
+    FrameProfiler::Counter("Disabled counter", 1.0);
+  }
+  Tools::StartPerformanceCounter("Disabled counter");
+  Tools::EndPerformanceCounter("Disabled counter");
+  EXPECT_TRUE(FrameProfiler::Events().empty());
+}
+
+TEST(TestFrameProfiler, nestedZonesAndChromeTrace)
+{
+  using namespace BABYLON;
+
+  FrameProfiler::Clear();
+  FrameProfiler::SetEnabled(true);
+  FrameProfiler::BeginFrame();
+  {
+    BABYLON_PROFILE_ZONE("Outer");
+    {
+      BABYLON_PROFILE_ZONE("Inner \"quoted\"");
+    }
+    Tools::StartPerformanceCounter("Rendering camera " + std::string("main"));
+    Tools::EndPerformanceCounter("Rendering camera main");
+    FrameProfiler::Counter("Draw calls", 12.0);
+  }
+  // Unmatched, ignored
+  FrameProfiler::EndFrame();
+  FrameProfiler::EndZone();
+  FrameProfiler::SetEnabled(false);
+
+  const auto events = FrameProfiler::Events();
+  ASSERT_EQ(events.size(), 9ull);
+  std::string phases;
+  for (const auto& event : events) {
+    phases += event.phase;
+  }
+  EXPECT_EQ(phases, "BBBEBECEE");
+  EXPECT_STREQ(events[0].name, "Frame");
+  EXPECT_STREQ(events[4].name, "Rendering camera main");
+  EXPECT_DOUBLE_EQ(events[6].value, 12.0);
+  for (size_t i = 1; i < events.size(); ++i) {
+    EXPECT_GE(events[i].timestamp, events[i - 1].timestamp);
+  }
+
+  std::ostringstream stream;
+  FrameProfiler::WriteChromeTrace(stream);
+  const auto trace        = nlohmann::json::parse(stream.str());
+  const auto& traceEvents = trace["traceEvents"];
+  ASSERT_EQ(traceEvents.size(), events.size());
+  EXPECT_EQ(traceEvents[1]["name"], "Outer");
+  EXPECT_EQ(traceEvents[2]["name"], "Inner \"quoted\"");
+  EXPECT_EQ(traceEvents[6]["ph"], "C");
+  EXPECT_EQ(traceEvents[6]["args"]["value"], 12.0);
+}
+
+TEST(TestFrameProfiler, threadsRecordInTheirOwnRingBuffer)
+{
+  using namespace BABYLON;
+
+  FrameProfiler::Clear();
+  FrameProfiler::SetEnabled(true);
+  const auto capacity                 = FrameProfiler::ThreadBufferCapacity;
+  FrameProfiler::ThreadBufferCapacity = 8;
+  std::thread worker([]() {
+    for (size_t i = 0; i < 10; ++i) {
+      BABYLON_PROFILE_ZONE("Worker");
+    }
+  });
+  worker.join();
+  FrameProfiler::ThreadBufferCapacity = capacity;
+  {
+    BABYLON_PROFILE_ZONE("Main");
+  }
+  FrameProfiler::SetEnabled(false);
+
+  // Only the last 8 events of the worker are kept
+  EXPECT_EQ(eventsNamed("Worker").size(), 4ull);
+  EXPECT_EQ(eventsNamed("Main").size(), 1ull);
+
+  std::ostringstream stream;
+  FrameProfiler::WriteChromeTrace(stream);
+  const auto trace = nlohmann::json::parse(stream.str());
+  std::set<size_t> threadIds;
+  for (const auto& event : trace["traceEvents"]) {
+    threadIds.insert(event["tid"].get<size_t>());
+  }
+  EXPECT_EQ(threadIds.size(), 2ull);
+}
+
+TEST(TestFrameProfiler, captureFramesWritesTrace)
+{
+  using namespace BABYLON;
+
+  const std::string filename = "frame_profiler_test_trace.json";
+  FrameProfiler::CaptureFrames(2, filename);
+  EXPECT_TRUE(FrameProfiler::IsEnabled());
+  for (size_t frame = 0; frame < 3; ++frame) {
+    FrameProfiler::BeginFrame();
+    {
+      BABYLON_PROFILE_ZONE("Render");
+    }
+    FrameProfiler::EndFrame();
+  }
+  EXPECT_FALSE(FrameProfiler::IsEnabled());
+
+  std::ifstream file{filename};
+  ASSERT_TRUE(file.good());
+  const auto trace  = nlohmann::json::parse(file);
+  size_t frameCount = 0;
+  for (const auto& event : trace["traceEvents"]) {
+    frameCount += (event["ph"] == "B" && event["name"] == "Frame") ? 1 : 0;
+  }
+  EXPECT_EQ(frameCount, 2ull);
+  file.close();
+  std::remove(filename.c_str());
+}
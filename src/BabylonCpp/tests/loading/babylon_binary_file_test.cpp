@@ -0,0 +1,110 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "../test_utils.h"
+
+#include <babylon/core/json_util.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(BabylonBinaryFile, roundTrip)
+{
+  using namespace BABYLON;
+
+  const auto document = json::parse(R"({
+    "producer": {"name": "test"},
+    "geometries": {"vertexData": [{
+      "id": "geometry0",
+      "positions": [0, 1.5, -2, 3e2, 4, 5],
+      "normals": [0, 0, 1, 0, 0, 1],
+      "indices": [0, 1, 2]
+    }]},
+    "meshes": [{"id": "mesh0", "position": [1, 2, 3], "geometryId": "geometry0"}]
+  })");
+
+  const auto data = BabylonBinaryFile::Serialize(document);
+  ASSERT_TRUE(BabylonBinaryFile::IsBinary(data));
+  // The blocks are aligned in the file
+  BabylonBinaryFileHeader header{};
+  std::memcpy(&header, data.data(), sizeof(header));
+  EXPECT_EQ(header.blocksOffset % BabylonBinaryFile::BlockAlignment, 0ull);
+
+  BabylonFileData fileData;
+  BabylonBinaryFile::Parse(data, fileData);
+  EXPECT_FALSE(json_util::has_key(fileData.root, "$blocks"));
+
+  const auto geometry = fileData.getGeometryById("geometry0");
+  ASSERT_NE(geometry, nullptr);
+  // The vertex data is read in place from the blocks
+  const auto& views = fileData.packedArrays.views;
+  ASSERT_EQ(views.size(), 3ull);
+  const auto& indicesView = views.at(&(*geometry)["indices"]);
+  EXPECT_FALSE(indicesView.isFloat);
+  EXPECT_GE(indicesView.data, data.data() + header.blocksOffset);
+  EXPECT_LT(indicesView.data, data.data() + data.size());
+  json_util::packed_arrays_scope scope(&fileData.packedArrays);
+  EXPECT_THAT(json_util::get_array<float>(*geometry, "positions"),
+              ::testing::ElementsAre(0.f, 1.5f, -2.f, 300.f, 4.f, 5.f));
+  EXPECT_THAT(json_util::get_array<float>(*geometry, "normals"),
+              ::testing::ElementsAre(0.f, 0.f, 1.f, 0.f, 0.f, 1.f));
+  EXPECT_THAT(json_util::get_array<uint32_t>(*geometry, "indices"),
+              ::testing::ElementsAre(0u, 1u, 2u));
+
+  // Writing the parsed file again gives the same content
+  EXPECT_EQ(BabylonBinaryFile::Serialize(fileData), data);
+
+  // Small arrays which are not vertex data stay in the metadata
+  const auto& mesh = fileData.root["meshes"][0];
+  EXPECT_THAT(json_util::get_array<float>(mesh, "position"),
+              ::testing::ElementsAre(1.f, 2.f, 3.f));
+}
+
+TEST(BabylonBinaryFile, truncatedFile)
+{
+  using namespace BABYLON;
+
+  const auto document = json::parse(R"({"geometries": {"vertexData": [{"positions": [0, 1, 2]}]}})");
+  const auto data     = BabylonBinaryFile::Serialize(document);
+
+  BabylonFileData fileData;
+  EXPECT_THROW(BabylonBinaryFile::Parse(data.substr(0, data.size() - 4), fileData),
+               std::exception);
+  EXPECT_THROW(BabylonBinaryFile::Parse("{}", fileData), std::exception);
+}
+
+TEST(BabylonBinaryFile, serializeMeshes)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  auto box          = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  box->position().x = 2.f;
+
+  const auto data = BabylonBinaryFile::SerializeMeshes({box});
+  ASSERT_TRUE(BabylonBinaryFile::IsBinary(data));
+
+  auto otherScene = Scene::New(engine.get());
+  std::vector<AbstractMeshPtr> meshes;
+  std::vector<IParticleSystemPtr> particleSystems;
+  std::vector<SkeletonPtr> skeletons;
+  BabylonBinaryFileLoader loader;
+  ASSERT_TRUE(
+    loader.importMesh({}, otherScene.get(), data, "", meshes, particleSystems, skeletons));
+  ASSERT_EQ(meshes.size(), 1ull);
+  auto mesh = std::static_pointer_cast<Mesh>(meshes[0]);
+  EXPECT_EQ(mesh->name, "box");
+  EXPECT_FLOAT_EQ(mesh->position().x, 2.f);
+  EXPECT_EQ(mesh->getVerticesData(VertexBuffer::PositionKind),
+            box->getVerticesData(VertexBuffer::PositionKind));
+  EXPECT_EQ(mesh->getIndices(), box->getIndices());
+}
@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/core/json_util.h>
+#include <babylon/loading/plugins/babylon/babylon_file_reader.h>
+
+TEST(BabylonFileReader, packsVertexData)
+{
+  using namespace BABYLON;
+
+  const std::string data = R"({
+    "producer": {"name": "test"},
+    "geometries": {"vertexData": [{
+      "id": "geometry0",
+      "positions": [0, 1.5, -2, 3e2, 4, 5],
+      "indices": [0, 1, 2],
+      "uvs": [0.25, 0.5, "not a number"],
+      "matricesIndices": [4294967295, 16909060]
+    }]},
+    "materials": [{"id": "material0"}, {"id": "material1"}, {"id": "material0", "name": "copy"}],
+    "skeletons": [{"id": 3, "name": "skeleton3"}],
+    "metadata": {"positions": [1, 2, 3]}
+  })";
+
+  BabylonFileData fileData;
+  BabylonFileReader::Parse(data, fileData);
+
+  const auto geometry = fileData.getGeometryById("geometry0");
+  ASSERT_NE(geometry, nullptr);
+  // The document holds empty arrays in place of the packed arrays
+  EXPECT_TRUE((*geometry)["positions"].empty());
+  EXPECT_EQ(fileData.packedArrays.floats.size(), 1ull);
+  EXPECT_EQ(fileData.packedArrays.indices.size(), 2ull);
+  {
+    json_util::packed_arrays_scope scope(&fileData.packedArrays);
+    EXPECT_THAT(json_util::get_array<float>(*geometry, "positions"),
+                ::testing::ElementsAre(0.f, 1.5f, -2.f, 300.f, 4.f, 5.f));
+    EXPECT_THAT(json_util::get_array<uint32_t>(*geometry, "indices"),
+                ::testing::ElementsAre(0u, 1u, 2u));
+    // Matrices indices are packed bytes, they are kept as integers
+    EXPECT_THAT(json_util::get_array<uint32_t>(*geometry, "matricesIndices"),
+                ::testing::ElementsAre(4294967295u, 16909060u));
+  }
+  EXPECT_TRUE(json_util::get_array<float>(*geometry, "positions").empty());
+  // Arrays which are not only numbers are kept as regular json arrays
+  EXPECT_TRUE((*geometry)["uvs"].is_array());
+  EXPECT_EQ((*geometry)["uvs"].size(), 3ull);
+  // Only the vertex data of meshes, geometries and morph targets is packed
+  EXPECT_EQ(fileData.root["metadata"]["positions"].size(), 3ull);
+
+  // The first entry wins for duplicated ids
+  ASSERT_NE(fileData.getMaterialById("material0"), nullptr);
+  EXPECT_FALSE(json_util::has_key(*fileData.getMaterialById("material0"), "name"));
+  EXPECT_NE(fileData.getMaterialById("material1"), nullptr);
+  EXPECT_EQ(fileData.getMaterialById("material2"), nullptr);
+  ASSERT_NE(fileData.getSkeletonById(3), nullptr);
+  EXPECT_EQ(json_util::get_string(*fileData.getSkeletonById(3), "name"), "skeleton3");
+}
+
+TEST(BabylonFileReader, consumesEntries)
+{
+  using namespace BABYLON;
+
+  const std::string data = R"({
+    "materials": [{"id": "material0"}, {"id": "material1"}],
+    "meshes": [
+      {"id": "mesh0", "positions": [0, 1, 2], "indices": [0]},
+      {"id": "mesh1", "positions": [3, 4, 5], "indices": [0]}
+    ],
+    "cameras": [{"id": "camera0"}]
+  })";
+
+  std::vector<std::string> entries;
+  std::vector<float> positions;
+  BabylonFileData fileData;
+  BabylonFileReader::Parse(
+    data, fileData, [&](const std::string& section, const json& entry) {
+      entries.emplace_back(section + ":" + json_util::get_string(entry, "id"));
+      if (section != "meshes") {
+        return false;
+      }
+      // The packed arrays of the entry are readable while it is consumed
+      for (auto position : json_util::get_array<float>(entry, "positions")) {
+        positions.emplace_back(position);
+      }
+      return json_util::get_string(entry, "id") == "mesh0";
+    });
+
+  EXPECT_THAT(entries, ::testing::ElementsAre("materials:material0", "materials:material1",
+                                              "meshes:mesh0", "meshes:mesh1"));
+  EXPECT_THAT(positions, ::testing::ElementsAre(0.f, 1.f, 2.f, 3.f, 4.f, 5.f));
+  // The consumed entry and its packed arrays are gone, the other entries are kept and indexed
+  ASSERT_EQ(fileData.root["meshes"].size(), 1ull);
+  EXPECT_EQ(json_util::get_string(fileData.root["meshes"][0], "id"), "mesh1");
+  EXPECT_EQ(fileData.packedArrays.floats.size(), 1ull);
+  EXPECT_EQ(fileData.packedArrays.indices.size(), 1ull);
+  EXPECT_NE(fileData.getMaterialById("material1"), nullptr);
+  EXPECT_EQ(fileData.root["cameras"].size(), 1ull);
+}
+
+TEST(BabylonFileReader, invalidDocument)
+{
+  using namespace BABYLON;
+
+  BabylonFileData fileData;
+  EXPECT_THROW(BabylonFileReader::Parse(R"({"meshes": [)", fileData), std::exception);
+}
@@ -0,0 +1,110 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/obj/obj_file_loader.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+/**
+ * @brief Generates a grid of quads using relative indices.
+ */
+std::string generateGrid(size_t size)
+{
+  std::ostringstream obj;
+  obj << "o grid\n";
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      obj << "v " << x << " " << y << " 0.5\n";
+      obj << "vt " << x * 0.1f << " " << y * 0.1f << "\n";
+      obj << "vn 0 0 1\n";
+      obj << "f -1/-1/-1 -1/-1/-1 -1/-1/-1\n";
+    }
+  }
+  for (size_t y = 0; y + 1 < size; ++y) {
+    for (size_t x = 0; x + 1 < size; ++x) {
+      const auto i = y * size + x + 1;
+      obj << "f " << i << "/" << i << "/" << i << " " << i + 1 << "/" << i + 1 << "/" << i + 1
+          << " " << i + size + 1 << "/" << i + size + 1 << "/" << i + size + 1 << " " << i + size
+          << "/" << i + size << "/" << i + size << "\n";
+    }
+  }
+  return obj.str();
+}
+
+} // end of anonymous namespace
+
+TEST(OBJFileLoader, parseFaces)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  const std::string data = "# quad and triangle\r\n"
+                           "v 0 0 0\r\n"
+                           "v 1.0 0 0\r\n"
+                           "v 1 1e0 0\r\n"
+                           "v 0 1 -0.5\r\n"
+                           "vt 0 0\r\n"
+                           "vt 1 0\r\n"
+                           "vt 1 1\r\n"
+                           "vt 0 1\r\n"
+                           "vn 0 0 1\r\n"
+                           "o quad\r\n"
+                           "f 1/1/1 2/2/1 3/3/1 4/4/1\r\n"
+                           "o triangle\r\n"
+                           "usemtl red\r\n"
+                           "f -4//-1   -3//-1 -2//-1\r\n";
+
+  OBJFileLoader loader;
+  const auto meshes = loader.importMesh({}, scene.get(), data);
+  ASSERT_EQ(meshes.size(), 2ull);
+
+  // The quad is split in two triangles sharing two vertices
+  auto quad = std::static_pointer_cast<Mesh>(meshes[0]);
+  EXPECT_EQ(quad->name, "quad");
+  EXPECT_EQ(quad->getTotalVertices(), 4ull);
+  EXPECT_EQ(quad->getIndices().size(), 6ull);
+  const auto uvs = quad->getVerticesData(VertexBuffer::UVKind);
+  EXPECT_THAT(uvs, ::testing::ElementsAre(0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f));
+
+  auto triangle = std::static_pointer_cast<Mesh>(meshes[1]);
+  EXPECT_EQ(triangle->name, "triangle");
+  EXPECT_EQ(triangle->getTotalVertices(), 3ull);
+  const auto positions = triangle->getVerticesData(VertexBuffer::PositionKind);
+  EXPECT_THAT(positions, ::testing::ElementsAre(0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f));
+}
+
+TEST(OBJFileLoader, parallelParsing)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  const auto data = generateGrid(40);
+
+  OBJFileLoader sequentialLoader;
+  const auto sequential = sequentialLoader.importMesh({}, scene.get(), data);
+
+  const auto threshold                      = OBJFileLoader::PARALLEL_PARSING_THRESHOLD;
+  OBJFileLoader::PARALLEL_PARSING_THRESHOLD = 1;
+  OBJFileLoader parallelLoader;
+  OBJFileLoader::PARALLEL_PARSING_THRESHOLD = threshold;
+  const auto parallel                       = parallelLoader.importMesh({}, scene.get(), data);
+
+  ASSERT_EQ(sequential.size(), 1ull);
+  ASSERT_EQ(parallel.size(), 1ull);
+  auto a = std::static_pointer_cast<Mesh>(sequential[0]);
+  auto b = std::static_pointer_cast<Mesh>(parallel[0]);
+  EXPECT_EQ(a->getTotalVertices(), 40ull * 40ull);
+  EXPECT_EQ(a->getIndices(), b->getIndices());
+  EXPECT_EQ(a->getVerticesData(VertexBuffer::PositionKind),
+            b->getVerticesData(VertexBuffer::PositionKind));
+  EXPECT_EQ(a->getVerticesData(VertexBuffer::UVKind), b->getVerticesData(VertexBuffer::UVKind));
+}
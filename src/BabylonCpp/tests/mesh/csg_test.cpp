@@ -0,0 +1,54 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(CSG, sphereMinusBox)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  SphereOptions sphereOptions;
+  sphereOptions.segments = 16;
+  sphereOptions.diameter = 2.f;
+  auto sphere            = MeshBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+  BoxOptions boxOptions;
+  boxOptions.size   = 1.f;
+  auto box          = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  box->position().x = 1.f;
+
+  auto sphereCSG = CSG::CSG::FromMesh(sphere);
+  auto result    = sphereCSG->subtract(CSG::CSG::FromMesh(box));
+  auto mesh      = result.toMesh("result", nullptr, scene.get());
+
+  ASSERT_GT(mesh->getTotalIndices(), 0ull);
+  EXPECT_EQ(mesh->getTotalIndices() % 3, 0ull);
+
+  // No vertex of the result lies strictly inside the box
+  const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto epsilon   = 1e-3f;
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    const bool inside = positions[i] > 0.5f + epsilon && positions[i] < 1.5f - epsilon
+                        && std::abs(positions[i + 1]) < 0.5f - epsilon
+                        && std::abs(positions[i + 2]) < 0.5f - epsilon;
+    EXPECT_FALSE(inside);
+  }
+
+  // Disjoint solids: the union keeps both solids and the intersection is empty
+  box->position().x = 4.f;
+  auto unionCSG     = CSG::CSG::FromMesh(sphere)->_union(CSG::CSG::FromMesh(box));
+  auto unionMesh    = unionCSG.toMesh("union", nullptr, scene.get());
+  EXPECT_GE(unionMesh->getTotalIndices(), sphere->getTotalIndices() + box->getTotalIndices());
+  auto intersection = CSG::CSG::FromMesh(sphere)->intersect(CSG::CSG::FromMesh(box));
+  EXPECT_EQ(intersection.toMesh("intersection", nullptr, scene.get())->getTotalIndices(), 0ull);
+}
@@ -29,3 +29,55 @@ TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
   auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
   EXPECT_THAT(result, ::testing::ContainerEq(data));
 }
+
+TEST(TestGeometry, markRangeCoalescesTheUploads)
+{
+  using namespace BABYLON;
+  auto subject = createSubject();
+  Float32Array data(48, 0.f);
+  auto buffer = std::make_shared<Buffer>(subject.get(), data, true, 3);
+
+  // Overlapping and adjacent ranges are merged, disjoint ones kept apart
+  buffer->markRange(3, 6);
+  buffer->markRange(6, 3);
+  buffer->markRange(9, 3);
+  buffer->markRange(24, 3);
+  EXPECT_TRUE(buffer->hasDirtyRanges());
+  subject->resetStateCounters();
+  buffer->uploadDirtyRanges();
+  EXPECT_FALSE(buffer->hasDirtyRanges());
+  EXPECT_EQ(subject->getStateCounters().vertexBufferUploads, 2ull);
+  EXPECT_EQ(subject->getStateCounters().vertexBufferUploadedBytes, 12 * sizeof(float));
+
+  // The number of uploads is bounded by merging the closest ranges
+  for (size_t index = 0; index < Buffer::MaxDirtyRanges + 4; ++index) {
+    buffer->markRange(index * 2, 1);
+  }
+  subject->resetStateCounters();
+  buffer->uploadDirtyRanges();
+  EXPECT_EQ(subject->getStateCounters().vertexBufferUploads, Buffer::MaxDirtyRanges);
+}
+
+TEST(TestGeometry, markRangeGrowsTheExtend)
+{
+  using namespace BABYLON;
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+  auto geometry = Geometry::New("geometry1", scene.get());
+  geometry->setVerticesData(VertexBuffer::PositionKind, positions, true);
+  EXPECT_FLOAT_EQ(geometry->extend().max.y, 1.f);
+
+  auto vertexBuffer = geometry->getVertexBuffer(VertexBuffer::PositionKind);
+  auto& data        = vertexBuffer->getData();
+  data[7]           = 4.f;
+  data[10]          = 0.5f;
+  subject->resetStateCounters();
+  geometry->markRange(VertexBuffer::PositionKind, 2, 2, true);
+  EXPECT_FLOAT_EQ(geometry->extend().max.y, 4.f);
+  EXPECT_FLOAT_EQ(geometry->extend().min.y, 0.f);
+
+  vertexBuffer->_uploadDirtyRanges();
+  EXPECT_EQ(subject->getStateCounters().vertexBufferUploads, 1ull);
+  EXPECT_EQ(subject->getStateCounters().vertexBufferUploadedBytes, 6 * sizeof(float));
+}
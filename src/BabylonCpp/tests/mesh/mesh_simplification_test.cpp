@@ -0,0 +1,153 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <tuple>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+/**
+ * @brief Returns a torus whose texture is split in charts two quads wide, so that every other
+ * ring of vertices is an attribute seam.
+ */
+BABYLON::VertexData createSeamedTorus(size_t charts, size_t tubeSegments)
+{
+  BABYLON::VertexData vertexData;
+  const auto segments = charts * 2;
+  const auto angle    = [](size_t step, size_t steps) {
+    return 2.f * 3.14159265f * static_cast<float>(step % steps) / static_cast<float>(steps);
+  };
+  for (size_t chart = 0; chart < charts; ++chart) {
+    for (size_t column = 0; column < 3; ++column) {
+      const auto theta = angle(chart * 2 + column, segments);
+      for (size_t row = 0; row < tubeSegments; ++row) {
+        const auto phi    = angle(row, tubeSegments);
+        const auto radius = 2.f + 0.5f * std::cos(phi);
+        vertexData.positions.insert(vertexData.positions.end(),
+                                    {radius * std::cos(theta), 0.5f * std::sin(phi),
+                                     radius * std::sin(theta)});
+        vertexData.normals.insert(vertexData.normals.end(),
+                                  {std::cos(phi) * std::cos(theta), std::sin(phi),
+                                   std::cos(phi) * std::sin(theta)});
+        vertexData.uvs.insert(vertexData.uvs.end(),
+                              {static_cast<float>(column) * 0.5f,
+                               static_cast<float>(row) / static_cast<float>(tubeSegments)});
+      }
+    }
+  }
+  const auto index = [tubeSegments](size_t chart, size_t column, size_t row) {
+    return static_cast<uint32_t>((chart * 3 + column) * tubeSegments + row % tubeSegments);
+  };
+  for (size_t chart = 0; chart < charts; ++chart) {
+    for (size_t column = 0; column < 2; ++column) {
+      for (size_t row = 0; row < tubeSegments; ++row) {
+        const auto a = index(chart, column, row);
+        const auto b = index(chart, column + 1, row);
+        const auto c = index(chart, column + 1, row + 1);
+        const auto d = index(chart, column, row + 1);
+        vertexData.indices.insert(vertexData.indices.end(), {a, b, c, a, c, d});
+      }
+    }
+  }
+  return vertexData;
+}
+
+} // end of anonymous namespace
+
+TEST(MeshSimplification, decimate)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GroundOptions groundOptions;
+  groundOptions.width        = 10.f;
+  groundOptions.height       = 10.f;
+  groundOptions.subdivisions = 32;
+  auto ground                = MeshBuilder::CreateGround("ground", groundOptions, scene.get());
+  const auto triangleCount   = ground->getTotalIndices() / 3;
+
+  QuadraticErrorSimplification simplifier(ground.get());
+  const auto data = simplifier.decimate(SimplificationSettings(0.5f, 10.f, false));
+  EXPECT_LE(data.indices.size() / 3, triangleCount / 2);
+  EXPECT_GT(data.indices.size(), 0ull);
+  ASSERT_EQ(data.subMeshes.size(), 1ull);
+  EXPECT_EQ(data.subMeshes[0].indexCount, data.indices.size());
+
+  // Attributes are kept for every remaining vertex
+  const auto verticesCount = data.vertexData.at(VertexBuffer::PositionKind).size() / 3;
+  EXPECT_EQ(data.vertexData.at(VertexBuffer::NormalKind).size(), verticesCount * 3);
+  EXPECT_EQ(data.vertexData.at(VertexBuffer::UVKind).size(), verticesCount * 2);
+  EXPECT_LT(verticesCount, ground->getTotalVertices());
+}
+
+TEST(MeshSimplification, simplificationQueue)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GroundOptions groundOptions;
+  groundOptions.subdivisions = 16;
+  auto ground                = MeshBuilder::CreateGround("ground", groundOptions, scene.get());
+
+  bool completed = false;
+  ground->simplify({SimplificationSettings(0.8f, 50.f, true),
+                    SimplificationSettings(0.4f, 100.f, true)},
+                   true, SimplificationType::QUADRATIC, [&completed]() { completed = true; });
+  scene->simplificationQueue()->flush();
+
+  EXPECT_TRUE(completed);
+  EXPECT_EQ(ground->getLODLevels().size(), 2ull);
+}
+
+TEST(MeshSimplification, decimateAlongSeams)
+{
+  using namespace BABYLON;
+  auto engine     = createSubject();
+  auto scene      = Scene::New(engine.get());
+  auto torus      = Mesh::New("torus", scene.get());
+  auto vertexData = createSeamedTorus(32, 16);
+  vertexData.applyToMesh(*torus);
+  const auto triangleCount = torus->getTotalIndices() / 3;
+
+  // Two thirds of the vertices are on a seam
+  QuadraticErrorSimplification simplifier(torus.get());
+  const auto data = simplifier.decimate(SimplificationSettings(0.2f, 10.f, true));
+  EXPECT_LE(data.indices.size() / 3, triangleCount / 5);
+  EXPECT_GT(data.indices.size(), 0ull);
+
+  // The seams stay closed: every edge is shared by two triangles once the seams are welded
+  const auto& positions = data.vertexData.at(VertexBuffer::PositionKind);
+  std::map<std::tuple<float, float, float>, size_t> weldedVertices;
+  std::vector<size_t> welded(positions.size() / 3);
+  for (size_t v = 0; v < welded.size(); ++v) {
+    const auto position
+      = std::make_tuple(positions[v * 3], positions[v * 3 + 1], positions[v * 3 + 2]);
+    welded[v] = weldedVertices.try_emplace(position, weldedVertices.size()).first->second;
+  }
+  std::map<std::pair<size_t, size_t>, size_t> edges;
+  for (size_t i = 0; i < data.indices.size(); i += 3) {
+    for (size_t j = 0; j < 3; ++j) {
+      const auto a = welded[data.indices[i + j]];
+      const auto b = welded[data.indices[i + (j + 1) % 3]];
+      ++edges[std::minmax(a, b)];
+    }
+  }
+  for (const auto& [edge, count] : edges) {
+    EXPECT_EQ(count, 2ull);
+  }
+}
@@ -3,7 +3,10 @@
 
 #include "../test_utils.h"
 
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_builder.h>
@@ -23,3 +26,48 @@ TEST(Mesh, clone)
     EXPECT_NE(sphere->uniqueId, sphereClone->uniqueId);
   }
 }
+
+TEST(Mesh, thinInstanceCulling)
+{
+  using namespace BABYLON;
+  auto engine                       = createSubject();
+  engine->getCaps().instancedArrays = true;
+  auto scene                        = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  // 100 thin instances in front of the camera and 100 behind it
+  BoxOptions boxOptions;
+  auto box = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  Float32Array matrices(200 * 16);
+  for (unsigned int i = 0; i < 100; ++i) {
+    const auto x = static_cast<float>(i % 10) - 5.f;
+    const auto y = static_cast<float>(i / 10) - 5.f;
+    Matrix::Translation(x * 0.5f, y * 0.5f, 0.f).copyToArray(matrices, i * 16);
+    Matrix::Translation(x, y, -50.f).copyToArray(matrices, (i + 100) * 16);
+  }
+  box->thinInstanceSetBuffer("matrix", matrices, 16);
+
+  scene->render();
+  EXPECT_EQ(box->thinInstanceGetVisibleCount(), 200ull);
+  EXPECT_EQ(scene->getActiveIndices(), 200 * 36ull);
+
+  box->thinInstanceEnableCulling = true;
+  scene->render();
+  EXPECT_EQ(box->thinInstanceGetVisibleCount(), 100ull);
+  EXPECT_EQ(scene->getActiveIndices(), 100 * 36ull);
+
+  // Moving the instances refreshes their bounds
+  for (size_t i = 0; i < 50; ++i) {
+    matrices[i * 16 + 12] += 100.f;
+  }
+  box->thinInstanceSetBuffer("matrix", matrices, 16);
+  scene->render();
+  EXPECT_EQ(box->thinInstanceGetVisibleCount(), 50ull);
+  EXPECT_EQ(scene->getActiveIndices(), 50 * 36ull);
+
+  box->thinInstanceEnableCulling = false;
+  scene->render();
+  EXPECT_EQ(box->thinInstanceGetVisibleCount(), 200ull);
+  EXPECT_EQ(scene->getActiveIndices(), 200 * 36ull);
+}
@@ -0,0 +1,56 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/misc/frame_arena.h>
+
+TEST(TestFrameArena, alignedAllocations)
+{
+  using namespace BABYLON;
+
+  FrameArena arena{256};
+  auto* a = arena.allocate(3, 1);
+  auto* b = arena.allocate(sizeof(double), alignof(double));
+  auto* c = arena.allocate(16, 64);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(double), 0ull);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 64, 0ull);
+  EXPECT_EQ(arena.bytesUsed(), 3 + sizeof(double) + 16);
+
+  // Larger than a block
+  auto* d = arena.allocate(1024, 16);
+  EXPECT_NE(d, nullptr);
+  EXPECT_EQ(arena.blockCount(), 2ull);
+}
+
+TEST(TestFrameArena, resetCoalescesTheBlocks)
+{
+  using namespace BABYLON;
+
+  FrameArena arena{128};
+  {
+    std::pmr::vector<int> values{&arena};
+    for (int i = 0; i < 1000; ++i) {
+      values.emplace_back(i);
+    }
+    EXPECT_EQ(values[999], 999);
+  }
+  EXPECT_GT(arena.blockCount(), 1ull);
+  const auto capacity = arena.capacity();
+
+  arena.reset();
+  EXPECT_EQ(arena.bytesUsed(), 0ull);
+  EXPECT_EQ(arena.blockCount(), 1ull);
+  EXPECT_EQ(arena.capacity(), capacity);
+
+  // The same frame fits in the coalesced block
+  {
+    std::pmr::vector<int> values{&arena};
+    for (int i = 0; i < 1000; ++i) {
+      values.emplace_back(i);
+    }
+  }
+  EXPECT_EQ(arena.blockCount(), 1ull);
+}
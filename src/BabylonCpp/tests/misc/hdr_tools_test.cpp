@@ -0,0 +1,102 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
+#include <babylon/misc/highdynamicrange/hdr_tools.h>
+
+namespace {
+
+/**
+ * @brief Returns a width x height RGBE file, the red mantissa is the column index, the green
+ * mantissa the row index and the blue mantissa 128.
+ * @param exponent The exponent of all the pixels
+ * @param runLength Whether the scanlines are run length encoded
+ */
+BABYLON::Uint8Array createHDRFile(size_t width, size_t height, uint8_t exponent, bool runLength)
+{
+  const auto header = "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " + std::to_string(height)
+                      + " +X " + std::to_string(width) + "\n";
+  BABYLON::Uint8Array file(header.begin(), header.end());
+  for (size_t y = 0; y < height; ++y) {
+    if (!runLength) {
+      for (size_t x = 0; x < width; ++x) {
+        file.insert(file.end(), {static_cast<uint8_t>(x), static_cast<uint8_t>(y), 128, exponent});
+      }
+      continue;
+    }
+    file.insert(file.end(), {2, 2, static_cast<uint8_t>(width >> 8),
+                             static_cast<uint8_t>(width & 0xff)});
+    // Red as literals, the other channels as runs
+    file.emplace_back(static_cast<uint8_t>(width));
+    for (size_t x = 0; x < width; ++x) {
+      file.emplace_back(static_cast<uint8_t>(x));
+    }
+    for (const uint8_t value : {static_cast<uint8_t>(y), uint8_t(128), exponent}) {
+      file.insert(file.end(), {static_cast<uint8_t>(128 + width), value});
+    }
+  }
+  return file;
+}
+
+} // end of anonymous namespace
+
+TEST(HDRTools, readPixels)
+{
+  using namespace BABYLON;
+  for (const auto runLength : {true, false}) {
+    const auto file    = createHDRFile(16, 4, 129, runLength);
+    const auto hdrInfo = HDRTools::RGBE_ReadHeader(file);
+    EXPECT_EQ(hdrInfo.width, 16ull);
+    EXPECT_EQ(hdrInfo.height, 4ull);
+
+    // mantissa * 2^(129 - 136)
+    const auto pixels = HDRTools::RGBE_ReadPixels(file, hdrInfo);
+    ASSERT_EQ(pixels.size(), 16ull * 4ull * 3ull);
+    for (size_t y = 0; y < 4; ++y) {
+      for (size_t x = 0; x < 16; ++x) {
+        const auto* pixel = &pixels[(y * 16 + x) * 3];
+        EXPECT_FLOAT_EQ(pixel[0], static_cast<float>(x) / 128.f);
+        EXPECT_FLOAT_EQ(pixel[1], static_cast<float>(y) / 128.f);
+        EXPECT_FLOAT_EQ(pixel[2], 1.f);
+      }
+    }
+  }
+
+  // A zero exponent is a black pixel
+  const auto file = createHDRFile(16, 4, 0, true);
+  for (const auto value : HDRTools::RGBE_ReadPixels(file, HDRTools::RGBE_ReadHeader(file))) {
+    EXPECT_EQ(value, 0.f);
+  }
+}
+
+TEST(HDRTools, uniformEnvironment)
+{
+  using namespace BABYLON;
+  // Every pixel is (0, 0, 1)
+  auto file = createHDRFile(64, 32, 129, false);
+  for (size_t i = file.size() - 64 * 32 * 4; i < file.size(); i += 4) {
+    file[i] = file[i + 1] = 0;
+  }
+
+  const auto cubeMap = HDRTools::GetCubeMapTextureData(file, 16);
+  EXPECT_EQ(cubeMap.size, 16ull);
+  for (const auto* face : {"right", "left", "up", "down", "front", "back"}) {
+    const auto data = cubeMap[face].float32Array();
+    ASSERT_EQ(data.size(), 16ull * 16ull * 3ull);
+    EXPECT_FLOAT_EQ(data[0], 0.f);
+    EXPECT_FLOAT_EQ(data[2], 1.f);
+  }
+
+  // The irradiance of a uniform environment has no directional terms
+  const auto polynomial = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+    cubeMap);
+  ASSERT_TRUE(polynomial != nullptr);
+  EXPECT_NEAR(polynomial->x.z, 0.f, 1e-4f);
+  EXPECT_NEAR(polynomial->y.z, 0.f, 1e-4f);
+  EXPECT_NEAR(polynomial->z.z, 0.f, 1e-4f);
+  EXPECT_NEAR(polynomial->xy.z, 0.f, 1e-4f);
+  EXPECT_NEAR(polynomial->xx.z, polynomial->zz.z, 1e-4f);
+  EXPECT_GT(polynomial->xx.z, 0.f);
+  EXPECT_FLOAT_EQ(polynomial->xx.x, 0.f);
+}
@@ -0,0 +1,74 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <babylon/misc/file_tools.h>
+#include <babylon/misc/image_decoder.h>
+
+namespace {
+
+/**
+ * @brief Returns a 1x2 binary PPM image with a red pixel above a blue one.
+ */
+BABYLON::ArrayBuffer redAboveBlueImage()
+{
+  const std::string header = "P6\n1 2\n255\n";
+  BABYLON::ArrayBuffer buffer(header.begin(), header.end());
+  for (uint8_t value : {255, 0, 0, 0, 0, 255}) {
+    buffer.emplace_back(value);
+  }
+  return buffer;
+}
+
+} // end of anonymous namespace
+
+TEST(ImageDecoder, decodeBatch)
+{
+  using namespace BABYLON;
+  const std::vector<ArrayBuffer> buffers(16, redAboveBlueImage());
+
+  const auto images = ImageDecoder::DecodeBatch(buffers, false, 4);
+  ASSERT_EQ(images.size(), buffers.size());
+  for (const auto& image : images) {
+    ASSERT_TRUE(image.valid());
+    EXPECT_EQ(image.width, 1);
+    EXPECT_EQ(image.height, 2);
+    EXPECT_THAT(image.data, ::testing::ElementsAre(255, 0, 0, 255, 0, 0, 255, 255));
+  }
+
+  // The rows are flipped after decoding
+  const auto flippedImages = ImageDecoder::DecodeBatch(buffers, true, 4);
+  for (const auto& image : flippedImages) {
+    EXPECT_THAT(image.data, ::testing::ElementsAre(0, 0, 255, 255, 255, 0, 0, 255));
+  }
+  EXPECT_EQ(FileTools::ArrayBufferToImage(buffers[0], true).data, flippedImages[0].data);
+}
+
+TEST(ImageDecoder, handsBackDecodedImagesOnTheCallingThread)
+{
+  using namespace BABYLON;
+  ImageDecoder decoder(2);
+  EXPECT_EQ(decoder.workerCount(), 2ull);
+
+  const auto callingThread = std::this_thread::get_id();
+  size_t decodedCount = 0, errorCount = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    decoder.decode(redAboveBlueImage(), false, [&](const Image& image) {
+      EXPECT_EQ(std::this_thread::get_id(), callingThread);
+      EXPECT_TRUE(image.valid());
+      ++decodedCount;
+    });
+  }
+  decoder.decodeUrl(
+    "missing_image.png", false, [&](const Image& /*image*/) { ++decodedCount; },
+    [&](const std::string& /*message*/, const std::string& /*exception*/) { ++errorCount; });
+
+  // Nothing is handed back before processing
+  EXPECT_EQ(decodedCount, 0ull);
+  EXPECT_EQ(decoder.waitForDecodedImages(), 9ull);
+  EXPECT_EQ(decodedCount, 8ull);
+  EXPECT_EQ(errorCount, 1ull);
+  EXPECT_EQ(decoder.pendingCount(), 0ull);
+  EXPECT_EQ(decoder.processDecodedImages(), 0ull);
+}
@@ -0,0 +1,72 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/misc/highdynamicrange/pmrem_generator.h>
+
+namespace {
+
+/**
+ * @brief Returns the 6 RGB faces of a cube map, each face has its own color and a brighter texel.
+ */
+std::vector<BABYLON::Float32Array> createCubeMap(size_t size)
+{
+  std::vector<BABYLON::Float32Array> faces;
+  for (size_t face = 0; face < 6; ++face) {
+    BABYLON::Float32Array data(size * size * 3);
+    for (size_t i = 0; i < size * size; ++i) {
+      data[i * 3 + 0] = static_cast<float>(face) / 6.f;
+      data[i * 3 + 1] = 0.5f;
+      data[i * 3 + 2] = (i == size * size / 2) ? 10.f : 1.f;
+    }
+    faces.emplace_back(std::move(data));
+  }
+  return faces;
+}
+
+} // end of anonymous namespace
+
+TEST(PMREMGenerator, uniformCubeMap)
+{
+  using namespace BABYLON;
+  const std::vector<Float32Array> input(6, Float32Array(16 * 16 * 3, 0.25f));
+
+  for (const auto importanceSampling : {false, true}) {
+    PMREMGenerator<Float32Array> generator(input, 16, 16, 0, 3, true, 50.f, 0.25f, false, true);
+    generator.importanceSampling = importanceSampling;
+    const auto& mips             = generator.filterCubeMap();
+
+    // 16, 8, 4, 2, 1
+    ASSERT_EQ(mips.size(), 5ull);
+    for (size_t level = 0; level < mips.size(); ++level) {
+      ASSERT_EQ(mips[level].size(), 6ull);
+      for (const auto& face : mips[level]) {
+        ASSERT_EQ(face.size(), (16ull >> level) * (16ull >> level) * 3ull);
+        for (const auto value : face) {
+          EXPECT_NEAR(value, 0.25f, 1e-4f);
+        }
+      }
+    }
+  }
+}
+
+TEST(PMREMGenerator, resultDoesNotDependOnWorkerCount)
+{
+  using namespace BABYLON;
+  const auto input = createCubeMap(16);
+
+  for (const auto importanceSampling : {false, true}) {
+    std::vector<std::vector<Float32Array>> results;
+    for (const size_t workerCount : {1u, 4u}) {
+      PMREMGenerator<Float32Array> generator(input, 16, 16, 0, 3, true, 50.f, 0.25f, false, true);
+      generator.importanceSampling = importanceSampling;
+      generator.workerCount        = workerCount;
+      results.emplace_back(generator.filterCubeMap()[1]);
+    }
+    EXPECT_EQ(results[0], results[1]);
+
+    // The bright texel is blurred into its neighbours
+    const auto& face = results[0][0];
+    EXPECT_GT(face[(4 * 8 + 4) * 3 + 2], 1.f);
+    EXPECT_LT(face[(4 * 8 + 4) * 3 + 2], 10.f);
+  }
+}
@@ -0,0 +1,78 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <babylon/misc/radix_sort.h>
+
+namespace {
+
+std::vector<uint32_t> stableSortedOrder(const std::vector<uint64_t>& keys)
+{
+  std::vector<uint32_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+  return order;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRadixSort, sort)
+{
+  using namespace BABYLON;
+
+  std::mt19937_64 generator(42);
+  std::vector<uint64_t> keys(1000);
+  for (auto& key : keys) {
+    // Few distinct values to check the stability
+    key = (generator() % 16) << 40 | (generator() % 4);
+  }
+
+  RadixSort sorter;
+  std::vector<uint32_t> order;
+  sorter.sort(keys, order);
+  EXPECT_THAT(order, ::testing::ContainerEq(stableSortedOrder(keys)));
+}
+
+TEST(TestRadixSort, sortCoherent)
+{
+  using namespace BABYLON;
+
+  std::vector<uint64_t> keys(500);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = keys.size() - i;
+  }
+
+  RadixSort sorter;
+  std::vector<uint32_t> order;
+  sorter.sort(keys, order);
+
+  // Same keys: the previous order is kept
+  EXPECT_TRUE(sorter.sortCoherent(keys, order));
+  EXPECT_THAT(order, ::testing::ContainerEq(stableSortedOrder(keys)));
+
+  // A few keys changed
+  std::swap(keys[10], keys[20]);
+  keys[100] = 0;
+  EXPECT_FALSE(sorter.sortCoherent(keys, order));
+  EXPECT_THAT(order, ::testing::ContainerEq(stableSortedOrder(keys)));
+
+  // Completely reversed
+  std::reverse(keys.begin(), keys.end());
+  EXPECT_FALSE(sorter.sortCoherent(keys, order));
+  EXPECT_THAT(order, ::testing::ContainerEq(stableSortedOrder(keys)));
+}
+
+TEST(TestRadixSort, FloatToOrderedBits)
+{
+  using namespace BABYLON;
+
+  const std::vector<float> values{-100.f, -1.5f, -0.f, 0.f, 1e-6f, 2.f, 1000.f};
+  for (size_t i = 1; i < values.size(); ++i) {
+    EXPECT_LE(RadixSort::FloatToOrderedBits(values[i - 1]),
+              RadixSort::FloatToOrderedBits(values[i]));
+  }
+}
@@ -0,0 +1,111 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <babylon/engines/constants.h>
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/file_tools.h>
+#include <babylon/misc/texture_disk_cache.h>
+
+namespace {
+
+/**
+ * @brief Enables the texture disk cache in an empty temporary directory for the test.
+ */
+class TextureDiskCacheTest : public ::testing::Test {
+
+protected:
+  void SetUp() override
+  {
+    _directory = std::filesystem::temp_directory_path() / "babylon_texture_disk_cache_test";
+    std::filesystem::remove_all(_directory);
+    std::filesystem::create_directories(_directory);
+    BABYLON::TextureDiskCache::SetDirectory(_directory.string());
+    BABYLON::TextureDiskCache::ResetStats();
+  }
+
+  void TearDown() override
+  {
+    BABYLON::TextureDiskCache::SetDirectory("");
+    std::filesystem::remove_all(_directory);
+  }
+
+  std::filesystem::path _directory;
+
+}; // end of class TextureDiskCacheTest
+
+} // end of anonymous namespace
+
+TEST_F(TextureDiskCacheTest, storeAndLoad)
+{
+  using namespace BABYLON;
+  const std::string source = "source bytes";
+  const auto key           = TextureDiskCache::Key(source, "faces");
+  EXPECT_NE(key, TextureDiskCache::Key(source, "faces:gamma"));
+  EXPECT_FALSE(TextureDiskCache::Load(key).has_value());
+
+  const std::string face0 = "first face";
+  const std::string face1 = "second, longer face";
+  TextureDiskCacheEntry entry;
+  entry.width                   = 4;
+  entry.height                  = 2;
+  entry.format                  = Constants::TEXTUREFORMAT_RGB;
+  entry.type                    = Constants::TEXTURETYPE_FLOAT;
+  entry.levels                  = {face0, face1};
+  entry.sphericalPolynomial     = std::make_shared<SphericalPolynomial>();
+  entry.sphericalPolynomial->zx = Vector3(1.f, 2.f, 3.f);
+  ASSERT_TRUE(TextureDiskCache::Store(key, entry));
+
+  const auto cached = TextureDiskCache::Load(key);
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_EQ(cached->width, 4);
+  EXPECT_EQ(cached->height, 2);
+  EXPECT_EQ(cached->format, Constants::TEXTUREFORMAT_RGB);
+  EXPECT_EQ(cached->type, Constants::TEXTURETYPE_FLOAT);
+  EXPECT_THAT(cached->levels, ::testing::ElementsAre(face0, face1));
+  ASSERT_TRUE(cached->sphericalPolynomial != nullptr);
+  EXPECT_FLOAT_EQ(cached->sphericalPolynomial->zx.z, 3.f);
+
+  const auto stats = TextureDiskCache::GetStats();
+  EXPECT_EQ(stats.hits, 1ull);
+  EXPECT_EQ(stats.misses, 1ull);
+  EXPECT_EQ(stats.stores, 1ull);
+  EXPECT_EQ(stats.bytesSaved, face0.size() + face1.size());
+}
+
+TEST_F(TextureDiskCacheTest, ignoresCorruptedFiles)
+{
+  using namespace BABYLON;
+  const auto key = TextureDiskCache::Key("source bytes", "");
+  std::ofstream(_directory / (key + TextureDiskCache::Extension), std::ios::binary)
+    << "BTEXCACH truncated";
+
+  EXPECT_FALSE(TextureDiskCache::Load(key).has_value());
+  EXPECT_EQ(TextureDiskCache::GetStats().misses, 1ull);
+}
+
+TEST_F(TextureDiskCacheTest, cachesDecodedImages)
+{
+  using namespace BABYLON;
+  // 1x2 binary PPM image with a red pixel above a blue one
+  const std::string ppm = "P6\n1 2\n255\n";
+  ArrayBuffer buffer(ppm.begin(), ppm.end());
+  for (uint8_t value : {255, 0, 0, 0, 0, 255}) {
+    buffer.emplace_back(value);
+  }
+
+  const auto decoded = FileTools::ArrayBufferToImage(buffer, true);
+  EXPECT_EQ(TextureDiskCache::GetStats().stores, 1ull);
+
+  const auto cached = FileTools::ArrayBufferToImage(buffer, true);
+  EXPECT_EQ(TextureDiskCache::GetStats().hits, 1ull);
+  EXPECT_EQ(cached.width, decoded.width);
+  EXPECT_EQ(cached.height, decoded.height);
+  EXPECT_EQ(cached.data, decoded.data);
+
+  // The flip is part of the key
+  FileTools::ArrayBufferToImage(buffer, false);
+  EXPECT_EQ(TextureDiskCache::GetStats().stores, 2ull);
+}
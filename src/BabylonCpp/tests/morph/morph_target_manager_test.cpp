@@ -0,0 +1,146 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+
+namespace {
+
+using WeightedTargets = std::vector<std::pair<const BABYLON::Float32Array*, float>>;
+
+/**
+ * @brief Returns base + sum(weight * (target - base)), the blend of the shaders.
+ */
+BABYLON::Float32Array blend(const BABYLON::Float32Array& base, const WeightedTargets& targets)
+{
+  auto result = base;
+  for (const auto& [target, weight] : targets) {
+    for (size_t index = 0; index < result.size(); ++index) {
+      result[index] += weight * ((*target)[index] - base[index]);
+    }
+  }
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMorphTargetManager, cpuMorphing)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  BoxOptions boxOptions;
+  auto box                 = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  const auto basePositions = box->getVerticesData(VertexBuffer::PositionKind);
+  const auto baseNormals   = box->getVerticesData(VertexBuffer::NormalKind);
+
+  // A target moving a single vertex and one scaling the whole box
+  auto corner          = MorphTarget::New("corner", 0.5f, scene.get());
+  auto cornerPositions = basePositions;
+  cornerPositions[3] += 1.f;
+  auto cornerNormals = baseNormals;
+  cornerNormals[4]   = 0.f;
+  corner->setPositions(cornerPositions);
+  corner->setNormals(cornerNormals);
+  auto scaled          = MorphTarget::New("scaled", 0.25f, scene.get());
+  auto scaledPositions = basePositions;
+  for (auto& value : scaledPositions) {
+    value *= 2.f;
+  }
+  scaled->setPositions(scaledPositions);
+  scaled->setNormals(baseNormals);
+
+  auto manager = MorphTargetManager::New(scene.get());
+  manager->addTarget(corner);
+  manager->addTarget(scaled);
+  manager->enableCpuMorphing = true;
+  box->morphTargetManager    = manager;
+  EXPECT_EQ(manager->numInfluencers(), 0ull);
+  EXPECT_TRUE(corner->_getDeltas(basePositions, &baseNormals).sparse);
+  EXPECT_FALSE(scaled->_getDeltas(basePositions, &baseNormals).sparse);
+
+  auto expectedPositions
+    = blend(basePositions, {{&cornerPositions, 0.5f}, {&scaledPositions, 0.25f}});
+  auto expectedNormals = blend(baseNormals, {{&cornerNormals, 0.5f}});
+  auto positions       = box->getVerticesData(VertexBuffer::PositionKind);
+  auto normals         = box->getVerticesData(VertexBuffer::NormalKind);
+  ASSERT_EQ(positions.size(), expectedPositions.size());
+  for (size_t index = 0; index < positions.size(); ++index) {
+    EXPECT_FLOAT_EQ(positions[index], expectedPositions[index]);
+    EXPECT_FLOAT_EQ(normals[index], expectedNormals[index]);
+  }
+
+  // Influence changes are blended once by the next frame
+  corner->influence = 1.f;
+  scaled->influence = 0.5f;
+  scene->render();
+  expectedPositions = blend(basePositions, {{&cornerPositions, 1.f}, {&scaledPositions, 0.5f}});
+  positions         = box->getVerticesData(VertexBuffer::PositionKind);
+  for (size_t index = 0; index < positions.size(); ++index) {
+    EXPECT_FLOAT_EQ(positions[index], expectedPositions[index]);
+  }
+
+  // The base shape comes back when the shaders take over
+  manager->enableCpuMorphing = false;
+  EXPECT_EQ(manager->numInfluencers(), 2ull);
+  positions = box->getVerticesData(VertexBuffer::PositionKind);
+  normals   = box->getVerticesData(VertexBuffer::NormalKind);
+  for (size_t index = 0; index < positions.size(); ++index) {
+    EXPECT_FLOAT_EQ(positions[index], basePositions[index]);
+    EXPECT_FLOAT_EQ(normals[index], baseNormals[index]);
+  }
+}
+
+TEST(TestMorphTargetManager, cpuMorphingInChunks)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GroundOptions groundOptions;
+  groundOptions.subdivisions = 200;
+  auto ground                = MeshBuilder::CreateGround("ground", groundOptions, scene.get());
+  const auto basePositions   = ground->getVerticesData(VertexBuffer::PositionKind);
+  ASSERT_GE(basePositions.size() / 3, MorphTargetManager::ParallelBlendThreshold);
+
+  // A bump on a few vertices and a wave over the whole ground
+  auto bumpPositions = basePositions;
+  for (size_t index = 1; index < bumpPositions.size(); index += 3 * 97) {
+    bumpPositions[index] += 1.f;
+  }
+  auto wavePositions = basePositions;
+  for (size_t index = 1; index < wavePositions.size(); index += 3) {
+    wavePositions[index] += std::sin(wavePositions[index - 1]);
+  }
+  auto bump = MorphTarget::New("bump", 0.75f, scene.get());
+  bump->setPositions(bumpPositions);
+  auto wave = MorphTarget::New("wave", -0.5f, scene.get());
+  wave->setPositions(wavePositions);
+  auto manager = MorphTargetManager::New(scene.get());
+  manager->addTarget(bump);
+  manager->addTarget(wave);
+  manager->enableCpuMorphing = true;
+  ground->morphTargetManager = manager;
+
+  const auto expected  = blend(basePositions, {{&bumpPositions, 0.75f}, {&wavePositions, -0.5f}});
+  const auto positions = ground->getVerticesData(VertexBuffer::PositionKind);
+  ASSERT_EQ(positions.size(), expected.size());
+  for (size_t index = 0; index < positions.size(); ++index) {
+    EXPECT_FLOAT_EQ(positions[index], expected[index]);
+  }
+}
@@ -0,0 +1,128 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/solid_particle.h>
+#include <babylon/particles/solid_particle_system.h>
+
+TEST(TestSolidParticleSystem, setParticles)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  auto box         = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  const auto model = box->getVerticesData(VertexBuffer::PositionKind);
+  auto sps         = SolidParticleSystem::New("sps", scene.get());
+  std::optional<SolidParticleSystemMeshBuilderOptions> options;
+  sps->addShape(box, 2, options);
+  sps->buildMesh();
+
+  auto& particle    = *sps->particles[1];
+  particle.position = Vector3(1.f, 2.f, 3.f);
+  particle.rotation = Vector3(0.3f, 1.2f, -0.4f);
+  particle.scaling  = Vector3(2.f, 1.f, 0.5f);
+  particle.pivot    = Vector3(0.5f, 0.f, 0.25f);
+  sps->setParticles();
+
+  // Scaled, moved from the pivot, rotated, moved back and translated to the particle position
+  Matrix rotation;
+  Quaternion::RotationYawPitchRoll(1.2f, 0.3f, -0.4f).toRotationMatrix(rotation);
+  const auto scaledPivot = particle.pivot.multiply(particle.scaling);
+  const auto positions   = sps->mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto nbVertices  = model.size() / 3;
+  for (size_t i = 0; i < nbVertices; ++i) {
+    const auto vertex = Vector3::FromArray(model, i * 3);
+    const auto expected
+      = Vector3::TransformCoordinates(vertex.multiply(particle.scaling).subtract(scaledPivot),
+                                      rotation)
+          .add(scaledPivot)
+          .add(particle.position);
+    // The first particle is left untouched
+    EXPECT_NEAR(positions[i * 3], vertex.x, 1e-5f);
+    EXPECT_NEAR(positions[i * 3 + 1], vertex.y, 1e-5f);
+    EXPECT_NEAR(positions[i * 3 + 2], vertex.z, 1e-5f);
+    EXPECT_NEAR(positions[(nbVertices + i) * 3], expected.x, 1e-5f);
+    EXPECT_NEAR(positions[(nbVertices + i) * 3 + 1], expected.y, 1e-5f);
+    EXPECT_NEAR(positions[(nbVertices + i) * 3 + 2], expected.z, 1e-5f);
+  }
+}
+
+TEST(TestSolidParticleSystem, setParticlesInChunks)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  auto box         = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  const auto model = box->getVerticesData(VertexBuffer::PositionKind);
+  auto sps         = SolidParticleSystem::New("sps", scene.get());
+  std::optional<SolidParticleSystemMeshBuilderOptions> options;
+  const auto nbParticles = 2 * SolidParticleSystem::ParallelUpdateThreshold;
+  sps->addShape(box, nbParticles, options);
+  sps->buildMesh();
+
+  for (size_t p = 0; p < nbParticles; ++p) {
+    sps->particles[p]->position.x = static_cast<float>(p);
+  }
+  sps->computeBoundingBox = true;
+  sps->setParticles();
+
+  const auto positions  = sps->mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto nbVertices = model.size() / 3;
+  for (size_t p = 0; p < nbParticles; ++p) {
+    EXPECT_FLOAT_EQ(positions[p * nbVertices * 3], model[0] + static_cast<float>(p));
+  }
+  const auto& boundingBox = sps->mesh->getBoundingInfo()->boundingBox;
+  EXPECT_FLOAT_EQ(boundingBox.minimum.x, -0.5f);
+  EXPECT_FLOAT_EQ(boundingBox.maximum.x, static_cast<float>(nbParticles) - 0.5f);
+}
+
+TEST(TestSolidParticleSystem, setParticlesSubsetUploadsItsVertices)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  auto box         = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  const auto model = box->getVerticesData(VertexBuffer::PositionKind);
+  auto sps         = SolidParticleSystem::New("sps", scene.get());
+  std::optional<SolidParticleSystemMeshBuilderOptions> options;
+  sps->addShape(box, 3, options);
+  sps->buildMesh();
+  sps->setParticles();
+
+  sps->particles[1]->position = Vector3(0.f, 5.f, 0.f);
+  engine->resetStateCounters();
+  sps->setParticles(1, 1);
+
+  // Positions, normals, colors and uvs of the 24 vertices of the second particle, uploaded when
+  // the mesh is bound
+  for (const auto& kind : {VertexBuffer::PositionKind, VertexBuffer::NormalKind,
+                           VertexBuffer::ColorKind, VertexBuffer::UVKind}) {
+    auto vertexBuffer = sps->mesh->getVertexBuffer(kind);
+    ASSERT_TRUE(vertexBuffer);
+    vertexBuffer->_uploadDirtyRanges();
+  }
+  const auto nbVertices = model.size() / 3;
+  EXPECT_EQ(engine->getStateCounters().vertexBufferUploads, 4ull);
+  EXPECT_EQ(engine->getStateCounters().vertexBufferUploadedBytes,
+            nbVertices * (3 + 3 + 4 + 2) * sizeof(float));
+  const auto positions = sps->mesh->getVerticesData(VertexBuffer::PositionKind);
+  for (size_t i = 0; i < nbVertices; ++i) {
+    EXPECT_NEAR(positions[(nbVertices + i) * 3 + 1], model[i * 3 + 1] + 5.f, 1e-5f);
+    EXPECT_NEAR(positions[(2 * nbVertices + i) * 3 + 1], model[i * 3 + 1], 1e-5f);
+  }
+}
@@ -0,0 +1,73 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/rendering/rendering_group.h>
+
+TEST(TestRenderingGroup, sortSubMeshesWithBuiltInComparators)
+{
+  using namespace BABYLON;
+  using SortCompareFn = bool (*)(const SubMesh* a, const SubMesh* b);
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  std::vector<MaterialPtr> materials;
+  for (size_t i = 0; i < 3; ++i) {
+    materials.emplace_back(StandardMaterial::New("material" + std::to_string(i), scene.get()));
+  }
+
+  // Few alpha indices, materials and distances, so that most keys have ties
+  std::vector<MeshPtr> meshes;
+  std::vector<SubMesh*> subMeshes;
+  BoxOptions boxOptions;
+  for (size_t i = 0; i < 64; ++i) {
+    auto box      = MeshBuilder::CreateBox("box" + std::to_string(i), boxOptions, scene.get());
+    box->material = materials[(i * 7) % materials.size()];
+    meshes.emplace_back(box);
+
+    auto subMesh               = box->subMeshes[0].get();
+    subMesh->_alphaIndex       = static_cast<int>((i * 5) % 3) - 1;
+    subMesh->_distanceToCamera = static_cast<float>((i * 11) % 9) * 1.5f;
+    subMeshes.emplace_back(subMesh);
+  }
+
+  for (SortCompareFn sortCompareFn :
+       {&RenderingGroup::defaultTransparentSortCompare, &RenderingGroup::backToFrontSortCompare,
+        &RenderingGroup::frontToBackSortCompare, &RenderingGroup::materialSortCompare,
+        &RenderingGroup::stateSortCompare}) {
+    RenderingGroup::_SortCache cache;
+    cache.sortKey = RenderingGroup::getSortKey(sortCompareFn);
+    ASSERT_NE(cache.sortKey, nullptr);
+
+    // The radix sort keys give the order of a stable sort with the comparison function, on the
+    // first frame and on the next frames starting from the previous order
+    for (size_t frame = 0; frame < 3; ++frame) {
+      auto expected = subMeshes;
+      std::stable_sort(expected.begin(), expected.end(), sortCompareFn);
+      EXPECT_EQ(RenderingGroup::sortSubMeshes(subMeshes, sortCompareFn, cache), expected);
+      for (auto subMesh : subMeshes) {
+        subMesh->_distanceToCamera += subMesh->_alphaIndex * 0.75f;
+      }
+    }
+  }
+
+  // The documented orders
+  auto sorted = subMeshes;
+  std::stable_sort(sorted.begin(), sorted.end(), &RenderingGroup::backToFrontSortCompare);
+  EXPECT_GE(sorted.front()->_distanceToCamera, sorted.back()->_distanceToCamera);
+  std::stable_sort(sorted.begin(), sorted.end(), &RenderingGroup::frontToBackSortCompare);
+  EXPECT_LE(sorted.front()->_distanceToCamera, sorted.back()->_distanceToCamera);
+  std::stable_sort(sorted.begin(), sorted.end(), &RenderingGroup::defaultTransparentSortCompare);
+  EXPECT_EQ(sorted.front()->_alphaIndex, -1);
+  EXPECT_EQ(sorted.back()->_alphaIndex, 1);
+}
@@ -1,3 +1,4 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <babylon/maths/vector2.h>
@@ -114,4 +115,92 @@ TEST(TestObservables, MouseObserver)
   EXPECT_FALSE(obervable.hasObservers());
 }
 
+TEST(TestObservables, RemoveDuringNotification)
+{
+  using namespace BABYLON;
+
+  Observable<int> observable;
+  std::vector<int> calls;
+  Observer<int>::Ptr second;
+  // The first observer removes itself and the next one
+  Observer<int>::Ptr first = observable.add([&](int*, EventState&) {
+    calls.emplace_back(1);
+    observable.remove(first);
+    observable.remove(second);
+  });
+  second = observable.add([&](int*, EventState&) { calls.emplace_back(2); });
+  observable.add([&](int*, EventState&) { calls.emplace_back(3); });
+  observable.addOnce([&](int*, EventState&) { calls.emplace_back(4); });
+
+  EXPECT_TRUE(observable.notifyObservers());
+  EXPECT_THAT(calls, ::testing::ElementsAre(1, 3, 4));
+  EXPECT_EQ(observable.observers().size(), 1ull);
+  EXPECT_FALSE(observable.remove(first));
+
+  calls.clear();
+  observable.notifyObservers();
+  EXPECT_THAT(calls, ::testing::ElementsAre(3));
+}
+
+TEST(TestObservables, AddAndClearDuringNotification)
+{
+  using namespace BABYLON;
+
+  Observable<int> observable;
+  size_t addedCalls = 0, lastCalls = 0;
+  Observer<int>::Ptr first = observable.add([&](int*, EventState&) {
+    observable.add([&](int*, EventState&) { ++addedCalls; }, -1, true);
+    observable.remove(first);
+  });
+  // The observer added by the notification is notified by the next ones, in first position
+  observable.notifyObservers();
+  EXPECT_EQ(addedCalls, 0ull);
+  EXPECT_EQ(observable.observers().size(), 1ull);
+  observable.notifyObservers();
+  EXPECT_EQ(addedCalls, 1ull);
+
+  observable.add([&](int*, EventState&) { observable.clear(); });
+  observable.add([&](int*, EventState&) { ++lastCalls; });
+  observable.notifyObservers();
+  EXPECT_EQ(addedCalls, 2ull);
+  EXPECT_EQ(lastCalls, 0ull);
+  EXPECT_FALSE(observable.hasObservers());
+}
+
+TEST(TestObservables, MaskAndPriority)
+{
+  using namespace BABYLON;
+
+  Observable<int> observable;
+  std::vector<int> calls;
+  observable.add([&](int*, EventState&) { calls.emplace_back(1); }, 0x01);
+  const auto second = observable.add(
+    [&](int*, EventState& state) {
+      calls.emplace_back(2);
+      state.skipNextObservers = true;
+    },
+    0x03);
+  EXPECT_TRUE(observable.hasSpecificMask(0x02));
+  EXPECT_FALSE(observable.hasSpecificMask(0x04));
+
+  // No observer matches
+  EXPECT_TRUE(observable.notifyObservers(nullptr, 0x04));
+  EXPECT_TRUE(calls.empty());
+
+  EXPECT_FALSE(observable.notifyObservers(nullptr, 0x02));
+  EXPECT_THAT(calls, ::testing::ElementsAre(2));
+
+  // The second observer stops the notification once it is called first
+  calls.clear();
+  observable.makeObserverTopPriority(second);
+  EXPECT_FALSE(observable.notifyObservers(nullptr, 0x01));
+  EXPECT_THAT(calls, ::testing::ElementsAre(2));
+
+  calls.clear();
+  observable.remove(second);
+  EXPECT_FALSE(observable.hasSpecificMask(0x02));
+  EXPECT_TRUE(observable.notifyObservers(nullptr, 0x01));
+  EXPECT_THAT(calls, ::testing::ElementsAre(1));
+}
+
 } // end of namespace BABYLON
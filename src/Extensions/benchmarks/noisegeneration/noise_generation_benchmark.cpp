@@ -0,0 +1,112 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+
+using ns = uint64_t;
+
+class NoiseGenerationBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    using namespace BABYLON::Extensions;
+
+    // A 1024 x 1024 height map, like the ones of the procedural terrains
+    const size_t width  = 1024;
+    const size_t height = 1024;
+    const size_t count  = width * height;
+    const float step    = 0.01f;
+    std::vector<float> values(count);
+    float checksum = 0.f;
+
+    SimplexNoise simplexNoise;
+    auto before = std::chrono::high_resolution_clock::now();
+    for (size_t row = 0; row < height; ++row) {
+      for (size_t col = 0; col < width; ++col) {
+        values[row * width + col] = simplexNoise.fBm(
+          Vector2(static_cast<float>(col) * step, static_cast<float>(row) * step));
+      }
+    }
+    auto after = std::chrono::high_resolution_clock::now();
+    const auto scalarFBm
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += values[count / 2];
+
+    before = std::chrono::high_resolution_clock::now();
+    simplexNoise.fBm2DGrid(0.f, 0.f, step, step, width, height, values.data());
+    after = std::chrono::high_resolution_clock::now();
+    const auto gridFBm
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += values[count / 2];
+
+    // Scattered points, like the vertices of a planet
+    std::vector<float> xs(count);
+    std::vector<float> ys(count);
+    for (size_t i = 0; i < count; ++i) {
+      xs[i] = static_cast<float>(i % 977) * 0.37f;
+      ys[i] = static_cast<float>(i / 977) * 0.11f;
+    }
+    before = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+      values[i] = simplexNoise.noise(Vector2(xs[i], ys[i]));
+    }
+    after = std::chrono::high_resolution_clock::now();
+    const auto scalarNoise
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += values[count / 2];
+
+    before = std::chrono::high_resolution_clock::now();
+    simplexNoise.noise2D(xs.data(), ys.data(), values.data(), count);
+    after = std::chrono::high_resolution_clock::now();
+    const auto batchNoise
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += values[count / 2];
+
+    PerlinNoiseOctave perlinNoiseOctave(4, 1);
+    std::vector<double> perlinValues(count);
+    before = std::chrono::high_resolution_clock::now();
+    for (size_t row = 0; row < height; ++row) {
+      for (size_t col = 0; col < width; ++col) {
+        perlinValues[row * width + col] = perlinNoiseOctave.noise(
+          static_cast<double>(col) * 0.01, static_cast<double>(row) * 0.01);
+      }
+    }
+    after = std::chrono::high_resolution_clock::now();
+    const auto scalarPerlin
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += static_cast<float>(perlinValues[count / 2]);
+
+    before = std::chrono::high_resolution_clock::now();
+    perlinNoiseOctave.noise2DGrid(0.0, 0.0, 0.01, 0.01, width, height, perlinValues.data());
+    after = std::chrono::high_resolution_clock::now();
+    const auto gridPerlin
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+    checksum += static_cast<float>(perlinValues[count / 2]);
+
+    const auto throughput = [count](ns duration) { return count * 1000.0 / duration; };
+    std::cout << count << " points (checksum " << checksum << ")" << std::endl;
+    std::cout << "simplex fBm: scalar " << throughput(static_cast<ns>(scalarFBm))
+              << " Mpoints/s, grid " << throughput(static_cast<ns>(gridFBm)) << " Mpoints/s"
+              << std::endl;
+    std::cout << "simplex noise: scalar " << throughput(static_cast<ns>(scalarNoise))
+              << " Mpoints/s, batch " << throughput(static_cast<ns>(batchNoise)) << " Mpoints/s"
+              << std::endl;
+    std::cout << "perlin octaves: scalar " << throughput(static_cast<ns>(scalarPerlin))
+              << " Mpoints/s, grid " << throughput(static_cast<ns>(gridPerlin)) << " Mpoints/s"
+              << std::endl;
+  } // Run
+
+}; // end of class NoiseGenerationBenchmark
+
+TEST(BenchmarkNoiseGeneration, throughput)
+{
+  NoiseGenerationBenchmark::Run();
+}
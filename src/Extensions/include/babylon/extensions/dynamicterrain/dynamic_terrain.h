@@ -2,6 +2,7 @@
 #define BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_DYNAMIC_TERRAIN_H
 
 #include <functional>
+#include <future>
 
 #include <babylon/babylon_api.h>
 #include <babylon/maths/color3.h>
@@ -87,6 +88,12 @@ public:
   DynamicTerrain(const std::string& name, DynamicTerrainOptions& options, Scene* scene);
   virtual ~DynamicTerrain(); // = default
 
+  /**
+   * Number of vertices from which the terrain update, the map normals and the batched height
+   * sampling are split in row bands processed in parallel
+   */
+  static constexpr size_t ParallelUpdateThreshold = 16384;
+
   /**
    * @brief Updates the terrain position and shape according to the camera
    * position.
@@ -137,6 +144,24 @@ public:
                                  unsigned int mapSubX, unsigned int mapSubZ, float mapSizeX,
                                  float mapSizeZ, const Vector3& normal = Vector3::Zero());
 
+  /**
+   * @brief Stores in heights the altitudes at the coordinates (xs[i], zs[i]) of the map, as
+   * returned by getHeightFromMap().
+   * @param xs the x coordinates of the points to sample
+   * @param zs the z coordinates of the points to sample
+   * @param heights the altitudes, must hold count floats
+   * @param count the number of points to sample
+   */
+  void getHeightsFromMap(const float* xs, const float* zs, float* heights, size_t count) const;
+
+  /**
+   * @brief Stores in heights the altitudes at the coordinates (xs[i], zs[i]) of the passed map, as
+   * returned by GetHeightFromMap(). Large batches are sampled in parallel.
+   */
+  static void GetHeightsFromMap(const float* xs, const float* zs, float* heights, size_t count,
+                                const Float32Array& mapData, unsigned int mapSubX,
+                                unsigned int mapSubZ);
+
   /**
    * @brief Computes all the normals from the terrain data map  and stores them
    * in the passed Float32Array reference.
@@ -418,6 +443,21 @@ public:
   [[nodiscard]] bool precomputeNormalsFromMap() const;
   void setPrecomputeNormalsFromMap(bool val);
 
+  /**
+   * @brief Is the next terrain window computed in the background ?
+   * When enabled, the terrain keeps its current shape and position until the window matching the
+   * camera position is ready, then swaps it in. Forced updates and the custom function
+   * updateVertex() are always processed synchronously.
+   * Default false.
+   */
+  [[nodiscard]] bool asyncUpdate() const;
+  void setAsyncUpdate(bool val);
+
+  /**
+   * @brief Returns true while a terrain window is computed in the background.
+   */
+  [[nodiscard]] bool hasPendingUpdate() const;
+
   // User custom functions.
   // These following can be overwritten bu the user to fit his needs.
 
@@ -460,6 +500,29 @@ private:
    */
   void _updateTerrain();
 
+  /**
+   * @brief Resamples the map into the passed ribbon arrays at the current map deltas and LOD, and
+   * computes their bounding box. The rows are processed in parallel bands when the terrain is large
+   * enough and no custom vertex function is used.
+   */
+  void _computeTerrainWindow(Float32Array& positions, Float32Array& normals, Float32Array& colors,
+                             Float32Array& uvs, Vector3& bbMin, Vector3& bbMax);
+
+  /**
+   * @brief Uploads the ribbon arrays to the terrain mesh and sets its bounding box.
+   */
+  void _uploadTerrainWindow(const Vector3& bbMin, const Vector3& bbMax);
+
+  /**
+   * @brief Waits for the terrain window computed in the background, if any, and swaps it in.
+   */
+  void _swapTerrainWindow();
+
+  /**
+   * @brief Updates the local and World terrain centers from the terrain position.
+   */
+  void _updateCenters();
+
   template <typename T>
   T _mod(T a, T b)
   {
@@ -571,16 +634,20 @@ private:
   MeshPtr _terrain;
   bool _isAlwaysVisible;
   bool _precomputeNormalsFromMap;
-  // tmp vectors
-  static Vector3 _v1;
-  static Vector3 _v2;
-  static Vector3 _v3;
-  static Vector3 _v4;
-  static Vector3 _vAvB;
-  static Vector3 _vAvC;
-  static Vector3 _norm;
-  static Vector3 _bbMin;
-  static Vector3 _bbMax;
+  // to compute the next terrain window in the background
+  bool _asyncUpdate;
+  // ribbon arrays of the terrain window computed in the background, swapped with the current ones
+  Float32Array _nextPositions;
+  Float32Array _nextNormals;
+  Float32Array _nextColors;
+  Float32Array _nextUVs;
+  // bounding box of the next terrain window
+  Vector3 _nextBBMin;
+  Vector3 _nextBBMax;
+  // terrain position matching the next terrain window
+  Vector3 _nextPosition;
+  // background computation of the next terrain window, declared last to be waited for first
+  std::future<void> _nextWindow;
 
 }; // end of class DynamicTerrain
 
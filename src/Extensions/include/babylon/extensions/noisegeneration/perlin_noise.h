@@ -49,6 +49,11 @@ public:
    */
   PerlinNoise(uint32_t seed);
 
+  /**
+   * Number of points from which the batch functions are processed in parallel chunks
+   */
+  static constexpr size_t ParallelBatchThreshold = 16384;
+
   /**
    * @brief Returns 1D Perlin noise value.
    * @param x X value.
@@ -73,6 +78,21 @@ public:
    */
   [[nodiscard]] double noise(double x, double y, double z) const;
 
+  /**
+   * @brief Stores in out the 2D Perlin noise values of the n points (xs[i], ys[i]).
+   * @param xs X values.
+   * @param ys Y values.
+   * @param out The noise values, equal to noise(xs[i], ys[i]).
+   * @param n Number of points.
+   */
+  void noise2D(const double* xs, const double* ys, double* out, size_t n) const;
+
+  /**
+   * @brief Hidden
+   * 2D Perlin noise, only blending the 4 corners of the z = 0 face of the unit cube.
+   */
+  [[nodiscard]] double _noise2D(double x, double y) const;
+
 private:
   // The permutation vector
   std::array<int, 512> p;
@@ -96,6 +116,14 @@ public:
 
   [[nodiscard]] double noise(double x, double y, double z) const;
 
+  /**
+   * @brief Stores in out, row after row, the 2D octave noise values of the points
+   * (x + col * dx, y + row * dy) of a width x height grid, equal to noise(x, y). Large grids are
+   * split in bands of rows processed in parallel.
+   */
+  void noise2DGrid(double x, double y, double dx, double dy, size_t width, size_t height,
+                   double* out) const;
+
 private:
   PerlinNoise _perlinNoise;
   int _octaves;
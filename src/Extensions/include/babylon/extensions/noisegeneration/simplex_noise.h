@@ -24,7 +24,7 @@ class BABYLON_SHARED_EXPORT SimplexNoise {
 
 public:
   template <typename T>
-  constexpr int fastfloor(T x)
+  static constexpr int fastfloor(T x)
   {
     return (x > 0) ? static_cast<int>(x) : static_cast<int>(x) - 1;
   }
@@ -86,6 +86,12 @@ public:
   SimplexNoise();
   ~SimplexNoise(); // = default
 
+  /**
+   * Number of points from which the batch functions split their work in chunks processed in
+   * parallel
+   */
+  static constexpr size_t ParallelBatchThreshold = 16384;
+
   // -----------------------------------------------------------------------------------------------
 
   /**
@@ -274,6 +280,22 @@ public:
 
   // -----------------------------------------------------------------------------------------------
 
+  /**
+   * @brief Stores in out the 2D simplex noises of the n points (xs[i], ys[i]), equal to
+   * noise(Vector2(xs[i], ys[i])).
+   */
+  void noise2D(const float* xs, const float* ys, float* out, size_t n) const;
+
+  /**
+   * @brief Stores in out, row after row, the 2D simplex noise fractal brownian motion sums of the
+   * points (x + col * dx, y + row * dy) of a width x height grid, equal to the ones of fBm(). The
+   * octaves are accumulated a row at a time and large grids are split in bands of rows.
+   */
+  void fBm2DGrid(float x, float y, float dx, float dy, size_t width, size_t height, float* out,
+                 uint8_t octaves = 4, float lacunarity = 2.0f, float gain = 0.5f) const;
+
+  // -----------------------------------------------------------------------------------------------
+
   /**
    * @brief Returns a 1D simplex noise fractal brownian motion sum with
    * analytical derivatives.
@@ -370,6 +392,12 @@ public:
   void seed(uint32_t s);
 
 private:
+  /*
+   * 2D simplex noise without branches nor temporaries, shared by noise(const Vector2&) and the
+   * batch functions.
+   */
+  [[nodiscard]] float _noise2D(float x, float y) const;
+
   /*
    * Helper functions to compute gradients-dot-residualvectors (1D to 4D)
    * Note that these generate gradients of more than unit length. To make a close match with the
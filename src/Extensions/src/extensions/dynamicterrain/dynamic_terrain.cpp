@@ -1,5 +1,7 @@
 #include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
 
+#include <thread>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -15,15 +17,137 @@
 namespace BABYLON {
 namespace Extensions {
 
-Vector3 DynamicTerrain::_v1    = Vector3::Zero();
-Vector3 DynamicTerrain::_v2    = Vector3::Zero();
-Vector3 DynamicTerrain::_v3    = Vector3::Zero();
-Vector3 DynamicTerrain::_v4    = Vector3::Zero();
-Vector3 DynamicTerrain::_vAvB  = Vector3::Zero();
-Vector3 DynamicTerrain::_vAvC  = Vector3::Zero();
-Vector3 DynamicTerrain::_norm  = Vector3::Zero();
-Vector3 DynamicTerrain::_bbMin = Vector3::Zero();
-Vector3 DynamicTerrain::_bbMax = Vector3::Zero();
+namespace {
+
+/**
+ * @brief Returns the number of chunks processed in parallel for count items, 1 below the
+ * threshold.
+ */
+size_t parallelChunkCount(size_t count)
+{
+  const size_t concurrency = std::thread::hardware_concurrency();
+  if (count < DynamicTerrain::ParallelUpdateThreshold || concurrency < 2) {
+    return 1;
+  }
+  return std::min<size_t>(concurrency, count / (DynamicTerrain::ParallelUpdateThreshold / 4));
+}
+
+/**
+ * @brief Runs job(chunk) for each chunk, the first one on the calling thread and the other ones
+ * asynchronously.
+ */
+template <typename Job>
+void runChunks(size_t chunkCount, const Job& job)
+{
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(chunkCount);
+  for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+    jobs.emplace_back(std::async(std::launch::async, [&job, chunk]() { job(chunk); }));
+  }
+  job(0);
+  for (auto& pending : jobs) {
+    pending.get();
+  }
+}
+
+/**
+ * @brief Computes the altitude at the coordinates (x,z) from the plane of the map triangle below
+ * them. Only uses locals so that it can be called from several threads.
+ */
+float sampleHeight(float x, float z, const Float32Array& mapData, unsigned int mapSubX,
+                   unsigned int mapSubZ, float mapSizeX, float mapSizeZ)
+{
+  const float x0 = mapData[0];
+  const float z0 = mapData[2];
+
+  // reset x and z in the map space so they are between 0 and the axis map size
+  x = x - std::floor((x - x0) / mapSizeX) * mapSizeX;
+  z = z - std::floor((z - z0) / mapSizeZ) * mapSizeZ;
+
+  const auto col1         = static_cast<unsigned>(std::floor((x - x0) * mapSubX / mapSizeX));
+  const auto row1         = static_cast<unsigned>(std::floor((z - z0) * mapSubZ / mapSizeZ));
+  const unsigned int col2 = (col1 + 1) % mapSubX;
+  const unsigned int row2 = (row1 + 1) % mapSubZ;
+  // starting indexes of the positions of 4 vertices defining a quad on the map
+  const unsigned int idx1 = 3 * (row1 * mapSubX + col1);
+  const unsigned int idx2 = 3 * (row1 * mapSubX + col2);
+  const unsigned int idx3 = 3 * ((row2)*mapSubX + col1);
+  const unsigned int idx4 = 3 * ((row2)*mapSubX + col2);
+
+  const Vector3 v1(mapData[idx1], mapData[idx1 + 1], mapData[idx1 + 2]);
+  const Vector3 v2(mapData[idx2], mapData[idx2 + 1], mapData[idx2 + 2]);
+  const Vector3 v3(mapData[idx3], mapData[idx3 + 1], mapData[idx3 + 2]);
+  const Vector3 v4(mapData[idx4], mapData[idx4 + 1], mapData[idx4 + 2]);
+
+  const float xv4v1 = v4.x - v1.x;
+  const float zv4v1 = v4.z - v1.z;
+  if (stl_util::almost_equal(xv4v1, 0.f) || stl_util::almost_equal(zv4v1, 0.f)) {
+    return v1.y;
+  }
+  const float cd = zv4v1 / xv4v1;
+  const float h  = v1.z - cd * v1.x;
+  // vertices of the triangle below (x, z), v is the one the plane goes through
+  const Vector3& vA = v1;
+  const Vector3& vB = (z < cd * x + h) ? v4 : v3;
+  const Vector3& vC = (z < cd * x + h) ? v2 : v4;
+  const Vector3& v  = (z < cd * x + h) ? vA : vB;
+  Vector3 vAvB;
+  Vector3 vAvC;
+  Vector3 norm;
+  vB.subtractToRef(vA, vAvB);
+  vC.subtractToRef(vA, vAvC);
+  Vector3::CrossToRef(vAvB, vAvC, norm);
+  norm.normalize();
+  const float d = -(norm.x * v.x + norm.y * v.y + norm.z * v.z);
+  float y       = v.y;
+  if (!stl_util::almost_equal(norm.y, 0.f)) {
+    y = -(norm.x * x + norm.z * z + d) / norm.y;
+  }
+
+  return y;
+}
+
+/**
+ * @brief Adds the normalized normal of the facet (i1, i2, i3) to normal once per occurrence of the
+ * vertex in the facet, like VertexData::ComputeNormals() does.
+ */
+void accumulateFacetNormal(const Float32Array& positions, unsigned int vertex, unsigned int i1,
+                           unsigned int i2, unsigned int i3, float* normal)
+{
+  if (vertex != i1 && vertex != i2 && vertex != i3) {
+    return;
+  }
+  const auto v1 = 3 * i1;
+  const auto v2 = 3 * i2;
+  const auto v3 = 3 * i3;
+
+  const float p1p2x = positions[v1] - positions[v2];
+  const float p1p2y = positions[v1 + 1] - positions[v2 + 1];
+  const float p1p2z = positions[v1 + 2] - positions[v2 + 2];
+  const float p3p2x = positions[v3] - positions[v2];
+  const float p3p2y = positions[v3 + 1] - positions[v2 + 1];
+  const float p3p2z = positions[v3 + 2] - positions[v2 + 2];
+
+  float faceNormalx = p1p2y * p3p2z - p1p2z * p3p2y;
+  float faceNormaly = p1p2z * p3p2x - p1p2x * p3p2z;
+  float faceNormalz = p1p2x * p3p2y - p1p2y * p3p2x;
+  float length
+    = std::sqrt(faceNormalx * faceNormalx + faceNormaly * faceNormaly + faceNormalz * faceNormalz);
+  length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
+  faceNormalx /= length;
+  faceNormaly /= length;
+  faceNormalz /= length;
+
+  for (const auto index : {i1, i2, i3}) {
+    if (index == vertex) {
+      normal[0] += faceNormalx;
+      normal[1] += faceNormaly;
+      normal[2] += faceNormalz;
+    }
+  }
+}
+
+} // end of anonymous namespace
 
 DynamicTerrain::DynamicTerrain(const std::string& iName, DynamicTerrainOptions& options,
                                Scene* scene)
@@ -71,6 +195,7 @@ DynamicTerrain::DynamicTerrain(const std::string& iName, DynamicTerrainOptions&
     , _mapSizeZ{0.f}
     , _isAlwaysVisible{false}
     , _precomputeNormalsFromMap{false}
+    , _asyncUpdate{false}
 {
   _terrainSub = (options.terrainSub > 0) ? static_cast<unsigned>(options.terrainSub) : 60;
   _mapData    = options.mapData;
@@ -201,6 +326,18 @@ DynamicTerrain::~DynamicTerrain() = default;
 
 DynamicTerrain& DynamicTerrain::update(bool force)
 {
+  // The terrain window computed in the background is swapped in once ready, no other one is
+  // started meanwhile
+  if (_nextWindow.valid()) {
+    if (!force && _nextWindow.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      return *this;
+    }
+    _swapTerrainWindow();
+  }
+
+  // terrain position before the update
+  const auto position = _terrain->position();
+
   _needsUpdate   = false;
   _updateLOD     = false;
   _updateForced  = (force);
@@ -242,200 +379,218 @@ DynamicTerrain& DynamicTerrain::update(bool force)
   if (_needsUpdate || _updateLOD || _updateForced) {
     _deltaSubX = _mod(_deltaSubX, _mapSubX);
     _deltaSubZ = _mod(_deltaSubZ, _mapSubZ);
-    _updateTerrain();
+    if (!_asyncUpdate || _updateForced || _useCustomVertexFunction) {
+      _updateTerrain();
+    }
+    else {
+      // The terrain stays where it is until the window matching its new position is swapped in
+      _nextPosition = _terrain->position();
+      _terrain->position().copyFrom(position);
+      if (_updateLOD) {
+        updateTerrainSize();
+      }
+      if (_nextPositions.size() != _positions.size()) {
+        _nextPositions = _positions;
+        _nextNormals   = _normals;
+        _nextColors    = _colors;
+        _nextUVs       = _uvs;
+      }
+      _nextWindow = std::async(std::launch::async, [this]() {
+        _computeTerrainWindow(_nextPositions, _nextNormals, _nextColors, _nextUVs, _nextBBMin,
+                              _nextBBMax);
+        if (_computeNormals) {
+          VertexData::ComputeNormals(_nextPositions, _indices, _nextNormals);
+        }
+      });
+    }
   }
-  _updateForced  = false;
-  _updateLOD     = false;
-  _centerLocal.x = _terrainHalfSizeX;
-  _centerLocal.y = _terrain->position().y;
-  _centerLocal.z = _terrainHalfSizeZ;
-  _centerWorld.x = _terrain->position().x + _terrainHalfSizeX;
-  _centerWorld.y = _terrain->position().y;
-  _centerWorld.z = _terrain->position().z + _terrainHalfSizeZ;
+  _updateForced = false;
+  _updateLOD    = false;
+  _updateCenters();
   return *this;
 }
 
 void DynamicTerrain::_updateTerrain()
 {
-  unsigned int stepJ        = 0;
-  unsigned int stepI        = 0;
-  unsigned int LODLimitDown = 0;
-  unsigned int LODLimitUp   = 0;
-  unsigned int LODValue     = _LODValue;
-  unsigned int lodI         = LODValue;
-  unsigned int lodJ         = LODValue;
-  unsigned int l            = 0;
-  unsigned int index        = 0;  // current vertex index in the map data array
-  unsigned int posIndex     = 0;  // current position index in the map data array
-  unsigned int colIndex     = 0;  // current index in the map color array
-  unsigned int uvIndex      = 0;  // current index in the map uv array
-  unsigned int terIndex     = 0;  // current vertex index in the terrain map array
-                                  // when used as a data map
-  unsigned int ribbonInd     = 0; // current ribbon vertex index
-  unsigned int ribbonPosInd  = 0; // current ribbon position index (same than normal index)
-  unsigned int ribbonUVInd   = 0; // current ribbon UV index
-  unsigned int ribbonColInd  = 0; // current ribbon color index
-  unsigned int ribbonPosInd1 = 0;
-  unsigned int ribbonPosInd2 = 0;
-  unsigned int ribbonPosInd3 = 0;
-  // note : all the indexes are explicitly set as integers for the js optimizer
-  // (store them all in the stack)
-
   if (_updateLOD || _updateForced) {
     updateTerrainSize();
   }
-  Vector3::FromFloatsToRef(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
-                           std::numeric_limits<float>::max(), _bbMin);
-  Vector3::FromFloatsToRef(std::numeric_limits<float>::lowest(),
-                           std::numeric_limits<float>::lowest(),
-                           std::numeric_limits<float>::lowest(), _bbMax);
+  Vector3 bbMin;
+  Vector3 bbMax;
+  _computeTerrainWindow(_positions, _normals, _colors, _uvs, bbMin, bbMax);
+  if (_computeNormals) {
+    VertexData::ComputeNormals(_positions, _indices, _normals);
+  }
+  _uploadTerrainWindow(bbMin, bbMax);
+}
 
-  for (unsigned int j = 0; j <= _terrainSub; ++j) {
-    // LOD Z
-    LODValue = _LODValue;
-    for (l = 0; l < _LODLimits.size(); ++l) {
-      LODLimitDown = _LODLimits[l];
-      LODLimitUp   = _terrainSub - LODLimitDown - 1;
-      if (j < LODLimitDown || j > LODLimitUp) {
-        LODValue = l + 1 + _LODValue;
+void DynamicTerrain::_computeTerrainWindow(Float32Array& positions, Float32Array& normals,
+                                           Float32Array& colors, Float32Array& uvs, Vector3& bbMin,
+                                           Vector3& bbMax)
+{
+  // LOD value and position step of each terrain row or column, the same on both axes
+  std::vector<unsigned int> lods(_terrainIdx, _LODValue);
+  std::vector<unsigned int> steps(_terrainIdx, 0);
+  for (unsigned int k = 0; k <= _terrainSub; ++k) {
+    for (unsigned int l = 0; l < _LODLimits.size(); ++l) {
+      const unsigned int LODLimitDown = _LODLimits[l];
+      const unsigned int LODLimitUp   = _terrainSub - LODLimitDown - 1;
+      if (k < LODLimitDown || k > LODLimitUp) {
+        lods[k] = l + 1 + _LODValue;
       }
-      lodJ = LODValue;
     }
+    if (k > 0) {
+      steps[k] = steps[k - 1] + lods[k - 1];
+    }
+  }
 
-    for (unsigned int i = 0; i <= _terrainSub; ++i) {
-      // LOD X
-      LODValue = _LODValue;
-      for (l = 0; l < _LODLimits.size(); ++l) {
-        LODLimitDown = _LODLimits[l];
-        LODLimitUp   = _terrainSub - LODLimitDown - 1;
-        if (i < LODLimitDown || i > LODLimitUp) {
-          LODValue = l + 1 + _LODValue;
+  // Rows [firstRow, lastRow[ of the ribbon, each band with its own bounding box
+  const auto computeRows = [&](unsigned int firstRow, unsigned int lastRow, Vector3& rowsMin,
+                               Vector3& rowsMax) {
+    Vector3::FromFloatsToRef(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::max(), rowsMin);
+    Vector3::FromFloatsToRef(std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest(), rowsMax);
+    for (unsigned int j = firstRow; j < lastRow; ++j) {
+      const unsigned int lodJ  = lods[j];
+      const unsigned int stepJ = steps[j];
+      for (unsigned int i = 0; i <= _terrainSub; ++i) {
+        const unsigned int lodI  = lods[i];
+        const unsigned int stepI = steps[i];
+
+        // map current index
+        const unsigned int index
+          = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX + _mod(_deltaSubX + stepI, _mapSubX);
+        // current vertex index in the terrain map array when used as a data map
+        const unsigned int terIndex = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
+                                      + _mod(_deltaSubX + stepI, _terrainIdx);
+
+        // related indexes in the arrays of positions (data map), UVs and colors
+        const unsigned int posIndex = _datamap ? 3 * index : 3 * terIndex;
+        const unsigned int uvIndex  = _uvmap ? 2 * index : 2 * terIndex;
+        const unsigned int colIndex = _colormap ? 3 * index : 3 * terIndex;
+        // ribbon indexes
+        const unsigned int ribbonInd     = j * _terrainIdx + i;
+        const unsigned int ribbonPosInd1 = 3 * ribbonInd;
+        const unsigned int ribbonPosInd2 = ribbonPosInd1 + 1;
+        const unsigned int ribbonPosInd3 = ribbonPosInd1 + 2;
+        const unsigned int ribbonColInd  = 4 * ribbonInd;
+        const unsigned int ribbonUVInd   = 2 * ribbonInd;
+
+        // geometry
+        positions[ribbonPosInd1] = _averageSubSizeX * stepI;
+        positions[ribbonPosInd2] = _mapData[posIndex + 1];
+        positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
+
+        if (!_computeNormals) {
+          normals[ribbonPosInd1] = _mapNormals[posIndex];
+          normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
+          normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
         }
-        lodI = LODValue;
-      }
-
-      // map current index
-      index    = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX + _mod(_deltaSubX + stepI, _mapSubX);
-      terIndex = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
-                 + _mod(_deltaSubX + stepI, _terrainIdx);
-
-      // related index in the array of positions (data map)
-      if (_datamap) {
-        posIndex = 3 * index;
-      }
-      else {
-        posIndex = 3 * terIndex;
-      }
-      // related index in the UV map
-      if (_uvmap) {
-        uvIndex = 2 * index;
-      }
-      else {
-        uvIndex = 2 * terIndex;
-      }
-      // related index in the color map
-      if (_colormap) {
-        colIndex = 3 * index;
-      }
-      else {
-        colIndex = 3 * terIndex;
-      }
-      // ribbon indexes
-      ribbonPosInd  = 3 * ribbonInd;
-      ribbonColInd  = 4 * ribbonInd;
-      ribbonUVInd   = 2 * ribbonInd;
-      ribbonPosInd1 = ribbonPosInd;
-      ribbonPosInd2 = ribbonPosInd + 1;
-      ribbonPosInd3 = ribbonPosInd + 2;
-      ribbonInd += 1;
-
-      // geometry
-      _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
-      _positions[ribbonPosInd2] = _mapData[posIndex + 1];
-      _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
-
-      if (!_computeNormals) {
-        _normals[ribbonPosInd1] = _mapNormals[posIndex];
-        _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
-        _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
-      }
 
-      // bbox internal update
-      if (_positions[ribbonPosInd1] < _bbMin.x) {
-        _bbMin.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd1] > _bbMax.x) {
-        _bbMax.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd2] < _bbMin.y) {
-        _bbMin.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd2] > _bbMax.y) {
-        _bbMax.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd3] < _bbMin.z) {
-        _bbMin.z = _positions[ribbonPosInd3];
-      }
-      if (_positions[ribbonPosInd3] > _bbMax.z) {
-        _bbMax.z = _positions[ribbonPosInd3];
-      }
-      // color
-      if (_colormap) {
-        _colors[ribbonColInd]     = _mapColors[colIndex];
-        _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
-        _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
-      }
-      // uv : the array _mapUVs is always populated
-      _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
-      _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
-
-      // call to user custom function with the current updated vertex object
-      if (_useCustomVertexFunction) {
-        _vertex.position.copyFromFloats(_positions[ribbonPosInd1], _positions[ribbonPosInd2],
-                                        _positions[ribbonPosInd3]);
-        _vertex.worldPosition.x = _mapData[posIndex];
-        _vertex.worldPosition.y = _vertex.position.y;
-        _vertex.worldPosition.z = _mapData[posIndex + 2];
-        _vertex.lodX            = lodI;
-        _vertex.lodZ            = lodJ;
-        _vertex.color.r         = _colors[ribbonColInd];
-        _vertex.color.g         = _colors[ribbonColInd + 1];
-        _vertex.color.b         = _colors[ribbonColInd + 2];
-        _vertex.color.a         = _colors[ribbonColInd + 3];
-        _vertex.uvs.x           = _uvs[ribbonUVInd];
-        _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
-        _vertex.mapIndex        = index;
-        updateVertex(_vertex, i,
-                     j); // the user can modify the array values here
-        _colors[ribbonColInd]     = _vertex.color.r;
-        _colors[ribbonColInd + 1] = _vertex.color.g;
-        _colors[ribbonColInd + 2] = _vertex.color.b;
-        _colors[ribbonColInd + 3] = _vertex.color.a;
-        _uvs[ribbonUVInd]         = _vertex.uvs.x;
-        _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
-        _positions[ribbonPosInd1] = _vertex.position.x;
-        _positions[ribbonPosInd2] = _vertex.position.y;
-        _positions[ribbonPosInd3] = _vertex.position.z;
+        // bbox internal update
+        rowsMin.x = std::min(rowsMin.x, positions[ribbonPosInd1]);
+        rowsMax.x = std::max(rowsMax.x, positions[ribbonPosInd1]);
+        rowsMin.y = std::min(rowsMin.y, positions[ribbonPosInd2]);
+        rowsMax.y = std::max(rowsMax.y, positions[ribbonPosInd2]);
+        rowsMin.z = std::min(rowsMin.z, positions[ribbonPosInd3]);
+        rowsMax.z = std::max(rowsMax.z, positions[ribbonPosInd3]);
+        // color
+        if (_colormap) {
+          colors[ribbonColInd]     = _mapColors[colIndex];
+          colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
+          colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
+        }
+        // uv : the array _mapUVs is always populated
+        uvs[ribbonUVInd]     = _mapUVs[uvIndex];
+        uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
+
+        // call to user custom function with the current updated vertex object
+        if (_useCustomVertexFunction) {
+          _vertex.position.copyFromFloats(positions[ribbonPosInd1], positions[ribbonPosInd2],
+                                          positions[ribbonPosInd3]);
+          _vertex.worldPosition.x = _mapData[posIndex];
+          _vertex.worldPosition.y = _vertex.position.y;
+          _vertex.worldPosition.z = _mapData[posIndex + 2];
+          _vertex.lodX            = lodI;
+          _vertex.lodZ            = lodJ;
+          _vertex.color.r         = colors[ribbonColInd];
+          _vertex.color.g         = colors[ribbonColInd + 1];
+          _vertex.color.b         = colors[ribbonColInd + 2];
+          _vertex.color.a         = colors[ribbonColInd + 3];
+          _vertex.uvs.x           = uvs[ribbonUVInd];
+          _vertex.uvs.y           = uvs[ribbonUVInd + 1];
+          _vertex.mapIndex        = index;
+          updateVertex(_vertex, i,
+                       j); // the user can modify the array values here
+          colors[ribbonColInd]     = _vertex.color.r;
+          colors[ribbonColInd + 1] = _vertex.color.g;
+          colors[ribbonColInd + 2] = _vertex.color.b;
+          colors[ribbonColInd + 3] = _vertex.color.a;
+          uvs[ribbonUVInd]         = _vertex.uvs.x;
+          uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
+          positions[ribbonPosInd1] = _vertex.position.x;
+          positions[ribbonPosInd2] = _vertex.position.y;
+          positions[ribbonPosInd3] = _vertex.position.z;
+        }
       }
-
-      stepI += lodI;
     }
-    stepI = 0;
-    stepJ += lodJ;
+  };
+
+  // The rows are independent unless the user custom function is called, which updates the shared
+  // vertex object in the row order
+  const auto chunkCount
+    = _useCustomVertexFunction ? 1 : parallelChunkCount(_terrainIdx * _terrainIdx);
+  std::vector<std::pair<Vector3, Vector3>> chunkBounds(chunkCount);
+  runChunks(chunkCount, [&](size_t chunk) {
+    auto& [chunkMin, chunkMax] = chunkBounds[chunk];
+    computeRows(static_cast<unsigned>(_terrainIdx * chunk / chunkCount),
+                static_cast<unsigned>(_terrainIdx * (chunk + 1) / chunkCount), chunkMin, chunkMax);
+  });
+  bbMin = chunkBounds[0].first;
+  bbMax = chunkBounds[0].second;
+  for (const auto& bounds : chunkBounds) {
+    bbMin.minimizeInPlace(bounds.first);
+    bbMax.maximizeInPlace(bounds.second);
   }
+}
 
-  // ribbon update
+void DynamicTerrain::_uploadTerrainWindow(const Vector3& bbMin, const Vector3& bbMax)
+{
   _terrain->updateVerticesData(VertexBuffer::PositionKind, _positions, false, false);
-  if (_computeNormals) {
-    VertexData::ComputeNormals(_positions, _indices, _normals);
-  }
   _terrain->updateVerticesData(VertexBuffer::NormalKind, _normals, false, false);
   _terrain->updateVerticesData(VertexBuffer::UVKind, _uvs, false, false);
   _terrain->updateVerticesData(VertexBuffer::ColorKind, _colors, false, false);
-  _terrain->_boundingInfo = std::make_unique<BoundingInfo>(_bbMin, _bbMax);
+  _terrain->_boundingInfo = std::make_unique<BoundingInfo>(bbMin, bbMax);
   _terrain->_boundingInfo->update(_terrain->_worldMatrix);
 }
 
+void DynamicTerrain::_swapTerrainWindow()
+{
+  if (!_nextWindow.valid()) {
+    return;
+  }
+  _nextWindow.get();
+  std::swap(_positions, _nextPositions);
+  std::swap(_normals, _nextNormals);
+  std::swap(_colors, _nextColors);
+  std::swap(_uvs, _nextUVs);
+  _terrain->position().copyFrom(_nextPosition);
+  _uploadTerrainWindow(_nextBBMin, _nextBBMax);
+  _updateCenters();
+}
+
+void DynamicTerrain::_updateCenters()
+{
+  _centerLocal.x = _terrainHalfSizeX;
+  _centerLocal.y = _terrain->position().y;
+  _centerLocal.z = _terrainHalfSizeZ;
+  _centerWorld.x = _terrain->position().x + _terrainHalfSizeX;
+  _centerWorld.y = _terrain->position().y;
+  _centerWorld.z = _terrain->position().z + _terrainHalfSizeZ;
+}
+
 DynamicTerrain& DynamicTerrain::updateTerrainSize()
 {
   unsigned int remainder = _terrainSub; // the remaining cells at the general current LOD value
@@ -479,84 +634,82 @@ float DynamicTerrain::GetHeightFromMap(float x, float z, const Float32Array& map
 
 float DynamicTerrain::_GetHeightFromMap(float x, float z, const Float32Array& mapData,
                                         unsigned int mapSubX, unsigned int mapSubZ, float mapSizeX,
-                                        float mapSizeZ, const Vector3& normal)
+                                        float mapSizeZ, const Vector3& /*normal*/)
 {
-  const float x0 = mapData[0];
-  const float z0 = mapData[2];
-
-  // reset x and z in the map space so they are between 0 and the axis map size
-  x = x - std::floor((x - x0) / mapSizeX) * mapSizeX;
-  z = z - std::floor((z - z0) / mapSizeZ) * mapSizeZ;
-
-  const auto col1         = static_cast<unsigned>(std::floor((x - x0) * mapSubX / mapSizeX));
-  const auto row1         = static_cast<unsigned>(std::floor((z - z0) * mapSubZ / mapSizeZ));
-  const unsigned int col2 = (col1 + 1) % mapSubX;
-  const unsigned int row2 = (row1 + 1) % mapSubZ;
-  // starting indexes of the positions of 4 vertices defining a quad on the map
-  const unsigned int idx1 = 3 * (row1 * mapSubX + col1);
-  const unsigned int idx2 = 3 * (row1 * mapSubX + col2);
-  const unsigned int idx3 = 3 * ((row2)*mapSubX + col1);
-  const unsigned int idx4 = 3 * ((row2)*mapSubX + col2);
-
-  DynamicTerrain::_v1.copyFromFloats(mapData[idx1], mapData[idx1 + 1], mapData[idx1 + 2]);
-  DynamicTerrain::_v2.copyFromFloats(mapData[idx2], mapData[idx2 + 1], mapData[idx2 + 2]);
-  DynamicTerrain::_v3.copyFromFloats(mapData[idx3], mapData[idx3 + 1], mapData[idx3 + 2]);
-  DynamicTerrain::_v4.copyFromFloats(mapData[idx4], mapData[idx4 + 1], mapData[idx4 + 2]);
-
-  Vector3 vA = DynamicTerrain::_v1;
-  Vector3 vB;
-  Vector3 vC;
-  Vector3 v;
+  return sampleHeight(x, z, mapData, mapSubX, mapSubZ, mapSizeX, mapSizeZ);
+}
 
-  const float xv4v1 = DynamicTerrain::_v4.x - DynamicTerrain::_v1.x;
-  const float zv4v1 = DynamicTerrain::_v4.z - DynamicTerrain::_v1.z;
-  if (stl_util::almost_equal(xv4v1, 0.f) || stl_util::almost_equal(zv4v1, 0.f)) {
-    return DynamicTerrain::_v1.y;
-  }
-  const float cd = zv4v1 / xv4v1;
-  const float h  = DynamicTerrain::_v1.z - cd * DynamicTerrain::_v1.x;
-  if (z < cd * x + h) {
-    vB = DynamicTerrain::_v4;
-    vC = DynamicTerrain::_v2;
-    v  = vA;
-  }
-  else {
-    vB = DynamicTerrain::_v3;
-    vC = DynamicTerrain::_v4;
-    v  = vB;
-  }
-  vB.subtractToRef(vA, DynamicTerrain::_vAvB);
-  vC.subtractToRef(vA, DynamicTerrain::_vAvC);
-  Vector3::CrossToRef(DynamicTerrain::_vAvB, DynamicTerrain::_vAvC, DynamicTerrain::_norm);
-  DynamicTerrain::_norm.normalize();
-  if (normal != Vector3::Zero()) {
-    auto tmpVector = normal;
-    tmpVector.copyFrom(DynamicTerrain::_norm);
-  }
-  const float d = -(DynamicTerrain::_norm.x * v.x + DynamicTerrain::_norm.y * v.y
-                    + DynamicTerrain::_norm.z * v.z);
-  float y       = v.y;
-  if (!stl_util::almost_equal(DynamicTerrain::_norm.y, 0.f)) {
-    y = -(DynamicTerrain::_norm.x * x + DynamicTerrain::_norm.z * z + d) / DynamicTerrain::_norm.y;
-  }
+void DynamicTerrain::getHeightsFromMap(const float* xs, const float* zs, float* heights,
+                                       size_t count) const
+{
+  const auto chunkCount = parallelChunkCount(count);
+  runChunks(chunkCount, [&](size_t chunk) {
+    for (size_t p = count * chunk / chunkCount; p < count * (chunk + 1) / chunkCount; ++p) {
+      heights[p]
+        = sampleHeight(xs[p], zs[p], _mapData, _mapSubX, _mapSubZ, _mapSizeX, _mapSizeZ);
+    }
+  });
+}
 
-  return y;
+void DynamicTerrain::GetHeightsFromMap(const float* xs, const float* zs, float* heights,
+                                       size_t count, const Float32Array& mapData,
+                                       unsigned int mapSubX, unsigned int mapSubZ)
+{
+  const float mapSizeX  = std::abs(mapData[(mapSubX - 1) * 3] - mapData[0]);
+  const float mapSizeZ  = std::abs(mapData[(mapSubZ - 1) * mapSubX * 3 + 2] - mapData[2]);
+  const auto chunkCount = parallelChunkCount(count);
+  runChunks(chunkCount, [&](size_t chunk) {
+    for (size_t p = count * chunk / chunkCount; p < count * (chunk + 1) / chunkCount; ++p) {
+      heights[p] = sampleHeight(xs[p], zs[p], mapData, mapSubX, mapSubZ, mapSizeX, mapSizeZ);
+    }
+  });
 }
 
 void DynamicTerrain::ComputeNormalsFromMapToRef(const Float32Array& mapData, unsigned int mapSubX,
                                                 unsigned int mapSubZ, Float32Array& normals)
 {
-  Uint32Array mapIndices;
-  auto tmp1Normal = Vector3::Zero();
-  auto tmp2Normal = Vector3::Zero();
-  unsigned int l  = mapSubX * (mapSubZ - 1);
-  for (unsigned int i = 0; i < l; i++) {
-    stl_util::concat(mapIndices, {i + 1, i + mapSubX, i});
-    stl_util::concat(mapIndices, {i + mapSubX, i + 1, i + mapSubX + 1});
-  }
-  VertexData::ComputeNormals(mapData, mapIndices, normals);
-  // seam process
+  // Each map cell i is made of the facets (i + 1, i + mapSubX, i) and (i + mapSubX, i + 1,
+  // i + mapSubX + 1). The normal of a vertex sums the normals of the facets around it in the cell
+  // order, as VertexData::ComputeNormals() does with these facets, so the map rows are processed in
+  // parallel bands without any shared accumulation. The facets going past the last vertex of the
+  // map are skipped.
+  const unsigned int vertexCount = mapSubX * mapSubZ;
+  const unsigned int l           = mapSubX * (mapSubZ - 1);
+  normals.resize(mapData.size());
+  const auto computeVertices = [&](unsigned int first, unsigned int last) {
+    for (unsigned int v = first; v < last; ++v) {
+      float normal[3] = {0.f, 0.f, 0.f};
+      // cells containing the vertex, in ascending order
+      const long cells[4] = {static_cast<long>(v) - mapSubX - 1, static_cast<long>(v) - mapSubX,
+                             static_cast<long>(v) - 1, static_cast<long>(v)};
+      for (size_t c = 0; c < 4; ++c) {
+        if (cells[c] < 0 || cells[c] >= l || (c > 0 && cells[c] == cells[c - 1])) {
+          continue;
+        }
+        const auto i = static_cast<unsigned int>(cells[c]);
+        accumulateFacetNormal(mapData, v, i + 1, i + mapSubX, i, normal);
+        if (i + mapSubX + 1 < vertexCount) {
+          accumulateFacetNormal(mapData, v, i + mapSubX, i + 1, i + mapSubX + 1, normal);
+        }
+      }
+      // last normalization of each normal
+      float length
+        = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+      length             = stl_util::almost_equal(length, 0.f) ? 1.f : length;
+      normals[3 * v]     = normal[0] / length;
+      normals[3 * v + 1] = normal[1] / length;
+      normals[3 * v + 2] = normal[2] / length;
+    }
+  };
+  const auto chunkCount = std::min<size_t>(parallelChunkCount(vertexCount), mapSubZ);
+  runChunks(chunkCount, [&](size_t chunk) {
+    computeVertices(static_cast<unsigned>(mapSubZ * chunk / chunkCount) * mapSubX,
+                    static_cast<unsigned>(mapSubZ * (chunk + 1) / chunkCount) * mapSubX);
+  });
 
+  // seam process
+  auto tmp1Normal       = Vector3::Zero();
+  auto tmp2Normal       = Vector3::Zero();
   unsigned int lastIdx  = (mapSubX - 1) * 3;
   unsigned int colStart = 0;
   unsigned int colEnd   = 0;
@@ -579,6 +732,7 @@ void DynamicTerrain::ComputeNormalsFromMapToRef(const Float32Array& mapData, uns
 
 DynamicTerrain& DynamicTerrain::computeNormalsFromMap()
 {
+  _swapTerrainWindow();
   DynamicTerrain::ComputeNormalsFromMapToRef(_mapData, _mapSubX, _mapSubZ, _mapNormals);
   return *this;
 }
@@ -814,6 +968,7 @@ const Uint32Array& DynamicTerrain::LODLimits() const
 
 void DynamicTerrain::LODLimits(Uint32Array ar)
 {
+  _swapTerrainWindow();
   std::sort(ar.begin(), ar.end(), std::greater<std::uint32_t>());
   _LODLimits = std::move(ar);
 }
@@ -825,6 +980,7 @@ const Float32Array& DynamicTerrain::mapData() const
 
 void DynamicTerrain::setMapData(const Float32Array& val)
 {
+  _swapTerrainWindow();
   _mapData         = val;
   _datamap         = true;
   _mapSizeX        = std::abs(_mapData[(_mapSubX - 1) * 3] - _mapData[0]);
@@ -844,6 +1000,7 @@ unsigned int DynamicTerrain::mapSubX() const
 
 void DynamicTerrain::setMapSubX(unsigned int val)
 {
+  _swapTerrainWindow();
   _mapSubX = val;
 }
 
@@ -854,6 +1011,7 @@ unsigned int DynamicTerrain::mapSubZ() const
 
 void DynamicTerrain::setMapSubZ(unsigned int val)
 {
+  _swapTerrainWindow();
   _mapSubZ = val;
 }
 
@@ -864,6 +1022,7 @@ const Float32Array& DynamicTerrain::mapColors() const
 
 void DynamicTerrain::setMapColors(const Float32Array& val)
 {
+  _swapTerrainWindow();
   _colormap  = true;
   _mapColors = val;
 }
@@ -875,6 +1034,7 @@ const Float32Array& DynamicTerrain::mapUVs() const
 
 void DynamicTerrain::setMapUVs(const Float32Array& val)
 {
+  _swapTerrainWindow();
   _uvmap  = true;
   _mapUVs = val;
 }
@@ -886,6 +1046,7 @@ const Float32Array& DynamicTerrain::mapNormals() const
 
 void DynamicTerrain::setMapNormals(const Float32Array& val)
 {
+  _swapTerrainWindow();
   _mapNormals = val;
 }
 
@@ -896,6 +1057,7 @@ bool DynamicTerrain::computeNormals() const
 
 void DynamicTerrain::setComputeNormals(bool val)
 {
+  _swapTerrainWindow();
   _computeNormals = val;
 }
 
@@ -906,6 +1068,7 @@ bool DynamicTerrain::useCustomVertexFunction() const
 
 void DynamicTerrain::useCustomVertexFunction(bool val)
 {
+  _swapTerrainWindow();
   _useCustomVertexFunction = val;
 }
 
@@ -930,6 +1093,22 @@ void DynamicTerrain::setPrecomputeNormalsFromMap(bool val)
   _precomputeNormalsFromMap = val;
 }
 
+bool DynamicTerrain::asyncUpdate() const
+{
+  return _asyncUpdate;
+}
+
+void DynamicTerrain::setAsyncUpdate(bool val)
+{
+  _swapTerrainWindow();
+  _asyncUpdate = val;
+}
+
+bool DynamicTerrain::hasPendingUpdate() const
+{
+  return _nextWindow.valid();
+}
+
 void DynamicTerrain::updateVertex(DynamicTerrainVertex& /*vertex*/, unsigned int /*i*/,
                                   unsigned /*j*/)
 {
@@ -1,12 +1,46 @@
 #include <babylon/extensions/noisegeneration/perlin_noise.h>
 
 #include <algorithm>
+#include <future>
 #include <numeric>
 #include <random>
+#include <thread>
 
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+/**
+ * @brief Calls job(begin, end) on count items of pointCount points each, in parallel chunks from
+ * PerlinNoise::ParallelBatchThreshold points with the first chunk on the calling thread.
+ */
+template <typename Job>
+void forEachChunk(size_t count, size_t pointCount, const Job& job)
+{
+  const size_t concurrency = std::thread::hardware_concurrency();
+  const auto points        = count * pointCount;
+  if (points < PerlinNoise::ParallelBatchThreshold || concurrency < 2) {
+    job(size_t{0}, count);
+    return;
+  }
+  const auto chunkCount = std::min<size_t>(
+    {concurrency, count, points / (PerlinNoise::ParallelBatchThreshold / 4)});
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(chunkCount);
+  for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+    jobs.emplace_back(std::async(std::launch::async, [&job, count, chunk, chunkCount]() {
+      job(count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+    }));
+  }
+  job(size_t{0}, count / chunkCount);
+  for (auto& pending : jobs) {
+    pending.get();
+  }
+}
+
+} // end of anonymous namespace
+
 // Initialize with the reference values for the permutation vector
 PerlinNoise::PerlinNoise()
 {
@@ -103,6 +137,47 @@ double PerlinNoise::noise(double x, double y, double z) const
   return lerp(w, a, b);
 }
 
+void PerlinNoise::noise2D(const double* xs, const double* ys, double* out, size_t n) const
+{
+  forEachChunk(n, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      out[i] = _noise2D(xs[i], ys[i]);
+    }
+  });
+}
+
+double PerlinNoise::_noise2D(double x, double y) const
+{
+  // Find the unit square that contains the point
+  const int32_t X = static_cast<int32_t>(std::floor(x)) & 255;
+  const int32_t Y = static_cast<int32_t>(std::floor(y)) & 255;
+
+  // Find relative x, y of point in square
+  x -= std::floor(x);
+  y -= std::floor(y);
+
+  // Compute fade curves for each of x, y
+  const double u = fade(x);
+  const double v = fade(y);
+
+  // Hash coordinates of the 4 square corners, z being 0
+  const auto A  = p[static_cast<unsigned>(X)] + Y;
+  const auto AA = p[static_cast<unsigned>(A)];
+  const auto AB = p[static_cast<unsigned>(A + 1)];
+  const auto B  = p[static_cast<unsigned>(X + 1)] + Y;
+  const auto BA = p[static_cast<unsigned>(B)];
+  const auto BB = p[static_cast<unsigned>(B + 1)];
+
+  const auto PAA = p[static_cast<unsigned>(AA)];
+  const auto PBA = p[static_cast<unsigned>(BA)];
+  const auto PAB = p[static_cast<unsigned>(AB)];
+  const auto PBB = p[static_cast<unsigned>(BB)];
+
+  // The fade curve of z is 0, only the corners of the z = 0 face are blended
+  return lerp(v, lerp(u, grad(PAA, x, y, 0.0), grad(PBA, x - 1, y, 0.0)),
+              lerp(u, grad(PAB, x, y - 1, 0.0), grad(PBB, x - 1, y - 1, 0.0)));
+}
+
 PerlinNoiseOctave::PerlinNoiseOctave(int octaves, uint32_t seed)
     : _perlinNoise{seed}, _octaves{octaves}
 {
@@ -125,5 +200,29 @@ double PerlinNoiseOctave::noise(double x, double y, double z) const
   return result;
 }
 
+void PerlinNoiseOctave::noise2DGrid(double x, double y, double dx, double dy, size_t width,
+                                    size_t height, double* out) const
+{
+  forEachChunk(height, width, [&](size_t firstRow, size_t lastRow) {
+    for (size_t row = firstRow; row < lastRow; ++row) {
+      for (size_t col = 0; col < width; ++col) {
+        double px     = x + static_cast<double>(col) * dx;
+        double py     = y + static_cast<double>(row) * dy;
+        double result = 0.0;
+        double amp    = 1.0;
+
+        int i = _octaves;
+        while (i--) {
+          result += _perlinNoise._noise2D(px, py) * amp;
+          px *= 2.0;
+          py *= 2.0;
+          amp *= 0.5;
+        }
+        out[row * width + col] = result;
+      }
+    }
+  });
+}
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -1,6 +1,8 @@
 #include <babylon/extensions/noisegeneration/simplex_noise.h>
 
+#include <future>
 #include <random>
+#include <thread>
 
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
@@ -9,6 +11,39 @@
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+/**
+ * @brief Calls job(begin, end) on count items of pointCount points each. From
+ * SimplexNoise::ParallelBatchThreshold points, the items are split in chunks processed in parallel,
+ * the first chunk on the calling thread.
+ */
+template <typename Job>
+void forEachChunk(size_t count, size_t pointCount, const Job& job)
+{
+  const size_t concurrency = std::thread::hardware_concurrency();
+  const auto points        = count * pointCount;
+  if (points < SimplexNoise::ParallelBatchThreshold || concurrency < 2) {
+    job(size_t{0}, count);
+    return;
+  }
+  const auto chunkCount = std::min<size_t>(
+    {concurrency, count, points / (SimplexNoise::ParallelBatchThreshold / 4)});
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(chunkCount);
+  for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+    jobs.emplace_back(std::async(std::launch::async, [&job, count, chunk, chunkCount]() {
+      job(count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+    }));
+  }
+  job(size_t{0}, count / chunkCount);
+  for (auto& pending : jobs) {
+    pending.get();
+  }
+}
+
+} // end of anonymous namespace
+
 std::array<std::array<float, 2>, 8> SimplexNoise::grad2lut{{{{-1.0f, -1.0f}},
                                                             {{1.0f, 0.0f}},
                                                             {{-1.0f, 0.0f}},
@@ -158,72 +193,53 @@ float SimplexNoise::noise(float x)
 // 2D simplex noise
 float SimplexNoise::noise(const Vector2& v)
 {
-  float n0, n1, n2; // Noise contributions from the three corners
+  return _noise2D(v.x, v.y);
+}
 
+float SimplexNoise::_noise2D(float x, float y) const
+{
   // Skew the input space to determine which simplex cell we're in
-  float s  = (v.x + v.y) * F2; // Hairy factor for 2D
-  float xs = v.x + s;
-  float ys = v.y + s;
-  int i    = fastfloor(xs);
-  int j    = fastfloor(ys);
+  const float s = (x + y) * F2; // Hairy factor for 2D
+  const int i   = fastfloor(x + s);
+  const int j   = fastfloor(y + s);
 
-  float t  = static_cast<float>(i + j) * G2;
-  float X0 = i - t; // Unskew the cell origin back to (x,y) space
-  float Y0 = j - t;
-  float x0 = v.x - X0; // The x,y distances from the cell origin
-  float y0 = v.y - Y0;
+  const float t  = static_cast<float>(i + j) * G2;
+  const float X0 = i - t; // Unskew the cell origin back to (x,y) space
+  const float Y0 = j - t;
+  const float x0 = x - X0; // The x,y distances from the cell origin
+  const float y0 = y - Y0;
 
   // For the 2D case, the simplex shape is an equilateral triangle.
-  // Determine which simplex we are in.
-  unsigned int i1,
-    j1; // Offsets for second (middle) corner of simplex in (i,j) coords
-  if (x0 > y0) {
-    i1 = 1;
-    j1 = 0;
-  } // lower triangle, XY order: (0,0)->(1,0)->(1,1)
-  else {
-    i1 = 0;
-    j1 = 1;
-  } // upper triangle, YX order: (0,0)->(0,1)->(1,1)
+  // Determine which simplex we are in: the lower triangle, XY order: (0,0)->(1,0)->(1,1), or the
+  // upper triangle, YX order: (0,0)->(0,1)->(1,1)
+  const unsigned int i1 = (x0 > y0) ? 1 : 0; // Offsets for second (middle) corner of simplex
+  const unsigned int j1 = 1 - i1;            // in (i,j) coords
 
   // A step of (1,0) in (i,j) means a step of (1-c,-c) in (x,y), and
   // a step of (0,1) in (i,j) means a step of (-c,1-c) in (x,y), where
   // c = (3-sqrt(3))/6
 
-  float x1 = x0 - i1 + G2; // Offsets for middle corner in (x,y) unskewed coords
-  float y1 = y0 - j1 + G2;
-  float x2 = x0 - 1.0f + 2.0f * G2; // Offsets for last corner in (x,y) unskewed coords
-  float y2 = y0 - 1.0f + 2.0f * G2;
+  const float x1 = x0 - i1 + G2; // Offsets for middle corner in (x,y) unskewed coords
+  const float y1 = y0 - j1 + G2;
+  const float x2 = x0 - 1.0f + 2.0f * G2; // Offsets for last corner in (x,y) unskewed coords
+  const float y2 = y0 - 1.0f + 2.0f * G2;
 
   // Wrap the integer indices at 256, to avoid indexing perm[] out of
   // bounds
-  unsigned int ii = i & 0xff;
-  unsigned int jj = j & 0xff;
+  const unsigned int ii = i & 0xff;
+  const unsigned int jj = j & 0xff;
 
-  // Calculate the contribution from the three corners
+  // Calculate the contribution from the three corners, zero outside of their radius
   float t0 = 0.5f - x0 * x0 - y0 * y0;
-  if (t0 < 0.0f)
-    n0 = 0.0f;
-  else {
-    t0 *= t0;
-    n0 = t0 * t0 * grad(perm[ii + perm[jj]], x0, y0);
-  }
-
+  t0       = (t0 < 0.0f) ? 0.0f : t0 * t0;
   float t1 = 0.5f - x1 * x1 - y1 * y1;
-  if (t1 < 0.0f)
-    n1 = 0.0f;
-  else {
-    t1 *= t1;
-    n1 = t1 * t1 * grad(perm[ii + i1 + perm[jj + j1]], x1, y1);
-  }
-
+  t1       = (t1 < 0.0f) ? 0.0f : t1 * t1;
   float t2 = 0.5f - x2 * x2 - y2 * y2;
-  if (t2 < 0.0f)
-    n2 = 0.0f;
-  else {
-    t2 *= t2;
-    n2 = t2 * t2 * grad(perm[ii + 1 + perm[jj + 1]], x2, y2);
-  }
+  t2       = (t2 < 0.0f) ? 0.0f : t2 * t2;
+
+  const float n0 = t0 * t0 * grad(perm[ii + perm[jj]], x0, y0);
+  const float n1 = t1 * t1 * grad(perm[ii + i1 + perm[jj + j1]], x1, y1);
+  const float n2 = t2 * t2 * grad(perm[ii + 1 + perm[jj + 1]], x2, y2);
 
   // Add contributions from each corner to get the final noise value.
   // The result is scaled to return values in the interval [-1,1].
@@ -1842,6 +1858,40 @@ float SimplexNoise::fBm(const Vector4& v, uint8_t octaves, float lacunarity, flo
 
 // -----------------------------------------------------------------------------
 
+void SimplexNoise::noise2D(const float* xs, const float* ys, float* out, size_t n) const
+{
+  forEachChunk(n, 1, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; ++p) {
+      out[p] = _noise2D(xs[p], ys[p]);
+    }
+  });
+}
+
+void SimplexNoise::fBm2DGrid(float x, float y, float dx, float dy, size_t width, size_t height,
+                             float* out, uint8_t octaves, float lacunarity, float gain) const
+{
+  // Same operations as fBm_t() for each point, the octave loop being the outer one
+  forEachChunk(height, width, [&](size_t firstRow, size_t lastRow) {
+    for (size_t row = firstRow; row < lastRow; ++row) {
+      const float py = y + static_cast<float>(row) * dy;
+      float* sum     = out + row * width;
+      std::fill(sum, sum + width, 0.0f);
+      float freq = 1.0f;
+      float amp  = 0.5f;
+      for (uint8_t i = 0; i < octaves; i++) {
+        for (size_t col = 0; col < width; ++col) {
+          const float px = x + static_cast<float>(col) * dx;
+          sum[col] += _noise2D(px * freq, py * freq) * amp;
+        }
+        freq *= lacunarity;
+        amp *= gain;
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+
 Vector2 SimplexNoise::dfBm(float x, uint8_t octaves, float lacunarity, float gain)
 {
   Vector2 sum = Vector2(0.0f);
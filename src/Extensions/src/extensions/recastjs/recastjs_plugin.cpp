@@ -86,7 +86,7 @@ void RecastJSPlugin::createNavMesh(const std::vector<MeshPtr>& meshes,
       const auto worldMatrix = mesh->computeWorldMatrix(true);
 
       if (mesh->hasThinInstances()) {
-        auto thinMatrices = mesh->thinInstanceGetWorldMatrices();
+        auto& thinMatrices = mesh->thinInstanceGetWorldMatrices();
         for (auto& thinMatrix : thinMatrices) {
           Matrix tmpMatrix;
           thinMatrix.multiplyToRef(worldMatrix, tmpMatrix);
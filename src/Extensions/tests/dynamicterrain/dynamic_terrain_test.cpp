@@ -0,0 +1,186 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+/**
+ * @brief Returns a map of subX x subZ points, one unit apart, with some hills.
+ */
+BABYLON::Float32Array createMapData(unsigned int subX, unsigned int subZ)
+{
+  BABYLON::Float32Array mapData(subX * subZ * 3);
+  for (unsigned int row = 0; row < subZ; ++row) {
+    for (unsigned int col = 0; col < subX; ++col) {
+      const auto index   = 3 * (row * subX + col);
+      const auto x       = static_cast<float>(col) - subX * 0.5f;
+      const auto z       = static_cast<float>(row) - subZ * 0.5f;
+      mapData[index]     = x;
+      mapData[index + 1] = 5.f * std::sin(x * 0.1f) * std::cos(z * 0.13f);
+      mapData[index + 2] = z;
+    }
+  }
+  return mapData;
+}
+
+std::unique_ptr<BABYLON::Engine> createEngine()
+{
+  BABYLON::NullEngineOptions options;
+  options.renderHeight = 256;
+  options.renderWidth  = 256;
+  options.textureSize  = 256;
+  return BABYLON::NullEngine::New(options);
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicTerrain, ComputeNormalsFromMapToRefInBands)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  const unsigned int subX = 160;
+  const unsigned int subZ = 150;
+  ASSERT_GE(subX * subZ, DynamicTerrain::ParallelUpdateThreshold);
+  const auto mapData = createMapData(subX, subZ);
+  Float32Array normals;
+  DynamicTerrain::ComputeNormalsFromMapToRef(mapData, subX, subZ, normals);
+
+  // Same facets as the map cells, the last one going past the end of the map excepted
+  Uint32Array indices;
+  for (unsigned int i = 0; i < subX * (subZ - 1); ++i) {
+    indices.insert(indices.end(), {i + 1, i + subX, i});
+    if (i + subX + 1 < subX * subZ) {
+      indices.insert(indices.end(), {i + subX, i + 1, i + subX + 1});
+    }
+  }
+  Float32Array expected;
+  VertexData::ComputeNormals(mapData, indices, expected);
+  ASSERT_EQ(normals.size(), expected.size());
+  for (unsigned int row = 0; row < subZ; ++row) {
+    // the first and last columns are set by the seam process
+    for (unsigned int col = 1; col + 1 < subX; ++col) {
+      const auto index = 3 * (row * subX + col);
+      EXPECT_FLOAT_EQ(normals[index], expected[index]);
+      EXPECT_FLOAT_EQ(normals[index + 1], expected[index + 1]);
+      EXPECT_FLOAT_EQ(normals[index + 2], expected[index + 2]);
+    }
+  }
+}
+
+TEST(TestDynamicTerrain, GetHeightsFromMap)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  const unsigned int subX = 120;
+  const unsigned int subZ = 100;
+  const auto mapData      = createMapData(subX, subZ);
+  const size_t count      = 2 * DynamicTerrain::ParallelUpdateThreshold;
+  std::vector<float> xs(count);
+  std::vector<float> zs(count);
+  for (size_t p = 0; p < count; ++p) {
+    xs[p] = 250.f * std::sin(p * 0.37f);
+    zs[p] = 250.f * std::cos(p * 0.11f);
+  }
+  std::vector<float> heights(count);
+  DynamicTerrain::GetHeightsFromMap(xs.data(), zs.data(), heights.data(), count, mapData, subX,
+                                    subZ);
+  for (size_t p = 0; p < count; ++p) {
+    EXPECT_EQ(heights[p], DynamicTerrain::GetHeightFromMap(xs[p], zs[p], mapData, subX, subZ));
+  }
+}
+
+TEST(TestDynamicTerrain, updateInRowBands)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  auto engine = createEngine();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(3.f, 20.f, -7.f), scene.get());
+  DynamicTerrainOptions options;
+  options.terrainSub = 150;
+  options.mapSubX    = 300;
+  options.mapSubZ    = 300;
+  options.mapData    = createMapData(300, 300);
+  options.camera     = camera;
+  ASSERT_GE(static_cast<size_t>((options.terrainSub + 1) * (options.terrainSub + 1)),
+            DynamicTerrain::ParallelUpdateThreshold);
+
+  // The custom vertex function keeps the update on a single band
+  DynamicTerrain banded("banded", options, scene.get());
+  DynamicTerrain serial("serial", options, scene.get());
+  serial.useCustomVertexFunction(true);
+  for (auto* terrain : {&banded, &serial}) {
+    terrain->LODLimits({4, 10});
+    terrain->update(true);
+  }
+
+  const auto positions       = banded.mesh()->getVerticesData(VertexBuffer::PositionKind);
+  const auto normals         = banded.mesh()->getVerticesData(VertexBuffer::NormalKind);
+  const auto serialPositions = serial.mesh()->getVerticesData(VertexBuffer::PositionKind);
+  const auto serialNormals   = serial.mesh()->getVerticesData(VertexBuffer::NormalKind);
+  ASSERT_EQ(positions.size(), serialPositions.size());
+  for (size_t index = 0; index < positions.size(); ++index) {
+    EXPECT_EQ(positions[index], serialPositions[index]);
+    EXPECT_EQ(normals[index], serialNormals[index]);
+  }
+  const auto& boundingBox       = banded.mesh()->_boundingInfo->boundingBox;
+  const auto& serialBoundingBox = serial.mesh()->_boundingInfo->boundingBox;
+  EXPECT_TRUE(boundingBox.minimum.equals(serialBoundingBox.minimum));
+  EXPECT_TRUE(boundingBox.maximum.equals(serialBoundingBox.maximum));
+}
+
+TEST(TestDynamicTerrain, asyncUpdate)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  auto engine = createEngine();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 20.f, 0.f), scene.get());
+  camera->getViewMatrix(true);
+  DynamicTerrainOptions options;
+  options.terrainSub = 60;
+  options.mapSubX    = 200;
+  options.mapSubZ    = 200;
+  options.mapData    = createMapData(200, 200);
+  options.camera     = camera;
+  DynamicTerrain background("background", options, scene.get());
+  DynamicTerrain foreground("foreground", options, scene.get());
+  background.setAsyncUpdate(true);
+
+  // The terrain keeps its shape and position until the next window is swapped in
+  const auto position  = background.mesh()->position();
+  const auto positions = background.mesh()->getVerticesData(VertexBuffer::PositionKind);
+  camera->position     = Vector3(12.f, 20.f, 7.f);
+  camera->getViewMatrix(true);
+  background.update(false);
+  ASSERT_TRUE(background.hasPendingUpdate());
+  EXPECT_TRUE(background.mesh()->position().equals(position));
+  EXPECT_EQ(background.mesh()->getVerticesData(VertexBuffer::PositionKind), positions);
+  while (background.hasPendingUpdate()) {
+    background.update(false);
+  }
+
+  foreground.update(false);
+  EXPECT_TRUE(background.mesh()->position().equals(foreground.mesh()->position()));
+  EXPECT_FALSE(background.mesh()->position().equals(position));
+  EXPECT_EQ(background.mesh()->getVerticesData(VertexBuffer::PositionKind),
+            foreground.mesh()->getVerticesData(VertexBuffer::PositionKind));
+  EXPECT_EQ(background.mesh()->getVerticesData(VertexBuffer::NormalKind),
+            foreground.mesh()->getVerticesData(VertexBuffer::NormalKind));
+  EXPECT_TRUE(background.centerWorld().equals(foreground.centerWorld()));
+}
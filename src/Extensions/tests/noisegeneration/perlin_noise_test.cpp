@@ -0,0 +1,49 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+
+TEST(TestPerlinNoise, noise2D)
+{
+  using namespace BABYLON::Extensions;
+
+  PerlinNoise perlinNoise(7);
+  const size_t count = 2 * PerlinNoise::ParallelBatchThreshold + 5;
+  std::vector<double> xs(count);
+  std::vector<double> ys(count);
+  for (size_t i = 0; i < count; ++i) {
+    xs[i] = 500.0 * std::cos(i * 0.007) + 0.25;
+    ys[i] = 0.03 * i - 400.0;
+  }
+  std::vector<double> noises(count);
+  perlinNoise.noise2D(xs.data(), ys.data(), noises.data(), count);
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(noises[i], perlinNoise.noise(xs[i], ys[i]));
+  }
+}
+
+TEST(TestPerlinNoise, noise2DGrid)
+{
+  using namespace BABYLON::Extensions;
+
+  PerlinNoiseOctave perlinNoiseOctave(6, 11);
+  // Large enough to be split in bands of rows
+  const size_t width  = 160;
+  const size_t height = 150;
+  const double x      = -3.1;
+  const double y      = 17.9;
+  const double dx     = 0.021;
+  const double dy     = 0.034;
+  std::vector<double> noises(width * height);
+  perlinNoiseOctave.noise2DGrid(x, y, dx, dy, width, height, noises.data());
+  for (size_t row = 0; row < height; ++row) {
+    for (size_t col = 0; col < width; ++col) {
+      EXPECT_EQ(noises[row * width + col],
+                perlinNoiseOctave.noise(x + static_cast<double>(col) * dx,
+                                        y + static_cast<double>(row) * dy));
+    }
+  }
+}
@@ -0,0 +1,52 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+
+TEST(TestSimplexNoise, noise2D)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  SimplexNoise simplexNoise;
+  const size_t count = 2 * SimplexNoise::ParallelBatchThreshold + 3;
+  std::vector<float> xs(count);
+  std::vector<float> ys(count);
+  for (size_t i = 0; i < count; ++i) {
+    xs[i] = 300.f * std::sin(i * 0.013f) - 0.5f;
+    ys[i] = 0.01f * i - 100.f;
+  }
+  std::vector<float> noises(count);
+  simplexNoise.noise2D(xs.data(), ys.data(), noises.data(), count);
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(noises[i], simplexNoise.noise(Vector2(xs[i], ys[i])));
+  }
+}
+
+TEST(TestSimplexNoise, fBm2DGrid)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  SimplexNoise simplexNoise;
+  simplexNoise.seed(42);
+  // Large enough to be split in bands of rows
+  const size_t width  = 200;
+  const size_t height = 170;
+  const float x       = -12.5f;
+  const float y       = 3.25f;
+  const float dx      = 0.05f;
+  const float dy      = 0.07f;
+  std::vector<float> fBms(width * height);
+  simplexNoise.fBm2DGrid(x, y, dx, dy, width, height, fBms.data(), 5, 2.1f, 0.45f);
+  for (size_t row = 0; row < height; ++row) {
+    for (size_t col = 0; col < width; ++col) {
+      const Vector2 point(x + static_cast<float>(col) * dx, y + static_cast<float>(row) * dy);
+      EXPECT_EQ(fBms[row * width + col], simplexNoise.fBm(point, 5, 2.1f, 0.45f));
+    }
+  }
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Compares two runs of the SamplesBenchmarks scenes benchmark.
+
+Each argument is either a JSON result file or a SamplesBenchmarks executable, which is then run to
+produce the results. Exits with 1 when a sample mean frame time, allocation count or draw call
+count regressed by more than the threshold.
+
+    compare_benchmarks.py build-main/bin/SamplesBenchmarks build-branch/bin/SamplesBenchmarks
+    compare_benchmarks.py baseline.json candidate.json --threshold 10
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# (label, path in a sample result), lower is better
+METRICS = [
+    ("frame ms", ("frameMs", "mean")),
+    ("p95 ms", ("frameMs", "p95")),
+    ("allocs/frame", ("perFrame", "allocations")),
+    ("draw calls", ("perFrame", "drawCalls")),
+    ("state changes", ("perFrame", "stateChanges")),
+]
+# Metrics gating the exit code, the others are informative
+GATED_METRICS = ["frame ms", "allocs/frame", "draw calls"]
+
+
+def load_results(path, frames, sample_filter):
+    if path.endswith(".json"):
+        with open(path) as f:
+            return json.load(f)
+    env = dict(os.environ)
+    env["BABYLON_BENCHMARK_FRAMES"] = str(frames)
+    if sample_filter:
+        env["BABYLON_BENCHMARK_FILTER"] = sample_filter
+    with tempfile.TemporaryDirectory() as directory:
+        output = os.path.join(directory, "scenes_benchmark.json")
+        env["BABYLON_BENCHMARK_OUTPUT"] = output
+        subprocess.run([os.path.abspath(path), "--gtest_filter=BenchmarkScenes.*"], env=env,
+                       check=True, stdout=subprocess.DEVNULL)
+        with open(output) as f:
+            return json.load(f)
+
+
+def metric_value(sample, path):
+    value = sample
+    for key in path:
+        value = value.get(key, {}) if isinstance(value, dict) else {}
+    return value if isinstance(value, (int, float)) else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares two scenes benchmark runs")
+    parser.add_argument("baseline", help="baseline results (.json) or SamplesBenchmarks executable")
+    parser.add_argument("candidate", help="candidate results (.json) or SamplesBenchmarks executable")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="regression threshold in percent (default 5)")
+    parser.add_argument("--frames", type=int, default=200,
+                        help="frames per sample when running an executable (default 200)")
+    parser.add_argument("--filter", default="", help="only run the samples containing this text")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline, args.frames, args.filter)
+    candidate = load_results(args.candidate, args.frames, args.filter)
+    baseline_samples = {sample["name"]: sample for sample in baseline["samples"]}
+
+    regressions = []
+    print("%-24s %-14s %12s %12s %9s" % ("sample", "metric", "baseline", "candidate", "change"))
+    for sample in candidate["samples"]:
+        name = sample["name"]
+        reference = baseline_samples.get(name)
+        if reference is None or sample["status"] != "ok" or reference["status"] != "ok":
+            print("%-24s %s" % (name, "skipped, " + sample.get("error", "not in both runs")))
+            continue
+        for label, path in METRICS:
+            before = metric_value(reference, path)
+            after = metric_value(sample, path)
+            if before is None or after is None:
+                continue
+            change = (after - before) * 100.0 / before if before else 0.0
+            flag = ""
+            if label in GATED_METRICS and change > args.threshold:
+                flag = "  REGRESSION"
+                regressions.append((name, label, change))
+            print("%-24s %-14s %12.3f %12.3f %8.1f%%%s" % (name, label, before, after, change,
+                                                         flag))
+
+    if regressions:
+        print("\n%d regression(s) above %.1f%%" % (len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,317 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/core/profiling/memory_tracker.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/frame_profiler.h>
+#include <babylon/interfaces/icanvas.h>
+#include <babylon/interfaces/irenderable_scene.h>
+#include <babylon/samples/samples_auto_declarations.h>
+
+#ifdef BABYLON_TRACK_ALLOCATIONS
+
+// The allocations are counted by the global operator new of BabylonCpp
+BABYLON::AllocationCounts processAllocations()
+{
+  return BABYLON::MemoryTracker::Allocations();
+}
+
+#else
+
+namespace {
+
+// Allocations made by the benchmark process, counted by the global operator new below
+std::atomic<size_t> allocationCount{0};
+std::atomic<size_t> allocatedBytes{0};
+
+} // end of anonymous namespace
+
+BABYLON::AllocationCounts processAllocations()
+{
+  return {allocationCount.load(), allocatedBytes.load()};
+}
+
+void* operator new(size_t size)
+{
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+#endif // BABYLON_TRACK_ALLOCATIONS
+
+using ns = uint64_t;
+using json = nlohmann::json;
+
+/**
+ * @brief Canvas without rendering context, the samples only register their input listeners.
+ */
+class HeadlessCanvas : public BABYLON::ICanvas {
+
+public:
+  HeadlessCanvas(int iWidth, int iHeight)
+  {
+    width = clientWidth = _boundingClientRect.width = _boundingClientRect.right = iWidth;
+    height = clientHeight = _boundingClientRect.height = _boundingClientRect.bottom = iHeight;
+  }
+
+  BABYLON::ClientRect& getBoundingClientRect() override
+  {
+    return _boundingClientRect;
+  }
+
+  bool initializeContext3d() override
+  {
+    return true;
+  }
+
+  BABYLON::ICanvasRenderingContext2D* getContext2d() override
+  {
+    return nullptr;
+  }
+
+  BABYLON::GL::IGLRenderingContext*
+  getContext3d(const BABYLON::EngineOptions& /*options*/) override
+  {
+    return nullptr;
+  }
+
+}; // end of class HeadlessCanvas
+
+/**
+ * @brief Renders a curated set of the samples on a NullEngine and writes per-frame timings,
+ * profiler phases, allocations, draw calls and state changes as JSON.
+ *
+ * Environment variables:
+ * - BABYLON_BENCHMARK_FRAMES: number of measured frames per sample (default 100)
+ * - BABYLON_BENCHMARK_FILTER: only run the samples whose name contains this text
+ * - BABYLON_BENCHMARK_OUTPUT: the JSON file to write (default scenes_benchmark.json)
+ *
+ * Two result files, or two builds, are compared with benchmarks/compare_benchmarks.py.
+ */
+class ScenesBenchmark {
+
+public:
+  static void Run()
+  {
+    using namespace BABYLON;
+    const auto frameCount = EnvironmentValue("BABYLON_BENCHMARK_FRAMES", 100);
+    const char* filter    = std::getenv("BABYLON_BENCHMARK_FILTER");
+    const char* output    = std::getenv("BABYLON_BENCHMARK_OUTPUT");
+
+    std::map<std::string, std::pair<std::string, SampleFactory>> factories;
+    auto registerFunction = [&factories](const std::string& categoryName,
+                                         const std::string& sampleName, SampleFactory factory) {
+      factories[sampleName] = {categoryName, factory};
+    };
+    Samples::auto_populate_samples(registerFunction);
+
+    FrameProfiler::ThreadBufferCapacity = 1 << 18;
+    json samples = json::array();
+    for (const auto& sampleName : sample_names) {
+      if (filter && sampleName.find(filter) == std::string::npos) {
+        continue;
+      }
+      const auto& [categoryName, factory] = factories.at(sampleName);
+      auto result                         = RunSample(factory, frameCount);
+      result["name"]                      = sampleName;
+      result["category"]                  = categoryName;
+      Report(result);
+      samples.emplace_back(std::move(result));
+    }
+
+    const json results = {{"frames", frameCount}, {"samples", samples}};
+    std::ofstream file{output ? output : "scenes_benchmark.json"};
+    file << results.dump(2) << std::endl;
+    EXPECT_TRUE(file.good());
+  } // Run
+
+private:
+  using SampleFactory = std::shared_ptr<BABYLON::IRenderableScene> (*)(BABYLON::ICanvas*);
+
+  // Meshes, instances, particles, animations, shadows and loaders
+  static inline const std::vector<std::string> sample_names = {
+    "CubesScene",         "MergedMeshesScene",  "TubeScene",        "ManyBoxInstancesScene",
+    "LevelOfDetailScene", "CubeChaosScene",     "BuildingsSpsScene", "LightedSpsScene",
+    "PumpJackScene",      "Animations101Scene", "MorphTargetsScene", "ShadowsScene",
+    "BoxShadowScene",     "ImportDudeScene",    "ImportMeshesSkullScene",
+  };
+  static constexpr size_t warmup_frame_count = 10;
+
+  static size_t EnvironmentValue(const char* name, size_t defaultValue)
+  {
+    const char* value = std::getenv(name);
+    return value ? static_cast<size_t>(std::max(std::strtol(value, nullptr, 10), 1l)) :
+                   defaultValue;
+  }
+
+  static json RunSample(SampleFactory factory, size_t frameCount)
+  {
+    using namespace BABYLON;
+    json result;
+    try {
+      HeadlessCanvas canvas{512, 256};
+      NullEngineOptions options;
+      options.renderWidth  = canvas.width;
+      options.renderHeight = canvas.height;
+      options.textureSize  = 512;
+
+      auto sample = factory(&canvas);
+      result["initializeMs"]
+        = ToMilliseconds(Measure([&]() { sample->initialize(&canvas, NullEngine::New(options)); }));
+      auto engine = sample->getEngine();
+      auto scene  = sample->getScene();
+      // Also creates the profiler buffer of the thread, not counted as a scene allocation
+      FrameProfiler::SetEnabled(true);
+      for (size_t frame = 0; frame < warmup_frame_count; ++frame) {
+        sample->render();
+      }
+
+      std::vector<ns> frameTimes;
+      frameTimes.reserve(frameCount);
+      const auto drawCalls = engine->_drawCalls.current();
+      engine->resetStateCounters();
+      const auto allocations = processAllocations();
+      FrameProfiler::Clear();
+      for (size_t frame = 0; frame < frameCount; ++frame) {
+        frameTimes.emplace_back(Measure([&]() { sample->render(); }));
+      }
+      FrameProfiler::SetEnabled(false);
+
+      const auto perFrame = [frameCount](size_t value) {
+        return static_cast<double>(value) / static_cast<double>(frameCount);
+      };
+      const auto& stateCounters = engine->getStateCounters();
+      result["perFrame"]        = {
+        {"allocations", perFrame(processAllocations().allocations - allocations.allocations)},
+        {"allocatedBytes", perFrame(processAllocations().bytes - allocations.bytes)},
+        {"drawCalls", perFrame(engine->_drawCalls.current() - drawCalls)},
+        {"stateChanges", perFrame(stateCounters.stateChanges())},
+        {"stateChangesAvoided", perFrame(stateCounters.stateChangesAvoided())},
+        {"activeMeshes", scene->getActiveMeshes().size()},
+        {"activeIndices", scene->getActiveIndices()},
+      };
+      result["frameMs"]  = Statistics(frameTimes);
+      result["phasesMs"] = Phases(frameCount);
+      result["status"]   = "ok";
+    }
+    catch (const std::exception& e) {
+      FrameProfiler::SetEnabled(false);
+      result["status"] = "error";
+      result["error"]  = e.what();
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the mean, median, 95th percentile and max of the frame times.
+   */
+  static json Statistics(std::vector<ns> frameTimes)
+  {
+    std::sort(frameTimes.begin(), frameTimes.end());
+    ns total = 0;
+    for (const auto frameTime : frameTimes) {
+      total += frameTime;
+    }
+    const auto percentile = [&frameTimes](double ratio) {
+      const auto index = static_cast<size_t>(ratio * static_cast<double>(frameTimes.size() - 1));
+      return ToMilliseconds(frameTimes[index]);
+    };
+    return {
+      {"mean", ToMilliseconds(total) / static_cast<double>(frameTimes.size())},
+      {"median", percentile(0.5)},
+      {"p95", percentile(0.95)},
+      {"max", ToMilliseconds(frameTimes.back())},
+    };
+  }
+
+  /**
+   * @brief Returns the average time per frame spent in each profiler zone, read from the Chrome
+   * trace of the measured frames. Nested zones are included in their parent's time.
+   */
+  static json Phases(size_t frameCount)
+  {
+    std::ostringstream stream;
+    BABYLON::FrameProfiler::WriteChromeTrace(stream);
+    const auto trace = json::parse(stream.str());
+
+    std::map<size_t, std::vector<std::pair<std::string, double>>> openZones;
+    std::map<std::string, double> totals;
+    for (const auto& event : trace["traceEvents"]) {
+      auto& stack = openZones[event["tid"].get<size_t>()];
+      if (event["ph"] == "B") {
+        stack.emplace_back(event["name"].get<std::string>(), event["ts"].get<double>());
+      }
+      else if (event["ph"] == "E" && !stack.empty()) {
+        totals[stack.back().first] += event["ts"].get<double>() - stack.back().second;
+        stack.pop_back();
+      }
+    }
+
+    json phases = json::object();
+    for (const auto& [name, microseconds] : totals) {
+      phases[name] = microseconds / 1000.0 / static_cast<double>(frameCount);
+    }
+    return phases;
+  }
+
+  template <typename Function>
+  static ns Measure(Function&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    function();
+    const auto after = std::chrono::high_resolution_clock::now();
+    return static_cast<ns>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+  }
+
+  static double ToMilliseconds(ns duration)
+  {
+    return static_cast<double>(duration) / 1000000.0;
+  }
+
+  static void Report(const json& result)
+  {
+    std::cout << result["name"].get<std::string>() << ": ";
+    if (result["status"] != "ok") {
+      std::cout << "error, " << result["error"].get<std::string>() << std::endl;
+      return;
+    }
+    std::cout << result["frameMs"]["mean"].get<double>() << " ms/frame, "
+              << result["perFrame"]["drawCalls"].get<double>() << " draw calls, "
+              << result["perFrame"]["allocations"].get<double>() << " allocations per frame"
+              << std::endl;
+  }
+
+}; // end of class ScenesBenchmark
+
+TEST(BenchmarkScenes, nullEngine)
+{
+  ScenesBenchmark::Run();
+}